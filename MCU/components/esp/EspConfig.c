@@ -104,13 +104,13 @@ BufferString *getEspHeapInfo() {
 	size_t aMinFreeHeapSize =  heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT | MALLOC_CAP_SPIRAM);
 	size_t aMinFreeInternalHeapSize =  heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL);
 
-    return stringFormat(&espInfoStr, "Heap Total: [%ld] | "
-                                     "SPI Free: [%ld] | "
-                                     "SPI Large Block: [%ld] | "
-                                     "SPI Min Free: [%ld] | "
-                                     "Int Free: [%ld] | "
-                                     "Int Large Block: [%ld] | "
-                                     "Int Min Free: [%ld]", 
+    return STRING_FORMAT_TO(&espInfoStr, "Heap Total: [%ld] | "
+                                         "SPI Free: [%ld] | "
+                                         "SPI Large Block: [%ld] | "
+                                         "SPI Min Free: [%ld] | "
+                                         "Int Free: [%ld] | "
+                                         "Int Large Block: [%ld] | "
+                                         "Int Min Free: [%ld]", 
                                     (long) aFreeHeapSize, 
                                     (long) aFreeSPIHeapSize, 
                                     (long) aHeapLargestFreeBlockSize, 
@@ -178,7 +178,7 @@ uint32_t getSDCardPartitionAllocationSize() {// Get volume information and free
 
 void getSDCardManufacturer(BufferString *str) {
     const char *cardManufacturer = getSDCardManufacturerById(sdCardCid.mfg_id);
-    stringFormat(str, "%s (ID: %d)", cardManufacturer, sdCardCid.mfg_id);
+    STRING_FORMAT_TO(str, "%s (ID: %d)", cardManufacturer, sdCardCid.mfg_id);
 }
 
 void getSDCardName(BufferString *str) {
@@ -1,11 +1,20 @@
 #include "ServerUtils.h"
+#include "BufferFlatMap.h"
+
+#define CONTENT_TYPE_MAP_CAPACITY 16
+
+CREATE_FLAT_MAP_TYPE(char*, char*, str, str, strComparator)
 
 static const char *TAG = "SERVER";
 
 static char scratchBuffer[SERVER_FILE_SCRATCH_BUFFER_SIZE];
 CspTemplate *notFoundPage;
 
+static str_strFlatMap contentTypeMap;
+static str_strFlatMapEntry contentTypeEntries[CONTENT_TYPE_MAP_CAPACITY];
+
 static esp_err_t setContentTypeByFileExtension(httpd_req_t *request, const char *fileName);
+static str_strFlatMap *getContentTypeMap();
 
 
 esp_err_t sendFile(httpd_req_t *request, const char *fileName) {
@@ -123,33 +132,27 @@ char *getScratchBufferPointer() {
 }
 
 static esp_err_t setContentTypeByFileExtension(httpd_req_t *request, const char *fileName) {
-    BufferString *fileStr = NEW_STRING(PATH_MAX_LEN, fileName);
-    if (isStrEndsWith(fileStr, ".pdf")) {
-        return httpd_resp_set_type(request, "application/pdf");
-
-    } else if (isStrEndsWith(fileStr, ".html")) {
-        return httpd_resp_set_type(request, "text/html");
-
-    } else if (isStrEndsWith(fileStr, ".jpeg") || isStrEndsWith(fileStr, ".jpg")) {
-        return httpd_resp_set_type(request, "image/jpeg");
-
-    } else if (isStrEndsWith(fileStr, ".ico")) {
-        return httpd_resp_set_type(request, "image/x-icon");
-
-    } else if (isStrEndsWith(fileStr, ".js")) {
-        return httpd_resp_set_type(request, "text/javascript");
-
-    } else if (isStrEndsWith(fileStr, ".css")) {
-        return httpd_resp_set_type(request, "text/css");
-
-    } else if (isStrEndsWith(fileStr, ".woff")) {
-        return httpd_resp_set_type(request, "font/woff");
-
-    } else if (isStrEndsWith(fileStr, ".woff2")) {
-        return httpd_resp_set_type(request, "font/woff2");
+    const char *extension = strrchr(fileName, '.');
+    // This is a limited set only. For any other type always set as plain text
+    char *contentType = extension != NULL ?
+            str_strFlatMapGetOrDefault(getContentTypeMap(), (char *) extension + 1, "text/plain") :
+            "text/plain";
+    return httpd_resp_set_type(request, contentType);
+}
 
-    } else {
-        // This is a limited set only. For any other type always set as plain text
-        return httpd_resp_set_type(request, "text/plain");
+static str_strFlatMap *getContentTypeMap() {
+    if (!is_str_strFlatMapFrozen(&contentTypeMap)) {
+        str_strFlatMap *map = new_str_strBufferFlatMap(&contentTypeMap, contentTypeEntries, CONTENT_TYPE_MAP_CAPACITY);
+        str_strFlatMapAdd(map, "pdf", "application/pdf");
+        str_strFlatMapAdd(map, "html", "text/html");
+        str_strFlatMapAdd(map, "jpeg", "image/jpeg");
+        str_strFlatMapAdd(map, "jpg", "image/jpeg");
+        str_strFlatMapAdd(map, "ico", "image/x-icon");
+        str_strFlatMapAdd(map, "js", "text/javascript");
+        str_strFlatMapAdd(map, "css", "text/css");
+        str_strFlatMapAdd(map, "woff", "font/woff");
+        str_strFlatMapAdd(map, "woff2", "font/woff2");
+        str_strFlatMapFreeze(map, FLAT_MAP_LAYOUT_SORTED);
     }
-}
\ No newline at end of file
+    return &contentTypeMap;
+}
@@ -45,6 +45,8 @@ static CspObjectArray *mapApRecordsToList(wifi_ap_record_t *apRecords, uint16_t
 static int apRecordComparator(const void *v1, const void *v2);
 static Properties *getPropertiesByFileName(const char *configFileName);
 static int propertyEntryKeyCompareFun(const void *one, const void *two);
+static void jsonToRopeWriter(void *rope, const char *value, uint32_t length);
+static bool sendRopeChunk(void *request, const char *value, uint32_t length);
 
 
 httpd_handle_t startWebServerAP() {
@@ -449,10 +451,11 @@ static esp_err_t summaryPageHandler(httpd_req_t *request) {
     bool isSubscribedToBot = getProperty(&wlanConfig, PROPERTY_TELEGRAM_CHAT_ID_KEY) != NULL;
     cspAddValToMap(paramMap, "isSubscribedToBot", CSP_BOOL_VALUE(isSubscribedToBot));
 
-    if (isSchedulerConfigured && isProjectTimeSet()) {
-        parseCronExpression(&cron, getProperty(&wlanConfig, PROPERTY_SYSTEM_CRON_EXPR_KEY));
+    const CronExpression *summaryCron = isSchedulerConfigured ? parseCronExpressionCached(getProperty(&wlanConfig, PROPERTY_SYSTEM_CRON_EXPR_KEY), NULL) : NULL;
+    if (summaryCron != NULL && isProjectTimeSet()) {
+        cron = *summaryCron;    // keep worker expression in sync, it is used for sleep time on restart
         ZonedDateTime currentDate = zonedDateTimeNow(&timeZone);
-        ZonedDateTime nextDate = nextCronZonedDateTime(&cron, &currentDate);
+        ZonedDateTime nextDate = nextCronZonedDateTime(summaryCron, &currentDate);
 
         char nextDateStr[64] = {0};
         DateTimeFormatter formatter;
@@ -563,7 +566,7 @@ static esp_err_t saveWifiCredentialsAjaxHandler(httpd_req_t *request) {
 
     if (isGeolocationEnabledByParam && !isTimeZoneSet) {
         // Call ip geolocation service to receive timezone
-        BufferString *url = STRING_FORMAT_128(
+        BufferString *url = stringFormat(EMPTY_STRING(128),     // format comes from config, so it's parsed at runtime
             getProperty(&appConfig, PROPERTY_IP_GEOLOCATION_TIMEZONE_FORMAT_URL_KEY), 
             getProperty(&appConfig, PROPERTY_IP_GEOLOCATION_API_KEY));
         LOG_DEBUG(TAG, "Call geolocation to receive timezone: [%s]", url->value);
@@ -588,19 +591,18 @@ static esp_err_t saveWifiCredentialsAjaxHandler(httpd_req_t *request) {
                 char *currentTime = getJsonObjectString(&timezoneJson, "current_time");
                 LOG_DEBUG(TAG, "Received timezone: [%s]. Time: [%s]", timezoneName, currentTime);
 
-                DateTimeFormatter formatter;
-                parseDateTimePattern(&formatter, "yyyy-MM-dd HH:mm:ss.SSSZ");
-                ZonedDateTime zdateTime = parseToZonedDateTime(currentTime, &formatter);
+                int64_t currentEpoch;
+                int32_t currentOffset;
 
-                if (isDateTimeValid(&zdateTime.dateTime)) {
+                if (currentTime != NULL && parseEpochSecondsByPattern(currentTime, strlen(currentTime), "yyyy-MM-dd HH:mm:ss.SSSZ", &currentEpoch, &currentOffset)) {
                     LOG_DEBUG(TAG, "Received time string successfully parsed...");
                     if (timeZone.id != NULL && strcmp(timeZone.id, UTC.id) != 0) {
                         free((char *) timeZone.id);
                     }
 
                     timeZone.id = strdup(timezoneName);
-                    timeZone.utcOffset = zdateTime.zone.utcOffset;
-                    timeZone.names = zdateTime.zone.names;
+                    timeZone.utcOffset = currentOffset;
+                    timeZone.names = UTC.names;
                     LOG_INFO(TAG, "Time zone updated. Zone id: [%s], Offset: %ds", timeZone.id, timeZone.utcOffset);
 
                 } else {
@@ -874,7 +876,7 @@ static esp_err_t adminUpdatePropertyAjaxHandler(httpd_req_t *request) {
 
     Properties *configProp = getPropertiesByFileName(configFileName);
     if (configProp == NULL) {
-        BufferString *message = STRING_FORMAT_64("Unknown config file: [%S]", configFileName);
+        BufferString *message = STRING_FORMAT_64("Unknown config file: [%s]", configFileName);
         deleteJSONObject(rootObject);
         ASSERT_404(false, message->value)
     }
@@ -900,7 +902,7 @@ static esp_err_t adminRemovePropertyAjaxHandler(httpd_req_t *request) {
 
     Properties *configProp = getPropertiesByFileName(configFileName);
     if (configProp == NULL) {
-        BufferString *message = STRING_FORMAT_64("Unknown config file: [%S]", configFileName);
+        BufferString *message = STRING_FORMAT_64("Unknown config file: [%s]", configFileName);
         LOG_ERROR(TAG, "%s", message->value);
         httpd_resp_send_err(request, HTTPD_404_NOT_FOUND, message->value);
         deleteJSONObject(rootObject);
@@ -995,15 +997,24 @@ static esp_err_t adminDirectoryContentsAjaxHandler(httpd_req_t *request) {
     }
 
     jsonObjectAddArray(&rootObject, "content", &contentArray);
-    size_t bufferSize = (MAX_FILES_IN_DIR * PATH_MAX_LEN) + 4096;
-    char *buffer = callocPsramHeap(bufferSize, sizeof(char));
-    jsonObjectToString(&rootObject, buffer, bufferSize);
-
-    httpd_resp_set_hdr(request, "Content-Type", "application/json");
-    httpd_resp_sendstr(request, buffer);
+    StringRope jsonRope = EMPTY_STRING_ROPE(STRING_ROPE_DEFAULT_CHUNK_SIZE);   // grows with listing, no worst-case buffer
+    jsonObjectWriteTo(&rootObject, jsonToRopeWriter, &jsonRope);
     deleteJSONObject(&rootObject);
     free(fileBuffer);
-    freePsramHeap(buffer);
+    if (jsonRope.isOutOfMemory) {
+        clearStringRope(&jsonRope);
+        ASSERT_500(false, "Not enough memory for directory content");
+    }
+
+    httpd_resp_set_hdr(request, "Content-Type", "application/json");
+    bool isSent = ropeForEachChunk(&jsonRope, sendRopeChunk, request);
+    clearStringRope(&jsonRope);
+    if (!isSent) {
+        LOG_ERROR(TAG, "Directory content sending failed!");
+        httpd_resp_send_chunk(request, NULL, 0);
+        return ESP_FAIL;
+    }
+    httpd_resp_send_chunk(request, NULL, 0);
     return ESP_OK;
 }
 
@@ -1137,7 +1148,15 @@ static Properties *getPropertiesByFileName(const char *configFileName) {
 }
 
 static int propertyEntryKeyCompareFun(const void *one, const void *two) {
-    BufferString *firstKey = SUBSTRING_CSTR_BEFORE(PATH_MAX_LEN, ((MapEntry *) one)->key, ".");
-    BufferString *secondKey = SUBSTRING_CSTR_BEFORE(PATH_MAX_LEN, ((MapEntry *) two)->key, ".");
-    return strcmp(stringValue(firstKey), stringValue(secondKey));
+    StringView firstKey = stringViewBefore(stringViewOf(((MapEntry *) one)->key), ".");
+    StringView secondKey = stringViewBefore(stringViewOf(((MapEntry *) two)->key), ".");
+    return (int) stringViewCompare(firstKey, secondKey);
+}
+
+static void jsonToRopeWriter(void *rope, const char *value, uint32_t length) {
+    ropeConcatCharsByLength(rope, value, length);
+}
+
+static bool sendRopeChunk(void *request, const char *value, uint32_t length) {
+    return httpd_resp_send_chunk(request, value, (ssize_t) length) == ESP_OK;
 }
@@ -10,6 +10,8 @@ static bool isTimeWasNotSetAtBootPrintStartBlock = false;
 static char buffer[128] = {0};
 
 static void timeSyncNotificationCallback(struct timeval *tv);
+static uint32_t loadTimezoneRulesFromFile(const char *zoneId, int64_t fromEpoch);
+static bool findTimeZoneInFile(const char *zoneId, TimeZone *zone);
 
 
 bool setupNtpTime() {
@@ -73,6 +75,9 @@ bool isNtpTimeSyncEnabled() {
 }
 
 void setupUserTimeZone() {
+    setenv("TZ", "UTC0", 1);    // All system logs and data should be in the UTC time zone. User-specific zone is handled by date-time library clock
+    tzset();
+
     if (propertiesHasKey(&appConfig, PROPERTY_APP_SYSTEM_TIMEZONE_KEY)) {
         char *timeZoneName = getPropertyOrDefault(&appConfig, PROPERTY_APP_SYSTEM_TIMEZONE_KEY, "UTC");
         LOG_INFO(TAG, "Time zone is set from [%s] config: [%s]", CONFIG_FILE, timeZoneName);
@@ -90,6 +95,17 @@ void setupUserTimeZone() {
 
 TimeZone findTimeZoneInDb(const char *zoneId) {
     TimeZone resultTimeZone = UTC;
+    const TimeZone *compiledZone = findTimeZone(zoneId);    // hash lookup, zones are compiled in only with ENABLE_TIME_ZONE_SUPPORT
+    if (compiledZone != NULL) {
+        resultTimeZone.id = strdup(compiledZone->id);
+        resultTimeZone.utcOffset = compiledZone->utcOffset;
+        return resultTimeZone;
+    }
+
+    if (findTimeZoneInFile(zoneId, &resultTimeZone)) {  // perfect hash in tzdb.bin, single probe. SQL query below can't use index for LOWER()
+        return resultTimeZone;
+    }
+
     ResultSet *rs = executeQuery(embeddedDb, "SELECT * FROM time_zone WHERE LOWER(zone_name) = LOWER(:zoneId)", SQL_PARAM_MAP("zoneId", (char *) zoneId));
     if (rs == NULL) {
         LOG_INFO(TAG, "Timezone: [%s] not found in DB returning default UTC", zoneId);
@@ -130,10 +146,8 @@ const char *getNtpStatusText(sntp_sync_status_t status) {
 }
 
 char *getCurrentTimeString(const char *format) {
-    DateTimeFormatter formatter;
-    parseDateTimePattern(&formatter, format);
     ZonedDateTime zDateTime = zonedDateTimeNow(&timeZone);
-    formatZonedDateTime(&zDateTime, buffer, sizeof(buffer), &formatter);
+    formatZonedDateTimeByPattern(&zDateTime, buffer, sizeof(buffer), format);    // pattern is parsed only once
     return buffer;
 }
 
@@ -147,6 +161,15 @@ void loadTimezoneHistoricRules(TimeZone *userTimeZone) {
     zonedDateTimeMinusYears(&zDateTime, 1);   // move back for one year for a transition gap
     int64_t fromEpoch = dateTimeToEpochSecond(&zDateTime.dateTime, zDateTime.offset);
 
+    uint32_t rows = loadTimezoneRulesFromFile(userTimeZone->id, fromEpoch);
+    if (rows > 0) {
+        LOG_INFO(TAG, "Total time zone rules loaded from [%s]: [%d]", TIMEZONE_DATABASE_FILE, rows);
+        userTimeZone->rules = TIMEZONE_RULES;
+        userTimeZone->ruleCount = rows;
+        resetZoneOffsetCache();
+        return;
+    }
+
     LOG_INFO(TAG, "Fetching timezone: %s, DST historic rules", userTimeZone->id);
     char *queryStr = "SELECT * FROM time_zone_rules "
                      "WHERE zone_name = :time_zone "
@@ -155,7 +178,7 @@ void loadTimezoneHistoricRules(TimeZone *userTimeZone) {
     str_DbValueMap *params = SQL_PARAM_MAP("time_zone", (char *) userTimeZone->id, "epoch", fromEpoch, "max_length", TIMEZONE_RULES_LENGTH - 1);
     ResultSet *rs = executeQuery(embeddedDb, queryStr, params);
 
-    uint32_t rows = 0;
+    rows = 0;
     while (nextResultSet(rs) && rows < TIMEZONE_RULES_LENGTH - 1) {
         TimeZoneRule *zoneRule = &TIMEZONE_RULES[rows];
         zoneRule->transition = rsGetI64(rs, "time_start");
@@ -167,6 +190,8 @@ void loadTimezoneHistoricRules(TimeZone *userTimeZone) {
     resultSetDelete(rs);
     LOG_INFO(TAG, "Total time zone rules rows fetched: [%d]", rows);
     userTimeZone->rules = TIMEZONE_RULES;
+    userTimeZone->ruleCount = rows;
+    resetZoneOffsetCache();
 }
 
 int64_t calculateSecondsToWaitFromNow() {
@@ -189,25 +214,28 @@ void enterTimerDeepSleep(int64_t sleepSeconds) {
 }
 
 char *zonedDateTimeToStrByFormat(ZonedDateTime *zdt, const char *format) {
-    memset(buffer, 0, sizeof(buffer));
-    DateTimeFormatter formatter;
-    parseDateTimePattern(&formatter, format);
-    formatZonedDateTime(zdt, buffer, sizeof(buffer), &formatter);
+    formatZonedDateTimeByPattern(zdt, buffer, sizeof(buffer), format);
     return buffer;
 }
 
 ZonedDateTime zonedDateTimeNow(const TimeZone *zone) {
-    time_t now;
-    struct tm timeinfo;
-    setenv("TZ", "UTC0", 1);    // All system logs and data should be in the UTC time zone. User-specific zone will be handled separately
-    tzset();
-    time(&now);
-    localtime_r(&now, &timeinfo);
-    ZonedDateTime zDateTime = zonedDateTimeOf(timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday, timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec, 0, &UTC);
-    return zonedDateTimeWithSameInstant(&zDateTime, zone);
+    ZonedDateTime zDateTime = clockZonedDateTime(zone);     // no libc TZ state, zone rules are from date-time library
+    zDateTime.dateTime.time.millis = 0;     // whole seconds, same as system time() before
+    return zDateTime;
+}
+
+int64_t clockWallMicros() {
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    return (int64_t) now.tv_sec * MICROS_PER_SECOND + now.tv_usec;
+}
+
+int64_t clockMonotonicMicros() {
+    return esp_timer_get_time();
 }
 
 static void timeSyncNotificationCallback(struct timeval *tv) {
+    syncClock();    // system time was changed
     if (isTimeWasNotSetAtBootPrintStartBlock) {
         LOG_INFO(TAG, "=================================================");
         LOG_INFO(TAG, "==================== Start ======================");
@@ -218,3 +246,30 @@ static void timeSyncNotificationCallback(struct timeval *tv) {
     LOG_INFO(TAG, "Time is synced with NTP Server: [%s]", getNtpServerName());
     LOG_INFO(TAG, "Current time: [%s]", getCurrentTimeString(DATE_TIME_FORMAT_ZONE_STR));
 }
+
+static uint32_t loadTimezoneRulesFromFile(const char *zoneId, int64_t fromEpoch) {
+    TimeZoneDb tzdb;
+    if (!openTimeZoneDb(&tzdb, TIMEZONE_DATABASE_FILE)) return 0;
+
+    uint32_t rows = 0;
+    TimeZoneDbEntry entry;
+    if (findTimeZoneDbEntry(&tzdb, zoneId, &entry)) {
+        rows = readTimeZoneDbRules(&tzdb, &entry, fromEpoch, TIMEZONE_RULES, TIMEZONE_RULES_LENGTH);
+    }
+    closeTimeZoneDb(&tzdb);
+    return rows;
+}
+
+static bool findTimeZoneInFile(const char *zoneId, TimeZone *zone) {
+    TimeZoneDb tzdb;
+    if (!openTimeZoneDb(&tzdb, TIMEZONE_DATABASE_FILE)) return false;
+
+    TimeZoneDbEntry entry;
+    bool isFound = findTimeZoneDbEntry(&tzdb, zoneId, &entry);
+    closeTimeZoneDb(&tzdb);
+    if (isFound) {
+        zone->id = strdup(entry.id);
+        zone->utcOffset = entry.utcOffset;
+    }
+    return isFound;
+}
@@ -10,6 +10,7 @@
 #include "esp_event.h"
 #include "esp_attr.h"
 #include "esp_sleep.h"
+#include "esp_timer.h"
 #include "esp_sntp.h"
 #include "driver/gpio.h"
 #include <driver/rtc_io.h>
@@ -25,6 +25,7 @@
 #define INF_WITH_SIGN_LENGTH (INF_LENGTH + 1)
 
 #define LENGTH_FIELD_MAX_SIZE 2
+#define FORMAT_DYNAMIC_FIELD (-2)   // width or precision is '*', value is taken from arguments
 #define SKIP_ONE_CHAR 1
 #define SKIP_TWO_CHARS 2
 #define FORMAT_NUMBER_BUFFER_SIZE 66
@@ -78,16 +79,24 @@ typedef enum FormatFlagField {
     ADAPTIVE_EXPONENT_FLAG,  // flag for: '%g' that represents the decimal format of the answer, depending upon whose length is smaller, comparing between %e and %f.
 } FormatFlagField;
 
+static bool replaceStringRange(BufferString *str, uint32_t position, uint32_t targetLength, const char *replacement, uint32_t replacementLength);
 static uint32_t isDelimiterChar(char valueChar, const char *delimiters, uint32_t length);
+static uint32_t parseFormatOp(const char *format, StringFormatOp *op);
 static uint8_t parseFormatFlags(const char *format, uint8_t *flags);
-static uint8_t parseFormatFieldWith(const char *format, va_list *vaList, int32_t *widthField, uint8_t *flags);
-static uint8_t parseFormatPrecision(const char *format, va_list *vaList, int32_t *precision);
+static uint8_t parseFormatFieldWith(const char *format, int16_t *widthField);
+static uint8_t parseFormatPrecision(const char *format, int16_t *precision);
 static uint8_t parseLengthField(char *lengthField, const char *format);
+static BufferString *formatByParsing(BufferString *str, const char *format, va_list *vaList);
+static StringFormatOps *compileFormatSpec(StringFormatSpec *spec);
+static bool isFormatSpecArgsMatch(StringFormatSpec *spec, StringFormatOps *ops);
+static int32_t formatOpArgType(const StringFormatOp *op);
+static BufferString *executeFormatOp(BufferString *str, const StringFormatOp *op, va_list *vaList);
 
 static BufferString *formatCharacter(BufferString *str, uint8_t flags, int32_t widthField, va_list *vaList);
 static BufferString *formatChars(BufferString *str, uint8_t flags, int32_t widthField, int32_t precision, va_list *vaList);
 static BufferString *formatString(BufferString *str, uint8_t flags, int32_t widthField, int64_t precision, va_list *vaList);
 static BufferString *doFormatChars(BufferString *str, const char *valueStr, uint32_t length, uint8_t flags, int32_t widthField);
+static BufferString *formatShortestDouble(BufferString *str, uint8_t flags, int32_t widthField, double value);
 static BufferString *formatPointer(BufferString *str, uint8_t flags, int32_t widthField, int32_t precision, uint64_t pointerAddress);
 static BufferString *formatNumber(BufferString *str, uint8_t flags, const char *lengthField, int32_t widthField, int32_t precision, uint8_t base, va_list *vaList);
 
@@ -140,104 +149,28 @@ BufferString *stringFormat(BufferString *str, const char *format, ...) {
     clearString(str);
     va_list vaList;
     va_start(vaList, format);
+    str = formatByParsing(str, format, &vaList);
+    va_end(vaList);
+    return str;
+}
 
-    for (; str != NULL && *format != '\0'; format++) {
-        if (*format != '%') {
-            str = concatChar(str, *format);
-            continue;
-        }
-
-        format++;   // skip also '%'
-        uint8_t flags = 0;
-        format += parseFormatFlags(format, &flags);
-
-        int32_t widthField = NO_RESULT;
-        format += parseFormatFieldWith(format, &vaList, &widthField, &flags);
-
-        int32_t precisionField = NO_RESULT;
-        format += parseFormatPrecision(format, &vaList, &precisionField);
-
-        char lengthField[LENGTH_FIELD_MAX_SIZE] = {0};
-        format += parseLengthField(lengthField, format);
-
-        uint8_t base = DEC_BASE;    // default base
-        switch (*format) {
-            case 'c':
-                str = formatCharacter(str, flags, widthField - 1, &vaList);
-                continue;
-            case 's':
-                str = formatChars(str, flags, widthField, precisionField, &vaList);
-                continue;
-            case 'S':
-                str = formatString(str, flags, widthField, precisionField, &vaList);
-                continue;
-            case 'p':
-                str = formatPointer(str, flags, widthField, precisionField, (uintptr_t) va_arg(vaList, void *));
-                continue;
-            case 'n':   // Print nothing, but writes the number of characters written so far into an integer pointer parameter.
-                str = concatChar(str, '\n');    // BufferString holds string length, so no need to count this. Just add new line like in Java 
-                continue;
-            case '%':
-                str = concatChar(str, '%');
-                continue;
-
-            case 'o':
-                base = OCT_BASE;
-                break;
-            case 'b':
-                base = BIN_BASE;
-                break;
-            case 'x':
-                SET_FLAG(flags, LOWER_CASE_FLAG);
-                // fall through
-            case 'X':
-                base = HEX_BASE;
-                break;
-
-            case 'd':
-            case 'i':
-                SET_FLAG(flags, SIGNED_NUMBER_FLAG);
-                break;
-            case 'u':
-                break;
-
-            case 'I':
-                SET_FLAG(flags, SIGNED_NUMBER_FLAG);
-                format += IS_INT_8(lengthField) ? SKIP_ONE_CHAR : SKIP_TWO_CHARS;
-                break;
-            case 'U':
-                format += IS_INT_8(lengthField) ? SKIP_ONE_CHAR : SKIP_TWO_CHARS;
-                break;
+BufferString *stringFormatBySpec(BufferString *str, StringFormatSpec *spec, ...) {
+    if (str == NULL || spec == NULL || spec->format == NULL) return NULL;
+    StringFormatOps *ops = atomic_load_explicit(&spec->ops, memory_order_acquire);
+    if (ops == NULL) {
+        ops = compileFormatSpec(spec);  // NULL when out of memory
+    }
 
-                #ifdef ENABLE_FLOAT_FORMATTING
-            case 'f':
-                SET_FLAG(flags, LOWER_CASE_FLAG);
-            case 'F':
-                str = formatFloat(str, va_arg(vaList, double), flags, widthField, precisionField);
-                continue;
-
-            case 'e':
-                SET_FLAG(flags, LOWER_CASE_FLAG);
-            case 'E':
-                str = formatExponential(str, va_arg(vaList, double), flags, widthField, precisionField);
-                continue;
-
-            case 'g':
-                SET_FLAG(flags, LOWER_CASE_FLAG);
-            case 'G':
-                SET_FLAG(flags, ADAPTIVE_EXPONENT_FLAG);
-                str = formatExponential(str, va_arg(vaList, double), flags, widthField, precisionField);
-                continue;
-                #endif
-
-            default:    // unknown char, just concatenate as is
-                str = concatChar(str, *format);
-                continue;
+    clearString(str);
+    va_list vaList;
+    va_start(vaList, spec);
+    if (ops != NULL && ops->isArgsMatch) {
+        for (uint32_t i = 0; str != NULL && i < ops->count; i++) {
+            str = executeFormatOp(str, &ops->items[i], &vaList);
         }
-
-        str = formatNumber(str, flags, lengthField, widthField, precisionField, base, &vaList);
+    } else {
+        str = formatByParsing(str, spec->format, &vaList);
     }
-
     va_end(vaList);
     return str;
 }
@@ -307,22 +240,29 @@ BufferString *swapCase(BufferString *str) {
 }
 
 BufferString *replaceFirstOccurrence(BufferString *source, const char *target, const char *replacement) {
-    char *sourcePointer = strstr(source->value, target);
-    if (sourcePointer == NULL) return NULL;
-
+    if (source == NULL || target == NULL || replacement == NULL) return NULL;
     uint32_t targetLength = strlen(target);
-    uint32_t replacementLength = strlen(replacement);
-    uint32_t tailLength = strlen(sourcePointer + targetLength) + 1;
+    const char *targetPointer = findStrInRange(source->value, source->length, target, targetLength);
+    if (targetPointer == NULL) return NULL;
 
-    if (targetLength >= source->capacity) return NULL;
-    memmove(sourcePointer + replacementLength, sourcePointer + targetLength, tailLength);
-    strncpy(sourcePointer, replacement, replacementLength);
-    source->length = strlen(source->value);
-    return source;
+    uint32_t position = targetPointer - source->value;
+    return replaceStringRange(source, position, targetLength, replacement, strlen(replacement)) ? source : NULL;
 }
 
 BufferString *replaceAllOccurrences(BufferString *source, const char *target, const char *replacement) {
-    while (replaceFirstOccurrence(source, target, replacement) != NULL);
+    if (source == NULL || target == NULL || replacement == NULL) return source;
+    uint32_t targetLength = strlen(target);
+    uint32_t replacementLength = strlen(replacement);
+    if (targetLength == 0 || strcmp(target, replacement) == 0) return source;
+
+    uint32_t fromIndex = 0;
+    const char *targetPointer;
+    while ((targetPointer = findStrInRange(source->value + fromIndex, source->length - fromIndex, target, targetLength)) != NULL) {
+        uint32_t position = targetPointer - source->value;
+        if (!replaceStringRange(source, position, targetLength, replacement, replacementLength)) break;
+        // text before replaced part is unchanged, only its tail can join with replacement into a new occurrence
+        fromIndex = position >= (targetLength - 1) ? position - (targetLength - 1) : 0;
+    }
     return source;
 }
 
@@ -497,11 +437,12 @@ bool hasNextSplitToken(StringIterator *iterator, BufferString *token) {
         return false;
     }
 
-    char *endPointer = strstr(startPointer, iterator->delimiter);
+    uint32_t remainingLength = iterator->str->length - (startPointer - iterator->str->value);
+    const char *endPointer = findStrInRange(startPointer, remainingLength, iterator->delimiter, iterator->delimiterLength);
     if (endPointer == NULL) {   // check that delimiter exist
         if (iterator->nextToken != NULL &&
             iterator->nextToken != iterator->str->value) {// copy last part only when source string has at least one existing delimiter
-            copyStringByLength(token, startPointer, strlen(iterator->nextToken));
+            copyStringByLength(token, startPointer, remainingLength);
             iterator->nextToken = NULL;
             return true;
         }
@@ -584,10 +525,10 @@ BufferString *joinStrings(BufferString *str, const char *delimiter, uint32_t arg
 }
 
 BufferString *repeatChar(BufferString *str, char repeatChar, uint32_t count) {
-    while (str != NULL && count > 0) {
-        str = concatChar(str, repeatChar);
-        count--;
-    }
+    if (str == NULL || count >= (str->capacity - str->length)) return NULL;
+    memset(STRING_END(str), repeatChar, count);
+    str->length += count;
+    TERMINATE_STRING(str);
     return str;
 }
 
@@ -600,25 +541,24 @@ BufferString *repeatChars(BufferString *str, const char *repeatChars, uint32_t c
 }
 
 BufferString *int64ToString(BufferString *str, int64_t value) {
-    char *bufferPointer = str->value;
-    uint64_t convertedValue = (value < 0) ? -value : value;
-    int32_t length = numberToStringByBase(convertedValue, bufferPointer, DEC_BASE, 0);
-
+    char numberBuffer[UINT64_DECIMAL_MAX_LENGTH + 1];
+    uint32_t length = 0;
     if (value < 0) {
-        if ((length + 1) >= str->capacity) return NULL;
-        bufferPointer[length] = '-';
-        length++;   // add minus sign to length
+        numberBuffer[length++] = '-';
     }
-
-    str->length = length;
-    return reverseString(str);
+    uint64_t convertedValue = (value < 0) ? -(uint64_t) value : (uint64_t) value;
+    length += uInt64ToDecimalChars(convertedValue, numberBuffer + length);
+    return copyStringByLength(str, numberBuffer, length);
 }
 
 BufferString *uInt64ToString(BufferString *str, uint64_t value) {
-    char *bufferPointer = str->value;
-    int32_t length = numberToStringByBase(value, bufferPointer, DEC_BASE, 0);
-    str->length = length;
-    return reverseString(str);
+    char numberBuffer[UINT64_DECIMAL_MAX_LENGTH];
+    return copyStringByLength(str, numberBuffer, uInt64ToDecimalChars(value, numberBuffer));
+}
+
+BufferString *doubleToString(BufferString *str, double value) {
+    char doubleBuffer[DOUBLE_SHORTEST_MAX_LENGTH];
+    return copyStringByLength(str, doubleBuffer, doubleToShortestChars(value, doubleBuffer));
 }
 
 StringToI64Status stringToI64(BufferString *str, int64_t *out, int base) {
@@ -705,16 +645,14 @@ bool isBuffStrEqualsIgnoreCase(BufferString *one, BufferString *two) {
 
 int32_t indexOfChar(BufferString *str, char charToFind, uint32_t fromIndex) {
     if (str == NULL || fromIndex >= str->length) return NO_RESULT;
-    for (int32_t i = (int32_t) fromIndex; i < str->length; i++) {
-        if (str->value[i] == charToFind) {
-            return i;
-        }
-    }
-    return NO_RESULT;
+    const char *charPointer = findCharInRange(str->value + fromIndex, str->length - fromIndex, charToFind);
+    return charPointer != NULL ? (charPointer - str->value) : NO_RESULT;
 }
 
 int32_t indexOfString(BufferString *str, const char *stringToFind, uint32_t fromIndex) {
-    return indexOfCStr(str != NULL ? str->value : NULL, stringToFind, fromIndex);
+    if (str == NULL || stringToFind == NULL || fromIndex >= str->length) return NO_RESULT;
+    const char *strPointer = findStrInRange(str->value + fromIndex, str->length - fromIndex, stringToFind, strlen(stringToFind));
+    return strPointer != NULL ? (strPointer - str->value) : NO_RESULT;
 }
 
 int32_t lastIndexOfString(BufferString *str, const char *stringToFind) {
@@ -722,26 +660,22 @@ int32_t lastIndexOfString(BufferString *str, const char *stringToFind) {
 }
 
 int32_t indexOfCStr(char *str, const char *stringToFind, uint32_t fromIndex) {
-    if (str == NULL || stringToFind == NULL || fromIndex >= strlen(str)) return NO_RESULT;
-    char *strPointer = strstr(str + fromIndex, stringToFind);
+    if (str == NULL || stringToFind == NULL) return NO_RESULT;
+    uint32_t length = strlen(str);
+    if (fromIndex >= length) return NO_RESULT;
+    const char *strPointer = findStrInRange(str + fromIndex, length - fromIndex, stringToFind, strlen(stringToFind));
     return strPointer != NULL ? (strPointer - str) : NO_RESULT;
 }
 
 int32_t lastIndexOfCStr(char *str, const char *stringToFind) {
     if (str == NULL || stringToFind == NULL) return NO_RESULT;
     uint32_t substringLength = strlen(stringToFind);
+    uint32_t length = strlen(str);
+    if (substringLength > length) return NO_RESULT;
 
-    uint32_t i = strlen(str);
-    while (true) {
-        uint32_t step = (i > substringLength) ? substringLength : 1;
-        if (i == 0) {
-            break;
-        }
-        i -= step;
-
-        char *substringPointer = strstr(str + i, stringToFind);
-        if (substringPointer != NULL) {
-            return (substringPointer - str);
+    for (uint32_t i = length - substringLength + 1; i-- > 0;) {    // backward scan, overlapping matches like "bcb" in "bcbcb" included
+        if (memcmp(str + i, stringToFind, substringLength) == 0) {
+            return (int32_t) i;
         }
     }
     return NO_RESULT;
@@ -750,21 +684,14 @@ int32_t lastIndexOfCStr(char *str, const char *stringToFind) {
 bool isStrStartsWith(BufferString *str, const char *prefix, uint32_t toOffset) {
     if (str == NULL || prefix == NULL) return false;
     uint32_t prefixLength = strlen(prefix);
-    if (toOffset > (str->length - prefixLength)) return false;
-
-    const char *valuePointer = str->value + toOffset;
-    for (uint32_t i = 0; i < prefixLength; i++) {
-        if (valuePointer[i] != prefix[i]) {
-            return false;
-        }
-    }
-    return true;
+    if (prefixLength > str->length || toOffset > (str->length - prefixLength)) return false;
+    return memcmp(str->value + toOffset, prefix, prefixLength) == 0;
 }
 
 bool isStrStartsWithIgnoreCase(BufferString *str, const char *prefix, uint32_t toOffset) {
     if (str == NULL || prefix == NULL) return false;
     uint32_t prefixLength = strlen(prefix);
-    if (toOffset > (str->length - prefixLength)) return false;
+    if (prefixLength > str->length || toOffset > (str->length - prefixLength)) return false;
 
     const char *valuePointer = str->value + toOffset;
     for (uint32_t i = 0; i < prefixLength; i++) {
@@ -777,19 +704,7 @@ bool isStrStartsWithIgnoreCase(BufferString *str, const char *prefix, uint32_t t
 
 bool isStrEndsWith(BufferString *str, const char *suffix) {
     if (str == NULL || suffix == NULL) return false;
-    uint32_t suffixLength = strlen(suffix);
-
-    if (suffixLength > str->length) {
-        return false;
-    }
-
-    uint32_t length = str->length;
-    for (uint32_t i = suffixLength; i > 0; i--, length--) {
-        if (str->value[length - 1] != suffix[i - 1]) {
-            return false;
-        }
-    }
-    return true;
+    return isRangeEndsWith(str->value, str->length, suffix, strlen(suffix));
 }
 
 bool isStrEndsWithIgnoreCase(BufferString *str, const char *suffix) {
@@ -809,6 +724,17 @@ bool isStrEndsWithIgnoreCase(BufferString *str, const char *suffix) {
     return true;
 }
 
+static bool replaceStringRange(BufferString *str, uint32_t position, uint32_t targetLength, const char *replacement, uint32_t replacementLength) {
+    uint32_t newLength = str->length - targetLength + replacementLength;
+    if (newLength >= str->capacity) return false;
+
+    char *targetPointer = str->value + position;
+    memmove(targetPointer + replacementLength, targetPointer + targetLength, str->length - position - targetLength + 1);  // tail with null terminator
+    memcpy(targetPointer, replacement, replacementLength);
+    str->length = newLength;
+    return true;
+}
+
 static uint32_t isDelimiterChar(char valueChar, const char *delimiters, uint32_t length) {
     for (int i = 0; i < length; i++) {
         if (delimiters[i] == valueChar) {
@@ -818,6 +744,70 @@ static uint32_t isDelimiterChar(char valueChar, const char *delimiters, uint32_t
     return false;
 }
 
+static uint32_t parseFormatOp(const char *format, StringFormatOp *op) {
+    const char *start = format;
+    const char *specifier = strchr(format, '%');
+    uint32_t literalLength = (specifier != NULL) ? (uint32_t) (specifier - format) : strlen(format);
+    *op = (StringFormatOp) {
+            .literal = format,
+            .literalLength = literalLength,
+            .widthField = NO_RESULT,
+            .precisionField = NO_RESULT,
+            .base = DEC_BASE
+    };
+
+    format += literalLength;
+    if (*format == '\0') return format - start;   // trailing literal without conversion
+
+    format++;   // skip also '%'
+    format += parseFormatFlags(format, &op->flags);
+    format += parseFormatFieldWith(format, &op->widthField);
+    format += parseFormatPrecision(format, &op->precisionField);
+    format += parseLengthField(op->lengthField, format);
+
+    op->conversion = *format;
+    switch (*format) {
+        case '\0':  // '%' at the end of format, nothing to convert
+            return format - start;
+        case 'o':
+            op->base = OCT_BASE;
+            break;
+        case 'b':
+            op->base = BIN_BASE;
+            break;
+        case 'x':
+            SET_FLAG(op->flags, LOWER_CASE_FLAG);
+            // fall through
+        case 'X':
+            op->base = HEX_BASE;
+            break;
+        case 'd':
+        case 'i':
+            SET_FLAG(op->flags, SIGNED_NUMBER_FLAG);
+            break;
+        case 'I':
+            SET_FLAG(op->flags, SIGNED_NUMBER_FLAG);
+            format += IS_INT_8(op->lengthField) ? SKIP_ONE_CHAR : SKIP_TWO_CHARS;
+            break;
+        case 'U':
+            format += IS_INT_8(op->lengthField) ? SKIP_ONE_CHAR : SKIP_TWO_CHARS;
+            break;
+        case 'f':
+        case 'e':
+            SET_FLAG(op->flags, LOWER_CASE_FLAG);
+            break;
+        case 'g':
+            SET_FLAG(op->flags, LOWER_CASE_FLAG);
+            // fall through
+        case 'G':
+            SET_FLAG(op->flags, ADAPTIVE_EXPONENT_FLAG);
+            break;
+        default:
+            break;
+    }
+    return (format + 1) - start;
+}
+
 static uint8_t parseFormatFlags(const char *format, uint8_t *flags) {
     uint8_t flagsLength = 0;
     bool haveNextFlag = true;
@@ -853,42 +843,203 @@ static uint8_t parseFormatFlags(const char *format, uint8_t *flags) {
     return flagsLength;
 }
 
-static uint8_t parseFormatFieldWith(const char *format, va_list *vaList, int32_t *widthField, uint8_t *flags) {
+static uint8_t parseFormatFieldWith(const char *format, int16_t *widthField) {
     if (isdigit((int) *format)) {
-        *widthField = 0;
-        return stringToNumber(format, widthField);
+        int32_t width = 0;
+        uint8_t length = stringToNumber(format, &width);
+        *widthField = (int16_t) ((width < INT16_MAX) ? width : INT16_MAX);
+        return length;
 
     } else if (*format == '*') {
-        *widthField = va_arg(*vaList, int32_t);   // dynamic width field value must be provided
-        if (*widthField < 0) {
-            *widthField = -*widthField;
-            SET_FLAG(*flags, LEFT_ALIGN_FLAG);
-        }
+        *widthField = FORMAT_DYNAMIC_FIELD;   // dynamic width field value must be provided
         return SKIP_ONE_CHAR; // skip '*'
     }
     return 0;
 }
 
-static uint8_t parseFormatPrecision(const char *format, va_list *vaList, int32_t *precision) {
+static uint8_t parseFormatPrecision(const char *format, int16_t *precision) {
     if (*format == '.') {
         format++;   // skip '.'
         if (isdigit((int) *format)) {
-            *precision = 0;
-            return stringToNumber(format, precision) + SKIP_ONE_CHAR;   // also skip '.'
+            int32_t precisionValue = 0;
+            uint8_t length = stringToNumber(format, &precisionValue);
+            *precision = (int16_t) ((precisionValue < INT16_MAX) ? precisionValue : INT16_MAX);
+            return length + SKIP_ONE_CHAR;   // also skip '.'
 
         } else if (*format == '*') {
-            *precision = va_arg(*vaList, int32_t);   // dynamic precision field value must be provided
+            *precision = FORMAT_DYNAMIC_FIELD;   // dynamic precision field value must be provided
             return SKIP_TWO_CHARS; // skip '*' and '.'
         }
 
-        if (*precision < 0) {
-            *precision = 0;
-        }
+        *precision = 0;
         return SKIP_ONE_CHAR;      // also skip '.'
     }
     return 0;
 }
 
+static BufferString *formatByParsing(BufferString *str, const char *format, va_list *vaList) {
+    StringFormatOp op;
+    while (str != NULL && *format != '\0') {
+        format += parseFormatOp(format, &op);
+        str = executeFormatOp(str, &op, vaList);
+    }
+    return str;
+}
+
+static StringFormatOps *compileFormatSpec(StringFormatSpec *spec) {
+    uint32_t opCount = 0;
+    StringFormatOp op;
+    for (const char *format = spec->format; *format != '\0'; opCount++) {
+        format += parseFormatOp(format, &op);
+    }
+    if (opCount > UINT16_MAX) return NULL;
+
+    StringFormatOps *ops = malloc(sizeof(StringFormatOps) + opCount * sizeof(StringFormatOp));
+    if (ops == NULL) return NULL;
+    const char *format = spec->format;
+    for (uint32_t i = 0; i < opCount; i++) {
+        format += parseFormatOp(format, &ops->items[i]);
+    }
+    ops->count = opCount;
+    ops->isArgsMatch = isFormatSpecArgsMatch(spec, ops);
+
+    StringFormatOps *publishedOps = NULL;   // concurrent first calls race here, only the first published block is kept
+    if (!atomic_compare_exchange_strong_explicit(&spec->ops, &publishedOps, ops, memory_order_acq_rel, memory_order_acquire)) {
+        free(ops);
+        return publishedOps;
+    }
+    return ops;
+}
+
+static bool isFormatSpecArgsMatch(StringFormatSpec *spec, StringFormatOps *ops) {
+    uint32_t argIndex = 0;  // extra arguments are ignored like in printf, missing or mismatched are not
+    for (uint32_t i = 0; i < ops->count; i++) {
+        const StringFormatOp *op = &ops->items[i];
+        if (op->widthField == FORMAT_DYNAMIC_FIELD) {
+            if (argIndex >= spec->argCount || spec->argTypes[argIndex++] != FORMAT_ARG_INT32) return false;
+        }
+        if (op->precisionField == FORMAT_DYNAMIC_FIELD) {
+            if (argIndex >= spec->argCount || spec->argTypes[argIndex++] != FORMAT_ARG_INT32) return false;
+        }
+
+        int32_t expectedType = formatOpArgType(op);
+        if (expectedType == NO_RESULT) continue;    // conversion without argument
+        if (argIndex >= spec->argCount) return false;
+
+        FormatArgType argType = spec->argTypes[argIndex++];
+        bool isPointerArg = argType == FORMAT_ARG_POINTER || argType == FORMAT_ARG_CHARS || argType == FORMAT_ARG_BUFFER_STRING;
+        bool isStringConversion = expectedType == FORMAT_ARG_CHARS || expectedType == FORMAT_ARG_BUFFER_STRING;
+        if ((int32_t) argType == expectedType) continue;
+        if (expectedType == FORMAT_ARG_POINTER && isPointerArg) continue;
+        if (isStringConversion && argType == FORMAT_ARG_POINTER) continue;     // NULL or void * for %s and %S, as stringFormat() takes
+        return false;
+    }
+    return true;
+}
+
+static int32_t formatOpArgType(const StringFormatOp *op) {
+    switch (op->conversion) {
+        case 'c':
+            return FORMAT_ARG_INT32;
+        case 's':
+            return FORMAT_ARG_CHARS;
+        case 'S':
+            return FORMAT_ARG_BUFFER_STRING;
+        case 'p':
+            return FORMAT_ARG_POINTER;
+        case 'D':
+            return FORMAT_ARG_DOUBLE;
+        #ifdef ENABLE_FLOAT_FORMATTING
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+            return FORMAT_ARG_DOUBLE;
+        #endif
+        case 'o':
+        case 'b':
+        case 'x':
+        case 'X':
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'I':
+        case 'U':
+            if (op->lengthField[0] == 'l' && op->lengthField[1] != 'l') {
+                return sizeof(long) > sizeof(int32_t) ? FORMAT_ARG_INT64 : FORMAT_ARG_INT32;
+            }
+            return (op->lengthField[1] == 'l' || IS_INT_64(op->lengthField)) ? FORMAT_ARG_INT64 : FORMAT_ARG_INT32;
+        default:
+            return NO_RESULT;
+    }
+}
+
+static BufferString *executeFormatOp(BufferString *str, const StringFormatOp *op, va_list *vaList) {
+    if (op->literalLength > 0) {
+        str = concatCharsByLength(str, op->literal, op->literalLength);
+    }
+    if (str == NULL || op->conversion == '\0') return str;
+
+    uint8_t flags = op->flags;
+    int32_t widthField = op->widthField;
+    if (widthField == FORMAT_DYNAMIC_FIELD) {
+        widthField = va_arg(*vaList, int32_t);
+        if (widthField < 0) {
+            widthField = -widthField;
+            SET_FLAG(flags, LEFT_ALIGN_FLAG);
+        }
+    }
+
+    int32_t precisionField = op->precisionField;
+    if (precisionField == FORMAT_DYNAMIC_FIELD) {
+        precisionField = va_arg(*vaList, int32_t);
+    }
+
+    switch (op->conversion) {
+        case 'c':
+            return formatCharacter(str, flags, widthField - 1, vaList);
+        case 's':
+            return formatChars(str, flags, widthField, precisionField, vaList);
+        case 'S':
+            return formatString(str, flags, widthField, precisionField, vaList);
+        case 'D':
+            return formatShortestDouble(str, flags, widthField, va_arg(*vaList, double));
+        case 'p':
+            return formatPointer(str, flags, widthField, precisionField, (uintptr_t) va_arg(*vaList, void *));
+        case 'n':   // Print nothing, but writes the number of characters written so far into an integer pointer parameter.
+            return concatChar(str, '\n');    // BufferString holds string length, so no need to count this. Just add new line like in Java
+        case '%':
+            return concatChar(str, '%');
+
+        case 'o':
+        case 'b':
+        case 'x':
+        case 'X':
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'I':
+        case 'U':
+            return formatNumber(str, flags, op->lengthField, widthField, precisionField, op->base, vaList);
+
+            #ifdef ENABLE_FLOAT_FORMATTING
+        case 'f':
+        case 'F':
+            return formatFloat(str, va_arg(*vaList, double), flags, widthField, precisionField);
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+            return formatExponential(str, va_arg(*vaList, double), flags, widthField, precisionField);
+            #endif
+
+        default:    // unknown char, just concatenate as is
+            return concatChar(str, op->conversion);
+    }
+}
+
 static uint8_t parseLengthField(char *lengthField, const char *format) {
     if (*format == 'h' || *format == 'l' || *format == 'L') {
         lengthField[0] = *format;
@@ -964,6 +1115,13 @@ static BufferString *doFormatChars(BufferString *str, const char *valueStr, uint
     return str;
 }
 
+static BufferString *formatShortestDouble(BufferString *str, uint8_t flags, int32_t widthField, double value) {
+    char doubleBuffer[DOUBLE_SHORTEST_MAX_LENGTH];
+    uint32_t length = doubleToShortestChars(value, doubleBuffer);
+    widthField = (widthField > 0) ? widthField : 0;
+    return doFormatChars(str, doubleBuffer, length, flags, widthField);
+}
+
 static BufferString *formatPointer(BufferString *str, uint8_t flags, int32_t widthField, int32_t precision, uint64_t pointerAddress) {
     if (widthField <= 0) {
         widthField = POINTER_DEFAULT_WIDTH;
@@ -973,6 +1131,10 @@ static BufferString *formatPointer(BufferString *str, uint8_t flags, int32_t wid
 }
 
 static BufferString *formatNumber(BufferString *str, uint8_t flags, const char *lengthField, int32_t widthField, int32_t precision, uint8_t base, va_list *vaList) {
+    if (precision >= 0) {
+        BIT_CLEAR(flags, ZEROES_PADDING_FLAG);  // as in printf, '0' flag is ignored for integers with precision
+    }
+
     if (lengthField[0] == 'h' || IS_INT_8(lengthField) || IS_INT_16(lengthField)) {    // 	Expect int-sized integer argument which was promoted from a short.
         if (lengthField[1] == 'h' || IS_INT_8(lengthField)) {    // Expect int-sized integer argument which was promoted from a char.
             return formatByte(str, flags, widthField, precision, base, vaList);
@@ -1006,12 +1168,10 @@ static BufferString *formatFloat(BufferString *str, double decimalValue, uint8_t
         precision = FORMAT_DEFAULT_FLOAT_PRECISION;
     }
 
-    int32_t bufferLength = 0;
-    char tmpDecimalBuffer[FORMAT_FLOAT_BUFFER_SIZE] = {0};
-    while (bufferLength < FORMAT_FLOAT_BUFFER_SIZE && precision > FORMAT_MAX_FLOAT_PRECISION) {// limit precision to 9, cause a precision > 9 can lead to overflow errors
-        tmpDecimalBuffer[bufferLength] = '0';
-        bufferLength++;
-        precision--;
+    int32_t extraZeroCount = 0;
+    if (precision > FORMAT_MAX_FLOAT_PRECISION) {   // limit precision to 9, cause a precision > 9 can lead to overflow errors
+        extraZeroCount = precision - FORMAT_MAX_FLOAT_PRECISION;
+        precision = FORMAT_MAX_FLOAT_PRECISION;
     }
 
     double power = FLOAT_POW_OF_10[precision];
@@ -1021,7 +1181,7 @@ static BufferString *formatFloat(BufferString *str, double decimalValue, uint8_t
     int64_t wholePart = (int64_t) decimalValue;
     char sign = resolveSign(&wholePart, flags, &widthField);
     if (precision == 0) {
-        return numberToString(str, wholePart, sign, DEC_BASE, widthField, 0, flags);  // return string if only whole part is needed
+        return numberToString(str, wholePart, sign, DEC_BASE, widthField, 1, flags);  // return string if only whole part is needed, "0" for fractions below 0.5
     }
 
     decimalValue = (sign == '-') ? -decimalValue : decimalValue;
@@ -1029,29 +1189,26 @@ static BufferString *formatFloat(BufferString *str, double decimalValue, uint8_t
     tmpFractional = (((int32_t) (tmpFractional + 0.5)) / power) * power; // round conversion
     int32_t fractionalPart = (int32_t) tmpFractional;   // extract fraction
 
-    int32_t decimalLength = numberToStringByBase(fractionalPart, (tmpDecimalBuffer + bufferLength), DEC_BASE, flags);
-    bufferLength += decimalLength;
-    int32_t precisionDigitCount = (precision - bufferLength);
-
-    while (precisionDigitCount > 0 && bufferLength < FORMAT_FLOAT_BUFFER_SIZE) {   // add extra precision 0s
-        tmpDecimalBuffer[bufferLength] = '0';
-        precisionDigitCount--;
-        bufferLength++;
-    }
+    char fractionDigits[FORMAT_NUMBER_BUFFER_SIZE];
+    int32_t fractionLength = numberToStringByBase(fractionalPart, fractionDigits, DEC_BASE, flags);
 
-    if (bufferLength < FORMAT_FLOAT_BUFFER_SIZE) {  // add decimal point
-        tmpDecimalBuffer[bufferLength] = '.';
-        bufferLength++;
-    }
+    int32_t bufferLength = 0;
+    char tmpDecimalBuffer[FORMAT_FLOAT_BUFFER_SIZE];    // decimal point, leading fraction 0s, fraction, extra precision 0s
+    tmpDecimalBuffer[bufferLength++] = '.';
+    int32_t leadingZeroCount = (precision > fractionLength) ? (precision - fractionLength) : 0;
+    memset(tmpDecimalBuffer + bufferLength, '0', leadingZeroCount);
+    bufferLength += leadingZeroCount;
+    memcpy(tmpDecimalBuffer + bufferLength, fractionDigits, fractionLength);
+    bufferLength += fractionLength;
+    extraZeroCount = (extraZeroCount < FORMAT_FLOAT_BUFFER_SIZE - bufferLength) ? extraZeroCount : FORMAT_FLOAT_BUFFER_SIZE - bufferLength;
+    memset(tmpDecimalBuffer + bufferLength, '0', extraZeroCount);
+    bufferLength += extraZeroCount;
 
     uint32_t startValueLength = str->length;
     int32_t wholeLength = IS_FLAG_SET(flags, LEFT_ALIGN_FLAG) ? 0 : (widthField - bufferLength);   // when '-' flag set, concat only number without padding
     str = numberToString(str, wholePart, sign, DEC_BASE, wholeLength, 1, flags); // concat whole part with padding minus length of decimal part
 
-    while (str != NULL && bufferLength > 0) { // concat fraction and decimal point part
-        char digitChar = tmpDecimalBuffer[--bufferLength];
-        str = concatChar(str, digitChar);
-    }
+    str = concatCharsByLength(str, tmpDecimalBuffer, bufferLength);    // concat decimal point and fraction part
 
     if (IS_FLAG_SET(flags, LEFT_ALIGN_FLAG)) {
         uint32_t endValueLength = str->length - startValueLength;
@@ -1196,15 +1353,18 @@ static inline BufferString *formatInt(BufferString *str, uint8_t flags, int32_t
 
 static BufferString *numberToString(BufferString *str, uint64_t number, char sign, uint8_t base, int32_t size, int32_t precision, uint8_t flags) {
     if (number == 0) {
+        if (IS_FLAG_SET(flags, SPECIAL_FLAG) && base == OCT_BASE) {
+            precision = (precision > 0) ? precision : 1;    // "%#.0o" still prints single '0'
+        }
         BIT_CLEAR(flags, SPECIAL_FLAG);
-        precision = (size < 0 && precision < 0) ? 1 : precision;    // when field width, precision not provided and number is 0, concat single '0' to string
-
-        if (precision <= 0) {
-            if (size >= 0) {
-                BIT_CLEAR(flags, ZEROES_PADDING_FLAG);  // concat only ' '
-                str = concatLeftPadding(str, &sign, base, &size, flags);
-            }
-            return concatSignIfPresent(str, sign);
+        precision = (precision < 0) ? 1 : precision;    // when precision not provided and number is 0, concat single '0' to string
+
+        if (precision <= 0) {   // no digits, only sign and padding
+            size = (size > 0) ? size : 0;
+            BIT_CLEAR(flags, ZEROES_PADDING_FLAG);  // concat only ' '
+            str = concatLeftPadding(str, &sign, base, &size, flags);
+            str = concatSignIfPresent(str, sign);
+            return concatRightPadding(str, size);
         }
     }
 
@@ -1212,17 +1372,17 @@ static BufferString *numberToString(BufferString *str, uint64_t number, char sig
         BIT_CLEAR(flags, ZEROES_PADDING_FLAG);
     }
 
+    char tmpNumberBuffer[FORMAT_NUMBER_BUFFER_SIZE] = {0};
+    int32_t numberLength = numberToStringByBase(number, tmpNumberBuffer, base, flags);
     if (IS_FLAG_SET(flags, SPECIAL_FLAG)) {
         if (base == HEX_BASE || base == BIN_BASE) {
             size -= HEX_SIZE;
 
-        } else if (base == OCT_BASE) {
-            size--;
+        } else if (base == OCT_BASE) {  // octal '#' only makes the first digit '0'
+            BIT_CLEAR(flags, SPECIAL_FLAG);
+            precision = (precision > numberLength) ? precision : numberLength + 1;
         }
     }
-
-    char tmpNumberBuffer[FORMAT_NUMBER_BUFFER_SIZE] = {0};
-    int32_t numberLength = numberToStringByBase(number, tmpNumberBuffer, base, flags);
     precision = (numberLength > precision) ? numberLength : precision;
 
     size -= precision;
@@ -1230,16 +1390,14 @@ static BufferString *numberToString(BufferString *str, uint64_t number, char sig
 
     str = concatLeftPadding(str, &sign, base, &size, flags);
     str = concatSignIfPresent(str, sign);
-
-    while (numberLength < precision) {  // add precision before value
-        str = concatChar(str, '0');
-        precision--;
+    if (IS_FLAG_SET(flags, LEFT_ALIGN_FLAG)) {
+        str = concatSpecialIfPresent(str, base, flags);     // padding goes to the right, prefix still follows the sign
     }
 
-    while (numberLength > 0) { // reverse concat number chars
-        str = concatChar(str, tmpNumberBuffer[--numberLength]);
+    if (numberLength < precision) {  // add precision before value
+        str = repeatChar(str, '0', precision - numberLength);
     }
-
+    str = concatCharsByLength(str, tmpNumberBuffer, numberLength);
     return concatRightPadding(str, size);
 }
 
@@ -1255,20 +1413,8 @@ static uint8_t stringToNumber(const char *numberStr, int32_t *resultValue) {
 }
 
 static int32_t numberToStringByBase(uint64_t number, char *numberBuffer, uint8_t base, uint8_t flags) {
-    /* called only with base 2, 8, 10 or 16, thus don't need more than "F..."  */
-    static const char DIGITS[] = "0123456789ABCDEF";
-
-    int32_t length = 0;
-    bool isUpperCaseValue = IS_FLAG_SET(flags, LOWER_CASE_FLAG);
-    do {
-        uint64_t result = number % base;
-        number = number / base;
-        char digit = DIGITS[result];
-        numberBuffer[length] = (char) (isUpperCaseValue ? tolower((int) digit) : digit);
-        length++;
-    } while (number > 0);
-
-    return length;
+    /* called only with base 2, 8, 10 or 16, digits are written in reading order */
+    return (int32_t) uInt64ToCharsByBase(number, numberBuffer, base, IS_FLAG_SET(flags, LOWER_CASE_FLAG));
 }
 
 static BufferString *concatLeftPadding(BufferString *str, char *sign, uint8_t base, int32_t *size, uint8_t flags) {
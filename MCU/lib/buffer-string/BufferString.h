@@ -9,6 +9,9 @@
 #include <limits.h>
 #include <errno.h>
 #include <stdlib.h>
+#include <stdatomic.h>
+#include "StringSearch.h"
+#include "NumberFormat.h"
 
 #ifdef ENABLE_FLOAT_FORMATTING
 #include <float.h>
@@ -35,6 +38,39 @@ typedef enum StringToI64Status {
     STR_TO_I64_INCONVERTIBLE
 } StringToI64Status;
 
+typedef enum FormatArgType {
+    FORMAT_ARG_INT32,
+    FORMAT_ARG_INT64,
+    FORMAT_ARG_DOUBLE,
+    FORMAT_ARG_CHARS,
+    FORMAT_ARG_BUFFER_STRING,
+    FORMAT_ARG_POINTER
+} FormatArgType;
+
+typedef struct StringFormatOp {     // literal run followed by single conversion
+    const char *literal;
+    uint16_t literalLength;
+    int16_t widthField;
+    int16_t precisionField;
+    char conversion;    // '\0' when op is trailing literal only
+    uint8_t flags;
+    uint8_t base;
+    char lengthField[2];
+} StringFormatOp;
+
+typedef struct StringFormatOps {    // parsed once and published as one block, so count and check result are never seen without ops
+    uint16_t count;
+    bool isArgsMatch;
+    StringFormatOp items[];
+} StringFormatOps;
+
+typedef struct StringFormatSpec {   // one static instance per call site, ops are parsed from format on first call
+    const char *format;
+    const uint8_t *argTypes;
+    uint8_t argCount;
+    _Atomic(StringFormatOps *) ops;
+} StringFormatSpec;
+
 // initialization
 #define NEW_STRING(capacity, initValue) newString(&(BufferString){0}, initValue, (char[capacity]){0}, capacity)
 #define NEW_STRING_LEN(capacity, initValue, length) newStringWithLength(&(BufferString){0}, initValue, length, (char[capacity]){0}, capacity)
@@ -42,7 +78,8 @@ typedef enum StringToI64Status {
 #define EMPTY_STRING(capacity) newString(&(BufferString){0}, "", (char[capacity]){0}, capacity)
 #define DUP_STRING(capacity, source) dubString(source, &(BufferString){0}, (char[capacity]){0}, capacity)
 
-#define STRING_FORMAT(capacity, format, args...) stringFormat(EMPTY_STRING(capacity), format, args)
+#define STRING_FORMAT(capacity, format, args...) STRING_FORMAT_TO(EMPTY_STRING(capacity), format, args)
+#define STRING_FORMAT_TO(str, format, args...) stringFormatBySpec(str, STRING_FORMAT_SPEC(format, args), args)   // format must be literal, for runtime formats use stringFormat()
 #define SUBSTRING(capacity, source, beginIndex, endIndex) substringFromTo(source, EMPTY_STRING(capacity), beginIndex, endIndex)
 #define SUBSTRING_AFTER(capacity, source, separator) substringAfter(source, EMPTY_STRING(capacity), separator)
 #define SUBSTRING_AFTER_LAST(capacity, source, separator) substringAfterLast(source, EMPTY_STRING(capacity), separator)
@@ -59,6 +96,66 @@ typedef enum StringToI64Status {
 
 #define INT64_TO_STRING(value) int64ToString(EMPTY_STRING(32), value)
 #define UINT64_TO_STRING(value) uInt64ToString(EMPTY_STRING(32), value)
+#define DOUBLE_TO_STRING(value) doubleToString(EMPTY_STRING(DOUBLE_SHORTEST_MAX_LENGTH + 1), value)
+
+// format spec is static per call site, argument types are captured by _Generic and checked against conversions when spec is parsed, mismatched call sites are formatted by parsing
+#define STRING_FORMAT_SPEC(FORMAT, args...) ({                                  \
+    static const uint8_t formatArgTypes[] = {FORMAT_ARG_TYPES(args)};          \
+    static StringFormatSpec formatSpec = {                                      \
+        .format = "" FORMAT "",                                                 \
+        .argTypes = formatArgTypes,                                             \
+        .argCount = sizeof(formatArgTypes)                                      \
+    };                                                                          \
+    &formatSpec;                                                                \
+})
+
+#define FORMAT_ARG_INT_OF_SIZE(type) (sizeof(type) > sizeof(int32_t) ? FORMAT_ARG_INT64 : FORMAT_ARG_INT32)
+#define FORMAT_ARG_TYPE(arg) _Generic((arg),                                   \
+    _Bool: FORMAT_ARG_INT32,                                                    \
+    char: FORMAT_ARG_INT32,                                                     \
+    signed char: FORMAT_ARG_INT32,                                              \
+    unsigned char: FORMAT_ARG_INT32,                                            \
+    short: FORMAT_ARG_INT32,                                                    \
+    unsigned short: FORMAT_ARG_INT32,                                           \
+    int: FORMAT_ARG_INT32,                                                      \
+    unsigned int: FORMAT_ARG_INT32,                                             \
+    long: FORMAT_ARG_INT_OF_SIZE(long),                                         \
+    unsigned long: FORMAT_ARG_INT_OF_SIZE(unsigned long),                       \
+    long long: FORMAT_ARG_INT64,                                                \
+    unsigned long long: FORMAT_ARG_INT64,                                       \
+    float: FORMAT_ARG_DOUBLE,                                                   \
+    double: FORMAT_ARG_DOUBLE,                                                  \
+    char *: FORMAT_ARG_CHARS,                                                   \
+    const char *: FORMAT_ARG_CHARS,                                             \
+    unsigned char *: FORMAT_ARG_CHARS,                                          \
+    const unsigned char *: FORMAT_ARG_CHARS,                                    \
+    BufferString *: FORMAT_ARG_BUFFER_STRING,                                   \
+    const BufferString *: FORMAT_ARG_BUFFER_STRING,                             \
+    default: FORMAT_ARG_POINTER)
+
+#define FORMAT_ARG_TYPES_1(a) FORMAT_ARG_TYPE(a)
+#define FORMAT_ARG_TYPES_2(a, args...) FORMAT_ARG_TYPE(a), FORMAT_ARG_TYPES_1(args)
+#define FORMAT_ARG_TYPES_3(a, args...) FORMAT_ARG_TYPE(a), FORMAT_ARG_TYPES_2(args)
+#define FORMAT_ARG_TYPES_4(a, args...) FORMAT_ARG_TYPE(a), FORMAT_ARG_TYPES_3(args)
+#define FORMAT_ARG_TYPES_5(a, args...) FORMAT_ARG_TYPE(a), FORMAT_ARG_TYPES_4(args)
+#define FORMAT_ARG_TYPES_6(a, args...) FORMAT_ARG_TYPE(a), FORMAT_ARG_TYPES_5(args)
+#define FORMAT_ARG_TYPES_7(a, args...) FORMAT_ARG_TYPE(a), FORMAT_ARG_TYPES_6(args)
+#define FORMAT_ARG_TYPES_8(a, args...) FORMAT_ARG_TYPE(a), FORMAT_ARG_TYPES_7(args)
+#define FORMAT_ARG_TYPES_9(a, args...) FORMAT_ARG_TYPE(a), FORMAT_ARG_TYPES_8(args)
+#define FORMAT_ARG_TYPES_10(a, args...) FORMAT_ARG_TYPE(a), FORMAT_ARG_TYPES_9(args)
+#define FORMAT_ARG_TYPES_11(a, args...) FORMAT_ARG_TYPE(a), FORMAT_ARG_TYPES_10(args)
+#define FORMAT_ARG_TYPES_12(a, args...) FORMAT_ARG_TYPE(a), FORMAT_ARG_TYPES_11(args)
+#define FORMAT_ARG_TYPES_13(a, args...) FORMAT_ARG_TYPE(a), FORMAT_ARG_TYPES_12(args)
+#define FORMAT_ARG_TYPES_14(a, args...) FORMAT_ARG_TYPE(a), FORMAT_ARG_TYPES_13(args)
+#define FORMAT_ARG_TYPES_15(a, args...) FORMAT_ARG_TYPE(a), FORMAT_ARG_TYPES_14(args)
+#define FORMAT_ARG_TYPES_16(a, args...) FORMAT_ARG_TYPE(a), FORMAT_ARG_TYPES_15(args)
+
+#define FORMAT_ARG_TYPES_MACRO(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, FUN, ...) FUN
+#define FORMAT_ARG_TYPES(args...) FORMAT_ARG_TYPES_MACRO(args,                          \
+    FORMAT_ARG_TYPES_16, FORMAT_ARG_TYPES_15, FORMAT_ARG_TYPES_14, FORMAT_ARG_TYPES_13, \
+    FORMAT_ARG_TYPES_12, FORMAT_ARG_TYPES_11, FORMAT_ARG_TYPES_10, FORMAT_ARG_TYPES_9,  \
+    FORMAT_ARG_TYPES_8, FORMAT_ARG_TYPES_7, FORMAT_ARG_TYPES_6, FORMAT_ARG_TYPES_5,     \
+    FORMAT_ARG_TYPES_4, FORMAT_ARG_TYPES_3, FORMAT_ARG_TYPES_2, FORMAT_ARG_TYPES_1)(args)
 
 // useful inline creators
 #define NEW_STRING_16(initValue)   NEW_STRING(16, initValue)
@@ -82,7 +179,8 @@ typedef enum StringToI64Status {
 BufferString *newStringWithLength(BufferString *str, const void *initValue, uint32_t initLength, char *buffer, uint32_t bufferLength);
 BufferString *newString(BufferString *str, const void *initValue, char *buffer, uint32_t bufferLength);
 BufferString *dubString(BufferString *source, BufferString *dest, char *buffer, uint32_t bufferLength);
-BufferString *stringFormat(BufferString *str, const char *format, ...);
+BufferString *stringFormat(BufferString *str, const char *format, ...);  // printf like, plus %S - BufferString, %I8..%I64/%U8..%U64 - fixed width ints, %D - shortest round trip double
+BufferString *stringFormatBySpec(BufferString *str, StringFormatSpec *spec, ...);  // parses format on each call like stringFormat() when arguments don't match spec conversions or ops can't be allocated
 
 // fill
 BufferString *concatCharsByLength(BufferString *str, const char *strToConcat, uint32_t length);
@@ -137,6 +235,7 @@ BufferString *repeatChars(BufferString *str, const char *repeatChars, uint32_t c
 // convert
 BufferString *int64ToString(BufferString *str, int64_t value);
 BufferString *uInt64ToString(BufferString *str, uint64_t value);
+BufferString *doubleToString(BufferString *str, double value);
 StringToI64Status stringToI64(BufferString *str, int64_t *out, int base);
 StringToI64Status cStrToInt64(const char *str, int64_t *out, int base);
 
@@ -170,7 +269,7 @@ static inline char charAt(BufferString *str, uint32_t index) {
 }
 
 static inline bool containsStr(BufferString *str, const char *searchString) {
-    return (str != NULL && searchString != NULL && strstr(str->value, searchString) != NULL);
+    return (str != NULL && searchString != NULL && findStrInRange(str->value, str->length, searchString, strlen(searchString)) != NULL);
 }
 
 static inline bool isCstrEmpty(const char *str) {
@@ -0,0 +1,392 @@
+#include "NumberFormat.h"
+
+#define DIY_FP_PRECISION 64
+#define DOUBLE_SIGNIFICAND_BITS 52
+#define DOUBLE_EXPONENT_BIAS (1023 + DOUBLE_SIGNIFICAND_BITS)
+#define DOUBLE_MIN_EXPONENT (1 - DOUBLE_EXPONENT_BIAS)
+#define DOUBLE_HIDDEN_BIT (1ULL << DOUBLE_SIGNIFICAND_BITS)
+#define DOUBLE_EXPONENT_MASK 0x7FFULL
+
+#define GRISU_ALPHA (-60)   // target exponent range for cached power product, see Loitsch "Printing Floating-Point Numbers Quickly and Accurately with Integers"
+#define GRISU_GAMMA (-32)
+#define CACHED_POWERS_MIN_DECIMAL_EXPONENT (-300)
+#define CACHED_POWERS_DECIMAL_STEP 8
+
+#define SHORTEST_MIN_DECIMAL_EXPONENT (-4)
+#define SHORTEST_MAX_DECIMAL_EXPONENT 15
+#define SHORTEST_DIGITS_BUFFER_SIZE 32
+
+typedef struct DiyFp {  // do it yourself floating point: f * 2^e
+    uint64_t f;
+    int32_t e;
+} DiyFp;
+
+typedef struct CachedPower {    // normalized 10^k as f * 2^e
+    uint64_t f;
+    int32_t e;
+    int32_t k;
+} CachedPower;
+
+static const char DIGIT_PAIRS[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+static const CachedPower CACHED_POWERS[] = {
+        {0xAB70FE17C79AC6CA, -1060, -300},
+        {0xFF77B1FCBEBCDC4F, -1034, -292},
+        {0xBE5691EF416BD60C, -1007, -284},
+        {0x8DD01FAD907FFC3C, -980, -276},
+        {0xD3515C2831559A83, -954, -268},
+        {0x9D71AC8FADA6C9B5, -927, -260},
+        {0xEA9C227723EE8BCB, -901, -252},
+        {0xAECC49914078536D, -874, -244},
+        {0x823C12795DB6CE57, -847, -236},
+        {0xC21094364DFB5637, -821, -228},
+        {0x9096EA6F3848984F, -794, -220},
+        {0xD77485CB25823AC7, -768, -212},
+        {0xA086CFCD97BF97F4, -741, -204},
+        {0xEF340A98172AACE5, -715, -196},
+        {0xB23867FB2A35B28E, -688, -188},
+        {0x84C8D4DFD2C63F3B, -661, -180},
+        {0xC5DD44271AD3CDBA, -635, -172},
+        {0x936B9FCEBB25C996, -608, -164},
+        {0xDBAC6C247D62A584, -582, -156},
+        {0xA3AB66580D5FDAF6, -555, -148},
+        {0xF3E2F893DEC3F126, -529, -140},
+        {0xB5B5ADA8AAFF80B8, -502, -132},
+        {0x87625F056C7C4A8B, -475, -124},
+        {0xC9BCFF6034C13053, -449, -116},
+        {0x964E858C91BA2655, -422, -108},
+        {0xDFF9772470297EBD, -396, -100},
+        {0xA6DFBD9FB8E5B88F, -369, -92},
+        {0xF8A95FCF88747D94, -343, -84},
+        {0xB94470938FA89BCF, -316, -76},
+        {0x8A08F0F8BF0F156B, -289, -68},
+        {0xCDB02555653131B6, -263, -60},
+        {0x993FE2C6D07B7FAC, -236, -52},
+        {0xE45C10C42A2B3B06, -210, -44},
+        {0xAA242499697392D3, -183, -36},
+        {0xFD87B5F28300CA0E, -157, -28},
+        {0xBCE5086492111AEB, -130, -20},
+        {0x8CBCCC096F5088CC, -103, -12},
+        {0xD1B71758E219652C, -77, -4},
+        {0x9C40000000000000, -50, 4},
+        {0xE8D4A51000000000, -24, 12},
+        {0xAD78EBC5AC620000, 3, 20},
+        {0x813F3978F8940984, 30, 28},
+        {0xC097CE7BC90715B3, 56, 36},
+        {0x8F7E32CE7BEA5C70, 83, 44},
+        {0xD5D238A4ABE98068, 109, 52},
+        {0x9F4F2726179A2245, 136, 60},
+        {0xED63A231D4C4FB27, 162, 68},
+        {0xB0DE65388CC8ADA8, 189, 76},
+        {0x83C7088E1AAB65DB, 216, 84},
+        {0xC45D1DF942711D9A, 242, 92},
+        {0x924D692CA61BE758, 269, 100},
+        {0xDA01EE641A708DEA, 295, 108},
+        {0xA26DA3999AEF774A, 322, 116},
+        {0xF209787BB47D6B85, 348, 124},
+        {0xB454E4A179DD1877, 375, 132},
+        {0x865B86925B9BC5C2, 402, 140},
+        {0xC83553C5C8965D3D, 428, 148},
+        {0x952AB45CFA97A0B3, 455, 156},
+        {0xDE469FBD99A05FE3, 481, 164},
+        {0xA59BC234DB398C25, 508, 172},
+        {0xF6C69A72A3989F5C, 534, 180},
+        {0xB7DCBF5354E9BECE, 561, 188},
+        {0x88FCF317F22241E2, 588, 196},
+        {0xCC20CE9BD35C78A5, 614, 204},
+        {0x98165AF37B2153DF, 641, 212},
+        {0xE2A0B5DC971F303A, 667, 220},
+        {0xA8D9D1535CE3B396, 694, 228},
+        {0xFB9B7CD9A4A7443C, 720, 236},
+        {0xBB764C4CA7A44410, 747, 244},
+        {0x8BAB8EEFB6409C1A, 774, 252},
+        {0xD01FEF10A657842C, 800, 260},
+        {0x9B10A4E5E9913129, 827, 268},
+        {0xE7109BFBA19C0C9D, 853, 276},
+        {0xAC2820D9623BF429, 880, 284},
+        {0x80444B5E7AA7CF85, 907, 292},
+        {0xBF21E44003ACDD2D, 933, 300},
+        {0x8E679C2F5E44FF8F, 960, 308},
+        {0xD433179D9C8CB841, 986, 316},
+        {0x9E19DB92B4E31BA9, 1013, 324},
+};
+
+static char *writeDecimalBackwards(uint64_t value, char *end);
+static uint32_t grisu2(double value, char *buffer, int32_t *decimalExponent);
+static uint32_t formatShortestDigits(char *buffer, uint32_t length, int32_t decimalExponent);
+static char *appendExponent(char *buffer, int32_t exponent);
+
+
+uint32_t uInt64ToDecimalChars(uint64_t value, char *buffer) {
+    char digits[UINT64_DECIMAL_MAX_LENGTH];
+    char *end = digits + UINT64_DECIMAL_MAX_LENGTH;
+    char *start = writeDecimalBackwards(value, end);
+    uint32_t length = end - start;
+    memcpy(buffer, start, length);
+    return length;
+}
+
+uint32_t uInt64ToCharsByBase(uint64_t value, char *buffer, uint8_t base, bool isLowerCase) {
+    if (base == 10) return uInt64ToDecimalChars(value, buffer);
+
+    const char *digitChars = isLowerCase ? "0123456789abcdef" : "0123456789ABCDEF";
+    uint8_t shift = (base == 16) ? 4 : (base == 8) ? 3 : 1;
+    uint8_t mask = (1 << shift) - 1;
+
+    char digits[UINT64_BINARY_MAX_LENGTH];
+    char *end = digits + UINT64_BINARY_MAX_LENGTH;
+    char *start = end;
+    do {
+        *--start = digitChars[value & mask];
+        value >>= shift;
+    } while (value > 0);
+
+    uint32_t length = end - start;
+    memcpy(buffer, start, length);
+    return length;
+}
+
+uint32_t doubleToShortestChars(double value, char *buffer) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    bool isNegative = (bits >> 63) != 0;
+    uint64_t exponentBits = (bits >> DOUBLE_SIGNIFICAND_BITS) & DOUBLE_EXPONENT_MASK;
+    uint64_t significand = bits & (DOUBLE_HIDDEN_BIT - 1);
+
+    char *start = buffer;
+    if (exponentBits == DOUBLE_EXPONENT_MASK) {    // NaN or infinity
+        if (significand != 0) {
+            memcpy(buffer, "nan", 3);
+            return 3;
+        }
+        if (isNegative) *buffer++ = '-';
+        memcpy(buffer, "inf", 3);
+        return (buffer - start) + 3;
+    }
+
+    if (isNegative) *buffer++ = '-';
+    if (exponentBits == 0 && significand == 0) {
+        memcpy(buffer, "0.0", 3);
+        return (buffer - start) + 3;
+    }
+
+    char digits[SHORTEST_DIGITS_BUFFER_SIZE];
+    int32_t decimalExponent = 0;
+    bits &= ~(1ULL << 63);   // digit generation works on absolute value
+    memcpy(&value, &bits, sizeof(bits));
+    uint32_t digitCount = grisu2(value, digits, &decimalExponent);
+    uint32_t length = formatShortestDigits(digits, digitCount, decimalExponent);
+    memcpy(buffer, digits, length);
+    return (buffer - start) + length;
+}
+
+static char *writeDecimalBackwards(uint64_t value, char *end) {
+    while (value > UINT32_MAX) {    // 64-bit division is a library call on 32-bit MCU, leave it as soon as value fits
+        uint32_t pairIndex = (uint32_t) (value % 100) * 2;
+        value /= 100;
+        end -= 2;
+        memcpy(end, DIGIT_PAIRS + pairIndex, 2);
+    }
+
+    uint32_t value32 = (uint32_t) value;
+    while (value32 >= 100) {
+        uint32_t pairIndex = (value32 % 100) * 2;
+        value32 /= 100;
+        end -= 2;
+        memcpy(end, DIGIT_PAIRS + pairIndex, 2);
+    }
+
+    if (value32 >= 10) {
+        end -= 2;
+        memcpy(end, DIGIT_PAIRS + value32 * 2, 2);
+    } else {
+        *--end = (char) ('0' + value32);
+    }
+    return end;
+}
+
+static inline DiyFp diyFpSub(DiyFp x, DiyFp y) {
+    return (DiyFp) {.f = x.f - y.f, .e = x.e};
+}
+
+static inline DiyFp diyFpMul(DiyFp x, DiyFp y) {  // upper 64 bits of 128-bit product, rounded
+    uint64_t xLow = x.f & UINT32_MAX;
+    uint64_t xHigh = x.f >> 32;
+    uint64_t yLow = y.f & UINT32_MAX;
+    uint64_t yHigh = y.f >> 32;
+
+    uint64_t lowLow = xLow * yLow;
+    uint64_t lowHigh = xLow * yHigh;
+    uint64_t highLow = xHigh * yLow;
+    uint64_t highHigh = xHigh * yHigh;
+
+    uint64_t middle = (lowLow >> 32) + (lowHigh & UINT32_MAX) + (highLow & UINT32_MAX);
+    middle += 1ULL << 31;
+    uint64_t high = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+    return (DiyFp) {.f = high, .e = x.e + y.e + DIY_FP_PRECISION};
+}
+
+static inline DiyFp diyFpNormalize(DiyFp x) {
+    int32_t shift = __builtin_clzll(x.f);
+    return (DiyFp) {.f = x.f << shift, .e = x.e - shift};
+}
+
+static inline DiyFp diyFpNormalizeTo(DiyFp x, int32_t targetExponent) {
+    return (DiyFp) {.f = x.f << (x.e - targetExponent), .e = targetExponent};
+}
+
+static inline const CachedPower *getCachedPowerForBinaryExponent(int32_t exponent) {
+    // k = ceil((alpha - e - 1) * log10(2)), 78913 / 2^18 approximates log10(2)
+    int32_t f = GRISU_ALPHA - exponent - 1;
+    int32_t k = (f * 78913) / (1 << 18) + (f > 0);
+    int32_t index = (-CACHED_POWERS_MIN_DECIMAL_EXPONENT + k + (CACHED_POWERS_DECIMAL_STEP - 1)) / CACHED_POWERS_DECIMAL_STEP;
+    return &CACHED_POWERS[index];
+}
+
+static inline uint32_t findLargestPow10(uint32_t number, uint32_t *pow10) {
+    static const uint32_t POWERS_OF_10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+    uint32_t digits = 10;
+    while (digits > 1 && number < POWERS_OF_10[digits - 1]) {
+        digits--;
+    }
+    *pow10 = POWERS_OF_10[digits - 1];
+    return digits;
+}
+
+static inline void grisu2Round(char *buffer, uint32_t length, uint64_t distance, uint64_t delta, uint64_t rest, uint64_t tenK) {
+    // move last digit closer to the exact value while it stays inside the rounding interval
+    while (rest < distance && delta - rest >= tenK && (rest + tenK < distance || distance - rest > rest + tenK - distance)) {
+        buffer[length - 1]--;
+        rest += tenK;
+    }
+}
+
+static uint32_t grisu2DigitGen(char *buffer, int32_t *decimalExponent, DiyFp minus, DiyFp w, DiyFp plus) {
+    uint64_t delta = diyFpSub(plus, minus).f;
+    uint64_t distance = diyFpSub(plus, w).f;
+    DiyFp one = {.f = 1ULL << -plus.e, .e = plus.e};
+
+    uint32_t integral = (uint32_t) (plus.f >> -one.e);
+    uint64_t fractional = plus.f & (one.f - 1);
+
+    uint32_t length = 0;
+    uint32_t pow10;
+    uint32_t remainingDigits = findLargestPow10(integral, &pow10);
+    while (remainingDigits > 0) {
+        uint32_t digit = integral / pow10;
+        integral %= pow10;
+        buffer[length++] = (char) ('0' + digit);
+        remainingDigits--;
+
+        uint64_t rest = ((uint64_t) integral << -one.e) + fractional;
+        if (rest <= delta) {
+            *decimalExponent += (int32_t) remainingDigits;
+            grisu2Round(buffer, length, distance, delta, rest, (uint64_t) pow10 << -one.e);
+            return length;
+        }
+        pow10 /= 10;
+    }
+
+    int32_t fractionalDigits = 0;
+    do {
+        fractional *= 10;
+        buffer[length++] = (char) ('0' + (fractional >> -one.e));
+        fractional &= one.f - 1;
+        fractionalDigits++;
+        delta *= 10;
+        distance *= 10;
+    } while (fractional > delta);
+
+    *decimalExponent -= fractionalDigits;
+    grisu2Round(buffer, length, distance, delta, fractional, one.f);
+    return length;
+}
+
+static uint32_t grisu2(double value, char *buffer, int32_t *decimalExponent) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint64_t exponentBits = bits >> DOUBLE_SIGNIFICAND_BITS;
+    uint64_t significand = bits & (DOUBLE_HIDDEN_BIT - 1);
+
+    DiyFp v = (exponentBits == 0) ?
+              (DiyFp) {.f = significand, .e = DOUBLE_MIN_EXPONENT} :    // subnormal
+              (DiyFp) {.f = significand + DOUBLE_HIDDEN_BIT, .e = (int32_t) exponentBits - DOUBLE_EXPONENT_BIAS};
+
+    // boundaries are half way to the neighbour doubles, lower one is closer when significand is a power of two
+    bool isLowerBoundaryCloser = significand == 0 && exponentBits > 1;
+    DiyFp plus = diyFpNormalize((DiyFp) {.f = 2 * v.f + 1, .e = v.e - 1});
+    DiyFp minus = isLowerBoundaryCloser ?
+                  (DiyFp) {.f = 4 * v.f - 1, .e = v.e - 2} :
+                  (DiyFp) {.f = 2 * v.f - 1, .e = v.e - 1};
+    minus = diyFpNormalizeTo(minus, plus.e);
+    DiyFp w = diyFpNormalize(v);
+
+    const CachedPower *cached = getCachedPowerForBinaryExponent(plus.e);
+    DiyFp cachedPower = {.f = cached->f, .e = cached->e};
+    DiyFp scaledW = diyFpMul(w, cachedPower);
+    DiyFp scaledMinus = diyFpMul(minus, cachedPower);
+    DiyFp scaledPlus = diyFpMul(plus, cachedPower);
+
+    scaledMinus.f++;    // shrink interval by one ulp to cover multiplication rounding errors
+    scaledPlus.f--;
+    *decimalExponent = -cached->k;
+    return grisu2DigitGen(buffer, decimalExponent, scaledMinus, scaledW, scaledPlus);
+}
+
+static uint32_t formatShortestDigits(char *buffer, uint32_t length, int32_t decimalExponent) {
+    int32_t digitCount = (int32_t) length;
+    int32_t pointPosition = digitCount + decimalExponent;   // value = 0.digits * 10^pointPosition
+    int32_t exponent = pointPosition - 1;                   // value = d.igits * 10^exponent
+
+    if (digitCount <= pointPosition && exponent <= SHORTEST_MAX_DECIMAL_EXPONENT) {    // digits[000].0
+        memset(buffer + digitCount, '0', pointPosition - digitCount);
+        buffer[pointPosition] = '.';
+        buffer[pointPosition + 1] = '0';
+        return pointPosition + 2;
+    }
+
+    if (0 < pointPosition && exponent <= SHORTEST_MAX_DECIMAL_EXPONENT) {    // dig.its
+        memmove(buffer + pointPosition + 1, buffer + pointPosition, digitCount - pointPosition);
+        buffer[pointPosition] = '.';
+        return digitCount + 1;
+    }
+
+    if (SHORTEST_MIN_DECIMAL_EXPONENT <= exponent && pointPosition <= 0) {    // 0.[000]digits
+        memmove(buffer + 2 - pointPosition, buffer, digitCount);
+        buffer[0] = '0';
+        buffer[1] = '.';
+        memset(buffer + 2, '0', -pointPosition);
+        return 2 - pointPosition + digitCount;
+    }
+
+    char *end = buffer + 1;
+    if (digitCount > 1) {   // d.igitse+123
+        memmove(buffer + 2, buffer + 1, digitCount - 1);
+        buffer[1] = '.';
+        end = buffer + digitCount + 1;
+    }
+    *end++ = 'e';
+    end = appendExponent(end, exponent);
+    return end - buffer;
+}
+
+static char *appendExponent(char *buffer, int32_t exponent) {   // sign and at least two digits, same as printf "%e"
+    *buffer++ = (exponent < 0) ? '-' : '+';
+    uint32_t absExponent = (exponent < 0) ? -exponent : exponent;
+    if (absExponent >= 100) {
+        *buffer++ = (char) ('0' + absExponent / 100);
+        absExponent %= 100;
+    }
+    memcpy(buffer, DIGIT_PAIRS + absExponent * 2, 2);
+    return buffer + 2;
+}
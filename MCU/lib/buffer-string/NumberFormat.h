@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// Digit generation used by stringFormat and number to string conversions. Output is not null terminated.
+// Decimal integers are written two digits per step from "00".."99" table, values that fit 32 bits skip 64-bit division.
+// Power of two bases use shift and mask instead of division.
+// Doubles are written as digit string that parses back to the same value (Grisu2), shortest one for all but ~0.1% of inputs.
+// No libm or float operations are used, so it works with ENABLE_FLOAT_FORMATTING disabled.
+
+#define UINT64_DECIMAL_MAX_LENGTH 20
+#define UINT64_BINARY_MAX_LENGTH 64
+#define DOUBLE_SHORTEST_MAX_LENGTH 25   // "-1.7976931348623157e+308" and spare
+
+uint32_t uInt64ToDecimalChars(uint64_t value, char *buffer);
+uint32_t uInt64ToCharsByBase(uint64_t value, char *buffer, uint8_t base, bool isLowerCase);   // base 2, 8, 10 or 16
+
+/*
+ * Same layout as JSON serializers: "1.5", "100.0", "0.001", "1e+16", "-2.5e-07".
+ * Decimal notation for exponents in [-4, 15], scientific otherwise. NaN and infinity are written as "nan", "inf", "-inf".
+ */
+uint32_t doubleToShortestChars(double value, char *buffer);
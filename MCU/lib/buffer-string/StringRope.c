@@ -0,0 +1,90 @@
+#include "StringRope.h"
+
+static StringRopeChunk *appendRopeChunk(StringRope *rope);
+
+
+StringRope *newStringRope(uint32_t chunkSize) {
+    StringRope *rope = malloc(sizeof(struct StringRope));
+    if (rope == NULL) return NULL;
+    *rope = EMPTY_STRING_ROPE(chunkSize > 0 ? chunkSize : STRING_ROPE_DEFAULT_CHUNK_SIZE);
+    return rope;
+}
+
+StringRope *ropeConcatCharsByLength(StringRope *rope, const char *value, uint32_t length) {
+    if (rope == NULL || value == NULL || rope->isOutOfMemory) return NULL;
+    if (rope->chunkSize == 0) {
+        rope->chunkSize = STRING_ROPE_DEFAULT_CHUNK_SIZE;
+    }
+
+    while (length > 0) {
+        StringRopeChunk *chunk = rope->tail;
+        if (chunk == NULL || chunk->length == rope->chunkSize) {
+            chunk = appendRopeChunk(rope);
+            if (chunk == NULL) return NULL;
+        }
+
+        uint32_t freeLength = rope->chunkSize - chunk->length;
+        uint32_t copyLength = length < freeLength ? length : freeLength;
+        memcpy(chunk->value + chunk->length, value, copyLength);
+        chunk->length += copyLength;
+        rope->length += copyLength;
+        value += copyLength;
+        length -= copyLength;
+    }
+    return rope;
+}
+
+StringRope *ropeConcatChars(StringRope *rope, const char *value) {
+    return value != NULL ? ropeConcatCharsByLength(rope, value, strlen(value)) : NULL;
+}
+
+StringRope *ropeConcatChar(StringRope *rope, char charToAdd) {
+    return ropeConcatCharsByLength(rope, &charToAdd, 1);
+}
+
+StringRope *ropeConcatString(StringRope *rope, BufferString *str) {
+    return str != NULL ? ropeConcatCharsByLength(rope, str->value, str->length) : NULL;
+}
+
+bool ropeForEachChunk(StringRope *rope, StringRopeChunkConsumer consumer, void *context) {
+    if (rope == NULL || consumer == NULL) return false;
+    for (StringRopeChunk *chunk = rope->head; chunk != NULL; chunk = chunk->next) {
+        if (!consumer(context, chunk->value, chunk->length)) return false;
+    }
+    return !rope->isOutOfMemory;
+}
+
+void clearStringRope(StringRope *rope) {
+    if (rope == NULL) return;
+    StringRopeChunk *chunk = rope->head;
+    while (chunk != NULL) {
+        StringRopeChunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    *rope = EMPTY_STRING_ROPE(rope->chunkSize);
+}
+
+void deleteStringRope(StringRope *rope) {
+    clearStringRope(rope);
+    free(rope);
+}
+
+static StringRopeChunk *appendRopeChunk(StringRope *rope) {
+    StringRopeChunk *chunk = malloc(sizeof(struct StringRopeChunk) + rope->chunkSize);
+    if (chunk == NULL) {
+        rope->isOutOfMemory = true;
+        return NULL;
+    }
+    chunk->next = NULL;
+    chunk->length = 0;
+
+    if (rope->tail != NULL) {
+        rope->tail->next = chunk;
+    } else {
+        rope->head = chunk;
+    }
+    rope->tail = chunk;
+    rope->chunkCount++;
+    return chunk;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "BufferString.h"
+
+// Segmented string builder: appends go into chain of fixed size heap chunks, already written bytes are never moved.
+// Use it for large generated output (directory listings, pages), when worst-case preallocation or realloc+copy is too costly.
+// Content is not null terminated and never flattened, read it chunk by chunk with ropeForEachChunk().
+
+#define STRING_ROPE_DEFAULT_CHUNK_SIZE 1024
+
+typedef struct StringRopeChunk {
+    struct StringRopeChunk *next;
+    uint32_t length;
+    char value[];
+} StringRopeChunk;
+
+typedef struct StringRope {
+    StringRopeChunk *head;
+    StringRopeChunk *tail;
+    uint32_t length;
+    uint32_t chunkSize;
+    uint32_t chunkCount;
+    bool isOutOfMemory;     // set when chunk allocation failed, further appends are ignored
+} StringRope;
+
+// Consumer receives chunks in order. Return false to stop iteration, e.g. when socket send failed.
+typedef bool (*StringRopeChunkConsumer)(void *context, const char *value, uint32_t length);
+
+#define EMPTY_STRING_ROPE(chunkSizeValue) ((StringRope) {.head = NULL, .tail = NULL, .length = 0, .chunkSize = (chunkSizeValue), .chunkCount = 0, .isOutOfMemory = false})
+
+StringRope *newStringRope(uint32_t chunkSize);
+
+StringRope *ropeConcatCharsByLength(StringRope *rope, const char *value, uint32_t length);
+StringRope *ropeConcatChars(StringRope *rope, const char *value);
+StringRope *ropeConcatChar(StringRope *rope, char charToAdd);
+StringRope *ropeConcatString(StringRope *rope, BufferString *str);
+
+// Returns false when consumer stopped iteration or rope failed to allocate some of its content
+bool ropeForEachChunk(StringRope *rope, StringRopeChunkConsumer consumer, void *context);
+
+void clearStringRope(StringRope *rope);     // free all chunks, rope can be reused
+void deleteStringRope(StringRope *rope);    // for ropes created by newStringRope()
+
+static inline bool isStringRopeEmpty(StringRope *rope) {
+    return rope == NULL || rope->length == 0;
+}
@@ -0,0 +1,111 @@
+#include "StringSearch.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#define HORSPOOL_ALPHABET_SIZE 256
+#define HORSPOOL_MAX_SHIFT UINT8_MAX
+
+#define SWAR_ONES ((size_t) -1 / UINT8_MAX)         // 0x01 in every byte
+#define SWAR_HIGHS (SWAR_ONES * 0x80)               // 0x80 in every byte
+#define SWAR_HAS_ZERO_BYTE(word) (((word) - SWAR_ONES) & ~(word) & SWAR_HIGHS)
+
+static const char *findCharSwar(const char *haystack, uint32_t length, char charToFind);
+static const char *findStrHorspool(const char *haystack, uint32_t haystackLength, const char *needle, uint32_t needleLength);
+
+
+const char *findCharInRange(const char *haystack, uint32_t length, char charToFind) {
+    if (haystack == NULL) return NULL;
+    uint32_t i = 0;
+
+#if defined(__AVX2__)
+    __m256i pattern256 = _mm256_set1_epi8(charToFind);
+    for (; i + sizeof(__m256i) <= length; i += sizeof(__m256i)) {
+        __m256i block = _mm256_loadu_si256((const __m256i *) (haystack + i));
+        uint32_t mask = (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, pattern256));
+        if (mask != 0) return haystack + i + __builtin_ctz(mask);
+    }
+#endif
+
+#if defined(__SSE2__)
+    __m128i pattern128 = _mm_set1_epi8(charToFind);
+    for (; i + sizeof(__m128i) <= length; i += sizeof(__m128i)) {
+        __m128i block = _mm_loadu_si128((const __m128i *) (haystack + i));
+        uint32_t mask = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(block, pattern128));
+        if (mask != 0) return haystack + i + __builtin_ctz(mask);
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    uint8x16_t pattern = vdupq_n_u8((uint8_t) charToFind);
+    for (; i + sizeof(uint8x16_t) <= length; i += sizeof(uint8x16_t)) {
+        uint8x16_t matches = vceqq_u8(vld1q_u8((const uint8_t *) (haystack + i)), pattern);
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0); // 4 bits per byte
+        if (mask != 0) return haystack + i + (__builtin_ctzll(mask) >> 2);
+    }
+#endif
+
+    return findCharSwar(haystack + i, length - i, charToFind);
+}
+
+const char *findStrInRange(const char *haystack, uint32_t haystackLength, const char *needle, uint32_t needleLength) {
+    if (haystack == NULL || needle == NULL || needleLength > haystackLength) return NULL;
+    if (needleLength == 0) return haystack;
+    if (needleLength == 1) return findCharInRange(haystack, haystackLength, needle[0]);
+
+    if (needleLength >= STRING_SEARCH_HORSPOOL_MIN_NEEDLE_LENGTH && haystackLength >= STRING_SEARCH_HORSPOOL_MIN_HAYSTACK_LENGTH) {
+        return findStrHorspool(haystack, haystackLength, needle, needleLength);
+    }
+
+    const char *searchPointer = haystack;
+    const char *lastCandidate = haystack + (haystackLength - needleLength);    // no match can start after this position
+    while (searchPointer <= lastCandidate) {
+        const char *candidate = findCharInRange(searchPointer, (lastCandidate - searchPointer) + 1, needle[0]);
+        if (candidate == NULL) return NULL;
+        if (memcmp(candidate + 1, needle + 1, needleLength - 1) == 0) return candidate;
+        searchPointer = candidate + 1;
+    }
+    return NULL;
+}
+
+static const char *findCharSwar(const char *haystack, uint32_t length, char charToFind) {
+    const char *end = haystack + length;
+    while (haystack < end && ((uintptr_t) haystack % sizeof(size_t)) != 0) {   // head bytes up to word alignment
+        if (*haystack == charToFind) return haystack;
+        haystack++;
+    }
+
+    size_t pattern = SWAR_ONES * (uint8_t) charToFind;
+    for (; haystack + sizeof(size_t) <= end; haystack += sizeof(size_t)) {
+        size_t word;
+        memcpy(&word, haystack, sizeof(size_t));    // aligned, compiles to single load
+        if (SWAR_HAS_ZERO_BYTE(word ^ pattern)) break;
+    }
+
+    for (; haystack < end; haystack++) {
+        if (*haystack == charToFind) return haystack;
+    }
+    return NULL;
+}
+
+static const char *findStrHorspool(const char *haystack, uint32_t haystackLength, const char *needle, uint32_t needleLength) {
+    uint8_t shiftTable[HORSPOOL_ALPHABET_SIZE];     // shifts are capped, smaller shift is always safe
+    uint8_t maxShift = needleLength < HORSPOOL_MAX_SHIFT ? needleLength : HORSPOOL_MAX_SHIFT;
+    memset(shiftTable, maxShift, sizeof(shiftTable));
+    for (uint32_t i = 0; i < needleLength - 1; i++) {
+        uint32_t shift = needleLength - 1 - i;
+        shiftTable[(uint8_t) needle[i]] = shift < HORSPOOL_MAX_SHIFT ? shift : HORSPOOL_MAX_SHIFT;
+    }
+
+    char lastNeedleChar = needle[needleLength - 1];
+    uint32_t position = 0;
+    while (position <= haystackLength - needleLength) {
+        char lastChar = haystack[position + needleLength - 1];
+        if (lastChar == lastNeedleChar && memcmp(haystack + position, needle, needleLength - 1) == 0) {
+            return haystack + position;
+        }
+        position += shiftTable[(uint8_t) lastChar];
+    }
+    return NULL;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Search primitives over explicit length ranges, no null terminator required.
+// Single char scan is word at a time (SWAR) on MCU targets, SSE2/AVX2/NEON is used when host compiler provides it.
+// Substring search verifies candidates found by first char scan, long needles switch to Boyer-Moore-Horspool.
+
+#ifndef STRING_SEARCH_HORSPOOL_MIN_NEEDLE_LENGTH
+#define STRING_SEARCH_HORSPOOL_MIN_NEEDLE_LENGTH 8
+#endif
+
+#ifndef STRING_SEARCH_HORSPOOL_MIN_HAYSTACK_LENGTH
+#define STRING_SEARCH_HORSPOOL_MIN_HAYSTACK_LENGTH 64
+#endif
+
+const char *findCharInRange(const char *haystack, uint32_t length, char charToFind);
+const char *findStrInRange(const char *haystack, uint32_t haystackLength, const char *needle, uint32_t needleLength);
+
+static inline bool isRangeEndsWith(const char *value, uint32_t length, const char *suffix, uint32_t suffixLength) {
+    return suffixLength <= length && memcmp(value + (length - suffixLength), suffix, suffixLength) == 0;
+}
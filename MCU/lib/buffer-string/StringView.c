@@ -0,0 +1,172 @@
+#include "StringView.h"
+
+#define STRING_VIEW_MAX_I64_DIGITS 72   // enough for sign, prefix and 64 binary digits
+
+static const char *findLastStrInRange(const char *haystack, uint32_t haystackLength, const char *needle, uint32_t needleLength);
+
+
+StringView stringViewOf(const char *str) {
+    return str != NULL ? stringViewOfLength(str, strlen(str)) : EMPTY_STRING_VIEW;
+}
+
+StringView stringViewOfLength(const char *str, uint32_t length) {
+    if (str == NULL) return EMPTY_STRING_VIEW;
+    StringView view = {.value = str, .length = length};
+    return view;
+}
+
+StringView stringViewOfBuffStr(BufferString *str) {
+    return str != NULL ? stringViewOfLength(str->value, str->length) : EMPTY_STRING_VIEW;
+}
+
+BufferString *stringViewToBuffStr(StringView view, BufferString *destination) {
+    return copyStringByLength(destination, view.value != NULL ? view.value : "", view.length);
+}
+
+int32_t stringViewCompare(StringView one, StringView two) {
+    uint32_t minLength = one.length < two.length ? one.length : two.length;
+    int32_t result = minLength > 0 ? memcmp(one.value, two.value, minLength) : 0;
+    if (result != 0) return result;
+    return one.length == two.length ? 0 : (one.length < two.length ? -1 : 1);
+}
+
+bool isStringViewEquals(StringView one, StringView two) {
+    return one.length == two.length && (one.length == 0 || memcmp(one.value, two.value, one.length) == 0);
+}
+
+bool isStringViewEqualsCstr(StringView view, const char *str) {
+    return str != NULL && isStringViewEquals(view, stringViewOf(str));
+}
+
+bool isStringViewEqualsIgnoreCase(StringView one, StringView two) {
+    return one.length == two.length && (one.length == 0 || strncasecmp(one.value, two.value, one.length) == 0);
+}
+
+bool isStringViewStartsWith(StringView view, const char *prefix) {
+    if (view.value == NULL || prefix == NULL) return false;
+    uint32_t prefixLength = strlen(prefix);
+    return prefixLength <= view.length && memcmp(view.value, prefix, prefixLength) == 0;
+}
+
+bool isStringViewEndsWith(StringView view, const char *suffix) {
+    if (view.value == NULL || suffix == NULL) return false;
+    return isRangeEndsWith(view.value, view.length, suffix, strlen(suffix));
+}
+
+int32_t stringViewIndexOfChar(StringView view, char charToFind, uint32_t fromIndex) {
+    if (view.value == NULL || fromIndex >= view.length) return -1;
+    const char *position = findCharInRange(view.value + fromIndex, view.length - fromIndex, charToFind);
+    return position != NULL ? (int32_t) (position - view.value) : -1;
+}
+
+int32_t stringViewIndexOf(StringView view, const char *stringToFind, uint32_t fromIndex) {
+    if (view.value == NULL || stringToFind == NULL || fromIndex > view.length) return -1;
+    const char *position = findStrInRange(view.value + fromIndex, view.length - fromIndex, stringToFind, strlen(stringToFind));
+    return position != NULL ? (int32_t) (position - view.value) : -1;
+}
+
+int32_t stringViewLastIndexOf(StringView view, const char *stringToFind) {
+    if (view.value == NULL || stringToFind == NULL) return -1;
+    const char *position = findLastStrInRange(view.value, view.length, stringToFind, strlen(stringToFind));
+    return position != NULL ? (int32_t) (position - view.value) : -1;
+}
+
+StringView stringViewSubstring(StringView view, uint32_t beginIndex, uint32_t endIndex) {
+    if (view.value == NULL || beginIndex > endIndex || endIndex > view.length) return EMPTY_STRING_VIEW;
+    return stringViewOfLength(view.value + beginIndex, endIndex - beginIndex);
+}
+
+StringView stringViewAfter(StringView view, const char *separator) {
+    int32_t index = stringViewIndexOf(view, separator, 0);
+    if (index < 0) return EMPTY_STRING_VIEW;
+    return stringViewSubstring(view, index + strlen(separator), view.length);
+}
+
+StringView stringViewAfterLast(StringView view, const char *separator) {
+    int32_t index = stringViewLastIndexOf(view, separator);
+    if (index < 0) return EMPTY_STRING_VIEW;
+    return stringViewSubstring(view, index + strlen(separator), view.length);
+}
+
+StringView stringViewBefore(StringView view, const char *separator) {
+    int32_t index = stringViewIndexOf(view, separator, 0);
+    return index >= 0 ? stringViewSubstring(view, 0, index) : EMPTY_STRING_VIEW;
+}
+
+StringView stringViewBeforeLast(StringView view, const char *separator) {
+    int32_t index = stringViewLastIndexOf(view, separator);
+    return index >= 0 ? stringViewSubstring(view, 0, index) : EMPTY_STRING_VIEW;
+}
+
+StringView stringViewBetween(StringView view, const char *open, const char *close) {
+    int32_t openIndex = stringViewIndexOf(view, open, 0);
+    if (openIndex < 0) return EMPTY_STRING_VIEW;
+    uint32_t beginIndex = openIndex + strlen(open);
+    int32_t closeIndex = stringViewIndexOf(view, close, beginIndex);
+    return closeIndex >= 0 ? stringViewSubstring(view, beginIndex, closeIndex) : EMPTY_STRING_VIEW;
+}
+
+StringView stringViewTrim(StringView view) {
+    if (view.value == NULL) return EMPTY_STRING_VIEW;
+    uint32_t beginIndex = 0;
+    uint32_t endIndex = view.length;
+    while (beginIndex < endIndex && isspace((int) view.value[beginIndex])) {
+        beginIndex++;
+    }
+    while (endIndex > beginIndex && isspace((int) view.value[endIndex - 1])) {
+        endIndex--;
+    }
+    return stringViewSubstring(view, beginIndex, endIndex);
+}
+
+StringViewIterator getStringViewSplitIterator(StringView view, const char *delimiter) {
+    StringViewIterator iterator = {
+            .source = view,
+            .delimiter = delimiter,
+            .delimiterLength = delimiter != NULL ? strlen(delimiter) : 0,
+            .nextToken = view.value
+    };
+    return iterator;
+}
+
+bool hasNextStringViewToken(StringViewIterator *iterator, StringView *token) {
+    if (iterator == NULL || iterator->nextToken == NULL || iterator->delimiterLength == 0 || token == NULL) return false;
+    const char *startPointer = iterator->nextToken;
+    uint32_t remainingLength = iterator->source.length - (startPointer - iterator->source.value);
+
+    const char *endPointer = findStrInRange(startPointer, remainingLength, iterator->delimiter, iterator->delimiterLength);
+    if (endPointer == NULL) {
+        iterator->nextToken = NULL;
+        if (startPointer != iterator->source.value) {   // last part only when source has at least one delimiter
+            *token = stringViewOfLength(startPointer, remainingLength);
+            return true;
+        }
+        return false;
+    }
+
+    *token = stringViewOfLength(startPointer, endPointer - startPointer);
+    iterator->nextToken = endPointer + iterator->delimiterLength;
+    return true;
+}
+
+StringToI64Status stringViewToI64(StringView view, int64_t *out, int base) {
+    if (isStringViewEmpty(view) || view.length >= STRING_VIEW_MAX_I64_DIGITS) return STR_TO_I64_INCONVERTIBLE;
+    char digits[STRING_VIEW_MAX_I64_DIGITS];    // strtoll needs terminated string, number fits on stack
+    memcpy(digits, view.value, view.length);
+    digits[view.length] = '\0';
+    return cStrToInt64(digits, out, base);
+}
+
+static const char *findLastStrInRange(const char *haystack, uint32_t haystackLength, const char *needle, uint32_t needleLength) {
+    if (needleLength > haystackLength) return NULL;
+    const char *lastMatch = NULL;
+    const char *searchPointer = haystack;
+    const char *end = haystack + haystackLength;
+    const char *match;
+    while ((match = findStrInRange(searchPointer, end - searchPointer, needle, needleLength)) != NULL) {
+        lastMatch = match;
+        if (match == end) break;   // empty needle
+        searchPointer = match + 1;
+    }
+    return lastMatch;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "BufferString.h"
+
+// Non owning read-only slice of a string: pointer + length, no null terminator and no copy.
+// View must not outlive the buffer it points to. Lookups that find nothing return empty view with NULL value.
+
+typedef struct StringView {
+    const char *value;
+    uint32_t length;
+} StringView;
+
+typedef struct StringViewIterator {
+    StringView source;
+    const char *delimiter;
+    uint32_t delimiterLength;
+    const char *nextToken;
+} StringViewIterator;
+
+#define EMPTY_STRING_VIEW ((StringView) {.value = NULL, .length = 0})
+#define STRING_VIEW_FORMAT "%.*s"   // printf support: printf(STRING_VIEW_FORMAT, STRING_VIEW_ARGS(view))
+#define STRING_VIEW_ARGS(view) (int) (view).length, (view).value
+
+// create
+StringView stringViewOf(const char *str);
+StringView stringViewOfLength(const char *str, uint32_t length);
+StringView stringViewOfBuffStr(BufferString *str);
+BufferString *stringViewToBuffStr(StringView view, BufferString *destination);
+
+// compare
+int32_t stringViewCompare(StringView one, StringView two);
+bool isStringViewEquals(StringView one, StringView two);
+bool isStringViewEqualsCstr(StringView view, const char *str);
+bool isStringViewEqualsIgnoreCase(StringView one, StringView two);
+bool isStringViewStartsWith(StringView view, const char *prefix);
+bool isStringViewEndsWith(StringView view, const char *suffix);
+
+// index
+int32_t stringViewIndexOfChar(StringView view, char charToFind, uint32_t fromIndex);
+int32_t stringViewIndexOf(StringView view, const char *stringToFind, uint32_t fromIndex);
+int32_t stringViewLastIndexOf(StringView view, const char *stringToFind);
+
+// slice
+StringView stringViewSubstring(StringView view, uint32_t beginIndex, uint32_t endIndex);
+StringView stringViewAfter(StringView view, const char *separator);
+StringView stringViewAfterLast(StringView view, const char *separator);
+StringView stringViewBefore(StringView view, const char *separator);
+StringView stringViewBeforeLast(StringView view, const char *separator);
+StringView stringViewBetween(StringView view, const char *open, const char *close);
+StringView stringViewTrim(StringView view);
+
+// split, same semantics as BufferString iterator: no tokens when source has no delimiter
+StringViewIterator getStringViewSplitIterator(StringView view, const char *delimiter);
+bool hasNextStringViewToken(StringViewIterator *iterator, StringView *token);
+
+// convert
+StringToI64Status stringViewToI64(StringView view, int64_t *out, int base);
+
+static inline bool isStringViewEmpty(StringView view) {
+    return view.value == NULL || view.length == 0;
+}
+
+static inline bool isStringViewNotEmpty(StringView view) {
+    return !isStringViewEmpty(view);
+}
+
+static inline char stringViewCharAt(StringView view, uint32_t index) {
+    return (char) (index < view.length ? view.value[index] : 0);
+}
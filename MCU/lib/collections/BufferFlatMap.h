@@ -0,0 +1,193 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Comparator.h"
+
+// Contiguous sorted map for read-mostly tables: fill with 'Add', then 'Freeze' once and only 'Get' afterwards.
+// Frozen map can be stored either in plain sorted order (ordered iteration) or in Eytzinger (BFS) order,
+// which keeps first search steps in the same cache lines and is faster for large tables.
+
+typedef enum FlatMapLayout {
+    FLAT_MAP_LAYOUT_SORTED,
+    FLAT_MAP_LAYOUT_EYTZINGER,
+} FlatMapLayout;
+
+#define FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME) KEY_NAME ## _ ## VALUE_NAME ## FlatMapEntry
+#define FLAT_MAP_TYPEDEF(KEY_NAME, VALUE_NAME) KEY_NAME ## _ ## VALUE_NAME ## FlatMap
+
+#define FLAT_MAP_METHOD_NAME_2(PREFIX, KEY_NAME, VALUE_NAME, POSTFIX) PREFIX ## _ ## KEY_NAME ## _ ## VALUE_NAME ## POSTFIX
+#define FLAT_MAP_METHOD_NAME_1(KEY_NAME, VALUE_NAME, POSTFIX) KEY_NAME ## _ ## VALUE_NAME ## POSTFIX
+#define FLAT_MAP_METHOD_MACRO(_1, _2, _3, _4, FUN, ...) FUN
+#define FLAT_MAP_METHOD(...)                                     \
+    FLAT_MAP_METHOD_MACRO(__VA_ARGS__,                           \
+                        FLAT_MAP_METHOD_NAME_2,                  \
+                        FLAT_MAP_METHOD_NAME_1,                  \
+                        ERROR)(__VA_ARGS__)                      \
+
+
+#define CREATE_FLAT_MAP_TYPE_NAME(KEY_TYPE, VALUE_TYPE, KEY_NAME, VALUE_NAME, COMPARE_FUN) \
+typedef struct FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME) { \
+    KEY_TYPE key;               \
+    VALUE_TYPE value;           \
+} FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME); \
+\
+typedef struct FLAT_MAP_TYPEDEF(KEY_NAME, VALUE_NAME) { \
+    FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME) *entries; \
+    uint32_t size;                  \
+    uint32_t capacity;              \
+    FlatMapLayout layout;           \
+    bool isFrozen;                  \
+} FLAT_MAP_TYPEDEF(KEY_NAME, VALUE_NAME); \
+\
+static inline int FLAT_MAP_METHOD(compare, KEY_NAME, VALUE_NAME, FlatMapEntry)(const void *a, const void *b) {  \
+    const FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME) *entryA = a;    \
+    const FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME) *entryB = b;    \
+    return COMPARE_FUN(entryA->key, entryB->key);                      \
+}                                                                       \
+\
+static inline FLAT_MAP_TYPEDEF(KEY_NAME, VALUE_NAME) * FLAT_MAP_METHOD(new, KEY_NAME, VALUE_NAME, BufferFlatMap)(FLAT_MAP_TYPEDEF(KEY_NAME, VALUE_NAME) *map, FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME) *entries, uint32_t capacity) { \
+    if (map == NULL || entries == NULL || capacity == 0) return NULL;  \
+    map->entries = entries;             \
+    map->size = 0;                      \
+    map->capacity = capacity;           \
+    map->layout = FLAT_MAP_LAYOUT_SORTED;   \
+    map->isFrozen = false;              \
+    return map;                         \
+}                                       \
+\
+static inline bool FLAT_MAP_METHOD(KEY_NAME, VALUE_NAME, FlatMapAdd)(FLAT_MAP_TYPEDEF(KEY_NAME, VALUE_NAME) *map, KEY_TYPE key, VALUE_TYPE value) {   \
+    if (map != NULL && !map->isFrozen && map->size < map->capacity) {   \
+        map->entries[map->size].key = key;          \
+        map->entries[map->size].value = value;      \
+        map->size++;                                \
+        return true;                                \
+    }                                               \
+    return false;                                   \
+}                                                   \
+\
+static inline uint32_t FLAT_MAP_METHOD(eytzinger, KEY_NAME, VALUE_NAME, FlatMapFill)(FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME) *dest, FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME) *sorted, uint32_t size, uint32_t sortedIndex, uint32_t node) {  \
+    if (node <= size) {                                                 \
+        sortedIndex = FLAT_MAP_METHOD(eytzinger, KEY_NAME, VALUE_NAME, FlatMapFill)(dest, sorted, size, sortedIndex, 2 * node);      \
+        dest[node - 1] = sorted[sortedIndex++];                         \
+        sortedIndex = FLAT_MAP_METHOD(eytzinger, KEY_NAME, VALUE_NAME, FlatMapFill)(dest, sorted, size, sortedIndex, 2 * node + 1);  \
+    }                                                                   \
+    return sortedIndex;                                                 \
+}                                                                       \
+\
+static inline bool FLAT_MAP_METHOD(KEY_NAME, VALUE_NAME, FlatMapFreeze)(FLAT_MAP_TYPEDEF(KEY_NAME, VALUE_NAME) *map, FlatMapLayout layout) {   \
+    if (map == NULL || map->isFrozen) return false;         \
+    qsort(map->entries, map->size, sizeof(FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME)), FLAT_MAP_METHOD(compare, KEY_NAME, VALUE_NAME, FlatMapEntry)); \
+                                                            \
+    uint32_t uniqueCount = 0;   /* duplicate keys collapse into a single entry */     \
+    for (uint32_t i = 0; i < map->size; i++) {              \
+        if (uniqueCount == 0 || COMPARE_FUN(map->entries[uniqueCount - 1].key, map->entries[i].key) != 0) {    \
+            map->entries[uniqueCount++] = map->entries[i];  \
+        }                                                   \
+    }                                                       \
+    map->size = uniqueCount;                                \
+                                                            \
+    if (layout == FLAT_MAP_LAYOUT_EYTZINGER && map->size > 1) {     \
+        FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME) *sorted = malloc(sizeof(FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME)) * map->size);   \
+        if (sorted == NULL) return false;                   \
+        memcpy(sorted, map->entries, sizeof(FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME)) * map->size);   \
+        FLAT_MAP_METHOD(eytzinger, KEY_NAME, VALUE_NAME, FlatMapFill)(map->entries, sorted, map->size, 0, 1);    \
+        free(sorted);                                       \
+    }                                                       \
+    map->layout = layout;                                   \
+    map->isFrozen = true;                                   \
+    return true;                                            \
+}                                                           \
+\
+static inline FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME) * FLAT_MAP_METHOD(find, KEY_NAME, VALUE_NAME, FlatMapEntry)(FLAT_MAP_TYPEDEF(KEY_NAME, VALUE_NAME) *map, KEY_TYPE key) { \
+    if (map == NULL || !map->isFrozen || map->size == 0) return NULL;  \
+    FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME) *entries = map->entries;  \
+                                                                \
+    if (map->layout == FLAT_MAP_LAYOUT_EYTZINGER) {             \
+        uint32_t node = 1;                                      \
+        while (node <= map->size) {                             \
+            node = 2 * node + (COMPARE_FUN(entries[node - 1].key, key) < 0);   \
+        }                                                       \
+        node >>= __builtin_ffs(~node);  /* climb back to the last node where search turned left */ \
+        return (node != 0 && COMPARE_FUN(entries[node - 1].key, key) == 0) ? &entries[node - 1] : NULL;   \
+    }                                                           \
+                                                                \
+    FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME) *base = entries;  \
+    uint32_t length = map->size;                                \
+    while (length > 1) {    /* branchless lower bound, loop trip count depends only on size */   \
+        uint32_t half = length / 2;                             \
+        base = (COMPARE_FUN(base[half - 1].key, key) < 0) ? base + half : base;   \
+        length -= half;                                         \
+    }                                                           \
+    return COMPARE_FUN(base->key, key) == 0 ? base : NULL;      \
+}                                                               \
+\
+static inline VALUE_TYPE FLAT_MAP_METHOD(KEY_NAME, VALUE_NAME, FlatMapGet)(FLAT_MAP_TYPEDEF(KEY_NAME, VALUE_NAME) *map, KEY_TYPE key) {    \
+    FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME) *entry = FLAT_MAP_METHOD(find, KEY_NAME, VALUE_NAME, FlatMapEntry)(map, key);  \
+    return entry != NULL ? entry->value : (VALUE_TYPE) {0};     \
+}                                   \
+\
+static inline VALUE_TYPE FLAT_MAP_METHOD(KEY_NAME, VALUE_NAME, FlatMapGetOrDefault)(FLAT_MAP_TYPEDEF(KEY_NAME, VALUE_NAME) *map, KEY_TYPE key, VALUE_TYPE defaultValue) { \
+    FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME) *entry = FLAT_MAP_METHOD(find, KEY_NAME, VALUE_NAME, FlatMapEntry)(map, key);  \
+    return entry != NULL ? entry->value : defaultValue;         \
+}                                   \
+\
+static inline bool FLAT_MAP_METHOD(KEY_NAME, VALUE_NAME, FlatMapContains)(FLAT_MAP_TYPEDEF(KEY_NAME, VALUE_NAME) *map, KEY_TYPE key) {    \
+    return FLAT_MAP_METHOD(find, KEY_NAME, VALUE_NAME, FlatMapEntry)(map, key) != NULL;  \
+}                                   \
+\
+static inline uint32_t FLAT_MAP_METHOD(KEY_NAME, VALUE_NAME, FlatMapSize)(FLAT_MAP_TYPEDEF(KEY_NAME, VALUE_NAME) *map) {  \
+    return map != NULL ? map->size : 0; \
+}                                   \
+\
+static inline bool FLAT_MAP_METHOD(is, KEY_NAME, VALUE_NAME, FlatMapEmpty)(FLAT_MAP_TYPEDEF(KEY_NAME, VALUE_NAME) *map) {  \
+    return map != NULL ? map->size == 0 : true; \
+}                                   \
+\
+static inline bool FLAT_MAP_METHOD(is, KEY_NAME, VALUE_NAME, FlatMapFrozen)(FLAT_MAP_TYPEDEF(KEY_NAME, VALUE_NAME) *map) {  \
+    return map != NULL && map->isFrozen; \
+}                                   \
+
+
+#define CREATE_FLAT_MAP_TYPE_1(KEY_TYPE, VALUE_TYPE) CREATE_FLAT_MAP_TYPE_NAME(KEY_TYPE, VALUE_TYPE, KEY_TYPE, VALUE_TYPE, COMPARATOR_FOR_TYPE(KEY_TYPE))
+#define CREATE_FLAT_MAP_TYPE_2(KEY_TYPE, VALUE_TYPE, KEY_NAME) CREATE_FLAT_MAP_TYPE_NAME(KEY_TYPE, VALUE_TYPE, KEY_NAME, VALUE_TYPE, COMPARATOR_FOR_TYPE(KEY_TYPE))
+#define CREATE_FLAT_MAP_TYPE_3(KEY_TYPE, VALUE_TYPE, KEY_NAME, VALUE_NAME) CREATE_FLAT_MAP_TYPE_NAME(KEY_TYPE, VALUE_TYPE, KEY_NAME, VALUE_NAME, COMPARATOR_FOR_TYPE(KEY_TYPE))
+#define CREATE_FLAT_MAP_TYPE_4(KEY_TYPE, VALUE_TYPE, KEY_NAME, VALUE_NAME, COMPARE_FUN) CREATE_FLAT_MAP_TYPE_NAME(KEY_TYPE, VALUE_TYPE, KEY_NAME, VALUE_NAME, COMPARE_FUN)
+#define CREATE_FLAT_MAP_TYPE_MACRO(_1, _2, _3, _4, _5, FUN, ...) FUN
+
+#define CREATE_FLAT_MAP_TYPE(...)                                     \
+    CREATE_FLAT_MAP_TYPE_MACRO(__VA_ARGS__,                           \
+                        CREATE_FLAT_MAP_TYPE_4,                       \
+                        CREATE_FLAT_MAP_TYPE_3,                       \
+                        CREATE_FLAT_MAP_TYPE_2,                       \
+                        CREATE_FLAT_MAP_TYPE_1,                       \
+                        ERROR)(__VA_ARGS__)
+
+
+#define NEW_FLAT_MAP_3(KEY_TYPE, VALUE_TYPE, KEY_NAME, VALUE_NAME, CAPACITY) \
+FLAT_MAP_METHOD(new, KEY_NAME, VALUE_NAME, BufferFlatMap)(&(FLAT_MAP_TYPEDEF(KEY_NAME, VALUE_NAME)){0}, \
+                                                           (FLAT_MAP_ENTRY_TYPEDEF(KEY_NAME, VALUE_NAME) [CAPACITY]){0}, \
+                                                            CAPACITY)
+#define NEW_FLAT_MAP_2(KEY_TYPE, VALUE_TYPE, KEY_NAME, CAPACITY) NEW_FLAT_MAP_3(KEY_TYPE, VALUE_TYPE, KEY_NAME, VALUE_TYPE, CAPACITY)
+#define NEW_FLAT_MAP_1(KEY_TYPE, VALUE_TYPE, CAPACITY) NEW_FLAT_MAP_3(KEY_TYPE, VALUE_TYPE, KEY_TYPE, VALUE_TYPE, CAPACITY)
+#define NEW_FLAT_MAP_MACRO(_1, _2, _3, _4, _5, FUN, ...) FUN
+
+#define NEW_FLAT_MAP(...)                                     \
+    NEW_FLAT_MAP_MACRO(__VA_ARGS__,                           \
+                        NEW_FLAT_MAP_3,                       \
+                        NEW_FLAT_MAP_2,                       \
+                        NEW_FLAT_MAP_1,                       \
+                        ERROR)(__VA_ARGS__)
+
+#define NEW_FLAT_MAP_BUFF(KEY_NAME, VALUE_NAME, BUFFER, CAPACITY) FLAT_MAP_METHOD(new, KEY_NAME, VALUE_NAME, BufferFlatMap)(&(FLAT_MAP_TYPEDEF(KEY_NAME, VALUE_NAME)){0}, BUFFER, CAPACITY)
+
+#define NEW_FLAT_MAP_4(...)    NEW_FLAT_MAP(__VA_ARGS__, 4)
+#define NEW_FLAT_MAP_8(...)    NEW_FLAT_MAP(__VA_ARGS__, 8)
+#define NEW_FLAT_MAP_16(...)   NEW_FLAT_MAP(__VA_ARGS__, 16)
+#define NEW_FLAT_MAP_32(...)   NEW_FLAT_MAP(__VA_ARGS__, 32)
+#define NEW_FLAT_MAP_64(...)   NEW_FLAT_MAP(__VA_ARGS__, 64)
+#define NEW_FLAT_MAP_128(...)  NEW_FLAT_MAP(__VA_ARGS__, 128)
+#define NEW_FLAT_MAP_256(...)  NEW_FLAT_MAP(__VA_ARGS__, 256)
+#define NEW_FLAT_MAP_512(...)  NEW_FLAT_MAP(__VA_ARGS__, 512)
+#define NEW_FLAT_MAP_1024(...) NEW_FLAT_MAP(__VA_ARGS__, 1024)
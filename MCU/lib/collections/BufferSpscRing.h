@@ -0,0 +1,167 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "Comparator.h"
+
+// Lock-free single-producer/single-consumer ring over a caller supplied buffer.
+// Exactly one task (or ISR) may push and exactly one task may pop, no mutex is needed between them.
+// Head and tail are free running counters, capacity must be a power of two so index wrap is a mask.
+
+#ifndef SPSC_RING_CACHE_LINE_SIZE
+    #define SPSC_RING_CACHE_LINE_SIZE 64
+#endif
+
+#ifndef MIN
+    #define MIN(x, y) (((x)<(y))?(x):(y))
+#endif
+
+#define SPSC_RING_IS_POW_OF_2(val) ((val) != 0 && (((val) & ((val) - 1)) == 0))
+
+#define SPSC_RING_TYPEDEF(NAME) NAME ##SpscRing
+#define SPSC_RING_METHOD_NAME_2(PREFIX, NAME, POSTFIX) PREFIX ## NAME ## SpscRing ## POSTFIX
+#define SPSC_RING_METHOD_NAME_1(NAME, POSTFIX) NAME ## SpscRing ## POSTFIX
+
+#define SPSC_RING_METHOD_MACRO(_1, _2, _3, FUN, ...) FUN
+#define SPSC_RING_METHOD(...)                                     \
+    SPSC_RING_METHOD_MACRO(__VA_ARGS__,                           \
+                        SPSC_RING_METHOD_NAME_2,                  \
+                        SPSC_RING_METHOD_NAME_1,                  \
+                        ERROR)(__VA_ARGS__)                       \
+
+
+#define CREATE_SPSC_RING_TYPE_NAME(TYPE, NAME) \
+typedef struct SPSC_RING_TYPEDEF(NAME) {                                \
+    _Alignas(SPSC_RING_CACHE_LINE_SIZE) atomic_uint_fast32_t head;      \
+    uint32_t tailCache;     /* consumer side copy of tail */            \
+    _Alignas(SPSC_RING_CACHE_LINE_SIZE) atomic_uint_fast32_t tail;      \
+    uint32_t headCache;     /* producer side copy of head */            \
+    _Alignas(SPSC_RING_CACHE_LINE_SIZE) TYPE *items;                    \
+    uint32_t capacity;                                                  \
+    uint32_t mask;                                                      \
+} SPSC_RING_TYPEDEF(NAME);                                              \
+\
+static inline SPSC_RING_TYPEDEF(NAME) * new ## NAME ## BuffSpscRing(SPSC_RING_TYPEDEF(NAME) *ring, TYPE *buffer, uint32_t capacity) { \
+    if (ring == NULL || buffer == NULL || !SPSC_RING_IS_POW_OF_2(capacity)) return NULL;  \
+    atomic_init(&ring->head, 0);                            \
+    atomic_init(&ring->tail, 0);                            \
+    ring->tailCache = 0;                                    \
+    ring->headCache = 0;                                    \
+    ring->items = buffer;                                   \
+    ring->capacity = capacity;                              \
+    ring->mask = capacity - 1;                              \
+    return ring;                                            \
+}                                      \
+\
+static inline bool SPSC_RING_METHOD(NAME, Push)(SPSC_RING_TYPEDEF(NAME) *ring, TYPE item) { \
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);     \
+    if ((tail - ring->headCache) == ring->capacity) {                           \
+        ring->headCache = atomic_load_explicit(&ring->head, memory_order_acquire);  \
+        if ((tail - ring->headCache) == ring->capacity) return false;           \
+    }                                                                           \
+    ring->items[tail & ring->mask] = item;                                      \
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);         \
+    return true;                                                                \
+}                                      \
+\
+static inline uint32_t SPSC_RING_METHOD(NAME, PushN)(SPSC_RING_TYPEDEF(NAME) *ring, TYPE *array, uint32_t length) { \
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);     \
+    uint32_t freeSlots = ring->capacity - (tail - ring->headCache);                  \
+    if (freeSlots < length) {                                                        \
+        ring->headCache = atomic_load_explicit(&ring->head, memory_order_acquire);  \
+        freeSlots = ring->capacity - (tail - ring->headCache);                       \
+    }                                                                           \
+    uint32_t count = MIN(length, freeSlots);                                         \
+    if (count == 0) return 0;                                                   \
+                                                                                \
+    uint32_t offset = tail & ring->mask;                                        \
+    uint32_t firstPart = MIN(count, ring->capacity - offset);                   \
+    memcpy(&ring->items[offset], array, sizeof(TYPE) * firstPart);              \
+    memcpy(ring->items, &array[firstPart], sizeof(TYPE) * (count - firstPart)); \
+    atomic_store_explicit(&ring->tail, tail + count, memory_order_release);     \
+    return count;                                                               \
+}                                      \
+\
+static inline bool SPSC_RING_METHOD(NAME, Pop)(SPSC_RING_TYPEDEF(NAME) *ring, TYPE *item) { \
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);     \
+    if (head == ring->tailCache) {                                              \
+        ring->tailCache = atomic_load_explicit(&ring->tail, memory_order_acquire);  \
+        if (head == ring->tailCache) return false;                              \
+    }                                                                           \
+    *item = ring->items[head & ring->mask];                                     \
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);         \
+    return true;                                                                \
+}                                      \
+\
+static inline uint32_t SPSC_RING_METHOD(NAME, PopN)(SPSC_RING_TYPEDEF(NAME) *ring, TYPE *array, uint32_t length) { \
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);     \
+    uint32_t available = ring->tailCache - head;                                \
+    if (available < length) {                                                   \
+        ring->tailCache = atomic_load_explicit(&ring->tail, memory_order_acquire);  \
+        available = ring->tailCache - head;                                     \
+    }                                                                           \
+    uint32_t count = MIN(length, available);                                    \
+    if (count == 0) return 0;                                                   \
+                                                                                \
+    uint32_t offset = head & ring->mask;                                        \
+    uint32_t firstPart = MIN(count, ring->capacity - offset);                   \
+    memcpy(array, &ring->items[offset], sizeof(TYPE) * firstPart);              \
+    memcpy(&array[firstPart], ring->items, sizeof(TYPE) * (count - firstPart)); \
+    atomic_store_explicit(&ring->head, head + count, memory_order_release);     \
+    return count;                                                               \
+}                                      \
+\
+static inline uint32_t SPSC_RING_METHOD(NAME, Size)(SPSC_RING_TYPEDEF(NAME) *ring) { \
+    if (ring == NULL) return 0;                                                 \
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);     \
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);     \
+    return tail - head;                                                         \
+}                                      \
+\
+static inline bool SPSC_RING_METHOD(is, NAME, Empty)(SPSC_RING_TYPEDEF(NAME) *ring) {  \
+    return SPSC_RING_METHOD(NAME, Size)(ring) == 0;     \
+}                                      \
+\
+static inline bool SPSC_RING_METHOD(is, NAME, NotEmpty)(SPSC_RING_TYPEDEF(NAME) *ring) {   \
+    return !SPSC_RING_METHOD(is, NAME, Empty)(ring);    \
+}                                      \
+\
+static inline bool SPSC_RING_METHOD(is, NAME, Full)(SPSC_RING_TYPEDEF(NAME) *ring) {  \
+    return ring != NULL && SPSC_RING_METHOD(NAME, Size)(ring) >= ring->capacity;    \
+}                                      \
+
+
+#define CREATE_SPSC_RING_TYPE_1(TYPE) CREATE_SPSC_RING_TYPE_NAME(TYPE, TYPE)
+#define CREATE_SPSC_RING_TYPE_2(TYPE, NAME) CREATE_SPSC_RING_TYPE_NAME(TYPE, NAME)
+#define CREATE_SPSC_RING_TYPE_MACRO(_1, _2, FUN, ...) FUN
+#define CREATE_SPSC_RING_TYPE(...)                                     \
+    CREATE_SPSC_RING_TYPE_MACRO(__VA_ARGS__,                           \
+                        CREATE_SPSC_RING_TYPE_2,                       \
+                        CREATE_SPSC_RING_TYPE_1,                       \
+                        ERROR)(__VA_ARGS__)
+
+
+#define NEW_SPSC_RING_2(TYPE, NAME, CAPACITY) new ## NAME ## BuffSpscRing(&(SPSC_RING_TYPEDEF(NAME)){0}, \
+                                                                            (TYPE [NEXT_POW_OF_2(CAPACITY)]){0}, \
+                                                                            NEXT_POW_OF_2(CAPACITY))
+#define NEW_SPSC_RING_1(TYPE, CAPACITY) NEW_SPSC_RING_2(TYPE, TYPE, CAPACITY)
+#define NEW_SPSC_RING_MACRO(_1, _2, _3, FUN, ...) FUN
+#define NEW_SPSC_RING(...)                                     \
+    NEW_SPSC_RING_MACRO(__VA_ARGS__,                           \
+                        NEW_SPSC_RING_2,                       \
+                        NEW_SPSC_RING_1,                       \
+                        ERROR)(__VA_ARGS__)
+
+#define NEW_SPSC_RING_BUFF(TYPE, NAME, BUFFER, SIZE) new ## NAME ## BuffSpscRing(&(SPSC_RING_TYPEDEF(NAME)){0}, BUFFER, SIZE)
+
+#define NEW_SPSC_RING_4(...)    NEW_SPSC_RING(__VA_ARGS__, 4)
+#define NEW_SPSC_RING_8(...)    NEW_SPSC_RING(__VA_ARGS__, 8)
+#define NEW_SPSC_RING_16(...)   NEW_SPSC_RING(__VA_ARGS__, 16)
+#define NEW_SPSC_RING_32(...)   NEW_SPSC_RING(__VA_ARGS__, 32)
+#define NEW_SPSC_RING_64(...)   NEW_SPSC_RING(__VA_ARGS__, 64)
+#define NEW_SPSC_RING_128(...)  NEW_SPSC_RING(__VA_ARGS__, 128)
+#define NEW_SPSC_RING_256(...)  NEW_SPSC_RING(__VA_ARGS__, 256)
+#define NEW_SPSC_RING_512(...)  NEW_SPSC_RING(__VA_ARGS__, 512)
+#define NEW_SPSC_RING_1024(...) NEW_SPSC_RING(__VA_ARGS__, 1024)
@@ -2,8 +2,13 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "Comparator.h"
 
+#ifndef MIN
+    #define MIN(x, y) (((x)<(y))?(x):(y))
+#endif
+
 #define VECTOR_TYPEDEF(NAME) NAME ##Vector
 #define VECTOR_METHOD_NAME_2(PREFIX, NAME, POSTFIX) PREFIX ## NAME ## Vec ## POSTFIX
 #define VECTOR_METHOD_NAME_1(NAME, POSTFIX) NAME ## Vec ## POSTFIX
@@ -71,13 +76,11 @@ static inline bool VECTOR_METHOD(NAME, Put)(VECTOR_TYPEDEF(NAME) *vector, uint32
 }                                      \
 \
 static inline bool VECTOR_METHOD(NAME, AddAt)(VECTOR_TYPEDEF(NAME) *vector, uint32_t index, TYPE item) { \
-    if (vector != NULL && index < vector->capacity) {               \
+    if (vector != NULL && index <= vector->size) {                  \
         if ((vector->size + 1) > vector->capacity) {                \
             return false;                                           \
         }                                                           \
-        for (uint32_t i = vector->size; i > index; i--) {           \
-            vector->items[i] = vector->items[i - 1];                \
-        }                                                           \
+        memmove(&vector->items[index + 1], &vector->items[index], sizeof(TYPE) * (vector->size - index));   \
         vector->items[index] = item;                                \
         vector->size++;                                             \
         return true;                                                \
@@ -86,17 +89,37 @@ static inline bool VECTOR_METHOD(NAME, AddAt)(VECTOR_TYPEDEF(NAME) *vector, uint
 }                                      \
 \
 static inline TYPE VECTOR_METHOD(NAME, RemoveAt)(VECTOR_TYPEDEF(NAME) *vector, uint32_t index) {    \
-    if (vector != NULL && index < vector->capacity) {                       \
+    if (vector != NULL && index < vector->size) {                           \
         TYPE item = vector->items[index];                                   \
-        for (uint32_t i = index + 1; i < vector->size; i++) {               \
-            vector->items[i - 1] = vector->items[i];                        \
-        }                                                                   \
+        memmove(&vector->items[index], &vector->items[index + 1], sizeof(TYPE) * (vector->size - index - 1));   \
         vector->size--;                                                     \
         return item;                                                        \
     }                                                                       \
     return (TYPE) {0};                                          \
 }                                      \
 \
+static inline bool VECTOR_METHOD(NAME, InsertRange)(VECTOR_TYPEDEF(NAME) *vector, uint32_t index, TYPE *array, uint32_t length) {   \
+    if (vector == NULL || index > vector->size || (array == NULL && length > 0)) return false;  \
+    if (length > (vector->capacity - vector->size)) return false;   \
+    memmove(&vector->items[index + length], &vector->items[index], sizeof(TYPE) * (vector->size - index));  \
+    memcpy(&vector->items[index], array, sizeof(TYPE) * length);   \
+    vector->size += length;                                         \
+    return true;                                                    \
+}                                      \
+\
+static inline bool VECTOR_METHOD(NAME, AddRange)(VECTOR_TYPEDEF(NAME) *vector, TYPE *array, uint32_t length) {   \
+    return vector != NULL && VECTOR_METHOD(NAME, InsertRange)(vector, vector->size, array, length);  \
+}                                      \
+\
+static inline bool VECTOR_METHOD(NAME, EraseRange)(VECTOR_TYPEDEF(NAME) *vector, uint32_t fromIndex, uint32_t toIndex) {   \
+    if (vector == NULL || fromIndex > toIndex || toIndex > vector->size) return false;  \
+    uint32_t erased = toIndex - fromIndex;                          \
+    memmove(&vector->items[fromIndex], &vector->items[toIndex], sizeof(TYPE) * (vector->size - toIndex));   \
+    memset(&vector->items[vector->size - erased], 0, sizeof(TYPE) * erased);   \
+    vector->size -= erased;                                         \
+    return true;                                                    \
+}                                      \
+\
 static inline bool VECTOR_METHOD(is, NAME, Empty)(VECTOR_TYPEDEF(NAME) *vector) {  \
     return (vector == NULL) || (vector->size == 0);     \
 }                                      \
@@ -111,30 +134,19 @@ static inline uint32_t VECTOR_METHOD(NAME, Size)(VECTOR_TYPEDEF(NAME) *vector) {
 \
 static inline void VECTOR_METHOD(NAME, Clear)(VECTOR_TYPEDEF(NAME) *vector) {   \
     if (vector != NULL) {                               \
-        for (uint32_t i = 0; i < vector->size; i++) {   \
-            vector->items[i] = (TYPE) {0};              \
-        }                                               \
+        memset(vector->items, 0, sizeof(TYPE) * vector->size);  \
         vector->size = 0;                               \
     }                                                   \
 }                                      \
 \
 static inline bool VECTOR_METHOD(NAME, AddAll)(VECTOR_TYPEDEF(NAME) *vecDest, VECTOR_TYPEDEF(NAME) *vecSource) { \
     if (vecDest == NULL || vecSource == NULL) return false; \
-    for (uint32_t i = 0; i < vecSource->size; i++) {        \
-        TYPE item = VECTOR_METHOD(NAME, Get)(vecSource, i);        \
-        if (!VECTOR_METHOD(NAME, Add)(vecDest, item)) {            \
-            return false;                                   \
-        }                                                   \
-    }                                                       \
-    return true;                                            \
+    return VECTOR_METHOD(NAME, AddRange)(vecDest, vecSource->items, vecSource->size);  \
 }                                           \
 \
 static inline VECTOR_TYPEDEF(NAME) * VECTOR_METHOD(NAME, FromArray)(VECTOR_TYPEDEF(NAME) *vector, TYPE array[], uint32_t length) {  \
-    for (uint32_t i = 0; i < length; i++) {             \
-        if (!VECTOR_METHOD(NAME, Add)(vector, array[i])) {     \
-            return vector;                              \
-        }                                               \
-    }                                                   \
+    if (vector == NULL) return vector;                  \
+    VECTOR_METHOD(NAME, AddRange)(vector, array, MIN(length, vector->capacity - vector->size));  \
     return vector;                                      \
 }                                           \
 \
@@ -6,18 +6,18 @@ static uint32_t hashCode(const char *key);
 static bool adjustHashMapCapacity(HashMap hashMap, uint32_t capacity);
 
 
+#define IS_HASH_MAP_INLINE_STORAGE(hashMap) ((hashMap)->entries == (hashMap)->inlineEntries)
+
+
 HashMap getHashMapInstance(uint32_t capacity) {
-    HashMap hashMapInstance = malloc(sizeof(struct HashMap));
+    uint32_t alignedCapacity = nextPowerOfTwo(capacity);
+    HashMap hashMapInstance = calloc(1, sizeof(struct HashMap) + (sizeof(MapEntry) * alignedCapacity));
     if (hashMapInstance == NULL) return NULL;
 
     hashMapInstance->size = 0;
-    hashMapInstance->capacity = nextPowerOfTwo(capacity);
+    hashMapInstance->capacity = alignedCapacity;
     hashMapInstance->deletedItemsCount = 0;
-    hashMapInstance->entries = calloc(hashMapInstance->capacity, sizeof(MapEntry));
-    if (hashMapInstance->entries == NULL) {
-        free(hashMapInstance);
-        return NULL;
-    }
+    hashMapInstance->entries = hashMapInstance->inlineEntries;
     return hashMapInstance;
 }
 
@@ -148,7 +148,9 @@ bool hashMapHasNext(HashMapIterator *iterator) {
 
 void hashMapDelete(HashMap hashMap) {
     if (hashMap != NULL) {
-        free(hashMap->entries);
+        if (!IS_HASH_MAP_INLINE_STORAGE(hashMap)) {
+            free(hashMap->entries);
+        }
         free(hashMap);
     }
 }
@@ -215,7 +217,9 @@ static bool adjustHashMapCapacity(HashMap hashMap, uint32_t capacity) {
         hashMap->size++;
     }
 
-    free(hashMap->entries);
+    if (!IS_HASH_MAP_INLINE_STORAGE(hashMap)) {
+        free(hashMap->entries);
+    }
     hashMap->entries = newEntries;
     hashMap->capacity = capacity;
     hashMap->deletedItemsCount = 0;
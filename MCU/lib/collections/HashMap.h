@@ -23,6 +23,7 @@ struct HashMap {
     uint32_t size;
     uint32_t capacity;
     uint32_t deletedItemsCount;
+    MapEntry inlineEntries[];   // initial table lives in the same allocation, spills to heap on first resize
 };
 
 typedef struct HashMapIterator {
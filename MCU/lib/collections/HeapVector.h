@@ -2,6 +2,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "Comparator.h"
 
 #ifndef MIN
@@ -34,36 +35,39 @@ static inline int NAME ##_compare(const void *a, const void *b) {      \
     return COMPARE_FUN(valueA, valueB);                 \
 }                                                       \
 \
+static bool HEAP_VECTOR_METHOD(resize, NAME, Capacity)(HEAP_VECTOR_TYPEDEF(NAME) *vector, uint32_t newCapacity) {  \
+    if (newCapacity == 0 || newCapacity > (UINT32_MAX / sizeof(TYPE))) return false;  \
+    TYPE *newItemArray = realloc(vector->items, sizeof(TYPE) * newCapacity);       \
+    if (newItemArray == NULL) return false;                         \
+    \
+    vector->items = newItemArray;                   \
+    vector->capacity = newCapacity;                 \
+    vector->size = MIN(vector->size, newCapacity);  \
+    return true;                                    \
+}                                                   \
+\
 static bool HEAP_VECTOR_METHOD(double, NAME, Capacity)(HEAP_VECTOR_TYPEDEF(NAME) *vector) {        \
     uint32_t newCapacity = vector->capacity * 2;                    \
     if (newCapacity < vector->capacity) return false;               \
-    \
-    TYPE *newItemArray = malloc(sizeof(TYPE) * newCapacity);  \
-    if (newItemArray == NULL) return false;                         \
-    \
-    for (uint32_t i = 0; i < vector->size; i++) {                   \
-        newItemArray[i] = vector->items[i];                         \
-    }                                                               \
-    free(vector->items);                \
-    vector->items = newItemArray;       \
-    vector->capacity = newCapacity;     \
-    return true;                        \
+    return HEAP_VECTOR_METHOD(resize, NAME, Capacity)(vector, newCapacity);  \
 }   \
 \
 static bool HEAP_VECTOR_METHOD(half, NAME, Capacity)(HEAP_VECTOR_TYPEDEF(NAME) *vector) {  \
     if (vector->capacity <= vector->initialCapacity) return false;  \
-    uint32_t newCapacity = vector->capacity / 2;                    \
-    TYPE *newItemArray = malloc(sizeof(TYPE) * newCapacity);  \
-    if (newItemArray == NULL) return false;                         \
-    \
-    for (uint32_t i = 0; i < MIN(vector->size, newCapacity); i++) { \
-        newItemArray[i] = vector->items[i];                         \
+    return HEAP_VECTOR_METHOD(resize, NAME, Capacity)(vector, vector->capacity / 2);  \
+}                                                   \
+\
+static bool HEAP_VECTOR_METHOD(ensure, NAME, Capacity)(HEAP_VECTOR_TYPEDEF(NAME) *vector, uint32_t minCapacity) {  \
+    if (minCapacity <= vector->capacity) return true;               \
+    uint32_t newCapacity = vector->capacity;                        \
+    while (newCapacity < minCapacity) {                             \
+        if ((newCapacity * 2) < newCapacity) {                      \
+            newCapacity = minCapacity;                              \
+            break;                                                  \
+        }                                                           \
+        newCapacity *= 2;                                           \
     }                                                               \
-    free(vector->items);                            \
-    vector->items = newItemArray;                   \
-    vector->capacity = newCapacity;                 \
-    vector->size = MIN(vector->size, newCapacity);  \
-    return true;                                    \
+    return HEAP_VECTOR_METHOD(resize, NAME, Capacity)(vector, newCapacity);  \
 }                                                   \
                                                     \
 static inline HEAP_VECTOR_TYPEDEF(NAME) * new ## NAME ## HeapVec(uint32_t capacity) { \
@@ -89,10 +93,8 @@ static inline HEAP_VECTOR_TYPEDEF(NAME) * new ## NAME ## HeapVecOf(const TYPE *b
     if (vector == NULL) {                               \
         return vector;                                  \
     }                                                   \
-    for (uint32_t i = 0; i < length; i++) {             \
-        vector->items[i] = buffer[i];                   \
-        vector->size++;                                 \
-    }                                                   \
+    memcpy(vector->items, buffer, sizeof(TYPE) * length);  \
+    vector->size = length;                              \
     return vector;                                      \
 }                                                       \
 \
@@ -126,15 +128,13 @@ static inline bool HEAP_VECTOR_METHOD(NAME, Put)(HEAP_VECTOR_TYPEDEF(NAME) *vect
 }                                      \
 \
 static inline bool HEAP_VECTOR_METHOD(NAME, AddAt)(HEAP_VECTOR_TYPEDEF(NAME) *vector, uint32_t index, TYPE item) { \
-    if (vector != NULL && index < vector->capacity) {               \
+    if (vector != NULL && index <= vector->size) {                  \
         if (vector->size >= vector->capacity) {                     \
             if (!HEAP_VECTOR_METHOD(double, NAME, Capacity)(vector)) { \
                 return false;                                       \
             }                                                       \
         }                                                           \
-        for (uint32_t i = vector->size; i > index; i--) {           \
-            vector->items[i] = vector->items[i - 1];                \
-        }                                                           \
+        memmove(&vector->items[index + 1], &vector->items[index], sizeof(TYPE) * (vector->size - index));   \
         vector->items[index] = item;                                \
         vector->size++;                                             \
         return true;                                                \
@@ -145,21 +145,58 @@ static inline bool HEAP_VECTOR_METHOD(NAME, AddAt)(HEAP_VECTOR_TYPEDEF(NAME) *ve
 static inline TYPE HEAP_VECTOR_METHOD(NAME, RemoveAt)(HEAP_VECTOR_TYPEDEF(NAME) *vector, uint32_t index) {    \
     if (vector != NULL && index < vector->size) {                           \
         TYPE item = vector->items[index];                                   \
-        for (uint32_t i = index + 1; i < vector->size; i++) {               \
-            vector->items[i - 1] = vector->items[i];                        \
-        }                                                                   \
+        memmove(&vector->items[index], &vector->items[index + 1], sizeof(TYPE) * (vector->size - index - 1));   \
         vector->size--;                                                     \
                                                                             \
         if ((vector->size * 4) < vector->capacity) {                        \
-            if (!HEAP_VECTOR_METHOD(half, NAME, Capacity)(vector)) {        \
-                return (TYPE) {0};                                          \
+            HEAP_VECTOR_METHOD(half, NAME, Capacity)(vector);               \
         }                                                                   \
         return item;                                                        \
-        }                                                         \
-    }\
+    }                                                                       \
     return (TYPE) {0};                                                      \
 }                                      \
 \
+static inline bool HEAP_VECTOR_METHOD(NAME, Reserve)(HEAP_VECTOR_TYPEDEF(NAME) *vector, uint32_t capacity) {   \
+    if (vector == NULL) return false;                               \
+    if (capacity <= vector->capacity) return true;                  \
+    return HEAP_VECTOR_METHOD(resize, NAME, Capacity)(vector, capacity);    \
+}                                      \
+\
+static inline bool HEAP_VECTOR_METHOD(NAME, ShrinkToFit)(HEAP_VECTOR_TYPEDEF(NAME) *vector) {   \
+    if (vector == NULL) return false;                               \
+    uint32_t newCapacity = vector->size > 0 ? vector->size : 1;     \
+    if (newCapacity == vector->capacity) return true;               \
+    if (!HEAP_VECTOR_METHOD(resize, NAME, Capacity)(vector, newCapacity)) return false;    \
+    vector->initialCapacity = MIN(vector->initialCapacity, newCapacity);    \
+    return true;                                                    \
+}                                      \
+\
+static inline bool HEAP_VECTOR_METHOD(NAME, InsertRange)(HEAP_VECTOR_TYPEDEF(NAME) *vector, uint32_t index, TYPE *array, uint32_t length) {   \
+    if (vector == NULL || index > vector->size || (array == NULL && length > 0)) return false;  \
+    if (length > (UINT32_MAX - vector->size)) return false;         \
+    if (!HEAP_VECTOR_METHOD(ensure, NAME, Capacity)(vector, vector->size + length)) return false;  \
+    memmove(&vector->items[index + length], &vector->items[index], sizeof(TYPE) * (vector->size - index));  \
+    memcpy(&vector->items[index], array, sizeof(TYPE) * length);   \
+    vector->size += length;                                         \
+    return true;                                                    \
+}                                      \
+\
+static inline bool HEAP_VECTOR_METHOD(NAME, AddRange)(HEAP_VECTOR_TYPEDEF(NAME) *vector, TYPE *array, uint32_t length) {   \
+    return vector != NULL && HEAP_VECTOR_METHOD(NAME, InsertRange)(vector, vector->size, array, length);  \
+}                                      \
+\
+static inline bool HEAP_VECTOR_METHOD(NAME, EraseRange)(HEAP_VECTOR_TYPEDEF(NAME) *vector, uint32_t fromIndex, uint32_t toIndex) {   \
+    if (vector == NULL || fromIndex > toIndex || toIndex > vector->size) return false;  \
+    memmove(&vector->items[fromIndex], &vector->items[toIndex], sizeof(TYPE) * (vector->size - toIndex));   \
+    vector->size -= (toIndex - fromIndex);                          \
+    while ((vector->size * 4) < vector->capacity) {                 \
+        if (!HEAP_VECTOR_METHOD(half, NAME, Capacity)(vector)) {    \
+            break;                                                  \
+        }                                                           \
+    }                                                               \
+    return true;                                                    \
+}                                      \
+\
 static inline bool HEAP_VECTOR_METHOD(is, NAME, Empty)(HEAP_VECTOR_TYPEDEF(NAME) *vector) {  \
     return (vector == NULL) || (vector->size == 0);     \
 }                                      \
@@ -185,21 +222,12 @@ static inline void HEAP_VECTOR_METHOD(NAME, Clear)(HEAP_VECTOR_TYPEDEF(NAME) *ve
 \
 static inline bool HEAP_VECTOR_METHOD(NAME, AddAll)(HEAP_VECTOR_TYPEDEF(NAME) *vecDest, HEAP_VECTOR_TYPEDEF(NAME) *vecSource) { \
     if (vecDest == NULL || vecSource == NULL) return false; \
-    for (uint32_t i = 0; i < vecSource->size; i++) {        \
-        TYPE item = HEAP_VECTOR_METHOD(NAME, Get)(vecSource, i);        \
-        if (!HEAP_VECTOR_METHOD(NAME, Add)(vecDest, item)) {            \
-            return false;                                   \
-        }                                                   \
-    }                                                       \
-    return true;                                            \
+    if (!HEAP_VECTOR_METHOD(ensure, NAME, Capacity)(vecDest, vecDest->size + vecSource->size)) return false;  \
+    return HEAP_VECTOR_METHOD(NAME, AddRange)(vecDest, vecSource->items, vecSource->size);  \
 }                                           \
 \
 static inline HEAP_VECTOR_TYPEDEF(NAME) * HEAP_VECTOR_METHOD(NAME, FromArray)(HEAP_VECTOR_TYPEDEF(NAME) *vector, TYPE array[], uint32_t length) {  \
-    for (uint32_t i = 0; i < length; i++) {             \
-        if (!HEAP_VECTOR_METHOD(NAME, Add)(vector, array[i])) {     \
-            return vector;                              \
-        }                                               \
-    }                                                   \
+    HEAP_VECTOR_METHOD(NAME, AddRange)(vector, array, length);  \
     return vector;                                      \
 }                                           \
 \
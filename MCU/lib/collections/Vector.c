@@ -1,31 +1,30 @@
 #include "Vector.h"
+#include <string.h>
 
 #define MIN(x, y) (((x)<(y))?(x):(y))
 
 static bool doubleVectorCapacity(Vector vector);
 static bool halfVectorCapacity(Vector vector);
 
+#define IS_VECTOR_INLINE_STORAGE(vector) ((vector)->itemArray == (vector)->inlineItems)
+
 struct Vector {
     VectorValueType *itemArray;
     uint32_t initialCapacity;
     uint32_t capacity;
     uint32_t size;
+    VectorValueType inlineItems[];  // first 'initialCapacity' items live in the same allocation, spill to heap on growth
 };
 
 Vector getVectorInstance(uint32_t capacity) {
-    if (capacity < 1) return NULL;
+    if (capacity < 1 || capacity > ((UINT32_MAX - sizeof(struct Vector)) / sizeof(VectorValueType))) return NULL;
 
-    Vector vector = malloc(sizeof(struct Vector));
+    Vector vector = calloc(1, sizeof(struct Vector) + (sizeof(VectorValueType) * capacity));
     if (vector == NULL) return NULL;
     vector->size = 0;
     vector->capacity = capacity;
     vector->initialCapacity = capacity;
-    vector->itemArray = calloc(vector->capacity, sizeof(VectorValueType));
-
-    if (vector->itemArray == NULL) {
-        vectorDelete(vector);
-        return NULL;
-    }
+    vector->itemArray = vector->inlineItems;
     return vector;
 }
 
@@ -57,9 +56,7 @@ bool vectorAddAt(Vector vector, uint32_t index, VectorValueType item) {
         if (vector->size >= vector->capacity) {
             if (!doubleVectorCapacity(vector)) return false;
         }
-        for (uint32_t i = vector->size; i > index; i--) {
-            vector->itemArray[i] = vector->itemArray[i - 1];
-        }
+        memmove(&vector->itemArray[index + 1], &vector->itemArray[index], sizeof(VectorValueType) * (vector->size - index));
         vector->itemArray[index] = item;
         vector->size++;
         return true;
@@ -70,13 +67,11 @@ bool vectorAddAt(Vector vector, uint32_t index, VectorValueType item) {
 VectorValueType vectorRemoveAt(Vector vector, uint32_t index) {
     if (vector != NULL && index < vector->size) {
         VectorValueType item = vector->itemArray[index];
-        for (uint32_t i = index + 1; i < vector->size; i++) {
-            vector->itemArray[i - 1] = vector->itemArray[i];
-        }
+        memmove(&vector->itemArray[index], &vector->itemArray[index + 1], sizeof(VectorValueType) * (vector->size - index - 1));
         vector->size--;
 
         if ((vector->size * 4) < vector->capacity) {
-            if (!halfVectorCapacity(vector)) return (VectorValueType) NULL;
+            halfVectorCapacity(vector);
         }
         return item;
     }
@@ -106,7 +101,9 @@ void vectorClear(Vector vector) {
 
 void vectorDelete(Vector vector) {
     if (vector != NULL) {
-        free(vector->itemArray);
+        if (!IS_VECTOR_INLINE_STORAGE(vector)) {
+            free(vector->itemArray);
+        }
         free(vector);
     }
 }
@@ -121,13 +118,16 @@ static bool doubleVectorCapacity(Vector vector) {
     uint32_t newCapacity = vector->capacity * 2;
     if (newCapacity < vector->capacity) return false;   // overflow (capacity would be too big)
 
-    VectorValueType *newItemArray = malloc(sizeof(VectorValueType) * newCapacity);
-    if (newItemArray == NULL) return false;
-
-    for (uint32_t i = 0; i < vector->size; i++) {
-        newItemArray[i] = vector->itemArray[i];
+    VectorValueType *newItemArray;
+    if (IS_VECTOR_INLINE_STORAGE(vector)) {     // first spill from inline storage to heap
+        newItemArray = malloc(sizeof(VectorValueType) * newCapacity);
+        if (newItemArray == NULL) return false;
+        memcpy(newItemArray, vector->itemArray, sizeof(VectorValueType) * vector->size);
+    } else {
+        newItemArray = realloc(vector->itemArray, sizeof(VectorValueType) * newCapacity);
+        if (newItemArray == NULL) return false;
     }
-    free(vector->itemArray);
+
     vector->itemArray = newItemArray;
     vector->capacity = newCapacity;
     return true;
@@ -136,15 +136,21 @@ static bool doubleVectorCapacity(Vector vector) {
 static bool halfVectorCapacity(Vector vector) {
     if (vector->capacity <= vector->initialCapacity) return false;
     uint32_t newCapacity = vector->capacity / 2;
-    VectorValueType *newItemArray = malloc(sizeof(VectorValueType) * newCapacity);
-    if (newItemArray == NULL) return false;
 
-    for (uint32_t i = 0; i < MIN(vector->size, newCapacity); i++) {
-        newItemArray[i] = vector->itemArray[i];
+    if (newCapacity <= vector->initialCapacity) {   // fits back into inline storage
+        vector->size = MIN(vector->size, vector->initialCapacity);
+        memcpy(vector->inlineItems, vector->itemArray, sizeof(VectorValueType) * vector->size);
+        free(vector->itemArray);
+        vector->itemArray = vector->inlineItems;
+        vector->capacity = vector->initialCapacity;
+        return true;
     }
-    free(vector->itemArray);
+
+    VectorValueType *newItemArray = realloc(vector->itemArray, sizeof(VectorValueType) * newCapacity);
+    if (newItemArray == NULL) return false;
+
     vector->itemArray = newItemArray;
     vector->capacity = newCapacity;
     vector->size = MIN(vector->size, newCapacity);
     return true;
-}
\ No newline at end of file
+}
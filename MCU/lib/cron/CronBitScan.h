@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdint.h>
+
+// Set bit queries on 64 bit cron field bitsets, GCC/Clang builtins or portable fallback
+
+#define CRON_BITSET_SIZE 64
+#define BIT_NOT_FOUND (-1)
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(CRON_PORTABLE_BIT_SCAN)    // define it to build the fallback with GCC, e.g. to test it on host
+static inline uint32_t countTrailingZeros(uint64_t bits) {  // bits must be non-zero
+    return __builtin_ctzll(bits);
+}
+
+static inline uint32_t countLeadingZeros(uint64_t bits) {   // bits must be non-zero
+    return __builtin_clzll(bits);
+}
+#else
+static inline uint32_t countTrailingZeros(uint64_t bits) {
+    static const uint8_t DE_BRUIJN_BIT_POSITION[CRON_BITSET_SIZE] = {
+            0, 1, 2, 53, 3, 7, 54, 27, 4, 38, 41, 8, 34, 55, 48, 28, 62, 5, 39, 46, 44, 42, 22, 9, 24, 35, 59, 56, 49, 18, 29, 11,
+            63, 52, 6, 26, 37, 40, 33, 47, 61, 45, 43, 21, 23, 58, 17, 10, 51, 25, 36, 32, 60, 20, 57, 16, 50, 31, 19, 15, 30, 14, 13, 12
+    };
+    return DE_BRUIJN_BIT_POSITION[((bits & (~bits + 1)) * 0x022FDD63CC95386DULL) >> 58];  // isolate lowest bit, then perfect hash it
+}
+
+static inline uint32_t countLeadingZeros(uint64_t bits) {
+    uint32_t count = 0;
+    for (uint32_t shift = CRON_BITSET_SIZE / 2; shift > 0; shift /= 2) {   // binary search for highest set bit
+        if ((bits >> (CRON_BITSET_SIZE - shift)) == 0) {
+            bits <<= shift;
+            count += shift;
+        }
+    }
+    return count;
+}
+#endif
+
+static inline int32_t nextSetBit(uint64_t bits, uint32_t fromIndex) {  // lowest set bit at or above fromIndex
+    if (fromIndex >= CRON_BITSET_SIZE) return BIT_NOT_FOUND;
+    uint64_t candidates = bits & (UINT64_MAX << fromIndex);     // drop bits below fromIndex
+    return candidates != 0 ? (int32_t) countTrailingZeros(candidates) : BIT_NOT_FOUND;
+}
+
+static inline int32_t previousSetBit(uint64_t bits, uint32_t fromIndex) {  // highest set bit at or below fromIndex
+    uint64_t candidates = fromIndex < (CRON_BITSET_SIZE - 1) ? bits & ((2ULL << fromIndex) - 1) : bits;    // drop bits above fromIndex
+    return candidates != 0 ? (int32_t) ((CRON_BITSET_SIZE - 1) - countLeadingZeros(candidates)) : BIT_NOT_FOUND;
+}
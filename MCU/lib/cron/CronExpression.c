@@ -1,20 +1,22 @@
 #include "CronExpression.h"
+#include "CronBitScan.h"
+#include "CronKeywords.h"
+#include "DateTimeKeywords.h"
 
-#define CRON_SECONDS_LENGTH 8
-#define CRON_MINUTES_LENGTH 8
-#define CRON_HOURS_LENGTH 3
-#define CRON_DAY_OF_MONTH_LENGTH 4
-#define CRON_MONTHS_LENGTH 2
-#define CRON_DAY_OF_WEEK_LENGTH 1
 #define CRON_MAX_ATTEMPTS (366 * 5)
+#define CRON_ORDINAL_NAME_LENGTH 3
 
 #define BIT_READ(value, bit) (((value) >> (bit)) & 0x01)
 #define BIT_SET(value, bit) ((value) |= (1UL << (bit)))
 #define BIT_CLEAR(value, bit) ((value) &= ~(1UL << (bit)))
 #define BIT_WRITE(value, bit, bitValue) ((bitValue) ? BIT_SET((value), (bit)) : BIT_CLEAR((value), (bit)))
 
-#define BITS_IN_BYTE 8
-#define BIT_NOT_FOUND (-1)
+#ifdef CRON_DEBUG_SEARCH_STEPS
+static _Thread_local uint32_t searchSteps;
+#define COUNT_SEARCH_STEP() (searchSteps++)
+#else
+#define COUNT_SEARCH_STEP()
+#endif
 
 #ifndef ARRAY_SIZE
 #define ARRAY_SIZE(x) (sizeof(x)/sizeof((x)[0]))
@@ -55,16 +57,6 @@ typedef struct QuartzOptionHolder {
     uint8_t numberOfWeekdays;
 } QuartzOptionHolder;
 
-static const char * const CRON_MACROS[] = {
-        "@yearly",   "0 0 0 1 1 *",
-        "@annually", "0 0 0 1 1 *",
-        "@monthly",  "0 0 0 1 * *",
-        "@weekly",   "0 0 0 * * 0",
-        "@daily",    "0 0 0 * * *",
-        "@midnight", "0 0 0 * * *",
-        "@hourly",   "0 0 * * * *"
-};
-
 static const ValueRange WEEKDAY_RANGE = {.min = 0, .max = SUNDAY};
 
 static const char *resolveCronMacros(const char *expression);
@@ -72,19 +64,19 @@ static const char *resolveCronMacros(const char *expression);
 static CronStatus parseCronField(CronExpression *cron, CronField cronField, char *cronValue);
 static CronStatus parseCronDayOfMonth(CronExpression *cron, char *cronValue);
 static CronStatus parseCronWeekDay(CronExpression *cron, char *cronValue);
-static CronStatus parseCronDate(CronExpression *cron, CronField cronField, uint8_t *bits, char *cronValue, const ValueRange *range);
-static CronStatus setNumberHits(CronExpression *cron, CronField cronField, uint8_t *bits, char *cronValue, const ValueRange *range);
+static CronStatus parseCronDate(CronExpression *cron, CronField cronField, uint64_t *bits, char *cronValue, const ValueRange *range);
+static CronStatus setNumberHits(CronExpression *cron, CronField cronField, uint64_t *bits, char *cronValue, const ValueRange *range);
 static ValueRange parseCronRange(CronExpression *cron, CronField cronField, char *cronValue, CronStatus *error, const ValueRange *range);
-static void replaceMonthOrdinals(char *fieldBuffer);
-static void replaceWeekDayOrdinals(char *fieldBuffer);
+static void replaceCronOrdinals(char *fieldBuffer, CronField cronField);
 
 static void findNextDateTime(CronExpression *cron, DateTime *nextDateTime);
+static bool findNextTimeInSameDay(const CronExpression *cron, DateTime *nextDateTime);
 static void findNextMonth(CronExpression *cron, DateTime *nextDateTime);
 static void findNextDayOfMonth(CronExpression *cron, DateTime *nextDateTime);
 static void findNextHour(CronExpression *cron, DateTime *nextDateTime);
 static void findNextMinutes(CronExpression *cron, DateTime *nextDateTime);
 static void findNextSeconds(CronExpression *cron, DateTime *nextDateTime);
-static void resetDateTimeSettings(CronExpression *cron, CronField fromField, DateTime *dateTime);
+static void resetDateTimeSettings(const CronExpression *cron, CronField fromField, DateTime *dateTime);
 static Date getMonthLastWeekDayDate(Date *date);
 static Date getLastDayOfMonthDate(Date *date);
 
@@ -96,14 +88,16 @@ static void adjustDateToWeekdayAndCount(DateTime *nextDateTime, DayOfWeek weekDa
 static uint8_t getQuartzOption(CronExpression *cron, QuartzOption option);
 static void setQuartzOption(CronExpression *cron, QuartzOption option, uint8_t value);
 
-static void setBitsInRange(uint8_t *bits, const ValueRange *range);
-static void clearBitsInRange(uint8_t *bits, const ValueRange *range);
-static int32_t nextSetBit(uint8_t *bits, uint32_t fromIndex, uint32_t bitSetLength);
-static void setBit(uint8_t *bits, uint32_t bitIndex);
-static void clearBit(uint8_t *bits, uint32_t bitIndex);
-static bool isBitSet(const uint8_t *bits, uint32_t bitIndex);
+static void setBitsInRange(uint64_t *bits, const ValueRange *range);
+static void clearBitsInRange(uint64_t *bits, const ValueRange *range);
+static void setBit(uint64_t *bits, uint32_t bitIndex);
+static void clearBit(uint64_t *bits, uint32_t bitIndex);
 
 
+static inline bool isOverlapTransition(ZoneTransition *transition) {
+    return transition->after != NULL && transition->after->gmtOffset < transition->before->gmtOffset;
+}
+
 static inline bool isLongNumberValid(int64_t number, const char *valuePointer, const char *endPointer) {
     return ((valuePointer == endPointer) ||               // no digits found
             (errno == ERANGE && number == LLONG_MIN) ||   // underflow occurred
@@ -111,6 +105,14 @@ static inline bool isLongNumberValid(int64_t number, const char *valuePointer, c
             ? false : true);
 }
 
+static inline bool isBitSet(uint64_t bits, uint32_t bitIndex) {
+    return bitIndex < CRON_BITSET_SIZE && ((bits >> bitIndex) & 1ULL);
+}
+
+static inline uint64_t bitRangeMask(const ValueRange *range) {     // bits [min, max] set, range must be within 0-63
+    return (UINT64_MAX >> ((CRON_BITSET_SIZE - 1) - range->max)) & (UINT64_MAX << range->min);
+}
+
 
 CronStatus parseCronExpression(CronExpression *cron, const char *expression) {
     if (isStringBlank(expression)) {
@@ -160,48 +162,125 @@ CronStatus parseCronExpression(CronExpression *cron, const char *expression) {
     return CRON_OK;
 }
 
-DateTime nextCronDateTime(CronExpression *cron, DateTime *date) {
+DateTime nextCronDateTime(const CronExpression *cron, DateTime *date) {
     if (!isDateTimeValid(date)) return ERROR_DATE_TIME;
+    CronExpression search = *cron;  // Quartz options set day bits for searched month, so keep them off the caller's expression
     DateTime nextDateTime = *date;  // copy original date
-    findNextDateTime(cron, &nextDateTime);
+    findNextDateTime(&search, &nextDateTime);
 
     if (isDateTimeEquals(date, &nextDateTime)) {
         // arrived at the original date - round up to the next whole second and try again...
         dateTimePlusSeconds(&nextDateTime, 1);
-        findNextDateTime(cron, &nextDateTime);
+        findNextDateTime(&search, &nextDateTime);
     }
     return nextDateTime;
 }
 
-ZonedDateTime nextCronZonedDateTime(CronExpression *cron, ZonedDateTime *date) {
-    DateTime nextDateTime = nextCronDateTime(cron, &date->dateTime);
-    return zonedDateTimeOfDateTime(&nextDateTime, &date->zone);
+ZonedDateTime nextCronZonedDateTime(const CronExpression *cron, ZonedDateTime *date) {
+    const TimeZone *zone = &date->zone;
+    DateTime searchFrom = date->dateTime;
+    int32_t offset = zone->utcOffset;
+    ZoneTransition transition = findLocalZoneTransition(dateTimeToEpochSecond(&searchFrom, 0), zone, &offset);
+    if (isOverlapTransition(&transition) && date->offset == transition.after->gmtOffset) {
+        // second pass of repeated local time, all fire times in overlap already happened at earlier offset, so continue right after it
+        int64_t overlapEnd = transition.after->transition + transition.before->gmtOffset;
+        searchFrom = dateTimeOfEpochSeconds(overlapEnd - 1, 0, 0);
+    }
+
+    DateTime nextDateTime = nextCronDateTime(cron, &searchFrom);
+    if (!isDateTimeValid(&nextDateTime)) {
+        return zonedDateTimeOfDateTime(&nextDateTime, zone);
+    }
+
+    // in overlap fire only once, at earlier offset. In gap local time does not exist, fire once when clocks jump forward
+    transition = findLocalZoneTransition(dateTimeToEpochSecond(&nextDateTime, 0), zone, &offset);
+    if (transition.after != NULL && !isOverlapTransition(&transition)) {
+        offset = transition.after->gmtOffset;
+        nextDateTime = dateTimeOfEpochSeconds(transition.after->transition, 0, offset);
+    }
+    ZonedDateTime nextZonedDateTime = {.dateTime = nextDateTime, .zone = *zone, .offset = offset};
+    return nextZonedDateTime;
 }
 
-static const char *resolveCronMacros(const char *expression) {
-    for (int i = 0; i < ARRAY_SIZE(CRON_MACROS); i += 2) {
-        if (strcasecmp(CRON_MACROS[i], expression) == 0) {
-            return CRON_MACROS[i + 1];
-        }
+#ifdef CRON_DEBUG_SEARCH_STEPS
+uint32_t getCronSearchSteps() {
+    return searchSteps;
+}
+
+void resetCronSearchSteps() {
+    searchSteps = 0;
+}
+#endif
+
+CronIterator getCronIterator(const CronExpression *cron, DateTime *from) {
+    CronIterator iterator = {
+            .cron = cron,
+            .current = *from,
+            .isStarted = false,
+            .isFinished = cron == NULL || !isDateTimeValid(from)
+    };
+    return iterator;
+}
+
+bool hasNextCronDateTime(CronIterator *iterator, DateTime *next) {
+    if (iterator == NULL || iterator->isFinished) return false;
+    if (!iterator->isStarted) {
+        iterator->current = nextCronDateTime(iterator->cron, &iterator->current);
+        iterator->isStarted = true;
+
+    } else if (!findNextTimeInSameDay(iterator->cron, &iterator->current)) {
+        CronExpression search = *iterator->cron;
+        dateTimePlusSeconds(&iterator->current, 1);     // previous result is fire time, so search can start right after it
+        findNextDateTime(&search, &iterator->current);
+    }
+
+    if (!isDateTimeValid(&iterator->current)) {
+        iterator->isFinished = true;
+        return false;
+    }
+    *next = iterator->current;
+    return true;
+}
+
+uint32_t nextCronDateTimes(const CronExpression *cron, DateTime *date, DateTime *results, uint32_t count) {
+    CronIterator iterator = getCronIterator(cron, date);
+    uint32_t resultCount = 0;
+    while (resultCount < count && hasNextCronDateTime(&iterator, &results[resultCount])) {
+        resultCount++;
+    }
+    return resultCount;
+}
+
+uint32_t cronDateTimesUntil(const CronExpression *cron, DateTime *date, DateTime *until, DateTime *results, uint32_t capacity) {
+    CronIterator iterator = getCronIterator(cron, date);
+    uint32_t resultCount = 0;
+    while (resultCount < capacity && hasNextCronDateTime(&iterator, &results[resultCount])) {
+        if (isDateTimeAfter(&results[resultCount], until)) break;
+        resultCount++;
     }
-    return expression;
+    return resultCount;
+}
+
+static const char *resolveCronMacros(const char *expression) {
+    const CronMacroKeyword *macro = findCronMacroKeyword(expression, strlen(expression));
+    return macro != NULL ? macro->value : expression;
 }
 
 static CronStatus parseCronField(CronExpression *cron, CronField cronField, char *cronValue) {
     switch (cronField) {
         case CRON_SECOND:
-            return setNumberHits(cron, CRON_SECOND, cron->seconds, cronValue, &SECOND_OF_MINUTE_RANGE);
+            return setNumberHits(cron, CRON_SECOND, &cron->seconds, cronValue, &SECOND_OF_MINUTE_RANGE);
         case CRON_MINUTE:
-            return setNumberHits(cron, CRON_MINUTE, cron->minutes, cronValue, &MINUTE_OF_HOUR_RANGE);
+            return setNumberHits(cron, CRON_MINUTE, &cron->minutes, cronValue, &MINUTE_OF_HOUR_RANGE);
         case CRON_HOUR:
-            return setNumberHits(cron, CRON_HOUR, cron->hours, cronValue, &HOUR_OF_DAY_RANGE);
+            return setNumberHits(cron, CRON_HOUR, &cron->hours, cronValue, &HOUR_OF_DAY_RANGE);
         case CRON_DAY_OF_MONTH:
             return parseCronDayOfMonth(cron, cronValue);
         case CRON_MONTH:
-            replaceMonthOrdinals(cronValue);
-            return setNumberHits(cron, CRON_MONTH, cron->months, cronValue, &MONTH_OF_YEAR_RANGE);
+            replaceCronOrdinals(cronValue, CRON_MONTH);
+            return setNumberHits(cron, CRON_MONTH, &cron->months, cronValue, &MONTH_OF_YEAR_RANGE);
         case CRON_DAY_OF_WEEK:
-            replaceWeekDayOrdinals(cronValue);
+            replaceCronOrdinals(cronValue, CRON_DAY_OF_WEEK);
             return parseCronWeekDay(cron, cronValue);
     }
     return CRON_ERROR_UNKNOWN_CRON_FIELD;
@@ -246,7 +325,7 @@ static CronStatus parseCronDayOfMonth(CronExpression *cron, char *cronValue) {
         return CRON_OK;
     }
 
-    return parseCronDate(cron, CRON_DAY_OF_MONTH, cron->daysOfMonth, cronValue, &DAY_OF_MONTH_RANGE);
+    return parseCronDate(cron, CRON_DAY_OF_MONTH, &cron->daysOfMonth, cronValue, &DAY_OF_MONTH_RANGE);
 }
 
 static CronStatus parseCronWeekDay(CronExpression *cron, char *cronValue) {
@@ -293,22 +372,22 @@ static CronStatus parseCronWeekDay(CronExpression *cron, char *cronValue) {
         return CRON_OK;
     }
 
-    CronStatus status = parseCronDate(cron, CRON_DAY_OF_WEEK, cron->daysOfWeek, cronValue, &WEEKDAY_RANGE);
+    CronStatus status = parseCronDate(cron, CRON_DAY_OF_WEEK, &cron->daysOfWeek, cronValue, &WEEKDAY_RANGE);
     if (isBitSet(cron->daysOfWeek, 0)) {
-        setBit(cron->daysOfWeek, 7);   // cron supports 0 for Sunday. GlobalDateTime use 7, so convert week day
-        clearBit(cron->daysOfWeek, 0);
+        setBit(&cron->daysOfWeek, 7);   // cron supports 0 for Sunday. GlobalDateTime use 7, so convert week day
+        clearBit(&cron->daysOfWeek, 0);
     }
     return status;
 }
 
-static CronStatus parseCronDate(CronExpression *cron, CronField cronField, uint8_t *bits, char *cronValue, const ValueRange *range) {
+static CronStatus parseCronDate(CronExpression *cron, CronField cronField, uint64_t *bits, char *cronValue, const ValueRange *range) {
     if (isStringEquals(cronValue, "?")) {
         strcpy(cronValue, "*");
     }
     return setNumberHits(cron, cronField, bits, cronValue, range);
 }
 
-static CronStatus setNumberHits(CronExpression *cron, CronField cronField, uint8_t *bits, char *cronValue, const ValueRange *range) {
+static CronStatus setNumberHits(CronExpression *cron, CronField cronField, uint64_t *bits, char *cronValue, const ValueRange *range) {
     CronStatus error = CRON_OK;
     char *nextPointer = NULL;
     char *cronFieldValue = splitStringReentrant(cronValue, ",", &nextPointer);
@@ -423,33 +502,38 @@ static ValueRange parseCronRange(CronExpression *cron, CronField cronField, char
     return resultRange;
 }
 
-static void replaceMonthOrdinals(char *fieldBuffer) {
-    char monthNameUpper[4] = {0};
-    char monthNumber[3] = {0};
+static void replaceCronOrdinals(char *fieldBuffer, CronField cronField) {  // "JAN-MAR" -> "1-3", "MON,FRI" -> "1,5"
     toUpperCaseString(fieldBuffer);
-    for (Month i = JANUARY; i <= DECEMBER; i++) {
-        const char *monthOrdinal = getMonthNameShort(i);
-        strcpy(monthNameUpper, monthOrdinal);
-        toUpperCaseString(monthNameUpper);
-        sprintf(monthNumber, "%d", i);
-        replaceString(fieldBuffer, monthNameUpper, monthNumber);
-    }
-}
+    char *resultPointer = fieldBuffer;
+    const char *nextPointer = fieldBuffer;
+    while (*nextPointer != '\0') {
+        int32_t ordinal = -1;
+        if (strnlen(nextPointer, CRON_ORDINAL_NAME_LENGTH) == CRON_ORDINAL_NAME_LENGTH) {
+            if (cronField == CRON_MONTH) {
+                const MonthShortNameKeyword *month = findMonthShortNameKeyword(nextPointer, CRON_ORDINAL_NAME_LENGTH);
+                ordinal = month != NULL ? (int32_t) month->value : -1;
+            } else {
+                const WeekDayShortNameKeyword *weekDay = findWeekDayShortNameKeyword(nextPointer, CRON_ORDINAL_NAME_LENGTH);
+                ordinal = weekDay != NULL ? (int32_t) weekDay->value : -1;
+            }
+        }
 
-static void replaceWeekDayOrdinals(char *fieldBuffer) {
-    char weekNameUpper[4] = {0};
-    char weekDayNumber[2] = {0};
-    toUpperCaseString(fieldBuffer);
-    for (DayOfWeek i = MONDAY; i <= SUNDAY; i++) {
-        const char *weekOrdinal = getWeekDayNameShort(i);
-        strcpy(weekNameUpper, weekOrdinal);
-        toUpperCaseString(weekNameUpper);
-        sprintf(weekDayNumber, "%d", i);
-        replaceString(fieldBuffer, weekNameUpper, weekDayNumber);
+        if (ordinal < 0) {
+            *resultPointer++ = *nextPointer++;
+            continue;
+        }
+
+        if (ordinal >= 10) {    // number is never longer than name, so buffer can be rewritten in place
+            *resultPointer++ = (char) ('0' + ordinal / 10);
+        }
+        *resultPointer++ = (char) ('0' + ordinal % 10);
+        nextPointer += CRON_ORDINAL_NAME_LENGTH;
     }
+    *resultPointer = '\0';
 }
 
 static void findNextDateTime(CronExpression *cron, DateTime *nextDateTime) {
+    COUNT_SEARCH_STEP();
     for (CronField field = CRON_SECOND; field <= CRON_DAY_OF_WEEK && isDateTimeValid(nextDateTime); field++) {
         switch (field) {    // No need to handle CRON_DAY_OF_WEEK separately, week settings is used in day of month calculation
             case CRON_MONTH:
@@ -473,10 +557,33 @@ static void findNextDateTime(CronExpression *cron, DateTime *nextDateTime) {
     }
 }
 
+static bool findNextTimeInSameDay(const CronExpression *cron, DateTime *nextDateTime) {  // previous fire day still matches, only time fields are scanned
+    int32_t nextSeconds = nextSetBit(cron->seconds, nextDateTime->time.seconds + 1);
+    if (nextSeconds != BIT_NOT_FOUND) {
+        nextDateTime->time.seconds = (int8_t) nextSeconds;
+        return true;
+    }
+
+    int32_t nextMinutes = nextSetBit(cron->minutes, nextDateTime->time.minutes + 1);
+    if (nextMinutes != BIT_NOT_FOUND) {
+        nextDateTime->time.minutes = (int8_t) nextMinutes;
+        resetDateTimeSettings(cron, CRON_SECOND, nextDateTime);
+        return true;
+    }
+
+    int32_t nextHour = nextSetBit(cron->hours, nextDateTime->time.hours + 1);
+    if (nextHour != BIT_NOT_FOUND) {
+        nextDateTime->time.hours = (int8_t) nextHour;
+        resetDateTimeSettings(cron, CRON_MINUTE, nextDateTime);
+        return true;
+    }
+    return false;
+}
+
 static void findNextMonth(CronExpression *cron, DateTime *nextDateTime) {
-    int32_t nextMonth = nextSetBit(cron->months, nextDateTime->date.month, CRON_MONTHS_LENGTH);
+    int32_t nextMonth = nextSetBit(cron->months, nextDateTime->date.month);
     if (nextMonth == BIT_NOT_FOUND) {
-        nextMonth = nextSetBit(cron->months, 0, CRON_MONTHS_LENGTH);
+        nextMonth = nextSetBit(cron->months, 0);
         dateTimePlusYears(nextDateTime, 1);
     }
 
@@ -486,6 +593,7 @@ static void findNextMonth(CronExpression *cron, DateTime *nextDateTime) {
         int64_t maxYear = nextDateTime->date.year + CRON_MAX_ATTEMPTS;
         while (!isDateTimeValid(nextDateTime) && nextDateTime->date.year <= maxYear) { // check when non leap year set invalid day of february
             nextDateTime->date.year++;
+            COUNT_SEARCH_STEP();
         }
 
         if (nextDateTime->date.year >= maxYear) {
@@ -506,22 +614,23 @@ static void findNextDayOfMonth(CronExpression *cron, DateTime *nextDateTime) {
     uint32_t count = 0;
     Month currentMonth = nextDateTime->date.month;
     while (count <= CRON_MAX_ATTEMPTS) {
+        COUNT_SEARCH_STEP();
 
         if (isMonthQuartzOptionsSet && (nextDateTime->date.month != currentMonth || count == 0)) {   // set month last day when month is changed or in first iteration, also clean previous month last day
             if (!options.isLastDayCompositeOptionSet) {
-                clearBitsInRange(cron->daysOfMonth, &DAY_OF_MONTH_RANGE);   // clear previous day of month day of month set bits, do not clear for composite month field
+                clearBitsInRange(&cron->daysOfMonth, &DAY_OF_MONTH_RANGE);   // clear previous day of month day of month set bits, do not clear for composite month field
             }
 
             if (options.isLastDayOptionSet) {   // "L"
                 int8_t monthLastDay = lengthOfMonth(nextDateTime->date.month, isLeapYear(nextDateTime->date.year));
-                setBit(cron->daysOfMonth, monthLastDay);
+                setBit(&cron->daysOfMonth, monthLastDay);
 
             } else if (options.isLastWeekendOptionSet) {    // "LW"
                 Date currentMonthEndDate = getMonthLastWeekDayDate(&nextDateTime->date);
                 if (!isDateEquals(&currentMonthEndDate, &nextDateTime->date)) {
                     resetDateTimeSettings(cron, CRON_HOUR, nextDateTime);
                 }
-                setBit(cron->daysOfMonth, currentMonthEndDate.day);
+                setBit(&cron->daysOfMonth, currentMonthEndDate.day);
 
             } else if (options.lastDayOffset != 0) {  // "L-[1-30]"
                 adjustMonthLastDayOffset(cron, nextDateTime, options.lastDayOffset);
@@ -532,20 +641,20 @@ static void findNextDayOfMonth(CronExpression *cron, DateTime *nextDateTime) {
                 if (!isDateTimeEquals(&copyDateTime, nextDateTime)) {
                     resetDateTimeSettings(cron, CRON_HOUR, nextDateTime);
                 }
-                setBit(cron->daysOfMonth, nextDateTime->date.day);
+                setBit(&cron->daysOfMonth, nextDateTime->date.day);
             }
             currentMonth = nextDateTime->date.month;
         }
 
         if (isWeekdayQuartzOptionsSet && (nextDateTime->date.month != currentMonth || count == 0)) {
-            clearBitsInRange(cron->daysOfWeek, &WEEKDAY_RANGE);
+            clearBitsInRange(&cron->daysOfWeek, &WEEKDAY_RANGE);
             if (options.lastWeekdayOfMonth != 0) {   // "[0-7]L"
                 DateTime copyDateTime = *nextDateTime;
                 adjustLastWeekdayOfMonth(nextDateTime, options.lastWeekdayOfMonth);
                 if (!isDateTimeEquals(&copyDateTime, nextDateTime)) {
                     resetDateTimeSettings(cron, CRON_HOUR, nextDateTime);
                 }
-                setBit(cron->daysOfWeek, nextDateTime->date.weekDay);
+                setBit(&cron->daysOfWeek, nextDateTime->date.weekDay);
 
             } else if (options.numberOfWeekdays != 0) {   // "[0-7]#[0-9]"
                 DateTime copyDateTime = *nextDateTime;
@@ -554,7 +663,7 @@ static void findNextDayOfMonth(CronExpression *cron, DateTime *nextDateTime) {
                 if (!isDateTimeEquals(&copyDateTime, nextDateTime)) {
                     resetDateTimeSettings(cron, CRON_HOUR, nextDateTime);
                 }
-                setBit(cron->daysOfWeek, nextDateTime->date.weekDay);
+                setBit(&cron->daysOfWeek, nextDateTime->date.weekDay);
             }
             currentMonth = nextDateTime->date.month;
         }
@@ -578,9 +687,9 @@ static void findNextDayOfMonth(CronExpression *cron, DateTime *nextDateTime) {
 }
 
 static void findNextHour(CronExpression *cron, DateTime *nextDateTime) {
-    int32_t nextHour = nextSetBit(cron->hours, nextDateTime->time.hours, CRON_HOURS_LENGTH);
+    int32_t nextHour = nextSetBit(cron->hours, nextDateTime->time.hours);
     if (nextHour == BIT_NOT_FOUND) {
-        nextHour = nextSetBit(cron->hours, 0, CRON_HOURS_LENGTH);
+        nextHour = nextSetBit(cron->hours, 0);
         dateTimePlusDays(nextDateTime, 1);
     }
 
@@ -591,9 +700,9 @@ static void findNextHour(CronExpression *cron, DateTime *nextDateTime) {
 }
 
 static void findNextMinutes(CronExpression *cron, DateTime *nextDateTime) {
-    int32_t nextMinutes = nextSetBit(cron->minutes, nextDateTime->time.minutes, CRON_MINUTES_LENGTH);
+    int32_t nextMinutes = nextSetBit(cron->minutes, nextDateTime->time.minutes);
     if (nextMinutes == BIT_NOT_FOUND) {
-        nextMinutes = nextSetBit(cron->minutes, 0, CRON_MINUTES_LENGTH);
+        nextMinutes = nextSetBit(cron->minutes, 0);
         dateTimePlusHours(nextDateTime, 1);
     }
 
@@ -604,9 +713,9 @@ static void findNextMinutes(CronExpression *cron, DateTime *nextDateTime) {
 }
 
 static void findNextSeconds(CronExpression *cron, DateTime *nextDateTime) {
-    int32_t nextSeconds = nextSetBit(cron->seconds, nextDateTime->time.seconds, CRON_SECONDS_LENGTH);
+    int32_t nextSeconds = nextSetBit(cron->seconds, nextDateTime->time.seconds);
     if (nextSeconds == BIT_NOT_FOUND) {
-        nextSeconds = nextSetBit(cron->seconds, 0, CRON_SECONDS_LENGTH);
+        nextSeconds = nextSetBit(cron->seconds, 0);
         dateTimePlusMinutes(nextDateTime, 1);
     }
 
@@ -615,27 +724,27 @@ static void findNextSeconds(CronExpression *cron, DateTime *nextDateTime) {
     }
 }
 
-static void resetDateTimeSettings(CronExpression *cron, CronField fromField, DateTime *dateTime) {
+static void resetDateTimeSettings(const CronExpression *cron, CronField fromField, DateTime *dateTime) {
     for (CronField field = fromField; field >= CRON_SECOND; field--) {
         switch (field) {
             case CRON_MONTH:
-                dateTime->date.month = nextSetBit(cron->months, 0, CRON_MONTHS_LENGTH);
+                dateTime->date.month = nextSetBit(cron->months, 0);
                 dateTime->date.month = dateTime->date.month != 0 ? dateTime->date.month : JANUARY;
                 break;
             case CRON_DAY_OF_MONTH:
             case CRON_DAY_OF_WEEK:
-                dateTime->date.weekDay = nextSetBit(cron->daysOfWeek, 0, CRON_DAY_OF_WEEK_LENGTH);
-                dateTime->date.day = (int8_t)nextSetBit(cron->daysOfMonth, 0, CRON_DAY_OF_MONTH_LENGTH);
+                dateTime->date.weekDay = nextSetBit(cron->daysOfWeek, 0);
+                dateTime->date.day = (int8_t)nextSetBit(cron->daysOfMonth, 0);
                 dateTime->date.day = dateTime->date.day != 0 ? dateTime->date.day : 1;
                 break;
             case CRON_HOUR:
-                dateTime->time.hours = (int8_t)nextSetBit(cron->hours, 0, CRON_HOURS_LENGTH);
+                dateTime->time.hours = (int8_t)nextSetBit(cron->hours, 0);
                 break;
             case CRON_MINUTE:
-                dateTime->time.minutes = (int8_t)nextSetBit(cron->minutes, 0, CRON_MINUTES_LENGTH);
+                dateTime->time.minutes = (int8_t)nextSetBit(cron->minutes, 0);
                 break;
             case CRON_SECOND:
-                dateTime->time.seconds = (int8_t)nextSetBit(cron->seconds, 0, CRON_SECONDS_LENGTH);
+                dateTime->time.seconds = (int8_t)nextSetBit(cron->seconds, 0);
                 break;
         }
 
@@ -674,7 +783,7 @@ QuartzOptionHolder getQuartzOptions(CronExpression *cron, DateTime *nextDateTime
 static void adjustMonthLastDayOffset(CronExpression *cron, DateTime *nextDateTime, uint8_t lastDayOffset) {
     Date currentMonthEndDate = getLastDayOfMonthDate(&nextDateTime->date);
     dateMinusDays(&currentMonthEndDate, lastDayOffset);
-    setBit(cron->daysOfMonth, currentMonthEndDate.day);
+    setBit(&cron->daysOfMonth, currentMonthEndDate.day);
 }
 
 static void adjustDateToNearestWeekend(DateTime *nextDateTime, uint8_t nearestWeekday) {
@@ -806,41 +915,22 @@ static void setQuartzOption(CronExpression *cron, QuartzOption option, uint8_t v
     }
 }
 
-static void setBitsInRange(uint8_t *bits, const ValueRange *range) {
-    for (int64_t i = range->min; i <= range->max; i++) {
-        setBit(bits, i);
-    }
+static void setBitsInRange(uint64_t *bits, const ValueRange *range) {
+    *bits |= bitRangeMask(range);
 }
 
-static void clearBitsInRange(uint8_t *bits, const ValueRange *range) {
-    for (int64_t i = range->min; i <= range->max; i++) {
-        clearBit(bits, i);
-    }
+static void clearBitsInRange(uint64_t *bits, const ValueRange *range) {
+    *bits &= ~bitRangeMask(range);
 }
 
-static int32_t nextSetBit(uint8_t *bits, uint32_t fromIndex, uint32_t bitSetLength) {
-    for (uint32_t i = fromIndex; i < bitSetLength * BITS_IN_BYTE; i++) {
-        if (isBitSet(bits, i)) {
-            return (int32_t) i;
-        }
+static void setBit(uint64_t *bits, uint32_t bitIndex) {
+    if (bitIndex < CRON_BITSET_SIZE) {
+        *bits |= (1ULL << bitIndex);
     }
-    return BIT_NOT_FOUND;
-}
-
-static void setBit(uint8_t *bits, uint32_t bitIndex) {
-    uint8_t byteIndex = bitIndex / BITS_IN_BYTE;
-    uint8_t bitInByteIndex = bitIndex % BITS_IN_BYTE;
-    BIT_SET(bits[byteIndex], bitInByteIndex);
 }
 
-static void clearBit(uint8_t *bits, uint32_t bitIndex) {
-    uint8_t byteIndex = bitIndex / BITS_IN_BYTE;
-    uint8_t bitInByteIndex = bitIndex % BITS_IN_BYTE;
-    BIT_CLEAR(bits[byteIndex], bitInByteIndex);
-}
-
-static bool isBitSet(const uint8_t *bits, uint32_t bitIndex) {
-    uint8_t byteIndex = bitIndex / BITS_IN_BYTE;
-    uint8_t bitInByteIndex = bitIndex % BITS_IN_BYTE;
-    return BIT_READ(bits[byteIndex], bitInByteIndex);
+static void clearBit(uint64_t *bits, uint32_t bitIndex) {
+    if (bitIndex < CRON_BITSET_SIZE) {
+        *bits &= ~(1ULL << bitIndex);
+    }
 }
@@ -29,18 +29,29 @@ typedef enum CronStatus {
     CRON_ERROR_INVALID_DAY_OF_WEEK_VALUE_HASH,               // Invalid first value "[0-7]#[0-9]"
     CRON_ERROR_INVALID_NUMBER_OF_DAY_OF_MONTH_VALUE_HASH,    // Invalid second value "[0-7]#[0-9]"
     CRON_ERROR_UNKNOWN_CRON_FIELD,
+    CRON_ERROR_INVALID_BINARY_FORMAT,                         // serialized expression is corrupted or has other version
+    CRON_ERROR_BINARY_SOURCE_CHANGED,                         // serialized expression was compiled from other source string
 } CronStatus;
 
+// Each field is bitset packed into single 64-bit word, bit index is field value: seconds 0-59, days of month 1-31, months 1-12, weekdays 1-7
 typedef struct CronExpression {
-    uint8_t seconds[8];
-    uint8_t minutes[8];
-    uint8_t hours[3];
-    uint8_t daysOfMonth[4];
-    uint8_t months[2];
-    uint8_t daysOfWeek[1];       //    0          1           2          3
+    uint64_t seconds;
+    uint64_t minutes;
+    uint64_t hours;
+    uint64_t daysOfMonth;
+    uint64_t months;
+    uint64_t daysOfWeek;         //    0          1           2          3
     uint8_t quartzOptions[4];   // [flags], [dayOfMonth], [weekday], [weekdayNum]
 } CronExpression;
 
+// Incremental fire time iteration, each result continues from previous one instead of full search from start date
+typedef struct CronIterator {
+    const CronExpression *cron;
+    DateTime current;
+    bool isStarted;     // first result is searched from start date, next ones from previous result
+    bool isFinished;    // no more fire times or search failed
+} CronIterator;
+
 /*
          ┌───────────── second (0-59)
          │ ┌───────────── minute (0 - 59)
@@ -55,5 +66,25 @@ typedef struct CronExpression {
 
 CronStatus parseCronExpression(CronExpression *cron, const char *expression);
 
-DateTime nextCronDateTime(CronExpression *cron, DateTime *date);
-ZonedDateTime nextCronZonedDateTime(CronExpression *cron, ZonedDateTime *date);
+// Searches never modify expression, Quartz options are resolved on local copy, so one expression can be shared between searches
+DateTime nextCronDateTime(const CronExpression *cron, DateTime *date);
+/*
+ * Zone aware variant, fields are matched against local time and daylight saving transitions are resolved in single search:
+ * fire time in overlap (clocks moved back) is used only once, with earlier offset,
+ * fire times in gap (clocks moved forward) don't exist, so job fires once at the moment of transition.
+ */
+ZonedDateTime nextCronZonedDateTime(const CronExpression *cron, ZonedDateTime *date);
+
+#ifdef CRON_DEBUG_SEARCH_STEPS   // test builds only: field passes and day/year loop iterations of searches on calling thread
+uint32_t getCronSearchSteps();
+void resetCronSearchSteps();
+#endif
+
+// Usage: CronIterator iterator = getCronIterator(&cron, &now); DateTime next; while (hasNextCronDateTime(&iterator, &next)) {...}
+CronIterator getCronIterator(const CronExpression *cron, DateTime *from);
+bool hasNextCronDateTime(CronIterator *iterator, DateTime *next);
+
+// Fill results with up to count next fire times after date. Returns number of stored results
+uint32_t nextCronDateTimes(const CronExpression *cron, DateTime *date, DateTime *results, uint32_t count);
+// Fire times after date and not after until, up to capacity. Returns number of stored results
+uint32_t cronDateTimesUntil(const CronExpression *cron, DateTime *date, DateTime *until, DateTime *results, uint32_t capacity);
@@ -0,0 +1,54 @@
+#pragma once
+
+// Generated by scripts/perfect_hash.py from CronKeywords.phf, do not edit manually
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <strings.h>
+
+#ifndef PERFECT_HASH_OF_DEFINED
+#define PERFECT_HASH_OF_DEFINED
+static inline uint32_t perfectHashOf(const char *key, uint32_t length, uint32_t seed, bool isIgnoreCase) {
+    uint32_t hash = (2166136261UL ^ seed) * 16777619UL;
+    for (uint32_t i = 0; i < length; i++) {
+        uint8_t byte = (uint8_t) key[i];
+        hash ^= isIgnoreCase ? (byte | 0x20) : byte;
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+#endif
+
+#define CRON_MACRO_KEYWORD_COUNT 7
+#define CRON_MACRO_MIN_LENGTH 6
+#define CRON_MACRO_MAX_LENGTH 9
+
+typedef struct CronMacroKeyword {
+    const char *name;
+    uint8_t length;
+    const char *value;
+} CronMacroKeyword;
+
+static const int16_t CRON_MACRO_DISPLACEMENTS[CRON_MACRO_KEYWORD_COUNT] = {
+        0, 0, -6, 2, -3, 0, -1,
+};
+
+static const CronMacroKeyword CRON_MACRO_KEYWORDS[CRON_MACRO_KEYWORD_COUNT] = {
+        {"@hourly", 7, "0 0 * * * *"},
+        {"@annually", 9, "0 0 0 1 1 *"},
+        {"@weekly", 7, "0 0 0 * * 0"},
+        {"@monthly", 8, "0 0 0 1 * *"},
+        {"@daily", 6, "0 0 0 * * *"},
+        {"@yearly", 7, "0 0 0 1 1 *"},
+        {"@midnight", 9, "0 0 0 * * *"},
+};
+
+static inline const CronMacroKeyword *findCronMacroKeyword(const char *key, uint32_t length) {
+    if (key == NULL || length < CRON_MACRO_MIN_LENGTH || length > CRON_MACRO_MAX_LENGTH) return NULL;
+    int32_t displacement = CRON_MACRO_DISPLACEMENTS[perfectHashOf(key, length, 0, true) % CRON_MACRO_KEYWORD_COUNT];
+    uint32_t index = displacement < 0 ? (uint32_t) (-displacement - 1) : perfectHashOf(key, length, displacement, true) % CRON_MACRO_KEYWORD_COUNT;
+    const CronMacroKeyword *keyword = &CRON_MACRO_KEYWORDS[index];
+    return (keyword->length == length && strncasecmp(keyword->name, key, length) == 0) ? keyword : NULL;
+}
@@ -0,0 +1,150 @@
+#include "CronScheduler.h"
+
+#define CRON_JOB_NEVER_FIRES INT64_MAX
+
+static void scheduleCronJob(CronJob *job, DateTime *from);
+static void restoreQueueOrder(CronScheduler *scheduler, uint32_t index);
+static void siftUp(CronScheduler *scheduler, uint32_t index);
+static void siftDown(CronScheduler *scheduler, uint32_t index);
+static void swapQueueItems(CronScheduler *scheduler, uint32_t one, uint32_t two);
+
+
+CronScheduler *newCronScheduler(uint32_t capacity) {
+    CronScheduler *scheduler = malloc(sizeof(struct CronScheduler));
+    if (scheduler == NULL) return NULL;
+    scheduler->queue = malloc(sizeof(CronJob *) * capacity);
+    if (scheduler->queue == NULL) {
+        free(scheduler);
+        return NULL;
+    }
+    scheduler->size = 0;
+    scheduler->capacity = capacity;
+    return scheduler;
+}
+
+CronJob *cronSchedulerAdd(CronScheduler *scheduler, uint32_t id, const CronExpression *cron, void *payload, DateTime *from) {
+    if (scheduler == NULL || cron == NULL || from == NULL || scheduler->size >= scheduler->capacity) return NULL;
+    CronJob *job = malloc(sizeof(struct CronJob));
+    if (job == NULL) return NULL;
+
+    job->id = id;
+    job->payload = payload;
+    job->cron = *cron;  // job owns its copy, so caller can reuse or free its expression
+    scheduleCronJob(job, from);
+
+    job->queueIndex = scheduler->size;
+    scheduler->queue[scheduler->size++] = job;
+    siftUp(scheduler, job->queueIndex);
+    return job;
+}
+
+bool cronSchedulerUpdate(CronScheduler *scheduler, CronJob *job, const CronExpression *cron, DateTime *from) {
+    if (scheduler == NULL || job == NULL || from == NULL || job->queueIndex >= scheduler->size || scheduler->queue[job->queueIndex] != job) {
+        return false;
+    }
+    if (cron != NULL) {
+        job->cron = *cron;
+    }
+    scheduleCronJob(job, from);
+    restoreQueueOrder(scheduler, job->queueIndex);
+    return true;
+}
+
+void cronSchedulerRemove(CronScheduler *scheduler, CronJob *job) {
+    if (scheduler == NULL || job == NULL || job->queueIndex >= scheduler->size || scheduler->queue[job->queueIndex] != job) return;
+    uint32_t index = job->queueIndex;
+    uint32_t lastIndex = scheduler->size - 1;
+    if (index != lastIndex) {
+        swapQueueItems(scheduler, index, lastIndex);
+    }
+    scheduler->size--;
+    if (index < scheduler->size) {
+        restoreQueueOrder(scheduler, index);
+    }
+    free(job);
+}
+
+CronJob *findCronSchedulerJob(CronScheduler *scheduler, uint32_t id) {
+    if (scheduler == NULL) return NULL;
+    for (uint32_t i = 0; i < scheduler->size; i++) {
+        if (scheduler->queue[i]->id == id) {
+            return scheduler->queue[i];
+        }
+    }
+    return NULL;
+}
+
+CronJob *cronSchedulerPeek(CronScheduler *scheduler) {
+    if (scheduler == NULL || scheduler->size == 0) return NULL;
+    CronJob *job = scheduler->queue[0];
+    return job->nextEpochSecond != CRON_JOB_NEVER_FIRES ? job : NULL;
+}
+
+CronJob *cronSchedulerPoll(CronScheduler *scheduler, DateTime *now, DateTime *fireDateTime) {
+    CronJob *job = cronSchedulerPeek(scheduler);
+    if (job == NULL || now == NULL || job->nextEpochSecond > dateTimeToEpochSecond(now, 0)) return NULL;
+
+    if (fireDateTime != NULL) {
+        *fireDateTime = job->nextDateTime;
+    }
+    DateTime fromDateTime = isDateTimeAfter(now, &job->nextDateTime) ? *now : job->nextDateTime;    // missed fire times are not replayed
+    scheduleCronJob(job, &fromDateTime);    // next fire time is strictly after current one and after now
+    siftDown(scheduler, 0);
+    return job;
+}
+
+void deleteCronScheduler(CronScheduler *scheduler) {
+    if (scheduler == NULL) return;
+    for (uint32_t i = 0; i < scheduler->size; i++) {
+        free(scheduler->queue[i]);
+    }
+    free(scheduler->queue);
+    free(scheduler);
+}
+
+static void scheduleCronJob(CronJob *job, DateTime *from) {
+    job->nextDateTime = nextCronDateTime(&job->cron, from);
+    job->nextEpochSecond = isDateTimeValid(&job->nextDateTime) ? dateTimeToEpochSecond(&job->nextDateTime, 0) : CRON_JOB_NEVER_FIRES;
+}
+
+static void restoreQueueOrder(CronScheduler *scheduler, uint32_t index) {   // key at index may be moved in any direction
+    if (index > 0 && scheduler->queue[index]->nextEpochSecond < scheduler->queue[(index - 1) / 2]->nextEpochSecond) {
+        siftUp(scheduler, index);
+    } else {
+        siftDown(scheduler, index);
+    }
+}
+
+static void siftUp(CronScheduler *scheduler, uint32_t index) {
+    while (index > 0) {
+        uint32_t parentIndex = (index - 1) / 2;
+        if (scheduler->queue[parentIndex]->nextEpochSecond <= scheduler->queue[index]->nextEpochSecond) break;
+        swapQueueItems(scheduler, parentIndex, index);
+        index = parentIndex;
+    }
+}
+
+static void siftDown(CronScheduler *scheduler, uint32_t index) {
+    while (true) {
+        uint32_t leftIndex = index * 2 + 1;
+        uint32_t rightIndex = leftIndex + 1;
+        uint32_t smallestIndex = index;
+        if (leftIndex < scheduler->size && scheduler->queue[leftIndex]->nextEpochSecond < scheduler->queue[smallestIndex]->nextEpochSecond) {
+            smallestIndex = leftIndex;
+        }
+        if (rightIndex < scheduler->size && scheduler->queue[rightIndex]->nextEpochSecond < scheduler->queue[smallestIndex]->nextEpochSecond) {
+            smallestIndex = rightIndex;
+        }
+        if (smallestIndex == index) break;
+        swapQueueItems(scheduler, index, smallestIndex);
+        index = smallestIndex;
+    }
+}
+
+static void swapQueueItems(CronScheduler *scheduler, uint32_t one, uint32_t two) {
+    CronJob *job = scheduler->queue[one];
+    scheduler->queue[one] = scheduler->queue[two];
+    scheduler->queue[two] = job;
+    scheduler->queue[one]->queueIndex = one;
+    scheduler->queue[two]->queueIndex = two;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdlib.h>
+#include "CronExpression.h"
+
+// Holds many cron jobs and answers which one fires next.
+// Jobs are kept in binary min-heap by next fire time: peek is O(1), add/update/remove/poll are O(log n).
+
+typedef struct CronJob {
+    uint32_t id;
+    void *payload;
+    CronExpression cron;
+    DateTime nextDateTime;      // invalid date time when expression has no more fire times
+    int64_t nextEpochSecond;    // heap key, INT64_MAX when job never fires
+    uint32_t queueIndex;        // position in scheduler queue
+} CronJob;
+
+typedef struct CronScheduler {
+    CronJob **queue;
+    uint32_t size;
+    uint32_t capacity;
+} CronScheduler;
+
+CronScheduler *newCronScheduler(uint32_t capacity);
+
+// Returned job pointer is stable until removed, use it as handle for update and remove. NULL when scheduler is full
+CronJob *cronSchedulerAdd(CronScheduler *scheduler, uint32_t id, const CronExpression *cron, void *payload, DateTime *from);
+// Replace job expression (or keep current one when cron is NULL) and schedule it from given date
+bool cronSchedulerUpdate(CronScheduler *scheduler, CronJob *job, const CronExpression *cron, DateTime *from);
+void cronSchedulerRemove(CronScheduler *scheduler, CronJob *job);
+CronJob *findCronSchedulerJob(CronScheduler *scheduler, uint32_t id);   // linear search, keep handles when lookup is frequent
+
+CronJob *cronSchedulerPeek(CronScheduler *scheduler);   // earliest job, NULL when empty or no job will ever fire
+/*
+ * Take earliest job that fires at or before now: fire time is stored to fireDateTime, then job is rescheduled to its next fire time after now.
+ * Fire times missed while not polling (sleep, clock jump forward) are coalesced into this single run, job is not fired for each of them.
+ * Returns NULL when no job is due. Call in loop to collect all due jobs.
+ */
+CronJob *cronSchedulerPoll(CronScheduler *scheduler, DateTime *now, DateTime *fireDateTime);
+
+void deleteCronScheduler(CronScheduler *scheduler);
+
+static inline uint32_t getCronSchedulerSize(CronScheduler *scheduler) {
+    return scheduler != NULL ? scheduler->size : 0;
+}
@@ -0,0 +1,115 @@
+#include "CronStore.h"
+
+#define CRON_BINARY_MAGIC 0xC5
+#define CRON_BINARY_VERSION 1
+#define CRON_BINARY_HEADER_SIZE 6
+#define CRON_BINARY_CHECKSUM_SIZE 2
+#define CRON_QUARTZ_OPTIONS_SIZE 4
+
+typedef struct CronParseCacheEntry {
+    char source[CRON_PARSE_CACHE_SOURCE_SIZE];
+    bool isUsed;
+    CronExpression cron;
+} CronParseCacheEntry;
+
+static const uint8_t CRON_FIELD_BYTES[] = {8, 8, 3, 4, 2, 1};    // only bytes that can have set bits: seconds 0-59 ... weekdays 1-7
+
+static CronParseCacheEntry parseCache[CRON_PARSE_CACHE_SIZE];
+static uint32_t nextCacheEntryIndex = 0;
+
+static uint64_t *getCronField(CronExpression *cron, uint32_t index);
+static void writeLittleEndian(uint8_t *buffer, uint64_t value, uint8_t byteCount);
+static uint64_t readLittleEndian(const uint8_t *buffer, uint8_t byteCount);
+
+
+uint32_t serializeCronExpression(CronExpression *cron, const char *source, uint8_t *buffer, uint32_t bufferSize) {
+    if (cron == NULL || source == NULL || buffer == NULL || bufferSize < CRON_BINARY_SIZE) return 0;
+    uint8_t *pointer = buffer;
+    *pointer++ = CRON_BINARY_MAGIC;
+    *pointer++ = CRON_BINARY_VERSION;
+    writeLittleEndian(pointer, generateCRC32(source, strlen(source)), sizeof(uint32_t));
+    pointer += sizeof(uint32_t);
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(CRON_FIELD_BYTES); i++) {
+        writeLittleEndian(pointer, *getCronField(cron, i), CRON_FIELD_BYTES[i]);
+        pointer += CRON_FIELD_BYTES[i];
+    }
+    memcpy(pointer, cron->quartzOptions, CRON_QUARTZ_OPTIONS_SIZE);
+    pointer += CRON_QUARTZ_OPTIONS_SIZE;
+
+    uint16_t checksum = generateCRC16((const char *) buffer, pointer - buffer);
+    writeLittleEndian(pointer, checksum, CRON_BINARY_CHECKSUM_SIZE);
+    return CRON_BINARY_SIZE;
+}
+
+CronStatus deserializeCronExpression(CronExpression *cron, const char *source, const uint8_t *buffer, uint32_t length) {
+    if (cron == NULL || source == NULL || buffer == NULL || length < CRON_BINARY_SIZE) return CRON_ERROR_INVALID_BINARY_FORMAT;
+    if (buffer[0] != CRON_BINARY_MAGIC || buffer[1] != CRON_BINARY_VERSION) return CRON_ERROR_INVALID_BINARY_FORMAT;
+
+    uint32_t checksumOffset = CRON_BINARY_SIZE - CRON_BINARY_CHECKSUM_SIZE;
+    uint16_t checksum = readLittleEndian(buffer + checksumOffset, CRON_BINARY_CHECKSUM_SIZE);
+    if (checksum != generateCRC16((const char *) buffer, checksumOffset)) return CRON_ERROR_INVALID_BINARY_FORMAT;
+    if (readLittleEndian(buffer + 2, sizeof(uint32_t)) != generateCRC32(source, strlen(source))) return CRON_ERROR_BINARY_SOURCE_CHANGED;
+
+    memset(cron, 0, sizeof(struct CronExpression));
+    const uint8_t *pointer = buffer + CRON_BINARY_HEADER_SIZE;
+    for (uint32_t i = 0; i < ARRAY_SIZE(CRON_FIELD_BYTES); i++) {
+        *getCronField(cron, i) = readLittleEndian(pointer, CRON_FIELD_BYTES[i]);
+        pointer += CRON_FIELD_BYTES[i];
+    }
+    memcpy(cron->quartzOptions, pointer, CRON_QUARTZ_OPTIONS_SIZE);
+    return CRON_OK;
+}
+
+const CronExpression *parseCronExpressionCached(const char *expression, CronStatus *status) {
+    if (expression == NULL) {
+        if (status != NULL) *status = CRON_ERROR_EMPTY_STRING;
+        return NULL;
+    }
+
+    bool isCacheable = strnlen(expression, CRON_PARSE_CACHE_SOURCE_SIZE) < CRON_PARSE_CACHE_SOURCE_SIZE;
+    for (uint32_t i = 0; isCacheable && i < CRON_PARSE_CACHE_SIZE; i++) {
+        CronParseCacheEntry *entry = &parseCache[i];
+        if (entry->isUsed && strcmp(entry->source, expression) == 0) {
+            if (status != NULL) *status = CRON_OK;
+            return &entry->cron;
+        }
+    }
+
+    CronParseCacheEntry *entry = &parseCache[nextCacheEntryIndex];    // replace oldest entry
+    CronStatus parseStatus = parseCronExpression(&entry->cron, expression);
+    if (status != NULL) *status = parseStatus;
+    if (parseStatus != CRON_OK) {
+        entry->isUsed = false;
+        return NULL;
+    }
+
+    entry->isUsed = isCacheable;    // too long source still gets the slot, but is never matched
+    if (isCacheable) strcpy(entry->source, expression);
+    nextCacheEntryIndex = (nextCacheEntryIndex + 1) % CRON_PARSE_CACHE_SIZE;
+    return &entry->cron;
+}
+
+void clearCronParseCache() {
+    memset(parseCache, 0, sizeof(parseCache));
+    nextCacheEntryIndex = 0;
+}
+
+static uint64_t *getCronField(CronExpression *cron, uint32_t index) {
+    uint64_t *fields[] = {&cron->seconds, &cron->minutes, &cron->hours, &cron->daysOfMonth, &cron->months, &cron->daysOfWeek};
+    return fields[index];
+}
+
+static void writeLittleEndian(uint8_t *buffer, uint64_t value, uint8_t byteCount) {
+    for (uint8_t i = 0; i < byteCount; i++) {
+        buffer[i] = (uint8_t) (value >> (i * 8));
+    }
+}
+
+static uint64_t readLittleEndian(const uint8_t *buffer, uint8_t byteCount) {
+    uint64_t value = 0;
+    for (uint8_t i = 0; i < byteCount; i++) {
+        value |= ((uint64_t) buffer[i]) << (i * 8);
+    }
+    return value;
+}
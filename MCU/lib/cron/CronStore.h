@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CronExpression.h"
+#include "CRC.h"
+
+// Store parsed expressions without parsing them again: compact binary form for persistent or RTC memory, and in-memory parse cache.
+// Binary form is keyed by CRC32 of source string and cache by source text, so changed expression in config is always detected and parsed again.
+
+#define CRON_BINARY_SIZE 38     // header(6) + bitsets(26) + quartz options(4) + CRC16(2)
+#define CRON_PARSE_CACHE_SIZE 4
+#define CRON_PARSE_CACHE_SOURCE_SIZE 64     // longer expressions are parsed on each call
+
+/*
+ * Layout: [magic][version][source CRC32 LE][seconds 8][minutes 8][hours 3][days of month 4][months 2][days of week 1][quartz 4][CRC16 LE]
+ * Returns number of written bytes, 0 when buffer is too small.
+ */
+uint32_t serializeCronExpression(CronExpression *cron, const char *source, uint8_t *buffer, uint32_t bufferSize);
+// Returns CRON_OK and restores expression, when buffer is valid and was serialized from the same source string
+CronStatus deserializeCronExpression(CronExpression *cron, const char *source, const uint8_t *buffer, uint32_t length);
+
+/*
+ * Parse with cache: for unchanged source the same compiled object is returned, without parsing. Searches don't modify it, copy it to change it.
+ * Returns NULL when expression is invalid, parse status is stored to status when it is not NULL.
+ * Cache is shared and not synchronized, use it from one task.
+ */
+const CronExpression *parseCronExpressionCached(const char *expression, CronStatus *status);
+void clearCronParseCache();
@@ -115,40 +115,50 @@ static CspTableString *renderTemplate(CspRenderer *renderer) {
             continue;
 
         } else if (isStartsWithCspOpenTag(renderer->templateText)) {
-            if (isStartsWithCspIf(renderer->templateText)) {
-                renderBranchingTag(renderer, CSP_TAG_IF);
-
-            } else if (isStartsWithCspElseIf(renderer->templateText)) {
-                renderBranchingTag(renderer, CSP_TAG_ELSE_IF);
-
-            } else if (isStartsWithCspElse(renderer->templateText)) {
-                renderer->tagIndex++;
-                skipUntilTagEnd(renderer);
-                skipNextWhitespaces(renderer);
-
-            } else if (isStartsWithCspLoop(renderer->templateText)) {
-                skipUntilTagEnd(renderer);
-                skipNextWhitespaces(renderer);
-                renderLoopTag(renderer);
-
-            } else if (isStartsWithCspVar(renderer->templateText)) {
-                skipUntilTagEnd(renderer);
-                skipNextWhitespaces(renderer);
-                renderVarTag(renderer);
-
-            } else if (isStartsWithCspRender(renderer->templateText)) {
-                skipUntilTagEnd(renderer);
-                skipNextWhitespaces(renderer);
-                renderRenderTag(renderer);
+            const CspTagKindData *tag = findCspTag(renderer->templateText);
+            switch (tag != NULL ? tag->kind : CSP_TAG_PARAM) {
+                case CSP_TAG_IF:
+                case CSP_TAG_ELSE_IF:
+                    renderBranchingTag(renderer, tag->kind);
+                    break;
+
+                case CSP_TAG_ELSE:
+                    renderer->tagIndex++;
+                    skipUntilTagEnd(renderer);
+                    skipNextWhitespaces(renderer);
+                    break;
+
+                case CSP_TAG_LOOP:
+                    skipUntilTagEnd(renderer);
+                    skipNextWhitespaces(renderer);
+                    renderLoopTag(renderer);
+                    break;
+
+                case CSP_TAG_SET:
+                    skipUntilTagEnd(renderer);
+                    skipNextWhitespaces(renderer);
+                    renderVarTag(renderer);
+                    break;
+
+                case CSP_TAG_RENDER:
+                    skipUntilTagEnd(renderer);
+                    skipNextWhitespaces(renderer);
+                    renderRenderTag(renderer);
+                    break;
+
+                default:
+                    break;
             }
 
         } else if (isStartsWithCspCloseTag(renderer->templateText)) {
-            if (isStartsWithCspEndIf(renderer->templateText) || isStartsWithCspEndElseIf(renderer->templateText)) {
+            const CspTagKindData *tag = findCspTag(renderer->templateText);
+            CspTagKind kind = tag != NULL ? tag->kind : CSP_TAG_PARAM;
+            if (kind == CSP_TAG_END_IF || kind == CSP_TAG_END_ELSE_IF) {
                 skipUntilTagEnd(renderer);
                 renderer->tagIndex++;
                 return renderer->tableStr;
 
-            } else if (isStartsWithCspEndLoop(renderer->templateText)) {
+            } else if (kind == CSP_TAG_END_LOOP) {
                 return renderer->tableStr;
 
             }
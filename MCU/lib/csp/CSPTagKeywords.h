@@ -0,0 +1,84 @@
+#pragma once
+
+// Generated by scripts/perfect_hash.py from CSPTagKeywords.phf, do not edit manually
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <strings.h>
+#include "CSPDataUtils.h"
+
+#ifndef PERFECT_HASH_OF_DEFINED
+#define PERFECT_HASH_OF_DEFINED
+static inline uint32_t perfectHashOf(const char *key, uint32_t length, uint32_t seed, bool isIgnoreCase) {
+    uint32_t hash = (2166136261UL ^ seed) * 16777619UL;
+    for (uint32_t i = 0; i < length; i++) {
+        uint8_t byte = (uint8_t) key[i];
+        hash ^= isIgnoreCase ? (byte | 0x20) : byte;
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+#endif
+
+#define CSP_OPEN_TAG_KEYWORD_COUNT 6
+#define CSP_OPEN_TAG_MIN_LENGTH 2
+#define CSP_OPEN_TAG_MAX_LENGTH 6
+
+typedef struct CspOpenTagKeyword {
+    const char *name;
+    uint8_t length;
+    const CspTagKindData *value;
+} CspOpenTagKeyword;
+
+static const int16_t CSP_OPEN_TAG_DISPLACEMENTS[CSP_OPEN_TAG_KEYWORD_COUNT] = {
+        -5, 4, 0, 0, -3, -1,
+};
+
+static const CspOpenTagKeyword CSP_OPEN_TAG_KEYWORDS[CSP_OPEN_TAG_KEYWORD_COUNT] = {
+        {"set", 3, &CSP_VAR},
+        {"loop", 4, &CSP_LOOP},
+        {"if", 2, &CSP_IF},
+        {"elseif", 6, &CSP_ELSE_IF},
+        {"else", 4, &CSP_ELSE},
+        {"render", 6, &CSP_RENDER},
+};
+
+static inline const CspOpenTagKeyword *findCspOpenTagKeyword(const char *key, uint32_t length) {
+    if (key == NULL || length < CSP_OPEN_TAG_MIN_LENGTH || length > CSP_OPEN_TAG_MAX_LENGTH) return NULL;
+    int32_t displacement = CSP_OPEN_TAG_DISPLACEMENTS[perfectHashOf(key, length, 0, true) % CSP_OPEN_TAG_KEYWORD_COUNT];
+    uint32_t index = displacement < 0 ? (uint32_t) (-displacement - 1) : perfectHashOf(key, length, displacement, true) % CSP_OPEN_TAG_KEYWORD_COUNT;
+    const CspOpenTagKeyword *keyword = &CSP_OPEN_TAG_KEYWORDS[index];
+    return (keyword->length == length && strncasecmp(keyword->name, key, length) == 0) ? keyword : NULL;
+}
+
+#define CSP_CLOSE_TAG_KEYWORD_COUNT 5
+#define CSP_CLOSE_TAG_MIN_LENGTH 2
+#define CSP_CLOSE_TAG_MAX_LENGTH 6
+
+typedef struct CspCloseTagKeyword {
+    const char *name;
+    uint8_t length;
+    const CspTagKindData *value;
+} CspCloseTagKeyword;
+
+static const int16_t CSP_CLOSE_TAG_DISPLACEMENTS[CSP_CLOSE_TAG_KEYWORD_COUNT] = {
+        0, 2, -5, -3, 0,
+};
+
+static const CspCloseTagKeyword CSP_CLOSE_TAG_KEYWORDS[CSP_CLOSE_TAG_KEYWORD_COUNT] = {
+        {"if", 2, &CSP_END_IF},
+        {"loop", 4, &CSP_END_LOOP},
+        {"elseif", 6, &CSP_END_ELSE_IF},
+        {"else", 4, &CSP_END_ELSE},
+        {"var", 3, &CSP_END_VAR},
+};
+
+static inline const CspCloseTagKeyword *findCspCloseTagKeyword(const char *key, uint32_t length) {
+    if (key == NULL || length < CSP_CLOSE_TAG_MIN_LENGTH || length > CSP_CLOSE_TAG_MAX_LENGTH) return NULL;
+    int32_t displacement = CSP_CLOSE_TAG_DISPLACEMENTS[perfectHashOf(key, length, 0, true) % CSP_CLOSE_TAG_KEYWORD_COUNT];
+    uint32_t index = displacement < 0 ? (uint32_t) (-displacement - 1) : perfectHashOf(key, length, displacement, true) % CSP_CLOSE_TAG_KEYWORD_COUNT;
+    const CspCloseTagKeyword *keyword = &CSP_CLOSE_TAG_KEYWORDS[index];
+    return (keyword->length == length && strncasecmp(keyword->name, key, length) == 0) ? keyword : NULL;
+}
@@ -201,87 +201,67 @@ static CspTemplate *parseHtmlTemplate(CspTemplate *cspTemplate) {
         }
 
         if (cspTemplate->remainingLength > CSP_TARGET_TAG_LENGTH && isStartsWithCspOpenTag(cspTemplate->nextKind)) {
-            if (isStartsWithCspIf(cspTemplate->nextKind)) {
-                cspTemplate->nextKind += CSP_IF.length;
-                parseIfTag(cspTemplate, CSP_IF.kind);
-                openedTagCount++;
-
-            } else if (isStartsWithCspVar(cspTemplate->nextKind )) {
-                cspTemplate->nextKind += CSP_VAR.length;
-                parseVarTag(cspTemplate);
-
-            } else if (isStartsWithCspElseIf(cspTemplate->nextKind)) {
-                cspTemplate->nextKind += CSP_ELSE_IF.length;
-                if (!haveValidPreviousBranching(cspTemplate)) {
-                    formatCspTemplateError(cspTemplate, "Invalid '" CSP_ELSE_IF_TAG_NAME "' branching");
+            const CspTagKindData *tag = findCspTag(cspTemplate->nextKind);
+            if (tag == NULL) {
+                formatCspTemplateError(cspTemplate, "Unknown tag after [" CSP_TARGET_TAG" ]");
+                return cspTemplate;
+            }
+
+            cspTemplate->nextKind += tag->length;
+            switch (tag->kind) {
+                case CSP_TAG_IF:
+                    parseIfTag(cspTemplate, CSP_TAG_IF);
+                    openedTagCount++;
                     break;
-                }
 
-                parseIfTag(cspTemplate, CSP_ELSE_IF.kind);
-                openedTagCount++;
+                case CSP_TAG_SET:
+                    parseVarTag(cspTemplate);
+                    break;
 
-            } else if (isStartsWithCspElse(cspTemplate->nextKind)) {
-                cspTemplate->nextKind += CSP_ELSE.length;
-                if (!haveValidPreviousBranching(cspTemplate)) {
-                    formatCspTemplateError(cspTemplate, "Invalid '" CSP_ELSE_TAG_NAME "' branching");
+                case CSP_TAG_ELSE_IF:
+                    if (!haveValidPreviousBranching(cspTemplate)) {
+                        formatCspTemplateError(cspTemplate, "Invalid '" CSP_ELSE_IF_TAG_NAME "' branching");
+                        return cspTemplate;
+                    }
+                    parseIfTag(cspTemplate, CSP_TAG_ELSE_IF);
+                    openedTagCount++;
                     break;
-                }
 
-                CspTagNode *tagNode = newCspTagNode(cspTemplate, CSP_TAG_ELSE);
-                if (tagNode == NULL) break;
-                vectorAdd(cspTemplate->tagVector, tagNode);
-                openedTagCount++;
+                case CSP_TAG_ELSE: {
+                    if (!haveValidPreviousBranching(cspTemplate)) {
+                        formatCspTemplateError(cspTemplate, "Invalid '" CSP_ELSE_TAG_NAME "' branching");
+                        return cspTemplate;
+                    }
 
-            } else if (isStartsWithCspRender(cspTemplate->nextKind)) {
-                cspTemplate->nextKind += CSP_RENDER.length;
-                parseRenderTag(cspTemplate);
+                    CspTagNode *tagNode = newCspTagNode(cspTemplate, CSP_TAG_ELSE);
+                    if (tagNode == NULL) return cspTemplate;
+                    vectorAdd(cspTemplate->tagVector, tagNode);
+                    openedTagCount++;
+                    break;
+                }
 
-            } else if (isStartsWithCspLoop(cspTemplate->nextKind)) {
-                cspTemplate->nextKind += CSP_LOOP.length;
-                parseLoopTag(cspTemplate);
-                openedTagCount++;
+                case CSP_TAG_RENDER:
+                    parseRenderTag(cspTemplate);
+                    break;
 
-            } else {
-                formatCspTemplateError(cspTemplate, "Unknown tag after [" CSP_TARGET_TAG" ]");
-                return cspTemplate;
+                default:    // CSP_TAG_LOOP
+                    parseLoopTag(cspTemplate);
+                    openedTagCount++;
+                    break;
             }
 
         } else if (cspTemplate->remainingLength >= CSP_TARGET_END_TAG_LENGTH && isStartsWithCspCloseTag(cspTemplate->nextKind)) {
-            if (isStartsWithCspEndIf(cspTemplate->nextKind)) {
-                cspTemplate->nextKind += CSP_END_IF.length;
-                CspTagNode *tagNode = newCspTagNode(cspTemplate, CSP_END_IF.kind);
-                vectorAdd(cspTemplate->tagVector, tagNode);
-                closedTagCount++;
-
-            } else if (isStartsWithCspEndElseIf(cspTemplate->nextKind)) {
-                cspTemplate->nextKind += CSP_END_ELSE_IF.length;
-                CspTagNode *tagNode = newCspTagNode(cspTemplate, CSP_END_ELSE_IF.kind);
-                vectorAdd(cspTemplate->tagVector, tagNode);
-                closedTagCount++;
-
-            } else if (isStartsWithCspEndElse(cspTemplate->nextKind)) {
-                cspTemplate->nextKind += CSP_END_ELSE.length;
-                CspTagNode *tagNode = newCspTagNode(cspTemplate, CSP_END_ELSE.kind);
-                vectorAdd(cspTemplate->tagVector, tagNode);
-                closedTagCount++;
-
-            } else if (isStartsWithCspEndLoop(cspTemplate->nextKind)) {
-                cspTemplate->nextKind += CSP_END_LOOP.length;
-                CspTagNode *tagNode = newCspTagNode(cspTemplate, CSP_END_LOOP.kind);
-                vectorAdd(cspTemplate->tagVector, tagNode);
-                closedTagCount++;
-
-            } else if (isStartsWithCspEndVar(cspTemplate->nextKind)) {
-                cspTemplate->nextKind += CSP_END_VAR.length;
-                CspTagNode *tagNode = newCspTagNode(cspTemplate, CSP_END_VAR.kind);
-                vectorAdd(cspTemplate->tagVector, tagNode);
-                closedTagCount++;
-
-            } else {
+            const CspTagKindData *tag = findCspTag(cspTemplate->nextKind);
+            if (tag == NULL) {
                 formatCspTemplateError(cspTemplate, "Unknown closing tag after [" CSP_TARGET_END_TAG "]");
                 return cspTemplate;
             }
 
+            cspTemplate->nextKind += tag->length;
+            CspTagNode *tagNode = newCspTagNode(cspTemplate, tag->kind);
+            vectorAdd(cspTemplate->tagVector, tagNode);
+            closedTagCount++;
+
         } else if (cspTemplate->remainingLength >= CSP_PARAMETER_START_LENGTH && isStartsWithCspParam(cspTemplate->nextKind)) {
             uint32_t paramLength = parseParamValue(cspTemplate);
             if (paramLength == 0) break;
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <ctype.h>
 #include "FileUtils.h"
 #include "Vector.h"
 #include "HashMap.h"
 #include "CSPCompiler.h"
 #include "CSPDataUtils.h"
+#include "CSPTagKeywords.h"
 
 #ifndef CSP_MAX_NESTED_INCLUDES
 #define CSP_MAX_NESTED_INCLUDES 10
@@ -43,6 +45,24 @@ typedef struct CspTagNode {
 } CspTagNode;
 
 
+static inline const CspTagKindData *findCspTag(const char *htmlString) {   // resolves "<csp:name" or "</csp:name", NULL for any other text
+    bool isCloseTag = isStartsWithCspCloseTag(htmlString);
+    if (!isCloseTag && !isStartsWithCspOpenTag(htmlString)) return NULL;
+
+    const char *tagName = htmlString + (isCloseTag ? CSP_TARGET_END_TAG_LENGTH : CSP_TARGET_TAG_LENGTH);
+    uint32_t tagNameLength = 0;
+    while (isalpha((int) tagName[tagNameLength])) {
+        tagNameLength++;
+    }
+
+    if (isCloseTag) {
+        const CspCloseTagKeyword *closeTag = findCspCloseTagKeyword(tagName, tagNameLength);
+        return closeTag != NULL ? closeTag->value : NULL;
+    }
+    const CspOpenTagKeyword *openTag = findCspOpenTagKeyword(tagName, tagNameLength);
+    return openTag != NULL ? openTag->value : NULL;
+}
+
 CspTemplate *newCspTemplate(const char *fileName);
 
 bool isCspTemplateOk(CspTemplate *cspTemplate);
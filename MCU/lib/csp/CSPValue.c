@@ -1,6 +1,7 @@
 #include "CSPValue.h"
 
 #define CSP_CONCAT_STRINGS(dest, one, two) (strcat(strcpy(dest, (one)), (two)))
+#define IS_CSP_MAP_INLINE_STORAGE(hashMap) ((hashMap)->entries == (hashMap)->inlineEntries)
 
 static CspObjectString *allocateStringObject(uint16_t length, bool isConstant);
 static char *copyStringValue(const char *src, uint16_t length);
@@ -67,17 +68,14 @@ CspObjectMap *newCspMapObject(uint32_t initCapacity, bool isConstant) {
 }
 
 CspHashMap *newCspHashMap(uint32_t capacity) {
-    CspHashMap *hashMapInstance = malloc(sizeof(struct CspHashMap));
+    uint32_t alignedCapacity = nextPowerOfTwo(capacity);
+    CspHashMap *hashMapInstance = calloc(1, sizeof(struct CspHashMap) + (sizeof(struct CspMapEntry) * alignedCapacity));
     if (hashMapInstance == NULL) return NULL;
 
     hashMapInstance->size = 0;
-    hashMapInstance->capacity = nextPowerOfTwo(capacity);
+    hashMapInstance->capacity = alignedCapacity;
     hashMapInstance->deletedItemsCount = 0;
-    hashMapInstance->entries = calloc(hashMapInstance->capacity, sizeof(struct CspMapEntry));
-    if (hashMapInstance->entries == NULL) {
-        free(hashMapInstance);
-        return NULL;
-    }
+    hashMapInstance->entries = hashMapInstance->inlineEntries;
     return hashMapInstance;
 }
 
@@ -151,7 +149,9 @@ void cspMapDelete(CspHashMap *hashMap) {
                 deleteCspValue(entry.value);
             }
         }
-        free(hashMap->entries);
+        if (!IS_CSP_MAP_INLINE_STORAGE(hashMap)) {
+            free(hashMap->entries);
+        }
         free(hashMap);
     }
 }
@@ -361,7 +361,9 @@ static bool adjustCspHashMapCapacity(CspHashMap *hashMap, uint32_t capacity) {
         hashMap->size++;
     }
 
-    free(hashMap->entries);
+    if (!IS_CSP_MAP_INLINE_STORAGE(hashMap)) {
+        free(hashMap->entries);
+    }
     hashMap->entries = newEntries;
     hashMap->capacity = capacity;
     hashMap->deletedItemsCount = 0;
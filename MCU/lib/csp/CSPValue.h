@@ -118,6 +118,7 @@ struct CspHashMap {
     uint16_t capacity;
     uint16_t deletedItemsCount;
     CspMapEntry *entries;
+    CspMapEntry inlineEntries[];    // initial table shares the map allocation, spills to heap on first resize
 };
 
 static CspObject *createdObjects = NULL;
@@ -0,0 +1,47 @@
+#include "Clock.h"
+
+typedef struct ClockBase {
+    bool isValid;
+    uint32_t syncGeneration;
+    int64_t wallMicros;
+    int64_t monotonicMicros;
+} ClockBase;
+
+static volatile uint32_t clockSyncGeneration = 0;
+static __thread ClockBase clockBase;   // one per task, so no locking needed
+
+
+void syncClock() {
+    clockSyncGeneration++;  // any change is enough, so lost concurrent increment is not a problem
+}
+
+int64_t clockEpochMicros() {
+    ClockBase *base = &clockBase;
+    uint32_t syncGeneration = clockSyncGeneration;
+    int64_t monotonicMicros = clockMonotonicMicros();
+    int64_t elapsedMicros = monotonicMicros - base->monotonicMicros;
+
+    if (!base->isValid || base->syncGeneration != syncGeneration || elapsedMicros < 0 || elapsedMicros >= CLOCK_RESYNC_INTERVAL_MICROS) {
+        base->wallMicros = clockWallMicros();
+        base->monotonicMicros = monotonicMicros;
+        base->syncGeneration = syncGeneration;
+        base->isValid = true;
+        return base->wallMicros;
+    }
+    return base->wallMicros + elapsedMicros;
+}
+
+Instant clockInstant() {
+    int64_t epochMicros = clockEpochMicros();
+    return (Instant) {.seconds = floorDiv(epochMicros, MICROS_PER_SECOND), .micros = (int32_t) floorMod(epochMicros, MICROS_PER_SECOND)};
+}
+
+ZonedDateTime clockZonedDateTime(const TimeZone *zone) {
+    if (zone == NULL) {
+        zone = &UTC;
+    }
+    Instant now = clockInstant();
+    int32_t offset = resolveTimeZoneOffset(now.seconds, zone);   // cached until next zone transition
+    DateTime dateTime = dateTimeOfEpochSeconds(now.seconds, now.micros, offset);
+    return (ZonedDateTime) {.dateTime = dateTime, .zone = *zone, .offset = offset};
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Instant.h"
+#include "ZonedDateTime.h"
+
+#define CLOCK_RESYNC_INTERVAL_MICROS (60 * MICROS_PER_SECOND)   // wall clock is read again at least that often to follow its corrections
+
+/* Time sources for the clock. Should be implemented on the driver side.
+ * Wall clock returns UTC microseconds from the epoch of 1970-01-01T00:00:00Z.
+ * Monotonic clock returns microseconds from any origin and never goes back, for example time since boot*/
+extern int64_t clockWallMicros();
+extern int64_t clockMonotonicMicros();
+
+/* Current time is wall clock base plus monotonic time elapsed from it, so most calls read the monotonic clock only.
+ * Base is kept per task, no locking and no libc TZ state are used, zone offset is resolved with the library zone rules.*/
+
+// Makes all tasks read wall clock again on next call. Call after system time was set, for example from NTP sync notification
+void syncClock();
+
+int64_t clockEpochMicros();
+Instant clockInstant();
+// Current date-time in zone, UTC when zone is NULL
+ZonedDateTime clockZonedDateTime(const TimeZone *zone);
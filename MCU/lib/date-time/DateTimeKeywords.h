@@ -0,0 +1,161 @@
+#pragma once
+
+// Generated by scripts/perfect_hash.py from DateTimeKeywords.phf, do not edit manually
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <strings.h>
+#include "LocalDate.h"
+
+#ifndef PERFECT_HASH_OF_DEFINED
+#define PERFECT_HASH_OF_DEFINED
+static inline uint32_t perfectHashOf(const char *key, uint32_t length, uint32_t seed, bool isIgnoreCase) {
+    uint32_t hash = (2166136261UL ^ seed) * 16777619UL;
+    for (uint32_t i = 0; i < length; i++) {
+        uint8_t byte = (uint8_t) key[i];
+        hash ^= isIgnoreCase ? (byte | 0x20) : byte;
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+#endif
+
+#define MONTH_SHORT_NAME_KEYWORD_COUNT 12
+#define MONTH_SHORT_NAME_MIN_LENGTH 3
+#define MONTH_SHORT_NAME_MAX_LENGTH 3
+
+typedef struct MonthShortNameKeyword {
+    const char *name;
+    uint8_t length;
+    Month value;
+} MonthShortNameKeyword;
+
+static const int16_t MONTH_SHORT_NAME_DISPLACEMENTS[MONTH_SHORT_NAME_KEYWORD_COUNT] = {
+        -10, -9, -6, 0, -5, 0, -3, -2, 3, 3, -1, 0,
+};
+
+static const MonthShortNameKeyword MONTH_SHORT_NAME_KEYWORDS[MONTH_SHORT_NAME_KEYWORD_COUNT] = {
+        {"Nov", 3, NOVEMBER},
+        {"Oct", 3, OCTOBER},
+        {"Aug", 3, AUGUST},
+        {"Jan", 3, JANUARY},
+        {"Jun", 3, JUNE},
+        {"Jul", 3, JULY},
+        {"Sep", 3, SEPTEMBER},
+        {"May", 3, MAY},
+        {"Mar", 3, MARCH},
+        {"Apr", 3, APRIL},
+        {"Dec", 3, DECEMBER},
+        {"Feb", 3, FEBRUARY},
+};
+
+static inline const MonthShortNameKeyword *findMonthShortNameKeyword(const char *key, uint32_t length) {
+    if (key == NULL || length < MONTH_SHORT_NAME_MIN_LENGTH || length > MONTH_SHORT_NAME_MAX_LENGTH) return NULL;
+    int32_t displacement = MONTH_SHORT_NAME_DISPLACEMENTS[perfectHashOf(key, length, 0, true) % MONTH_SHORT_NAME_KEYWORD_COUNT];
+    uint32_t index = displacement < 0 ? (uint32_t) (-displacement - 1) : perfectHashOf(key, length, displacement, true) % MONTH_SHORT_NAME_KEYWORD_COUNT;
+    const MonthShortNameKeyword *keyword = &MONTH_SHORT_NAME_KEYWORDS[index];
+    return (keyword->length == length && strncasecmp(keyword->name, key, length) == 0) ? keyword : NULL;
+}
+
+#define MONTH_LONG_NAME_KEYWORD_COUNT 12
+#define MONTH_LONG_NAME_MIN_LENGTH 3
+#define MONTH_LONG_NAME_MAX_LENGTH 9
+
+typedef struct MonthLongNameKeyword {
+    const char *name;
+    uint8_t length;
+    Month value;
+} MonthLongNameKeyword;
+
+static const int16_t MONTH_LONG_NAME_DISPLACEMENTS[MONTH_LONG_NAME_KEYWORD_COUNT] = {
+        0, 1, -10, 0, 0, 0, -9, 4, 1, 1, -6, 0,
+};
+
+static const MonthLongNameKeyword MONTH_LONG_NAME_KEYWORDS[MONTH_LONG_NAME_KEYWORD_COUNT] = {
+        {"October", 7, OCTOBER},
+        {"May", 3, MAY},
+        {"November", 8, NOVEMBER},
+        {"June", 4, JUNE},
+        {"April", 5, APRIL},
+        {"September", 9, SEPTEMBER},
+        {"July", 4, JULY},
+        {"December", 8, DECEMBER},
+        {"March", 5, MARCH},
+        {"August", 6, AUGUST},
+        {"February", 8, FEBRUARY},
+        {"January", 7, JANUARY},
+};
+
+static inline const MonthLongNameKeyword *findMonthLongNameKeyword(const char *key, uint32_t length) {
+    if (key == NULL || length < MONTH_LONG_NAME_MIN_LENGTH || length > MONTH_LONG_NAME_MAX_LENGTH) return NULL;
+    int32_t displacement = MONTH_LONG_NAME_DISPLACEMENTS[perfectHashOf(key, length, 0, true) % MONTH_LONG_NAME_KEYWORD_COUNT];
+    uint32_t index = displacement < 0 ? (uint32_t) (-displacement - 1) : perfectHashOf(key, length, displacement, true) % MONTH_LONG_NAME_KEYWORD_COUNT;
+    const MonthLongNameKeyword *keyword = &MONTH_LONG_NAME_KEYWORDS[index];
+    return (keyword->length == length && strncasecmp(keyword->name, key, length) == 0) ? keyword : NULL;
+}
+
+#define WEEK_DAY_SHORT_NAME_KEYWORD_COUNT 7
+#define WEEK_DAY_SHORT_NAME_MIN_LENGTH 3
+#define WEEK_DAY_SHORT_NAME_MAX_LENGTH 3
+
+typedef struct WeekDayShortNameKeyword {
+    const char *name;
+    uint8_t length;
+    DayOfWeek value;
+} WeekDayShortNameKeyword;
+
+static const int16_t WEEK_DAY_SHORT_NAME_DISPLACEMENTS[WEEK_DAY_SHORT_NAME_KEYWORD_COUNT] = {
+        0, 0, 0, 0, 0, 12, 10,
+};
+
+static const WeekDayShortNameKeyword WEEK_DAY_SHORT_NAME_KEYWORDS[WEEK_DAY_SHORT_NAME_KEYWORD_COUNT] = {
+        {"Tue", 3, TUESDAY},
+        {"Fri", 3, FRIDAY},
+        {"Wed", 3, WEDNESDAY},
+        {"Mon", 3, MONDAY},
+        {"Sat", 3, SATURDAY},
+        {"Sun", 3, SUNDAY},
+        {"Thu", 3, THURSDAY},
+};
+
+static inline const WeekDayShortNameKeyword *findWeekDayShortNameKeyword(const char *key, uint32_t length) {
+    if (key == NULL || length < WEEK_DAY_SHORT_NAME_MIN_LENGTH || length > WEEK_DAY_SHORT_NAME_MAX_LENGTH) return NULL;
+    int32_t displacement = WEEK_DAY_SHORT_NAME_DISPLACEMENTS[perfectHashOf(key, length, 0, true) % WEEK_DAY_SHORT_NAME_KEYWORD_COUNT];
+    uint32_t index = displacement < 0 ? (uint32_t) (-displacement - 1) : perfectHashOf(key, length, displacement, true) % WEEK_DAY_SHORT_NAME_KEYWORD_COUNT;
+    const WeekDayShortNameKeyword *keyword = &WEEK_DAY_SHORT_NAME_KEYWORDS[index];
+    return (keyword->length == length && strncasecmp(keyword->name, key, length) == 0) ? keyword : NULL;
+}
+
+#define WEEK_DAY_LONG_NAME_KEYWORD_COUNT 7
+#define WEEK_DAY_LONG_NAME_MIN_LENGTH 6
+#define WEEK_DAY_LONG_NAME_MAX_LENGTH 9
+
+typedef struct WeekDayLongNameKeyword {
+    const char *name;
+    uint8_t length;
+    DayOfWeek value;
+} WeekDayLongNameKeyword;
+
+static const int16_t WEEK_DAY_LONG_NAME_DISPLACEMENTS[WEEK_DAY_LONG_NAME_KEYWORD_COUNT] = {
+        -6, -5, 3, -4, -3, 0, -1,
+};
+
+static const WeekDayLongNameKeyword WEEK_DAY_LONG_NAME_KEYWORDS[WEEK_DAY_LONG_NAME_KEYWORD_COUNT] = {
+        {"Saturday", 8, SATURDAY},
+        {"Tuesday", 7, TUESDAY},
+        {"Thursday", 8, THURSDAY},
+        {"Wednesday", 9, WEDNESDAY},
+        {"Monday", 6, MONDAY},
+        {"Sunday", 6, SUNDAY},
+        {"Friday", 6, FRIDAY},
+};
+
+static inline const WeekDayLongNameKeyword *findWeekDayLongNameKeyword(const char *key, uint32_t length) {
+    if (key == NULL || length < WEEK_DAY_LONG_NAME_MIN_LENGTH || length > WEEK_DAY_LONG_NAME_MAX_LENGTH) return NULL;
+    int32_t displacement = WEEK_DAY_LONG_NAME_DISPLACEMENTS[perfectHashOf(key, length, 0, true) % WEEK_DAY_LONG_NAME_KEYWORD_COUNT];
+    uint32_t index = displacement < 0 ? (uint32_t) (-displacement - 1) : perfectHashOf(key, length, displacement, true) % WEEK_DAY_LONG_NAME_KEYWORD_COUNT;
+    const WeekDayLongNameKeyword *keyword = &WEEK_DAY_LONG_NAME_KEYWORDS[index];
+    return (keyword->length == length && strncasecmp(keyword->name, key, length) == 0) ? keyword : NULL;
+}
@@ -10,6 +10,10 @@ static inline int64_t minInt64(int64_t x, int64_t y) {
     return ((x < y) ? x : y);
 }
 
+static inline int64_t maxInt64(int64_t x, int64_t y) {
+    return ((x > y) ? x : y);
+}
+
 static inline int64_t absInt64(int64_t x) {
     return ((x < 0) ? (-x) : x);
 }
@@ -1,4 +1,7 @@
+#include <stdatomic.h>
+
 #include "GlobalDateTime.h"
+#include "DateTimeKeywords.h"
 
 #define MONTH_NAME_MAX_LENGTH 9
 #define INVALID_NUMBER_VALUE (-1)
@@ -34,6 +37,18 @@ typedef struct {
     uint8_t maxLength;
 } ChronoValue;
 
+typedef enum FormatterCacheEntryState {
+    FORMATTER_ENTRY_FREE,
+    FORMATTER_ENTRY_CLAIMED,    // one task writes pattern and compiled
+    FORMATTER_ENTRY_PUBLISHED,  // pattern and compiled are written, entry is never changed after that
+} FormatterCacheEntryState;
+
+typedef struct DateTimeFormatterCacheEntry {
+    char pattern[DATE_TIME_FORMAT_SIZE];
+    CompiledDateTimeFormatter compiled;
+    atomic_uint_fast8_t state;
+} DateTimeFormatterCacheEntry;
+
 typedef enum AmPmOfTime {
   TIME_AM, TIME_PM, TIME_NOT_AM_PM
 } AmPmOfTime;
@@ -82,6 +97,19 @@ static uint32_t formatTimeValues(TemporalField *temporal, uint32_t timeValue, ch
 static uint32_t formatTextTimeZone(TemporalField *temporal, Date *date, Time *time,  const TimeZone *zone, char *resultBuffer);
 static uint32_t formatDigitTimeZone(TemporalField *temporal, Date *date, Time *time, const TimeZone *zone, char *resultBuffer);
 
+static uint32_t compiledDateTimeFormat(Date *date, Time *time, const TimeZone *zone, char *resultBuffer, uint32_t length, CompiledDateTimeFormatter *compiled);
+static uint32_t formatCompiledField(DateTimeFormatOp *op, Date *date, Time *time, const TimeZone *zone, char *resultBuffer);
+static uint32_t formatPaddedNumber(uint64_t value, uint8_t width, char *resultBuffer);
+static uint8_t resolveNumericFieldWidth(TemporalField *temporal);
+
+static uint8_t parseCompiledNumber(DateTimeFormatOp *op, const char *text, uint32_t remaining, const ValueRange *range, int64_t *value);
+static uint8_t parseCompiledMonthName(DateTimeFormatOp *op, const char *text, uint32_t remaining, Month *month);
+static uint8_t parseCompiledDayInWeek(DateTimeFormatOp *op, const char *text, uint32_t remaining, DayOfWeek *weekDay);
+static uint8_t parseCompiledZoneOffset(const char *text, uint32_t remaining, int32_t *offset);
+static uint8_t resolveFieldMaxDigits(ChronoField field);
+
+static DateTimeFormatterCacheEntry formatterCache[DATE_TIME_FORMATTER_CACHE_SIZE];
+
 static inline bool isLongNumberValid(int64_t number, const char *valuePointer, const char *endPointer) {
     return ((valuePointer == endPointer) ||              // no digits found
             (errno == ERANGE && number == LLONG_MIN) ||   // underflow occurred
@@ -237,6 +265,218 @@ void formatZonedDateTime(ZonedDateTime *zonedDateTime, char *resultBuffer, uint3
     dateTimeFormat(&zonedDateTime->dateTime.date, &zonedDateTime->dateTime.time, &zonedDateTime->zone, resultBuffer, length, formatter);
 }
 
+void compileDateTimeFormatter(CompiledDateTimeFormatter *compiled, DateTimeFormatter *formatter) {
+    if (compiled == NULL) return;
+    memset(compiled, 0, sizeof(struct CompiledDateTimeFormatter));
+    compiled->isFormatValid = formatter != NULL && formatter->isFormatValid;
+    if (!compiled->isFormatValid) return;
+
+    uint8_t literalCount = 0;
+    for (uint32_t i = 0; i < DATE_TIME_FORMAT_SIZE && formatter->formatEntities[i].field != CHRONO_END_OF_PATTERN; i++) {
+        TemporalField *temporal = &formatter->formatEntities[i];
+        DateTimeFormatOp *previousOp = compiled->opCount > 0 ? &compiled->ops[compiled->opCount - 1] : NULL;
+        if (temporal->field == CHRONO_FIELD_LITERAL) {
+            compiled->literals[literalCount] = temporal->literal;
+            if (previousOp != NULL && previousOp->field == CHRONO_FIELD_LITERAL) {
+                previousOp->length++;   // literals are stored in order, so run continues
+            } else {
+                compiled->ops[compiled->opCount++] = (DateTimeFormatOp) {.field = CHRONO_FIELD_LITERAL, .length = 1, .literalOffset = literalCount};
+            }
+            literalCount++;
+            continue;
+        }
+        compiled->ops[compiled->opCount++] = (DateTimeFormatOp) {.field = temporal->field, .length = temporal->length, .width = resolveNumericFieldWidth(temporal)};
+    }
+}
+
+bool compileDateTimePattern(CompiledDateTimeFormatter *compiled, const char *pattern) {
+    DateTimeFormatter formatter;
+    parseDateTimePattern(&formatter, pattern);
+    compileDateTimeFormatter(compiled, &formatter);
+    return compiled != NULL && compiled->isFormatValid;
+}
+
+CompiledDateTimeFormatter *getCachedDateTimeFormatter(const char *pattern) {
+    if (pattern == NULL || strlen(pattern) >= DATE_TIME_FORMAT_SIZE) return NULL;
+    // Entries are filled in order. New pattern is claimed only after all entries before it were seen published with other patterns,
+    // so two tasks with the same pattern never fill two entries: the later one finds the first one claimed or published
+    for (uint32_t i = 0; i < DATE_TIME_FORMATTER_CACHE_SIZE; i++) {
+        DateTimeFormatterCacheEntry *entry = &formatterCache[i];
+        uint_fast8_t state = atomic_load_explicit(&entry->state, memory_order_acquire);
+        if (state == FORMATTER_ENTRY_FREE &&
+            atomic_compare_exchange_strong_explicit(&entry->state, &state, FORMATTER_ENTRY_CLAIMED, memory_order_acquire, memory_order_acquire)) {
+            compileDateTimePattern(&entry->compiled, pattern);
+            strcpy(entry->pattern, pattern);
+            atomic_store_explicit(&entry->state, FORMATTER_ENTRY_PUBLISHED, memory_order_release);
+            return entry->compiled.isFormatValid ? &entry->compiled : NULL;
+        }
+
+        if (state == FORMATTER_ENTRY_CLAIMED) return NULL;     // may be the same pattern, parse it this time instead of waiting
+        if (strcmp(entry->pattern, pattern) == 0) {
+            return entry->compiled.isFormatValid ? &entry->compiled : NULL;     // invalid patterns are cached too, so they are not parsed again
+        }
+    }
+    return NULL;
+}
+
+void clearDateTimeFormatterCache() {
+    for (uint32_t i = 0; i < DATE_TIME_FORMATTER_CACHE_SIZE; i++) {
+        atomic_store_explicit(&formatterCache[i].state, FORMATTER_ENTRY_FREE, memory_order_release);
+    }
+}
+
+void formatZonedDateTimeByPattern(ZonedDateTime *zonedDateTime, char *resultBuffer, uint32_t length, const char *pattern) {
+    CompiledDateTimeFormatter *compiled = getCachedDateTimeFormatter(pattern);
+    if (compiled != NULL) {
+        formatZonedDateTimeCompiled(zonedDateTime, resultBuffer, length, compiled);
+        return;
+    }
+
+    DateTimeFormatter formatter;    // pattern is not cached: too long, invalid or cache is full
+    parseDateTimePattern(&formatter, pattern);
+    formatZonedDateTime(zonedDateTime, resultBuffer, length, &formatter);
+}
+
+uint32_t formatDateTimeCompiled(DateTime *dateTime, char *resultBuffer, uint32_t length, CompiledDateTimeFormatter *compiled) {
+    if (dateTime == NULL) return 0;
+    return compiledDateTimeFormat(&dateTime->date, &dateTime->time, NULL, resultBuffer, length, compiled);
+}
+
+uint32_t formatZonedDateTimeCompiled(ZonedDateTime *zonedDateTime, char *resultBuffer, uint32_t length, CompiledDateTimeFormatter *compiled) {
+    if (zonedDateTime == NULL) return 0;
+    return compiledDateTimeFormat(&zonedDateTime->dateTime.date, &zonedDateTime->dateTime.time, &zonedDateTime->zone, resultBuffer, length, compiled);
+}
+
+uint32_t formatEpochSecondsBulk(const int64_t *epochSeconds, uint32_t count, const TimeZone *zone, CompiledDateTimeFormatter *compiled,
+                                char *resultBuffer, uint32_t length, uint32_t *offsets) {
+    if (epochSeconds == NULL || zone == NULL || compiled == NULL || !compiled->isFormatValid || resultBuffer == NULL) return 0;
+    char valueBuffer[DATE_TIME_FORMAT_MAX_LENGTH];
+    int64_t previousEpochDay = INT64_MIN;
+    Date date = UNINITIALIZED_DATE;
+    uint32_t printedSize = 0;
+    uint32_t formattedCount = 0;
+
+    for (; formattedCount < count; formattedCount++) {
+        int64_t localSeconds = epochSeconds[formattedCount] + resolveTimeZoneOffset(epochSeconds[formattedCount], zone); // cached until next transition
+        int64_t localEpochDay = floorDiv(localSeconds, SECONDS_PER_DAY);
+        if (localEpochDay != previousEpochDay) {
+            date = dateOfEpochDay(localEpochDay);
+            previousEpochDay = localEpochDay;
+        }
+        int32_t secondOfDay = (int32_t) (localSeconds - localEpochDay * SECONDS_PER_DAY);
+        Time time = {.hours = secondOfDay / SECONDS_PER_HOUR, .minutes = (secondOfDay / SECONDS_PER_MINUTE) % MINUTES_PER_HOUR, .seconds = secondOfDay % SECONDS_PER_MINUTE, .millis = 0};
+
+        uint32_t valueLength = compiledDateTimeFormat(&date, &time, zone, valueBuffer, sizeof(valueBuffer), compiled);
+        if (printedSize + valueLength + 1 > length) break;
+        memcpy(resultBuffer + printedSize, valueBuffer, valueLength + 1);
+        if (offsets != NULL) {
+            offsets[formattedCount] = printedSize;
+        }
+        printedSize += valueLength + 1;
+    }
+    return formattedCount;
+}
+
+bool parseEpochSecondsByPattern(const char *text, uint32_t textLength, const char *pattern, int64_t *epochSeconds, int32_t *zoneOffset) {
+    CompiledDateTimeFormatter *compiled = getCachedDateTimeFormatter(pattern);
+    if (compiled != NULL) {
+        return parseEpochSecondsCompiled(text, textLength, compiled, epochSeconds, zoneOffset);
+    }
+
+    CompiledDateTimeFormatter formatter;    // pattern is not cached: too long, invalid or cache is full
+    return pattern != NULL && compileDateTimePattern(&formatter, pattern) && parseEpochSecondsCompiled(text, textLength, &formatter, epochSeconds, zoneOffset);
+}
+
+bool parseEpochSecondsCompiled(const char *text, uint32_t textLength, CompiledDateTimeFormatter *compiled, int64_t *epochSeconds, int32_t *zoneOffset) {
+    if (text == NULL || compiled == NULL || !compiled->isFormatValid || epochSeconds == NULL) return false;
+    const char *textEnd = text + textLength;
+    Date date = {0};
+    Time time = {0};
+    DayOfWeek weekDay = 0;
+    AmPmOfTime amPm = TIME_NOT_AM_PM;
+    int32_t offset = 0;
+    int64_t value = 0;
+
+    for (uint32_t i = 0; i < compiled->opCount; i++) {
+        DateTimeFormatOp *op = &compiled->ops[i];
+        uint32_t remaining = textEnd - text;
+        uint8_t parsedLength = TEXT_NOT_PARSED;
+
+        switch (op->field) {
+            case CHRONO_FIELD_LITERAL:
+                if (remaining >= op->length && memcmp(text, &compiled->literals[op->literalOffset], op->length) == 0) {
+                    parsedLength = op->length;
+                }
+                break;
+            case CHRONO_FIELD_YEAR_OF_ERA:
+            case CHRONO_FIELD_YEAR:
+                parsedLength = parseCompiledNumber(op, text, remaining, &YEAR_RANGE, &value);
+                date.year = value;
+                break;
+            case CHRONO_FIELD_MONTH_IN_YEAR:
+                if (op->length <= PATTERN_LENGTH_TWO) {
+                    parsedLength = parseCompiledNumber(op, text, remaining, &MONTH_OF_YEAR_RANGE, &value);
+                    date.month = (Month) value;
+                } else {
+                    parsedLength = parseCompiledMonthName(op, text, remaining, &date.month);
+                }
+                break;
+            case CHRONO_FIELD_DAY_IN_MONTH:
+                parsedLength = parseCompiledNumber(op, text, remaining, &DAY_OF_MONTH_RANGE, &value);
+                date.day = (int8_t) value;
+                break;
+            case CHRONO_FIELD_DAY_IN_WEEK:
+                parsedLength = parseCompiledDayInWeek(op, text, remaining, &weekDay);
+                break;
+            case CHRONO_FIELD_AMPM_OF_DAY:
+                if (remaining >= AM_PM_LENGTH && (strncasecmp(text, "AM", AM_PM_LENGTH) == 0 || strncasecmp(text, "PM", AM_PM_LENGTH) == 0)) {
+                    amPm = (toupper((int) *text) == 'A') ? TIME_AM : TIME_PM;
+                    parsedLength = AM_PM_LENGTH;
+                }
+                break;
+            case CHRONO_FIELD_HOUR_OF_DAY:
+                parsedLength = parseCompiledNumber(op, text, remaining, &HOUR_OF_DAY_RANGE, &value);
+                time.hours = (int8_t) value;
+                break;
+            case CHRONO_FIELD_CLOCK_HOUR_OF_AMPM:
+                parsedLength = parseCompiledNumber(op, text, remaining, &HOUR_OF_AM_PM, &value);
+                time.hours = (int8_t) value;
+                break;
+            case CHRONO_FIELD_MINUTE_OF_HOUR:
+                parsedLength = parseCompiledNumber(op, text, remaining, &MINUTE_OF_HOUR_RANGE, &value);
+                time.minutes = (int8_t) value;
+                break;
+            case CHRONO_FIELD_SECOND_OF_MINUTE:
+                parsedLength = parseCompiledNumber(op, text, remaining, &SECOND_OF_MINUTE_RANGE, &value);
+                time.seconds = (int8_t) value;
+                break;
+            case CHRONO_FIELD_MILLISECOND:
+                parsedLength = parseCompiledNumber(op, text, remaining, &MILLIS_OF_SECOND_RANGE, &value);
+                time.millis = (int16_t) value;
+                break;
+            case CHRONO_FIELD_DIGIT_TIME_ZONE:
+                parsedLength = parseCompiledZoneOffset(text, remaining, &offset);
+                break;
+            default:
+                return false;   // unsupported pattern
+        }
+
+        if (parsedLength == TEXT_NOT_PARSED) return false;  // reject at first mismatch
+        text += parsedLength;
+    }
+
+    if (text != textEnd) return false;
+    resolveAmPmIfPresent(&time, amPm);
+    if (!isTimeValid(&time) || !isDateValid(&date)) return false;
+    if (weekDay != 0 && weekDay != getDayOfWeek(&date)) return false;
+
+    *epochSeconds = dateToEpochDay(&date) * SECONDS_PER_DAY + time.hours * SECONDS_PER_HOUR + time.minutes * SECONDS_PER_MINUTE + time.seconds - offset;
+    if (zoneOffset != NULL) {
+        *zoneOffset = offset;
+    }
+    return true;
+}
+
 static bool dateTimeParse(const char *text, TemporalField *formatEntities, Date *date, Time *time, TimeZone *zone) {
     if (text == NULL || formatEntities == NULL || haveDateTimeConflicts(formatEntities)) return false;
 
@@ -485,9 +725,7 @@ static uint8_t parseMonth(TemporalField *temporal, Date *date, const char *text)
         return TEXT_NOT_PARSED;
     }
 
-    char monthBuffer[16] = {0};
     if (temporal->length == PATTERN_LENGTH_ONE || temporal->length == PATTERN_LENGTH_TWO) {    // Parse numeric value
-        strncpy(monthBuffer, text, parsedLength);
         Month month = extractTemporalNumber(temporal, text, &parsedLength);
         if (isValidValue(&MONTH_OF_YEAR_RANGE, month)) {
             date->month = month;
@@ -497,22 +735,18 @@ static uint8_t parseMonth(TemporalField *temporal, Date *date, const char *text)
     }
 
     if (temporal->length == PATTERN_LENGTH_THREE) {    // Parse by month short name
-        strncpy(monthBuffer, text, temporal->length);
-        for (uint32_t i = 0; i < ARRAY_SIZE(MONTH_NAME_SHORT); i++) {
-            if (strcasecmp(monthBuffer, MONTH_NAME_SHORT[i]) == 0) {
-                date->month = i + 1;
-                return temporal->length;
-            }
+        const MonthShortNameKeyword *month = findMonthShortNameKeyword(text, strnlen(text, temporal->length));
+        if (month != NULL) {
+            date->month = month->value;
+            return temporal->length;
         }
         return TEXT_NOT_PARSED;
 
     } else {                            // Parse by month full name
-        strncpy(monthBuffer, text, parsedLength);
-        for (uint32_t i = 0; i < ARRAY_SIZE(MONTH_NAME_SHORT); i++) {
-            if (strcasecmp(monthBuffer, MONTH_NAME_LONG[i]) == 0) {
-                date->month = i + 1;
-                return parsedLength;
-            }
+        const MonthLongNameKeyword *month = findMonthLongNameKeyword(text, parsedLength);
+        if (month != NULL) {
+            date->month = month->value;
+            return parsedLength;
         }
         return TEXT_NOT_PARSED;
     }
@@ -531,27 +765,22 @@ static uint8_t parseDayInMonth(TemporalField *temporal, Date *date, const char *
 
 static uint8_t parseDayInWeek(TemporalField *temporal, Date *date, const char *text) {
     if (date == NULL) return TEXT_NOT_PARSED;
-    char weekDayBuffer[WIDE_DAY_OF_WEEK_MAX_LENGTH + 1] = {0};
     if (temporal->length >= PATTERN_LENGTH_ONE && temporal->length <= PATTERN_LENGTH_THREE) {   // parse short week name like: "Tue"
-        strncpy(weekDayBuffer, text, ABBREVIATED_DAY_OF_WEEK_LENGTH);
-        for (uint32_t i = 0; i < ARRAY_SIZE(WEEK_DAY_NAME_SHORT); i++) {
-            if (strcasecmp(weekDayBuffer, WEEK_DAY_NAME_SHORT[i]) == 0) {
-                date->weekDay = (DayOfWeek) i + 1;
-                return ABBREVIATED_DAY_OF_WEEK_LENGTH;
-            }
+        const WeekDayShortNameKeyword *weekDay = findWeekDayShortNameKeyword(text, strnlen(text, ABBREVIATED_DAY_OF_WEEK_LENGTH));
+        if (weekDay != NULL) {
+            date->weekDay = weekDay->value;
+            return ABBREVIATED_DAY_OF_WEEK_LENGTH;
         }
 
     } else if (temporal->length == PATTERN_LENGTH_FOUR) {   // parse long week name like: "Tuesday"
-        for (uint8_t i = 0; i < WIDE_DAY_OF_WEEK_MAX_LENGTH; i++) {
-            char dayOfWeekChar = text[i];
-            if (!isalpha((int) dayOfWeekChar)) break;
-            weekDayBuffer[i] = dayOfWeekChar;
+        uint8_t weekDayLength = 0;
+        while (weekDayLength < WIDE_DAY_OF_WEEK_MAX_LENGTH && isalpha((int) text[weekDayLength])) {
+            weekDayLength++;
         }
-        for (uint32_t i = 0; i < ARRAY_SIZE(WEEK_DAY_NAME_LONG); i++) {
-            if (strcasecmp(weekDayBuffer, WEEK_DAY_NAME_LONG[i]) == 0) {
-                date->weekDay = (DayOfWeek) i + 1;
-                return strlen(weekDayBuffer);
-            }
+        const WeekDayLongNameKeyword *weekDay = findWeekDayLongNameKeyword(text, weekDayLength);
+        if (weekDay != NULL) {
+            date->weekDay = weekDay->value;
+            return weekDayLength;
         }
 
     } else if (temporal->length == PATTERN_LENGTH_FIVE) {   // parse by first char like: "T"
@@ -644,6 +873,7 @@ static uint8_t parseTimeZone(TimeZone *zone, const char *text) {
         zone->utcOffset = UTC.utcOffset;
         zone->names = UTC.names;
         zone->rules = UTC.rules;
+        zone->ruleCount = UTC.ruleCount;
         return 1;
     }
 
@@ -707,6 +937,7 @@ static uint32_t parseZoneDigits(const char *text, uint32_t textLength, TimeZone
         zone->utcOffset = offset * sign;
         zone->names = UTC.names;
         zone->rules = UTC.rules;
+        zone->ruleCount = UTC.ruleCount;
         return (text - textStart);
     }
 
@@ -741,6 +972,7 @@ static uint32_t parseZoneDigits(const char *text, uint32_t textLength, TimeZone
     zone->utcOffset = offset * sign;
     zone->names = UTC.names;
     zone->rules = UTC.rules;
+    zone->ruleCount = UTC.ruleCount;
     return (text - textStart);
 }
 
@@ -764,6 +996,7 @@ static uint32_t parseZoneByName(const char *text, uint32_t textLength, TimeZone
         zone->utcOffset = zoneId->utcOffset;
         zone->names = zoneId->names;
         zone->rules = zoneId->rules;
+        zone->ruleCount = zoneId->ruleCount;
         return (text - textStart);
     }
     return TEXT_NOT_PARSED;
@@ -959,4 +1192,229 @@ static uint32_t formatDigitTimeZone(TemporalField *temporal, Date *date, Time *t
         return sprintf(resultBuffer, "%+03" PRIi32 ":%02" PRIi32 ":%02" PRIi32, hours, minutes, seconds);
     }
     return sprintf(resultBuffer, "%+03" PRIi32 ":%02" PRIi32, hours, minutes);
-}
\ No newline at end of file
+}
+
+static uint32_t compiledDateTimeFormat(Date *date, Time *time, const TimeZone *zone, char *resultBuffer, uint32_t length, CompiledDateTimeFormatter *compiled) {
+    if (resultBuffer == NULL || length == 0) return 0;
+    resultBuffer[0] = '\0';
+    if (compiled == NULL || !compiled->isFormatValid) return 0;
+
+    char fieldBuffer[DATE_TIME_FORMAT_SIZE];
+    uint32_t printedSize = 0;
+    for (uint32_t i = 0; i < compiled->opCount && printedSize < length - 1; i++) {
+        DateTimeFormatOp *op = &compiled->ops[i];
+        const char *fieldValue = fieldBuffer;
+        uint32_t fieldLength;
+        if (op->field == CHRONO_FIELD_LITERAL) {
+            fieldValue = &compiled->literals[op->literalOffset];
+            fieldLength = op->length;
+        } else {
+            fieldLength = formatCompiledField(op, date, time, zone, fieldBuffer);
+        }
+
+        uint32_t copyLength = minInt64(fieldLength, length - 1 - printedSize);
+        memcpy(resultBuffer + printedSize, fieldValue, copyLength);
+        printedSize += copyLength;
+    }
+    resultBuffer[printedSize] = '\0';
+    return printedSize;
+}
+
+static uint32_t formatCompiledField(DateTimeFormatOp *op, Date *date, Time *time, const TimeZone *zone, char *resultBuffer) {
+    bool isNumericTime = op->width > 0 && op->field >= CHRONO_FIELD_HOUR_OF_DAY && op->field <= CHRONO_FIELD_MILLISECOND;
+    if (isNumericTime) {
+        if (!isTimeValid(time)) return 0;
+        switch (op->field) {
+            case CHRONO_FIELD_HOUR_OF_DAY:
+                return formatPaddedNumber(time->hours, op->width, resultBuffer);
+            case CHRONO_FIELD_CLOCK_HOUR_OF_DAY:
+                return formatPaddedNumber(time->hours == 0 ? 24 : time->hours, op->width, resultBuffer);
+            case CHRONO_FIELD_HOUR_OF_AMPM:
+                return formatPaddedNumber(time->hours % 12, op->width, resultBuffer);
+            case CHRONO_FIELD_CLOCK_HOUR_OF_AMPM:
+                return formatPaddedNumber((time->hours == 0 || time->hours == 12) ? 12 : time->hours % 12, op->width, resultBuffer);
+            case CHRONO_FIELD_MINUTE_OF_HOUR:
+                return formatPaddedNumber(time->minutes, op->width, resultBuffer);
+            case CHRONO_FIELD_SECOND_OF_MINUTE:
+                return formatPaddedNumber(time->seconds, op->width, resultBuffer);
+            default:
+                return formatPaddedNumber(time->millis, op->width, resultBuffer);
+        }
+    }
+
+    bool isNumericDate = op->width > 0 && date != NULL && date->year >= 0;   // negative years have own sign handling
+    if (isNumericDate && (op->field == CHRONO_FIELD_YEAR_OF_ERA || op->field == CHRONO_FIELD_YEAR || op->field == CHRONO_FIELD_MONTH_IN_YEAR || op->field == CHRONO_FIELD_DAY_IN_MONTH)) {
+        if (!isDateValid(date)) return 0;
+        if (op->field == CHRONO_FIELD_MONTH_IN_YEAR) return formatPaddedNumber(date->month, op->width, resultBuffer);
+        if (op->field == CHRONO_FIELD_DAY_IN_MONTH) return formatPaddedNumber(date->day, op->width, resultBuffer);
+        return formatPaddedNumber(op->length == PATTERN_LENGTH_TWO ? date->year % 100 : date->year, op->width, resultBuffer);
+    }
+
+    TemporalField temporal = {.field = op->field, .length = op->length, .literal = '\0'};
+    switch (op->field) {
+        case CHRONO_FIELD_ERA:
+            return formatEra(&temporal, date, resultBuffer);
+        case CHRONO_FIELD_YEAR_OF_ERA:
+        case CHRONO_FIELD_YEAR:
+            return formatYear(&temporal, date, resultBuffer);
+        case CHRONO_FIELD_MONTH_IN_YEAR:
+            return formatMonth(&temporal, date, resultBuffer);
+        case CHRONO_FIELD_WEEK_IN_YEAR:
+            return formatWeekInYear(&temporal, date, resultBuffer);
+        case CHRONO_FIELD_WEEK_IN_MONTH:
+            return formatWeekInMoth(date, resultBuffer);
+        case CHRONO_FIELD_DAY_IN_YEAR:
+            return formatDayInYear(&temporal, date, resultBuffer);
+        case CHRONO_FIELD_DAY_IN_MONTH:
+            return formatDayInMonth(&temporal, date, resultBuffer);
+        case CHRONO_FIELD_DAY_OF_WEEK_IN_MONTH:
+            return formatDayOfWeekInMonth(date, resultBuffer);
+        case CHRONO_FIELD_DAY_IN_WEEK:
+            return formatDayInWeek(&temporal, date, resultBuffer);
+        case CHRONO_FIELD_AMPM_OF_DAY:
+            return formatAmPmOfDay(time, resultBuffer);
+        case CHRONO_FIELD_TEXT_TIME_ZONE:
+            return formatTextTimeZone(&temporal, date, time, zone, resultBuffer);
+        case CHRONO_FIELD_DIGIT_TIME_ZONE:
+            return formatDigitTimeZone(&temporal, date, time, zone, resultBuffer);
+        default:
+            return 0;
+    }
+}
+
+static uint32_t formatPaddedNumber(uint64_t value, uint8_t width, char *resultBuffer) {
+    char digits[20];
+    uint8_t count = 0;
+    do {
+        digits[count++] = (char) ('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    while (count < width) {
+        digits[count++] = '0';
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        resultBuffer[i] = digits[count - 1 - i];
+    }
+    return count;
+}
+
+static uint8_t resolveNumericFieldWidth(TemporalField *temporal) {   // 0 for text and other fields, same widths as sprintf() formats
+    switch (temporal->field) {
+        case CHRONO_FIELD_YEAR_OF_ERA:
+        case CHRONO_FIELD_YEAR:
+            return temporal->length;
+        case CHRONO_FIELD_MONTH_IN_YEAR:
+            return temporal->length <= PATTERN_LENGTH_TWO ? temporal->length : 0;
+        case CHRONO_FIELD_DAY_IN_MONTH:
+            return temporal->length == PATTERN_LENGTH_ONE ? PATTERN_LENGTH_ONE : PATTERN_LENGTH_TWO;
+        case CHRONO_FIELD_HOUR_OF_DAY:
+        case CHRONO_FIELD_CLOCK_HOUR_OF_DAY:
+        case CHRONO_FIELD_HOUR_OF_AMPM:
+        case CHRONO_FIELD_CLOCK_HOUR_OF_AMPM:
+        case CHRONO_FIELD_MINUTE_OF_HOUR:
+        case CHRONO_FIELD_SECOND_OF_MINUTE:
+        case CHRONO_FIELD_MILLISECOND:
+            return temporal->length >= PATTERN_LENGTH_THREE ? PATTERN_LENGTH_THREE : temporal->length;
+        default:
+            return 0;
+    }
+}
+
+static uint8_t parseCompiledNumber(DateTimeFormatOp *op, const char *text, uint32_t remaining, const ValueRange *range, int64_t *value) {
+    uint8_t maxDigits = (op->length == PATTERN_LENGTH_ONE) ? resolveFieldMaxDigits(op->field) : op->length;
+    uint8_t length = 0;
+    int64_t number = 0;
+    for (; length < maxDigits && length < remaining && isdigit((int) text[length]); length++) {
+        number = number * 10 + (text[length] - '0');
+    }
+
+    bool isLengthValid = (length > 0) && (op->length == PATTERN_LENGTH_ONE || length == maxDigits);    // if length is 1 then length is not strictly determined
+    if (!isLengthValid || !isValidValue(range, number)) return TEXT_NOT_PARSED;
+    *value = number;
+    return length;
+}
+
+static uint8_t parseCompiledMonthName(DateTimeFormatOp *op, const char *text, uint32_t remaining, Month *month) {
+    if (op->length == PATTERN_LENGTH_THREE) {
+        const MonthShortNameKeyword *shortName = (remaining >= PATTERN_LENGTH_THREE) ? findMonthShortNameKeyword(text, PATTERN_LENGTH_THREE) : NULL;
+        if (shortName == NULL) return TEXT_NOT_PARSED;
+        *month = shortName->value;
+        return PATTERN_LENGTH_THREE;
+    }
+
+    uint8_t length = 0;
+    while (length <= MONTH_NAME_MAX_LENGTH && length < remaining && isalpha((int) text[length])) {
+        length++;
+    }
+    const MonthLongNameKeyword *longName = (length <= MONTH_NAME_MAX_LENGTH) ? findMonthLongNameKeyword(text, length) : NULL;
+    if (longName == NULL) return TEXT_NOT_PARSED;
+    *month = longName->value;
+    return length;
+}
+
+static uint8_t parseCompiledDayInWeek(DateTimeFormatOp *op, const char *text, uint32_t remaining, DayOfWeek *weekDay) {
+    if (op->length <= PATTERN_LENGTH_THREE) {   // short week name like: "Tue"
+        const WeekDayShortNameKeyword *shortName = (remaining >= ABBREVIATED_DAY_OF_WEEK_LENGTH) ? findWeekDayShortNameKeyword(text, ABBREVIATED_DAY_OF_WEEK_LENGTH) : NULL;
+        if (shortName == NULL) return TEXT_NOT_PARSED;
+        *weekDay = shortName->value;
+        return ABBREVIATED_DAY_OF_WEEK_LENGTH;
+    }
+
+    if (op->length == PATTERN_LENGTH_FOUR) {    // long week name like: "Tuesday"
+        uint8_t length = 0;
+        while (length < WIDE_DAY_OF_WEEK_MAX_LENGTH && length < remaining && isalpha((int) text[length])) {
+            length++;
+        }
+        const WeekDayLongNameKeyword *longName = findWeekDayLongNameKeyword(text, length);
+        if (longName == NULL) return TEXT_NOT_PARSED;
+        *weekDay = longName->value;
+        return length;
+    }
+
+    char dayOfWeekChar = (remaining > 0) ? (char) toupper((int) *text) : '\0';  // narrow week name like: "T"
+    for (uint32_t i = 0; i < ARRAY_SIZE(WEEK_DAY_NAME_SHORT); i++) {
+        if (dayOfWeekChar == WEEK_DAY_NAME_SHORT[i][0]) {
+            *weekDay = (DayOfWeek) i + 1;
+            return NARROW_DAY_OF_WEEK_LENGTH;
+        }
+    }
+    return TEXT_NOT_PARSED;
+}
+
+static uint8_t parseCompiledZoneOffset(const char *text, uint32_t remaining, int32_t *offset) {   // "Z", "+hh", "+hhmm", "+hh:mm", "+hh:mm:ss"
+    if (remaining > 0 && *text == ISO8601_UTC_INDICATOR) {
+        *offset = 0;
+        return 1;
+    }
+
+    int8_t sign = (remaining > 0) ? charToOffsetSign(*text) : 0;
+    if (sign == 0 || remaining < 1 + ZONE_DOUBLE_DIGIT_COUNT || !isdigit((int) text[1]) || !isdigit((int) text[2])) return TEXT_NOT_PARSED;
+    int32_t seconds = ((text[1] - '0') * 10 + (text[2] - '0')) * SECONDS_PER_HOUR;
+    uint8_t length = 1 + ZONE_DOUBLE_DIGIT_COUNT;
+
+    for (int32_t unit = SECONDS_PER_MINUTE; unit > 0; unit /= SECONDS_PER_MINUTE) {    // optional minutes, then seconds
+        uint8_t separatorLength = (length < remaining && text[length] == ':') ? 1 : 0;
+        const char *digits = text + length + separatorLength;
+        if (remaining - length - separatorLength < ZONE_DOUBLE_DIGIT_COUNT || !isdigit((int) digits[0]) || !isdigit((int) digits[1])) break;
+        int32_t value = (digits[0] - '0') * 10 + (digits[1] - '0');
+        if (value >= SECONDS_PER_MINUTE) return TEXT_NOT_PARSED;
+        seconds += value * unit;
+        length += separatorLength + ZONE_DOUBLE_DIGIT_COUNT;
+    }
+    *offset = sign * seconds;
+    return length;
+}
+
+static uint8_t resolveFieldMaxDigits(ChronoField field) {   // same as single letter pattern in extractTemporalNumber()
+    switch (field) {
+        case CHRONO_FIELD_YEAR_OF_ERA:
+        case CHRONO_FIELD_YEAR:
+        case CHRONO_FIELD_MONTH_IN_YEAR:
+            return PATTERN_LENGTH_FIVE;
+        case CHRONO_FIELD_MILLISECOND:
+            return PATTERN_LENGTH_THREE;
+        default:
+            return PATTERN_LENGTH_TWO;
+    }
+}
@@ -8,6 +8,8 @@
 #include "ZonedDateTime.h"
 
 #define DATE_TIME_FORMAT_SIZE 64
+#define DATE_TIME_FORMATTER_CACHE_SIZE 4
+#define DATE_TIME_FORMAT_MAX_LENGTH 128     // longest single value printed by bulk formatting
 
 // parse error messages
 static const char * const FORMATTER_ERROR_UNKNOWN_CHAR = "Unknown pattern character";
@@ -55,6 +57,21 @@ typedef struct DateTimeFormatter {
     uint32_t errorAtIndex;
 } DateTimeFormatter;
 
+typedef struct DateTimeFormatOp {
+    ChronoField field;      // CHRONO_FIELD_LITERAL for run of literals
+    uint8_t length;         // pattern letters count, or literal run length
+    uint8_t width;          // zero padded width for numeric fields
+    uint8_t literalOffset;  // literal run start in literals
+} DateTimeFormatOp;
+
+// Pattern flattened to list of emit operations: adjacent literals are merged to single copy, numeric fields are printed without sprintf
+typedef struct CompiledDateTimeFormatter {
+    DateTimeFormatOp ops[DATE_TIME_FORMAT_SIZE];
+    char literals[DATE_TIME_FORMAT_SIZE];
+    uint8_t opCount;
+    bool isFormatValid;
+} CompiledDateTimeFormatter;
+
 /* This method parses the ID producing a TimeZone struct.
  * A TimeZone is also returned if the ID is 'Z', or starts with '+' or '-'*/
 TimeZone timeZoneOf(const char *zoneId);
@@ -69,4 +86,40 @@ ZonedDateTime parseToZonedDateTime(const char *text, DateTimeFormatter *formatte
 void formatTime(Time *time, char *resultBuffer, uint32_t length, DateTimeFormatter *formatter);
 void formatDate(Date *date, char *resultBuffer, uint32_t length, DateTimeFormatter *formatter);
 void formatDateTime(DateTime *dateTime, char *resultBuffer, uint32_t length, DateTimeFormatter *formatter);
-void formatZonedDateTime(ZonedDateTime *zonedDateTime, char *resultBuffer, uint32_t length, DateTimeFormatter *formatter);
\ No newline at end of file
+void formatZonedDateTime(ZonedDateTime *zonedDateTime, char *resultBuffer, uint32_t length, DateTimeFormatter *formatter);
+
+void compileDateTimeFormatter(CompiledDateTimeFormatter *compiled, DateTimeFormatter *formatter);
+bool compileDateTimePattern(CompiledDateTimeFormatter *compiled, const char *pattern);
+/*
+ * Compiled formatter for pattern from small cache, pattern is parsed and compiled only on first use.
+ * Entries are never replaced, so cache can be used from any task and returned formatter stays valid.
+ * Returns NULL when pattern is invalid, too long to be cached, cache is full or another task is just adding an entry, so call may parse instead.
+ */
+CompiledDateTimeFormatter *getCachedDateTimeFormatter(const char *pattern);
+void clearDateTimeFormatterCache();     // only when no other task uses cached formatters
+// Formats with cached formatter, patterns that can't be cached are parsed on each call
+void formatZonedDateTimeByPattern(ZonedDateTime *zonedDateTime, char *resultBuffer, uint32_t length, const char *pattern);
+
+// Same output as non-compiled variants, but never writes more than length, including terminating '\0'. Returns printed length
+uint32_t formatDateTimeCompiled(DateTime *dateTime, char *resultBuffer, uint32_t length, CompiledDateTimeFormatter *compiled);
+uint32_t formatZonedDateTimeCompiled(ZonedDateTime *zonedDateTime, char *resultBuffer, uint32_t length, CompiledDateTimeFormatter *compiled);
+
+/*
+ * Parse text of textLength chars, that doesn't need to be '\0' terminated, straight to epoch seconds. No heap, no text copies.
+ * Supports numeric fields, month and week day names, am/pm and digit zone 'Z', other pattern fields are rejected.
+ * Literals must match exactly, so parsing stops at the first wrong char. Text without zone field is read as UTC.
+ * Parsed zone offset is stored to zoneOffset when it is not NULL, milliseconds are validated and dropped.
+ * Returns false and leaves output untouched when text doesn't match pattern or date-time is invalid.
+ */
+bool parseEpochSecondsCompiled(const char *text, uint32_t textLength, CompiledDateTimeFormatter *compiled, int64_t *epochSeconds, int32_t *zoneOffset);
+// Parses with cached formatter, patterns that can't be cached are compiled on each call
+bool parseEpochSecondsByPattern(const char *text, uint32_t textLength, const char *pattern, int64_t *epochSeconds, int32_t *zoneOffset);
+
+/*
+ * Format column of instants in the same zone and pattern into packed buffer: values are stored one after another, each terminated by '\0'.
+ * Start of each value is stored to offsets when it is not NULL. Zone offset and date fields are reused while consecutive values
+ * are in the same offset range and local day, so sorted input is the fastest.
+ * Returns number of formatted values, it is less than count when buffer is full.
+ */
+uint32_t formatEpochSecondsBulk(const int64_t *epochSeconds, uint32_t count, const TimeZone *zone, CompiledDateTimeFormatter *compiled,
+                                char *resultBuffer, uint32_t length, uint32_t *offsets);
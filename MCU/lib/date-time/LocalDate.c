@@ -13,38 +13,21 @@ Date dateOf(int64_t year, Month month, uint8_t dayOfMonth) {
     return isProvidedDateValid(year, month, dayOfMonth) ? *setDate(&date, year, month, dayOfMonth) : date;
 }
 
-Date dateOfEpochDay(int64_t epochDay) {
-    if (isValidValue(&EPOCH_DAY_RANGE, epochDay)) {
-        int64_t zeroDay = epochDay + DAYS_0000_TO_1970;
-        // find the march-based year
-        zeroDay -= 60;  // adjust to 0000-03-01 so leap day is at end of four-year cycle
-        int64_t adjust = 0;
-        if (zeroDay < 0) {
-            // adjust negative years to positive for calculation
-            int64_t adjustCycles = (zeroDay + 1) / DAYS_PER_CYCLE - 1;
-            adjust = adjustCycles * 400;
-            zeroDay += -adjustCycles * DAYS_PER_CYCLE;
-        }
-        int64_t yearEst = (400 * zeroDay + 591) / DAYS_PER_CYCLE;
-        int64_t doyEst = zeroDay - (365 * yearEst + yearEst / 4 - yearEst / 100 + yearEst / 400);
-        if (doyEst < 0) {
-            yearEst--;// fix estimate
-            doyEst = zeroDay - (365 * yearEst + yearEst / 4 - yearEst / 100 + yearEst / 400);
-        }
-        yearEst += adjust;  // reset any negative year
-        uint32_t marchDoy0 = (uint32_t) doyEst;
-
-        // convert march-based values back to january-based
-        uint32_t marchMonth0 = (marchDoy0 * 5 + 2) / 153;
-        uint32_t month = (marchMonth0 + 2) % 12 + 1;
-        uint32_t dayOfMonth = marchDoy0 - (marchMonth0 * 306 + 5) / 10 + 1;
-        yearEst += marchMonth0 / 10;
-
-        if (isValidValue(&YEAR_RANGE, yearEst)) {
-            return dateOf(yearEst, month, dayOfMonth);
-        }
-    }
-    return UNINITIALIZED_DATE;
+Date dateOfEpochDay(int64_t epochDay) {   // days to civil date without loops, see howardhinnant.github.io/date_algorithms.html
+    if (!isValidValue(&EPOCH_DAY_RANGE, epochDay)) return UNINITIALIZED_DATE;
+    int64_t zeroDay = epochDay + DAYS_0000_TO_1970 - 60;   // days from 0000-03-01, so leap day is at the end of year
+    int64_t era = (zeroDay >= 0 ? zeroDay : zeroDay - (DAYS_PER_CYCLE - 1)) / DAYS_PER_CYCLE;
+    uint32_t dayOfEra = (uint32_t) (zeroDay - era * DAYS_PER_CYCLE);                                   // [0, 146096]
+    uint32_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;    // [0, 399]
+    uint32_t marchDayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);          // [0, 365]
+    uint32_t marchMonth = (5 * marchDayOfYear + 2) / 153;                                              // [0, 11], March is 0
+    uint32_t month = marchMonth < 10 ? marchMonth + 3 : marchMonth - 9;
+    int64_t year = era * 400 + yearOfEra + (month <= 2);
+    if (!isValidValue(&YEAR_RANGE, year)) return UNINITIALIZED_DATE;
+
+    Date date = {.year = year, .month = month, .day = (int8_t) (marchDayOfYear - (153 * marchMonth + 2) / 5 + 1)};
+    date.weekDay = floorMod(epochDay + 3, 7) + 1;
+    return date;
 }
 
 Date dateOfYearDay(uint32_t year, uint32_t dayOfYear) {
@@ -73,26 +56,15 @@ Date dateOfInstant(Instant *instant, const TimeZone *zone) {
     return UNINITIALIZED_DATE;
 }
 
-int64_t dateToEpochDay(Date *date) {
+int64_t dateToEpochDay(Date *date) {     // civil date to days without loops, inverse of dateOfEpochDay()
     if (!isDateValid(date)) return INT64_MIN;
-    int64_t year = date->year;
-    int64_t month = date->month;
-    int64_t total = 0;
-    total += 365 * year;
-    if (year >= 0) {
-        total += (year + 3) / 4 - (year + 99) / 100 + (year + 399) / 400;
-    } else {
-        total -= year / -4 - year / -100 + year / -400;
-    }
-    total += ((367 * month - 362) / 12);
-    total += date->day - 1;
-    if (month > 2) {
-        total--;
-        if (!isLeapYear(date->year)) {
-            total--;
-        }
-    }
-    return total - DAYS_0000_TO_1970;
+    uint32_t month = date->month;
+    int64_t year = date->year - (month <= 2);    // March based year
+    int64_t era = (year >= 0 ? year : year - 399) / 400;
+    uint32_t yearOfEra = (uint32_t) (year - era * 400);                                         // [0, 399]
+    uint32_t marchDayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + date->day - 1;   // [0, 365]
+    uint32_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + marchDayOfYear;    // [0, 146096]
+    return era * DAYS_PER_CYCLE + dayOfEra - (DAYS_0000_TO_1970 - 60);
 }
 
 int64_t dateToEpochSeconds(Date *date, Time *time, const TimeZone *zone) {
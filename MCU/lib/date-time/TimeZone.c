@@ -1,10 +1,34 @@
 #include "TimeZone.h"
 
+#ifdef ENABLE_TIME_ZONE_SUPPORT
+#include "TimeZoneIds.h"
+#endif
+
 #define ARRAY_SIZE(arr) (sizeof(arr) / sizeof((arr)[0]))
 #define ZONE_NOT_FOUND  (-1)
+#define MAX_ZONE_OFFSET_SECONDS 64800   // offsets are limited to -18:00 ... +18:00
+
+typedef struct ZoneOffsetCache {
+    bool isValid;
+    uint32_t resetGeneration;
+    const TimeZoneRule *rules;
+    uint16_t ruleCount;
+    int32_t utcOffset;
+    const char *const *names;
+    int64_t validFrom;  // [validFrom, validUntil) instant range with the same info
+    int64_t validUntil;
+    ZoneOffsetInfo info;
+    ZoneOffsetCacheStats stats;
+} ZoneOffsetCache;
 
+static volatile uint32_t zoneOffsetCacheGeneration = 0;
+static __thread ZoneOffsetCache zoneOffsetCache;   // one per task, so no locking needed
 
 static int32_t findZoneIndexById(const char *id);
+static ZoneOffsetInfo resolveZoneOffsetRange(int64_t epochSeconds, const TimeZone *zone, int64_t *validFrom, int64_t *validUntil);
+static bool isZoneOffsetCacheHit(ZoneOffsetCache *cache, uint32_t resetGeneration, int64_t epochSeconds, const TimeZone *zone);
+static uint32_t getZoneRuleCount(const TimeZone *zone);
+static uint32_t findFirstRuleNotBefore(const TimeZoneRule *rules, uint32_t fromIndex, uint32_t toIndex, int64_t epochSeconds);
 
 
 const TimeZone *findTimeZone(const char *zoneId) {
@@ -13,39 +37,58 @@ const TimeZone *findTimeZone(const char *zoneId) {
     return zoneIndex == ZONE_NOT_FOUND ? NULL : &ZONE_LIST[zoneIndex];
 }
 
-int32_t resolveTimeZoneOffset(int64_t epochSeconds, const TimeZone *zone) {
-    ZoneTransition zoneTransition = findZoneRuleTransition(epochSeconds, zone);
-    if (zoneTransition.after != NULL && zoneTransition.before != NULL) {
-        if (isTransitionGap(&zoneTransition, epochSeconds)) {
-            return zoneTransition.after->gmtOffset;
-        }
-        return zoneTransition.before->gmtOffset;
+uint32_t findTimeZonesByPrefix(const char *prefix, const TimeZone **zones, uint32_t capacity) {
+    if (prefix == NULL) return 0;
+    #ifdef ENABLE_TIME_ZONE_SUPPORT
+    uint32_t first = 0;
+    uint32_t count = findTimeZoneIdKeywordPrefixRange(prefix, strlen(prefix), &first);
+    for (uint32_t i = 0; zones != NULL && i < count && i < capacity; i++) {
+        zones[i] = &ZONE_LIST[getTimeZoneIdKeywordInOrder(first + i)->value];
     }
-    return zone->utcOffset;
+    return count;
+    #else
+    (void) zones;
+    (void) capacity;
+    return 0;
+    #endif
 }
 
-const char *resolveTimeZoneName(int64_t epochSeconds, const TimeZone *zone, ZoneTextStyle textStyle) {
-    ZoneTransition zoneTransition = findZoneRuleTransition(epochSeconds, zone);
-    if (zoneTransition.before != NULL) {
-        if (zoneTransition.before->isDaylightTime) {
-            return (textStyle == ZONE_NAME_LONG) ? zone->names[ZONE_LONG_NAME_DTS_INDEX] : zone->names[ZONE_SHORT_NAME_DTS_INDEX];
-        }
+ZoneOffsetInfo resolveTimeZoneInfo(int64_t epochSeconds, const TimeZone *zone) {
+    ZoneOffsetCache *cache = &zoneOffsetCache;
+    uint32_t resetGeneration = zoneOffsetCacheGeneration;  // read before resolving, so reset during lookup is not missed
+    if (isZoneOffsetCacheHit(cache, resetGeneration, epochSeconds, zone)) {
+        cache->stats.hits++;
+        return cache->info;
     }
-    return (textStyle == ZONE_NAME_LONG) ? zone->names[ZONE_LONG_NAME_STD_INDEX] : zone->names[ZONE_SHORT_NAME_STD_INDEX];
+
+    cache->stats.misses++;
+    cache->info = resolveZoneOffsetRange(epochSeconds, zone, &cache->validFrom, &cache->validUntil);
+    cache->rules = zone->rules;
+    cache->ruleCount = zone->ruleCount;
+    cache->utcOffset = zone->utcOffset;
+    cache->names = zone->names;
+    cache->resetGeneration = resetGeneration;
+    cache->isValid = true;
+    return cache->info;
+}
+
+int32_t resolveTimeZoneOffset(int64_t epochSeconds, const TimeZone *zone) {
+    return resolveTimeZoneInfo(epochSeconds, zone).offset;
+}
+
+const char *resolveTimeZoneName(int64_t epochSeconds, const TimeZone *zone, ZoneTextStyle textStyle) {
+    ZoneOffsetInfo info = resolveTimeZoneInfo(epochSeconds, zone);
+    return (textStyle == ZONE_NAME_LONG) ? info.longName : info.shortName;
 }
 
 ZoneTransition findZoneRuleTransition(int64_t epochSeconds, const TimeZone *zone) {
     ZoneTransition zoneTransition = {.after = NULL, .before = NULL};
     if (zone->rules != NULL) {
-        uint32_t i = 0;
-        const TimeZoneRule *rule = NULL;
-        while ((rule = &zone->rules[i])->transition != 0) {
-            if (rule->transition >= epochSeconds && i > 0) {
-                zoneTransition.before = &zone->rules[i - 1];
-                zoneTransition.after = &zone->rules[i];
-                break;
-            }
-            i++;
+        uint32_t ruleCount = getZoneRuleCount(zone);
+        uint32_t index = findFirstRuleNotBefore(zone->rules, 1, ruleCount, epochSeconds);  // first rule has nothing before it
+        if (index < ruleCount) {
+            zoneTransition.before = &zone->rules[index - 1];
+            zoneTransition.after = &zone->rules[index];
         }
     }
     return zoneTransition;
@@ -57,31 +100,128 @@ bool isTransitionGap(ZoneTransition *transition, int64_t epochSeconds) {
     return (epochSeconds >= secondsBefore) && (epochSeconds < (secondsBefore + offsetAfter));
 }
 
+ZoneTransition findLocalZoneTransition(int64_t localEpochSeconds, const TimeZone *zone, int32_t *offset) {
+    ZoneTransition zoneTransition = {.after = NULL, .before = NULL};
+    int32_t localOffset = zone->utcOffset;
+    if (zone->rules != NULL) {
+        // local window of each transition is within max offset from it, so earlier transitions can't contain local date-time
+        uint32_t ruleCount = getZoneRuleCount(zone);
+        uint32_t i = findFirstRuleNotBefore(zone->rules, 0, ruleCount, localEpochSeconds - MAX_ZONE_OFFSET_SECONDS);
+        if (i > 0) {
+            localOffset = zone->rules[i - 1].gmtOffset;
+        }
+
+        for (; i < ruleCount; i++) {
+            const TimeZoneRule *rule = &zone->rules[i];
+            int64_t localWindowStart = rule->transition + minInt64(localOffset, rule->gmtOffset);   // local time-line around transition
+            if (localEpochSeconds < localWindowStart) break;    // rules are sorted, next transitions are even later
+
+            int64_t localWindowEnd = rule->transition + maxInt64(localOffset, rule->gmtOffset);
+            if (localEpochSeconds < localWindowEnd && i > 0) {
+                zoneTransition.before = &zone->rules[i - 1];
+                zoneTransition.after = rule;
+                break;
+            }
+            localOffset = rule->gmtOffset;
+        }
+    }
+
+    if (offset != NULL) {
+        *offset = localOffset;
+    }
+    return zoneTransition;
+}
+
 bool isTimeZoneEquals(const TimeZone *timeZone, const TimeZone *other) {
     return strcmp(timeZone->id, other->id) == 0 && timeZone->utcOffset == other->utcOffset;
 }
 
-static int32_t findZoneIndexById(const char *id) {  // binary search
+ZoneOffsetCacheStats getZoneOffsetCacheStats() {
+    return zoneOffsetCache.stats;
+}
+
+void resetZoneOffsetCache() {
+    memset(&zoneOffsetCache, 0, sizeof(struct ZoneOffsetCache));
+    zoneOffsetCacheGeneration++;    // other tasks drop their cached range on next lookup, lost concurrent increment is not a problem
+}
+
+static int32_t findZoneIndexById(const char *id) {  // single perfect hash probe, ignoring case
     #ifdef ENABLE_TIME_ZONE_SUPPORT
-    int32_t leftIndex = 0;
-    int32_t rightIndex = ARRAY_SIZE(ZONE_LIST) - 1;
-    while (leftIndex <= rightIndex) {
-        int32_t middleIndex = leftIndex + (rightIndex - leftIndex) / 2;
+    const TimeZoneIdKeyword *keyword = findTimeZoneIdKeyword(id, strlen(id));
+    if (keyword != NULL && keyword->value < ARRAY_SIZE(ZONE_LIST)) {
+        return keyword->value;
+    }
+    #endif
+    return ZONE_NOT_FOUND;
+}
 
-        int32_t res = -1000;   // some random value assigned because if res is already 0 then it will always return 0
-        if (strcmp(id, ZONE_LIST[middleIndex].id) == 0)
-            res = 0;
+static ZoneOffsetInfo resolveZoneOffsetRange(int64_t epochSeconds, const TimeZone *zone, int64_t *validFrom, int64_t *validUntil) {
+    ZoneOffsetInfo info = {.offset = zone->utcOffset, .isDaylightTime = false, .shortName = NULL, .longName = NULL};
+    *validFrom = INT64_MIN;
+    *validUntil = INT64_MAX;
 
-        if (res == 0) { // Check if id is present at mid
-            return middleIndex;
+    uint32_t ruleCount = zone->rules != NULL ? getZoneRuleCount(zone) : 0;
+    uint32_t index = findFirstRuleNotBefore(zone->rules, 1, ruleCount, epochSeconds);
+    if (index < ruleCount) {    // same transition is found for (rules[index - 1], rules[index]]
+        const TimeZoneRule *before = &zone->rules[index - 1];
+        const TimeZoneRule *after = &zone->rules[index];
+        if (index > 1) {
+            *validFrom = before->transition + 1;
+        }
+        *validUntil = after->transition + 1;
+
+        ZoneTransition zoneTransition = {.before = before, .after = after};
+        uint32_t gapStart = before->transition;     // same bounds as in isTransitionGap()
+        uint32_t gapEnd = gapStart + after->gmtOffset;
+        if (isTransitionGap(&zoneTransition, epochSeconds)) {
+            info.offset = after->gmtOffset;
+            *validFrom = maxInt64(*validFrom, gapStart);
+            *validUntil = minInt64(*validUntil, gapEnd);
+        } else {
+            info.offset = before->gmtOffset;
+            if (epochSeconds < gapStart) {
+                *validUntil = minInt64(*validUntil, gapStart);
+            } else {
+                *validFrom = maxInt64(*validFrom, gapEnd);
+            }
         }
+        info.isDaylightTime = before->isDaylightTime;
+
+    } else if (ruleCount > 1) {
+        *validFrom = zone->rules[ruleCount - 1].transition + 1;
+    }
 
-        if (strcmp(id, ZONE_LIST[middleIndex].id) > 0) {    // If id greater, ignore leftIndex half
-            leftIndex = middleIndex + 1;
+    if (zone->names != NULL) {
+        info.shortName = info.isDaylightTime ? zone->names[ZONE_SHORT_NAME_DTS_INDEX] : zone->names[ZONE_SHORT_NAME_STD_INDEX];
+        info.longName = info.isDaylightTime ? zone->names[ZONE_LONG_NAME_DTS_INDEX] : zone->names[ZONE_LONG_NAME_STD_INDEX];
+    }
+    return info;
+}
+
+static bool isZoneOffsetCacheHit(ZoneOffsetCache *cache, uint32_t resetGeneration, int64_t epochSeconds, const TimeZone *zone) {
+    return cache->isValid && cache->resetGeneration == resetGeneration &&
+           epochSeconds >= cache->validFrom && epochSeconds < cache->validUntil &&
+           cache->rules == zone->rules && cache->ruleCount == zone->ruleCount &&
+           cache->utcOffset == zone->utcOffset && cache->names == zone->names;
+}
+
+static uint32_t getZoneRuleCount(const TimeZone *zone) {
+    if (zone->ruleCount > 0) return zone->ruleCount;
+    uint32_t count = 0;
+    while (zone->rules[count].transition != 0) {    // rules without known size, e.g. loaded at runtime
+        count++;
+    }
+    return count;
+}
+
+static uint32_t findFirstRuleNotBefore(const TimeZoneRule *rules, uint32_t fromIndex, uint32_t toIndex, int64_t epochSeconds) {   // binary search in [from, to)
+    while (fromIndex < toIndex) {
+        uint32_t middleIndex = fromIndex + (toIndex - fromIndex) / 2;
+        if (rules[middleIndex].transition < epochSeconds) {
+            fromIndex = middleIndex + 1;
         } else {
-            rightIndex = middleIndex - 1;  // If x is smaller, ignore rightIndex half
+            toIndex = middleIndex;
         }
     }
-    #endif
-    return ZONE_NOT_FOUND;
-}
\ No newline at end of file
+    return fromIndex;
+}
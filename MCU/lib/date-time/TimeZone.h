@@ -12,6 +12,7 @@ typedef struct TimeZone {
     int32_t utcOffset;   // in seconds
     const char *const *names;
     const TimeZoneRule *rules;
+    uint16_t ruleCount;  // rules before terminating {.transition = 0}, when 0 and rules are set, then counted on each lookup
 } TimeZone;
 
 typedef struct ZoneTransition {
@@ -19,6 +20,18 @@ typedef struct ZoneTransition {
     const TimeZoneRule *after;
 } ZoneTransition;
 
+typedef struct ZoneOffsetInfo {
+    int32_t offset;
+    bool isDaylightTime;
+    const char *shortName;
+    const char *longName;
+} ZoneOffsetInfo;
+
+typedef struct ZoneOffsetCacheStats {
+    uint32_t hits;
+    uint32_t misses;
+} ZoneOffsetCacheStats;
+
 typedef enum ZoneTextStyle {
     ZONE_NAME_SHORT,
     ZONE_NAME_LONG
@@ -32,32 +45,32 @@ static const TimeZone ZONE_LIST[] = {
         {.id = "Africa/Abidjan", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Accra", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Addis_Ababa", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Algiers", .utcOffset = 3600, .names = CET_ZONE_NAMES, .rules = AFRICA_ALGIERS_RULES},
+        {.id = "Africa/Algiers", .utcOffset = 3600, .names = CET_ZONE_NAMES, .rules = AFRICA_ALGIERS_RULES, .ruleCount = ZONE_RULE_COUNT(AFRICA_ALGIERS_RULES)},
         {.id = "Africa/Asmara", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Asmera", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Bamako", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Bangui", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Banjul", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Bissau", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = AFRICA_BISSAU_RULES},
+        {.id = "Africa/Bissau", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = AFRICA_BISSAU_RULES, .ruleCount = ZONE_RULE_COUNT(AFRICA_BISSAU_RULES)},
         {.id = "Africa/Blantyre", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Brazzaville", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Bujumbura", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Cairo", .utcOffset = 7200, .names = EET_ZONE_NAMES, .rules = AFRICA_CAIRO_RULES},
-        {.id = "Africa/Casablanca", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = AFRICA_CASABLANCA_RULES},
-        {.id = "Africa/Ceuta", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = AFRICA_CEUTA_RULES},
+        {.id = "Africa/Cairo", .utcOffset = 7200, .names = EET_ZONE_NAMES, .rules = AFRICA_CAIRO_RULES, .ruleCount = ZONE_RULE_COUNT(AFRICA_CAIRO_RULES)},
+        {.id = "Africa/Casablanca", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = AFRICA_CASABLANCA_RULES, .ruleCount = ZONE_RULE_COUNT(AFRICA_CASABLANCA_RULES)},
+        {.id = "Africa/Ceuta", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = AFRICA_CEUTA_RULES, .ruleCount = ZONE_RULE_COUNT(AFRICA_CEUTA_RULES)},
         {.id = "Africa/Conakry", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Dakar", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Dar_es_Salaam", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Djibouti", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Douala", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/El_Aaiun", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = AFRICA_EL_AAIUN_RULES},
+        {.id = "Africa/El_Aaiun", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = AFRICA_EL_AAIUN_RULES, .ruleCount = ZONE_RULE_COUNT(AFRICA_EL_AAIUN_RULES)},
         {.id = "Africa/Freetown", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Gaborone", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Harare", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Johannesburg", .utcOffset = 7200, .names = SAST_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Juba", .utcOffset = 7200, .names = EAT_ZONE_NAMES, .rules = AFRICA_JUBA_RULES},
+        {.id = "Africa/Juba", .utcOffset = 7200, .names = EAT_ZONE_NAMES, .rules = AFRICA_JUBA_RULES, .ruleCount = ZONE_RULE_COUNT(AFRICA_JUBA_RULES)},
         {.id = "Africa/Kampala", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Khartoum", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = AFRICA_KHARTOUM_RULES},
+        {.id = "Africa/Khartoum", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = AFRICA_KHARTOUM_RULES, .ruleCount = ZONE_RULE_COUNT(AFRICA_KHARTOUM_RULES)},
         {.id = "Africa/Kigali", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Kinshasa", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Lagos", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = NULL},
@@ -71,328 +84,328 @@ static const TimeZone ZONE_LIST[] = {
         {.id = "Africa/Maseru", .utcOffset = 7200, .names = SAST_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Mbabane", .utcOffset = 7200, .names = SAST_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Mogadishu", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Monrovia", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = AFRICA_MONROVIA_RULES},
+        {.id = "Africa/Monrovia", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = AFRICA_MONROVIA_RULES, .ruleCount = ZONE_RULE_COUNT(AFRICA_MONROVIA_RULES)},
         {.id = "Africa/Nairobi", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Ndjamena", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = AFRICA_NDJAMENA_RULES},
+        {.id = "Africa/Ndjamena", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = AFRICA_NDJAMENA_RULES, .ruleCount = ZONE_RULE_COUNT(AFRICA_NDJAMENA_RULES)},
         {.id = "Africa/Niamey", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Nouakchott", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Ouagadougou", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
         {.id = "Africa/Porto-Novo", .utcOffset = 3600, .names = WAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Sao_Tome", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = AFRICA_SAO_TOME_RULES},
+        {.id = "Africa/Sao_Tome", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = AFRICA_SAO_TOME_RULES, .ruleCount = ZONE_RULE_COUNT(AFRICA_SAO_TOME_RULES)},
         {.id = "Africa/Timbuktu", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Africa/Tripoli", .utcOffset = 7200, .names = EET_ZONE_NAMES, .rules = AFRICA_TRIPOLI_RULES},
-        {.id = "Africa/Tunis", .utcOffset = 3600, .names = CET_ZONE_NAMES, .rules = AFRICA_TUNIS_RULES},
-        {.id = "Africa/Windhoek", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = AFRICA_WINDHOEK_RULES},
-        {.id = "America/Adak", .utcOffset = -32400, .names = HST_ZONE_NAMES, .rules = AMERICA_ADAK_RULES},
-        {.id = "America/Anchorage", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = AMERICA_ANCHORAGE_RULES},
+        {.id = "Africa/Tripoli", .utcOffset = 7200, .names = EET_ZONE_NAMES, .rules = AFRICA_TRIPOLI_RULES, .ruleCount = ZONE_RULE_COUNT(AFRICA_TRIPOLI_RULES)},
+        {.id = "Africa/Tunis", .utcOffset = 3600, .names = CET_ZONE_NAMES, .rules = AFRICA_TUNIS_RULES, .ruleCount = ZONE_RULE_COUNT(AFRICA_TUNIS_RULES)},
+        {.id = "Africa/Windhoek", .utcOffset = 7200, .names = CAT_ZONE_NAMES, .rules = AFRICA_WINDHOEK_RULES, .ruleCount = ZONE_RULE_COUNT(AFRICA_WINDHOEK_RULES)},
+        {.id = "America/Adak", .utcOffset = -32400, .names = HST_ZONE_NAMES, .rules = AMERICA_ADAK_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_ADAK_RULES)},
+        {.id = "America/Anchorage", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = AMERICA_ANCHORAGE_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_ANCHORAGE_RULES)},
         {.id = "America/Anguilla", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
         {.id = "America/Antigua", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Araguaina", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_ARAGUAINA_RULES},
-        {.id = "America/Argentina/Buenos_Aires", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_BUENOS_AIRES_RULES},
-        {.id = "America/Argentina/Catamarca", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_CATAMARCA_RULES},
+        {.id = "America/Araguaina", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_ARAGUAINA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_ARAGUAINA_RULES)},
+        {.id = "America/Argentina/Buenos_Aires", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_BUENOS_AIRES_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_ARGENTINA_BUENOS_AIRES_RULES)},
+        {.id = "America/Argentina/Catamarca", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_CATAMARCA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_ARGENTINA_CATAMARCA_RULES)},
         {.id = "America/Argentina/ComodRivadavia", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Argentina/Cordoba", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_CORDOBA_RULES},
-        {.id = "America/Argentina/Jujuy", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_JUJUY_RULES},
-        {.id = "America/Argentina/La_Rioja", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_LA_RIOJA_RULES},
-        {.id = "America/Argentina/Mendoza", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_MENDOZA_RULES},
-        {.id = "America/Argentina/Rio_Gallegos", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_RIO_GALLEGOS_RULES},
-        {.id = "America/Argentina/Salta", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_SALTA_RULES},
-        {.id = "America/Argentina/San_Juan", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_SAN_JUAN_RULES},
-        {.id = "America/Argentina/San_Luis", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_SAN_LUIS_RULES},
-        {.id = "America/Argentina/Tucuman", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_TUCUMAN_RULES},
-        {.id = "America/Argentina/Ushuaia", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_USHUAIA_RULES},
+        {.id = "America/Argentina/Cordoba", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_CORDOBA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_ARGENTINA_CORDOBA_RULES)},
+        {.id = "America/Argentina/Jujuy", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_JUJUY_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_ARGENTINA_JUJUY_RULES)},
+        {.id = "America/Argentina/La_Rioja", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_LA_RIOJA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_ARGENTINA_LA_RIOJA_RULES)},
+        {.id = "America/Argentina/Mendoza", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_MENDOZA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_ARGENTINA_MENDOZA_RULES)},
+        {.id = "America/Argentina/Rio_Gallegos", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_RIO_GALLEGOS_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_ARGENTINA_RIO_GALLEGOS_RULES)},
+        {.id = "America/Argentina/Salta", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_SALTA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_ARGENTINA_SALTA_RULES)},
+        {.id = "America/Argentina/San_Juan", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_SAN_JUAN_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_ARGENTINA_SAN_JUAN_RULES)},
+        {.id = "America/Argentina/San_Luis", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_SAN_LUIS_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_ARGENTINA_SAN_LUIS_RULES)},
+        {.id = "America/Argentina/Tucuman", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_TUCUMAN_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_ARGENTINA_TUCUMAN_RULES)},
+        {.id = "America/Argentina/Ushuaia", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = AMERICA_ARGENTINA_USHUAIA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_ARGENTINA_USHUAIA_RULES)},
         {.id = "America/Aruba", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Asuncion", .utcOffset = -14400, .names = PYT_ZONE_NAMES, .rules = AMERICA_ASUNCION_RULES},
+        {.id = "America/Asuncion", .utcOffset = -14400, .names = PYT_ZONE_NAMES, .rules = AMERICA_ASUNCION_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_ASUNCION_RULES)},
         {.id = "America/Atikokan", .utcOffset = -18000, .names = EST_ZONE_NAMES, .rules = NULL},
         {.id = "America/Atka", .utcOffset = -32400, .names = HST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Bahia", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_BAHIA_RULES},
-        {.id = "America/Bahia_Banderas", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_BAHIA_BANDERAS_RULES},
-        {.id = "America/Barbados", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = AMERICA_BARBADOS_RULES},
-        {.id = "America/Belem", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_BELEM_RULES},
-        {.id = "America/Belize", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_BELIZE_RULES},
+        {.id = "America/Bahia", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_BAHIA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_BAHIA_RULES)},
+        {.id = "America/Bahia_Banderas", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_BAHIA_BANDERAS_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_BAHIA_BANDERAS_RULES)},
+        {.id = "America/Barbados", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = AMERICA_BARBADOS_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_BARBADOS_RULES)},
+        {.id = "America/Belem", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_BELEM_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_BELEM_RULES)},
+        {.id = "America/Belize", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_BELIZE_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_BELIZE_RULES)},
         {.id = "America/Blanc-Sablon", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Boa_Vista", .utcOffset = -14400, .names = AMT_ZONE_NAMES, .rules = AMERICA_BOA_VISTA_RULES},
-        {.id = "America/Bogota", .utcOffset = -18000, .names = COT_ZONE_NAMES, .rules = AMERICA_BOGOTA_RULES},
-        {.id = "America/Boise", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_BOISE_RULES},
+        {.id = "America/Boa_Vista", .utcOffset = -14400, .names = AMT_ZONE_NAMES, .rules = AMERICA_BOA_VISTA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_BOA_VISTA_RULES)},
+        {.id = "America/Bogota", .utcOffset = -18000, .names = COT_ZONE_NAMES, .rules = AMERICA_BOGOTA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_BOGOTA_RULES)},
+        {.id = "America/Boise", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_BOISE_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_BOISE_RULES)},
         {.id = "America/Buenos_Aires", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Cambridge_Bay", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_CAMBRIDGE_BAY_RULES},
-        {.id = "America/Campo_Grande", .utcOffset = -14400, .names = AMT_ZONE_NAMES, .rules = AMERICA_CAMPO_GRANDE_RULES},
-        {.id = "America/Cancun", .utcOffset = -18000, .names = EST_ZONE_NAMES, .rules = AMERICA_CANCUN_RULES},
-        {.id = "America/Caracas", .utcOffset = -14400, .names = VET_ZONE_NAMES, .rules = AMERICA_CARACAS_RULES},
+        {.id = "America/Cambridge_Bay", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_CAMBRIDGE_BAY_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_CAMBRIDGE_BAY_RULES)},
+        {.id = "America/Campo_Grande", .utcOffset = -14400, .names = AMT_ZONE_NAMES, .rules = AMERICA_CAMPO_GRANDE_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_CAMPO_GRANDE_RULES)},
+        {.id = "America/Cancun", .utcOffset = -18000, .names = EST_ZONE_NAMES, .rules = AMERICA_CANCUN_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_CANCUN_RULES)},
+        {.id = "America/Caracas", .utcOffset = -14400, .names = VET_ZONE_NAMES, .rules = AMERICA_CARACAS_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_CARACAS_RULES)},
         {.id = "America/Catamarca", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = NULL},
         {.id = "America/Cayenne", .utcOffset = -10800, .names = GFT_ZONE_NAMES, .rules = NULL},
         {.id = "America/Cayman", .utcOffset = -18000, .names = EST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Chicago", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_CHICAGO_RULES},
-        {.id = "America/Chihuahua", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_CHIHUAHUA_RULES},
+        {.id = "America/Chicago", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_CHICAGO_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_CHICAGO_RULES)},
+        {.id = "America/Chihuahua", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_CHIHUAHUA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_CHIHUAHUA_RULES)},
         {.id = "America/Coral_Harbour", .utcOffset = -18000, .names = EST_ZONE_NAMES, .rules = NULL},
         {.id = "America/Cordoba", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Costa_Rica", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_COSTA_RICA_RULES},
+        {.id = "America/Costa_Rica", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_COSTA_RICA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_COSTA_RICA_RULES)},
         {.id = "America/Creston", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Cuiaba", .utcOffset = -14400, .names = AMT_ZONE_NAMES, .rules = AMERICA_CUIABA_RULES},
+        {.id = "America/Cuiaba", .utcOffset = -14400, .names = AMT_ZONE_NAMES, .rules = AMERICA_CUIABA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_CUIABA_RULES)},
         {.id = "America/Curacao", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Danmarkshavn", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = AMERICA_DANMARKSHAVN_RULES},
-        {.id = "America/Dawson", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = AMERICA_DAWSON_RULES},
-        {.id = "America/Dawson_Creek", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = AMERICA_DAWSON_CREEK_RULES},
-        {.id = "America/Denver", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_DENVER_RULES},
-        {.id = "America/Detroit", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_DETROIT_RULES},
+        {.id = "America/Danmarkshavn", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = AMERICA_DANMARKSHAVN_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_DANMARKSHAVN_RULES)},
+        {.id = "America/Dawson", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = AMERICA_DAWSON_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_DAWSON_RULES)},
+        {.id = "America/Dawson_Creek", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = AMERICA_DAWSON_CREEK_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_DAWSON_CREEK_RULES)},
+        {.id = "America/Denver", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_DENVER_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_DENVER_RULES)},
+        {.id = "America/Detroit", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_DETROIT_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_DETROIT_RULES)},
         {.id = "America/Dominica", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Edmonton", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_EDMONTON_RULES},
-        {.id = "America/Eirunepe", .utcOffset = -18000, .names = ACT_ZONE_NAMES, .rules = AMERICA_EIRUNEPE_RULES},
-        {.id = "America/El_Salvador", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_EL_SALVADOR_RULES},
+        {.id = "America/Edmonton", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_EDMONTON_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_EDMONTON_RULES)},
+        {.id = "America/Eirunepe", .utcOffset = -18000, .names = ACT_ZONE_NAMES, .rules = AMERICA_EIRUNEPE_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_EIRUNEPE_RULES)},
+        {.id = "America/El_Salvador", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_EL_SALVADOR_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_EL_SALVADOR_RULES)},
         {.id = "America/Ensenada", .utcOffset = -25200, .names = PST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Fort_Nelson", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = AMERICA_FORT_NELSON_RULES},
+        {.id = "America/Fort_Nelson", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = AMERICA_FORT_NELSON_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_FORT_NELSON_RULES)},
         {.id = "America/Fort_Wayne", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Fortaleza", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_FORTALEZA_RULES},
-        {.id = "America/Glace_Bay", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = AMERICA_GLACE_BAY_RULES},
+        {.id = "America/Fortaleza", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_FORTALEZA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_FORTALEZA_RULES)},
+        {.id = "America/Glace_Bay", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = AMERICA_GLACE_BAY_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_GLACE_BAY_RULES)},
         {.id = "America/Godthab", .utcOffset = -7200, .names = WGT_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Goose_Bay", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = AMERICA_GOOSE_BAY_RULES},
-        {.id = "America/Grand_Turk", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_GRAND_TURK_RULES},
+        {.id = "America/Goose_Bay", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = AMERICA_GOOSE_BAY_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_GOOSE_BAY_RULES)},
+        {.id = "America/Grand_Turk", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_GRAND_TURK_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_GRAND_TURK_RULES)},
         {.id = "America/Grenada", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
         {.id = "America/Guadeloupe", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Guatemala", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_GUATEMALA_RULES},
-        {.id = "America/Guayaquil", .utcOffset = -18000, .names = ECT_ZONE_NAMES, .rules = AMERICA_GUAYAQUIL_RULES},
-        {.id = "America/Guyana", .utcOffset = -14400, .names = GYT_ZONE_NAMES, .rules = AMERICA_GUYANA_RULES},
-        {.id = "America/Halifax", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = AMERICA_HALIFAX_RULES},
-        {.id = "America/Havana", .utcOffset = -14400, .names = CST_ZONE_NAMES, .rules = AMERICA_HAVANA_RULES},
-        {.id = "America/Hermosillo", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = AMERICA_HERMOSILLO_RULES},
-        {.id = "America/Indiana/Indianapolis", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_INDIANA_INDIANAPOLIS_RULES},
-        {.id = "America/Indiana/Knox", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_INDIANA_KNOX_RULES},
-        {.id = "America/Indiana/Marengo", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_INDIANA_MARENGO_RULES},
-        {.id = "America/Indiana/Petersburg", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_INDIANA_PETERSBURG_RULES},
-        {.id = "America/Indiana/Tell_City", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_INDIANA_TELL_CITY_RULES},
-        {.id = "America/Indiana/Vevay", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_INDIANA_VEVAY_RULES},
-        {.id = "America/Indiana/Vincennes", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_INDIANA_VINCENNES_RULES},
-        {.id = "America/Indiana/Winamac", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_INDIANA_WINAMAC_RULES},
+        {.id = "America/Guatemala", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_GUATEMALA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_GUATEMALA_RULES)},
+        {.id = "America/Guayaquil", .utcOffset = -18000, .names = ECT_ZONE_NAMES, .rules = AMERICA_GUAYAQUIL_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_GUAYAQUIL_RULES)},
+        {.id = "America/Guyana", .utcOffset = -14400, .names = GYT_ZONE_NAMES, .rules = AMERICA_GUYANA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_GUYANA_RULES)},
+        {.id = "America/Halifax", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = AMERICA_HALIFAX_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_HALIFAX_RULES)},
+        {.id = "America/Havana", .utcOffset = -14400, .names = CST_ZONE_NAMES, .rules = AMERICA_HAVANA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_HAVANA_RULES)},
+        {.id = "America/Hermosillo", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = AMERICA_HERMOSILLO_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_HERMOSILLO_RULES)},
+        {.id = "America/Indiana/Indianapolis", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_INDIANA_INDIANAPOLIS_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_INDIANA_INDIANAPOLIS_RULES)},
+        {.id = "America/Indiana/Knox", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_INDIANA_KNOX_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_INDIANA_KNOX_RULES)},
+        {.id = "America/Indiana/Marengo", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_INDIANA_MARENGO_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_INDIANA_MARENGO_RULES)},
+        {.id = "America/Indiana/Petersburg", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_INDIANA_PETERSBURG_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_INDIANA_PETERSBURG_RULES)},
+        {.id = "America/Indiana/Tell_City", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_INDIANA_TELL_CITY_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_INDIANA_TELL_CITY_RULES)},
+        {.id = "America/Indiana/Vevay", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_INDIANA_VEVAY_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_INDIANA_VEVAY_RULES)},
+        {.id = "America/Indiana/Vincennes", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_INDIANA_VINCENNES_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_INDIANA_VINCENNES_RULES)},
+        {.id = "America/Indiana/Winamac", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_INDIANA_WINAMAC_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_INDIANA_WINAMAC_RULES)},
         {.id = "America/Indianapolis", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Inuvik", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_INUVIK_RULES},
-        {.id = "America/Iqaluit", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_IQALUIT_RULES},
-        {.id = "America/Jamaica", .utcOffset = -18000, .names = EST_ZONE_NAMES, .rules = AMERICA_JAMAICA_RULES},
+        {.id = "America/Inuvik", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_INUVIK_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_INUVIK_RULES)},
+        {.id = "America/Iqaluit", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_IQALUIT_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_IQALUIT_RULES)},
+        {.id = "America/Jamaica", .utcOffset = -18000, .names = EST_ZONE_NAMES, .rules = AMERICA_JAMAICA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_JAMAICA_RULES)},
         {.id = "America/Jujuy", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Juneau", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = AMERICA_JUNEAU_RULES},
-        {.id = "America/Kentucky/Louisville", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_KENTUCKY_LOUISVILLE_RULES},
-        {.id = "America/Kentucky/Monticello", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_KENTUCKY_MONTICELLO_RULES},
+        {.id = "America/Juneau", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = AMERICA_JUNEAU_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_JUNEAU_RULES)},
+        {.id = "America/Kentucky/Louisville", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_KENTUCKY_LOUISVILLE_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_KENTUCKY_LOUISVILLE_RULES)},
+        {.id = "America/Kentucky/Monticello", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_KENTUCKY_MONTICELLO_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_KENTUCKY_MONTICELLO_RULES)},
         {.id = "America/Knox_IN", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = NULL},
         {.id = "America/Kralendijk", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
         {.id = "America/La_Paz", .utcOffset = -14400, .names = BOT_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Lima", .utcOffset = -18000, .names = PET_ZONE_NAMES, .rules = AMERICA_LIMA_RULES},
-        {.id = "America/Los_Angeles", .utcOffset = -25200, .names = PST_ZONE_NAMES, .rules = AMERICA_LOS_ANGELES_RULES},
+        {.id = "America/Lima", .utcOffset = -18000, .names = PET_ZONE_NAMES, .rules = AMERICA_LIMA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_LIMA_RULES)},
+        {.id = "America/Los_Angeles", .utcOffset = -25200, .names = PST_ZONE_NAMES, .rules = AMERICA_LOS_ANGELES_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_LOS_ANGELES_RULES)},
         {.id = "America/Louisville", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = NULL},
         {.id = "America/Lower_Princes", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Maceio", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_MACEIO_RULES},
-        {.id = "America/Managua", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_MANAGUA_RULES},
-        {.id = "America/Manaus", .utcOffset = -14400, .names = AMT_ZONE_NAMES, .rules = AMERICA_MANAUS_RULES},
+        {.id = "America/Maceio", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_MACEIO_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_MACEIO_RULES)},
+        {.id = "America/Managua", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_MANAGUA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_MANAGUA_RULES)},
+        {.id = "America/Manaus", .utcOffset = -14400, .names = AMT_ZONE_NAMES, .rules = AMERICA_MANAUS_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_MANAUS_RULES)},
         {.id = "America/Marigot", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Martinique", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = AMERICA_MARTINIQUE_RULES},
-        {.id = "America/Matamoros", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_MATAMOROS_RULES},
-        {.id = "America/Mazatlan", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_MAZATLAN_RULES},
+        {.id = "America/Martinique", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = AMERICA_MARTINIQUE_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_MARTINIQUE_RULES)},
+        {.id = "America/Matamoros", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_MATAMOROS_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_MATAMOROS_RULES)},
+        {.id = "America/Mazatlan", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_MAZATLAN_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_MAZATLAN_RULES)},
         {.id = "America/Mendoza", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Menominee", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_MENOMINEE_RULES},
-        {.id = "America/Merida", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_MERIDA_RULES},
-        {.id = "America/Metlakatla", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = AMERICA_METLAKATLA_RULES},
-        {.id = "America/Mexico_City", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_MEXICO_CITY_RULES},
-        {.id = "America/Miquelon", .utcOffset = -7200, .names = PMST_ZONE_NAMES, .rules = AMERICA_MIQUELON_RULES},
-        {.id = "America/Moncton", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = AMERICA_MONCTON_RULES},
-        {.id = "America/Monterrey", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_MONTERREY_RULES},
-        {.id = "America/Montevideo", .utcOffset = -10800, .names = UYT_ZONE_NAMES, .rules = AMERICA_MONTEVIDEO_RULES},
+        {.id = "America/Menominee", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_MENOMINEE_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_MENOMINEE_RULES)},
+        {.id = "America/Merida", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_MERIDA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_MERIDA_RULES)},
+        {.id = "America/Metlakatla", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = AMERICA_METLAKATLA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_METLAKATLA_RULES)},
+        {.id = "America/Mexico_City", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_MEXICO_CITY_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_MEXICO_CITY_RULES)},
+        {.id = "America/Miquelon", .utcOffset = -7200, .names = PMST_ZONE_NAMES, .rules = AMERICA_MIQUELON_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_MIQUELON_RULES)},
+        {.id = "America/Moncton", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = AMERICA_MONCTON_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_MONCTON_RULES)},
+        {.id = "America/Monterrey", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_MONTERREY_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_MONTERREY_RULES)},
+        {.id = "America/Montevideo", .utcOffset = -10800, .names = UYT_ZONE_NAMES, .rules = AMERICA_MONTEVIDEO_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_MONTEVIDEO_RULES)},
         {.id = "America/Montreal", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = NULL},
         {.id = "America/Montserrat", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Nassau", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_NASSAU_RULES},
-        {.id = "America/New_York", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_NEW_YORK_RULES},
-        {.id = "America/Nipigon", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_NIPIGON_RULES},
-        {.id = "America/Nome", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = AMERICA_NOME_RULES},
-        {.id = "America/Noronha", .utcOffset = -7200, .names = FNT_ZONE_NAMES, .rules = AMERICA_NORONHA_RULES},
-        {.id = "America/North_Dakota/Beulah", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_NORTH_DAKOTA_BEULAH_RULES},
-        {.id = "America/North_Dakota/Center", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_NORTH_DAKOTA_CENTER_RULES},
-        {.id = "America/North_Dakota/New_Salem", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_NORTH_DAKOTA_NEW_SALEM_RULES},
-        {.id = "America/Nuuk", .utcOffset = -7200, .names = WGT_ZONE_NAMES, .rules = AMERICA_NUUK_RULES},
-        {.id = "America/Ojinaga", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_OJINAGA_RULES},
+        {.id = "America/Nassau", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_NASSAU_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_NASSAU_RULES)},
+        {.id = "America/New_York", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_NEW_YORK_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_NEW_YORK_RULES)},
+        {.id = "America/Nipigon", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_NIPIGON_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_NIPIGON_RULES)},
+        {.id = "America/Nome", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = AMERICA_NOME_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_NOME_RULES)},
+        {.id = "America/Noronha", .utcOffset = -7200, .names = FNT_ZONE_NAMES, .rules = AMERICA_NORONHA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_NORONHA_RULES)},
+        {.id = "America/North_Dakota/Beulah", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_NORTH_DAKOTA_BEULAH_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_NORTH_DAKOTA_BEULAH_RULES)},
+        {.id = "America/North_Dakota/Center", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_NORTH_DAKOTA_CENTER_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_NORTH_DAKOTA_CENTER_RULES)},
+        {.id = "America/North_Dakota/New_Salem", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_NORTH_DAKOTA_NEW_SALEM_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_NORTH_DAKOTA_NEW_SALEM_RULES)},
+        {.id = "America/Nuuk", .utcOffset = -7200, .names = WGT_ZONE_NAMES, .rules = AMERICA_NUUK_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_NUUK_RULES)},
+        {.id = "America/Ojinaga", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_OJINAGA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_OJINAGA_RULES)},
         {.id = "America/Panama", .utcOffset = -18000, .names = EST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Pangnirtung", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_PANGNIRTUNG_RULES},
-        {.id = "America/Paramaribo", .utcOffset = -10800, .names = SRT_ZONE_NAMES, .rules = AMERICA_PARAMARIBO_RULES},
+        {.id = "America/Pangnirtung", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_PANGNIRTUNG_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_PANGNIRTUNG_RULES)},
+        {.id = "America/Paramaribo", .utcOffset = -10800, .names = SRT_ZONE_NAMES, .rules = AMERICA_PARAMARIBO_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_PARAMARIBO_RULES)},
         {.id = "America/Phoenix", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Port-au-Prince", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_PORT_AU_PRINCE_RULES},
+        {.id = "America/Port-au-Prince", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_PORT_AU_PRINCE_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_PORT_AU_PRINCE_RULES)},
         {.id = "America/Port_of_Spain", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
         {.id = "America/Porto_Acre", .utcOffset = -18000, .names = ACT_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Porto_Velho", .utcOffset = -14400, .names = AMT_ZONE_NAMES, .rules = AMERICA_PORTO_VELHO_RULES},
+        {.id = "America/Porto_Velho", .utcOffset = -14400, .names = AMT_ZONE_NAMES, .rules = AMERICA_PORTO_VELHO_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_PORTO_VELHO_RULES)},
         {.id = "America/Puerto_Rico", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Punta_Arenas", .utcOffset = -10800, .names = GMT_03_00_ZONE_NAMES, .rules = AMERICA_PUNTA_ARENAS_RULES},
-        {.id = "America/Rainy_River", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_RAINY_RIVER_RULES},
-        {.id = "America/Rankin_Inlet", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_RANKIN_INLET_RULES},
-        {.id = "America/Recife", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_RECIFE_RULES},
+        {.id = "America/Punta_Arenas", .utcOffset = -10800, .names = GMT_03_00_ZONE_NAMES, .rules = AMERICA_PUNTA_ARENAS_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_PUNTA_ARENAS_RULES)},
+        {.id = "America/Rainy_River", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_RAINY_RIVER_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_RAINY_RIVER_RULES)},
+        {.id = "America/Rankin_Inlet", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_RANKIN_INLET_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_RANKIN_INLET_RULES)},
+        {.id = "America/Recife", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_RECIFE_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_RECIFE_RULES)},
         {.id = "America/Regina", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Resolute", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_RESOLUTE_RULES},
-        {.id = "America/Rio_Branco", .utcOffset = -18000, .names = ACT_ZONE_NAMES, .rules = AMERICA_RIO_BRANCO_RULES},
+        {.id = "America/Resolute", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_RESOLUTE_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_RESOLUTE_RULES)},
+        {.id = "America/Rio_Branco", .utcOffset = -18000, .names = ACT_ZONE_NAMES, .rules = AMERICA_RIO_BRANCO_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_RIO_BRANCO_RULES)},
         {.id = "America/Rosario", .utcOffset = -10800, .names = ART_ZONE_NAMES, .rules = NULL},
         {.id = "America/Santa_Isabel", .utcOffset = -25200, .names = PST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Santarem", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_SANTAREM_RULES},
-        {.id = "America/Santiago", .utcOffset = -14400, .names = CLT_ZONE_NAMES, .rules = AMERICA_SANTIAGO_RULES},
-        {.id = "America/Santo_Domingo", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = AMERICA_SANTO_DOMINGO_RULES},
-        {.id = "America/Sao_Paulo", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_SAO_PAULO_RULES},
-        {.id = "America/Scoresbysund", .utcOffset = 0, .names = EGT_ZONE_NAMES, .rules = AMERICA_SCORESBYSUND_RULES},
+        {.id = "America/Santarem", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_SANTAREM_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_SANTAREM_RULES)},
+        {.id = "America/Santiago", .utcOffset = -14400, .names = CLT_ZONE_NAMES, .rules = AMERICA_SANTIAGO_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_SANTIAGO_RULES)},
+        {.id = "America/Santo_Domingo", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = AMERICA_SANTO_DOMINGO_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_SANTO_DOMINGO_RULES)},
+        {.id = "America/Sao_Paulo", .utcOffset = -10800, .names = BRT_ZONE_NAMES, .rules = AMERICA_SAO_PAULO_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_SAO_PAULO_RULES)},
+        {.id = "America/Scoresbysund", .utcOffset = 0, .names = EGT_ZONE_NAMES, .rules = AMERICA_SCORESBYSUND_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_SCORESBYSUND_RULES)},
         {.id = "America/Shiprock", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Sitka", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = AMERICA_SITKA_RULES},
+        {.id = "America/Sitka", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = AMERICA_SITKA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_SITKA_RULES)},
         {.id = "America/St_Barthelemy", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/St_Johns", .utcOffset = -9000, .names = NST_ZONE_NAMES, .rules = AMERICA_ST_JOHNS_RULES},
+        {.id = "America/St_Johns", .utcOffset = -9000, .names = NST_ZONE_NAMES, .rules = AMERICA_ST_JOHNS_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_ST_JOHNS_RULES)},
         {.id = "America/St_Kitts", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
         {.id = "America/St_Lucia", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
         {.id = "America/St_Thomas", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
         {.id = "America/St_Vincent", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Swift_Current", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_SWIFT_CURRENT_RULES},
-        {.id = "America/Tegucigalpa", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_TEGUCIGALPA_RULES},
-        {.id = "America/Thule", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = AMERICA_THULE_RULES},
-        {.id = "America/Thunder_Bay", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_THUNDER_BAY_RULES},
-        {.id = "America/Tijuana", .utcOffset = -25200, .names = PST_ZONE_NAMES, .rules = AMERICA_TIJUANA_RULES},
-        {.id = "America/Toronto", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_TORONTO_RULES},
+        {.id = "America/Swift_Current", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_SWIFT_CURRENT_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_SWIFT_CURRENT_RULES)},
+        {.id = "America/Tegucigalpa", .utcOffset = -21600, .names = CST_ZONE_NAMES, .rules = AMERICA_TEGUCIGALPA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_TEGUCIGALPA_RULES)},
+        {.id = "America/Thule", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = AMERICA_THULE_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_THULE_RULES)},
+        {.id = "America/Thunder_Bay", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_THUNDER_BAY_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_THUNDER_BAY_RULES)},
+        {.id = "America/Tijuana", .utcOffset = -25200, .names = PST_ZONE_NAMES, .rules = AMERICA_TIJUANA_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_TIJUANA_RULES)},
+        {.id = "America/Toronto", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = AMERICA_TORONTO_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_TORONTO_RULES)},
         {.id = "America/Tortola", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Vancouver", .utcOffset = -25200, .names = PST_ZONE_NAMES, .rules = AMERICA_VANCOUVER_RULES},
+        {.id = "America/Vancouver", .utcOffset = -25200, .names = PST_ZONE_NAMES, .rules = AMERICA_VANCOUVER_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_VANCOUVER_RULES)},
         {.id = "America/Virgin", .utcOffset = -14400, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "America/Whitehorse", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = AMERICA_WHITEHORSE_RULES},
-        {.id = "America/Winnipeg", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_WINNIPEG_RULES},
-        {.id = "America/Yakutat", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = AMERICA_YAKUTAT_RULES},
-        {.id = "America/Yellowknife", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_YELLOWKNIFE_RULES},
-        {.id = "Antarctica/Casey", .utcOffset = 39600, .names = AWST_ZONE_NAMES, .rules = ANTARCTICA_CASEY_RULES},
-        {.id = "Antarctica/Davis", .utcOffset = 25200, .names = DAVT_ZONE_NAMES, .rules = ANTARCTICA_DAVIS_RULES},
+        {.id = "America/Whitehorse", .utcOffset = -25200, .names = MST_ZONE_NAMES, .rules = AMERICA_WHITEHORSE_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_WHITEHORSE_RULES)},
+        {.id = "America/Winnipeg", .utcOffset = -18000, .names = CST_ZONE_NAMES, .rules = AMERICA_WINNIPEG_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_WINNIPEG_RULES)},
+        {.id = "America/Yakutat", .utcOffset = -28800, .names = AKST_ZONE_NAMES, .rules = AMERICA_YAKUTAT_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_YAKUTAT_RULES)},
+        {.id = "America/Yellowknife", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = AMERICA_YELLOWKNIFE_RULES, .ruleCount = ZONE_RULE_COUNT(AMERICA_YELLOWKNIFE_RULES)},
+        {.id = "Antarctica/Casey", .utcOffset = 39600, .names = AWST_ZONE_NAMES, .rules = ANTARCTICA_CASEY_RULES, .ruleCount = ZONE_RULE_COUNT(ANTARCTICA_CASEY_RULES)},
+        {.id = "Antarctica/Davis", .utcOffset = 25200, .names = DAVT_ZONE_NAMES, .rules = ANTARCTICA_DAVIS_RULES, .ruleCount = ZONE_RULE_COUNT(ANTARCTICA_DAVIS_RULES)},
         {.id = "Antarctica/DumontDUrville", .utcOffset = 36000, .names = DDUT_ZONE_NAMES, .rules = NULL},
-        {.id = "Antarctica/Macquarie", .utcOffset = 36000, .names = MIST_ZONE_NAMES, .rules = ANTARCTICA_MACQUARIE_RULES},
-        {.id = "Antarctica/Mawson", .utcOffset = 18000, .names = MAWT_ZONE_NAMES, .rules = ANTARCTICA_MAWSON_RULES},
-        {.id = "Antarctica/McMurdo", .utcOffset = 43200, .names = NZST_ZONE_NAMES, .rules = ANTARCTICA_MCMURDO_RULES},
-        {.id = "Antarctica/Palmer", .utcOffset = -10800, .names = CLT_ZONE_NAMES, .rules = ANTARCTICA_PALMER_RULES},
-        {.id = "Antarctica/Rothera", .utcOffset = -10800, .names = ROTT_ZONE_NAMES, .rules = ANTARCTICA_ROTHERA_RULES},
+        {.id = "Antarctica/Macquarie", .utcOffset = 36000, .names = MIST_ZONE_NAMES, .rules = ANTARCTICA_MACQUARIE_RULES, .ruleCount = ZONE_RULE_COUNT(ANTARCTICA_MACQUARIE_RULES)},
+        {.id = "Antarctica/Mawson", .utcOffset = 18000, .names = MAWT_ZONE_NAMES, .rules = ANTARCTICA_MAWSON_RULES, .ruleCount = ZONE_RULE_COUNT(ANTARCTICA_MAWSON_RULES)},
+        {.id = "Antarctica/McMurdo", .utcOffset = 43200, .names = NZST_ZONE_NAMES, .rules = ANTARCTICA_MCMURDO_RULES, .ruleCount = ZONE_RULE_COUNT(ANTARCTICA_MCMURDO_RULES)},
+        {.id = "Antarctica/Palmer", .utcOffset = -10800, .names = CLT_ZONE_NAMES, .rules = ANTARCTICA_PALMER_RULES, .ruleCount = ZONE_RULE_COUNT(ANTARCTICA_PALMER_RULES)},
+        {.id = "Antarctica/Rothera", .utcOffset = -10800, .names = ROTT_ZONE_NAMES, .rules = ANTARCTICA_ROTHERA_RULES, .ruleCount = ZONE_RULE_COUNT(ANTARCTICA_ROTHERA_RULES)},
         {.id = "Antarctica/South_Pole", .utcOffset = 43200, .names = NZST_ZONE_NAMES, .rules = NULL},
         {.id = "Antarctica/Syowa", .utcOffset = 10800, .names = SYOT_ZONE_NAMES, .rules = NULL},
-        {.id = "Antarctica/Troll", .utcOffset = 7200, .names = UTC_ZONE_NAMES, .rules = ANTARCTICA_TROLL_RULES},
+        {.id = "Antarctica/Troll", .utcOffset = 7200, .names = UTC_ZONE_NAMES, .rules = ANTARCTICA_TROLL_RULES, .ruleCount = ZONE_RULE_COUNT(ANTARCTICA_TROLL_RULES)},
         {.id = "Antarctica/Vostok", .utcOffset = 21600, .names = VOST_ZONE_NAMES, .rules = NULL},
-        {.id = "Arctic/Longyearbyen", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = ARCTIC_LONGYEARBYEN_RULES},
+        {.id = "Arctic/Longyearbyen", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = ARCTIC_LONGYEARBYEN_RULES, .ruleCount = ZONE_RULE_COUNT(ARCTIC_LONGYEARBYEN_RULES)},
         {.id = "Asia/Aden", .utcOffset = 10800, .names = AST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Almaty", .utcOffset = 21600, .names = ALMT_ZONE_NAMES, .rules = ASIA_ALMATY_RULES},
-        {.id = "Asia/Amman", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_AMMAN_RULES},
-        {.id = "Asia/Anadyr", .utcOffset = 43200, .names = ANAT_ZONE_NAMES, .rules = ASIA_ANADYR_RULES},
-        {.id = "Asia/Aqtau", .utcOffset = 18000, .names = AQTT_ZONE_NAMES, .rules = ASIA_AQTAU_RULES},
-        {.id = "Asia/Aqtobe", .utcOffset = 18000, .names = AQTT_ZONE_NAMES, .rules = ASIA_AQTOBE_RULES},
-        {.id = "Asia/Ashgabat", .utcOffset = 18000, .names = TMT_ZONE_NAMES, .rules = ASIA_ASHGABAT_RULES},
+        {.id = "Asia/Almaty", .utcOffset = 21600, .names = ALMT_ZONE_NAMES, .rules = ASIA_ALMATY_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_ALMATY_RULES)},
+        {.id = "Asia/Amman", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_AMMAN_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_AMMAN_RULES)},
+        {.id = "Asia/Anadyr", .utcOffset = 43200, .names = ANAT_ZONE_NAMES, .rules = ASIA_ANADYR_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_ANADYR_RULES)},
+        {.id = "Asia/Aqtau", .utcOffset = 18000, .names = AQTT_ZONE_NAMES, .rules = ASIA_AQTAU_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_AQTAU_RULES)},
+        {.id = "Asia/Aqtobe", .utcOffset = 18000, .names = AQTT_ZONE_NAMES, .rules = ASIA_AQTOBE_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_AQTOBE_RULES)},
+        {.id = "Asia/Ashgabat", .utcOffset = 18000, .names = TMT_ZONE_NAMES, .rules = ASIA_ASHGABAT_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_ASHGABAT_RULES)},
         {.id = "Asia/Ashkhabad", .utcOffset = 18000, .names = TMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Atyrau", .utcOffset = 18000, .names = GMT_05_00_ZONE_NAMES, .rules = ASIA_ATYRAU_RULES},
-        {.id = "Asia/Baghdad", .utcOffset = 10800, .names = AST_ZONE_NAMES, .rules = ASIA_BAGHDAD_RULES},
-        {.id = "Asia/Bahrain", .utcOffset = 10800, .names = AST_ZONE_NAMES, .rules = ASIA_BAHRAIN_RULES},
-        {.id = "Asia/Baku", .utcOffset = 14400, .names = AZT_ZONE_NAMES, .rules = ASIA_BAKU_RULES},
+        {.id = "Asia/Atyrau", .utcOffset = 18000, .names = GMT_05_00_ZONE_NAMES, .rules = ASIA_ATYRAU_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_ATYRAU_RULES)},
+        {.id = "Asia/Baghdad", .utcOffset = 10800, .names = AST_ZONE_NAMES, .rules = ASIA_BAGHDAD_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_BAGHDAD_RULES)},
+        {.id = "Asia/Bahrain", .utcOffset = 10800, .names = AST_ZONE_NAMES, .rules = ASIA_BAHRAIN_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_BAHRAIN_RULES)},
+        {.id = "Asia/Baku", .utcOffset = 14400, .names = AZT_ZONE_NAMES, .rules = ASIA_BAKU_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_BAKU_RULES)},
         {.id = "Asia/Bangkok", .utcOffset = 25200, .names = ICT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Barnaul", .utcOffset = 25200, .names = GMT_07_00_ZONE_NAMES, .rules = ASIA_BARNAUL_RULES},
-        {.id = "Asia/Beirut", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_BEIRUT_RULES},
-        {.id = "Asia/Bishkek", .utcOffset = 21600, .names = KGT_ZONE_NAMES, .rules = ASIA_BISHKEK_RULES},
+        {.id = "Asia/Barnaul", .utcOffset = 25200, .names = GMT_07_00_ZONE_NAMES, .rules = ASIA_BARNAUL_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_BARNAUL_RULES)},
+        {.id = "Asia/Beirut", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_BEIRUT_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_BEIRUT_RULES)},
+        {.id = "Asia/Bishkek", .utcOffset = 21600, .names = KGT_ZONE_NAMES, .rules = ASIA_BISHKEK_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_BISHKEK_RULES)},
         {.id = "Asia/Brunei", .utcOffset = 28800, .names = BNT_ZONE_NAMES, .rules = NULL},
         {.id = "Asia/Calcutta", .utcOffset = 19800, .names = IST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Chita", .utcOffset = 32400, .names = YAKT_ZONE_NAMES, .rules = ASIA_CHITA_RULES},
-        {.id = "Asia/Choibalsan", .utcOffset = 28800, .names = CHOT_ZONE_NAMES, .rules = ASIA_CHOIBALSAN_RULES},
+        {.id = "Asia/Chita", .utcOffset = 32400, .names = YAKT_ZONE_NAMES, .rules = ASIA_CHITA_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_CHITA_RULES)},
+        {.id = "Asia/Choibalsan", .utcOffset = 28800, .names = CHOT_ZONE_NAMES, .rules = ASIA_CHOIBALSAN_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_CHOIBALSAN_RULES)},
         {.id = "Asia/Chongqing", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = NULL},
         {.id = "Asia/Chungking", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Colombo", .utcOffset = 19800, .names = IST_ZONE_NAMES, .rules = ASIA_COLOMBO_RULES},
+        {.id = "Asia/Colombo", .utcOffset = 19800, .names = IST_ZONE_NAMES, .rules = ASIA_COLOMBO_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_COLOMBO_RULES)},
         {.id = "Asia/Dacca", .utcOffset = 21600, .names = BDT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Damascus", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_DAMASCUS_RULES},
-        {.id = "Asia/Dhaka", .utcOffset = 21600, .names = BDT_ZONE_NAMES, .rules = ASIA_DHAKA_RULES},
-        {.id = "Asia/Dili", .utcOffset = 32400, .names = TLT_ZONE_NAMES, .rules = ASIA_DILI_RULES},
+        {.id = "Asia/Damascus", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_DAMASCUS_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_DAMASCUS_RULES)},
+        {.id = "Asia/Dhaka", .utcOffset = 21600, .names = BDT_ZONE_NAMES, .rules = ASIA_DHAKA_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_DHAKA_RULES)},
+        {.id = "Asia/Dili", .utcOffset = 32400, .names = TLT_ZONE_NAMES, .rules = ASIA_DILI_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_DILI_RULES)},
         {.id = "Asia/Dubai", .utcOffset = 14400, .names = GST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Dushanbe", .utcOffset = 18000, .names = TJT_ZONE_NAMES, .rules = ASIA_DUSHANBE_RULES},
-        {.id = "Asia/Famagusta", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_FAMAGUSTA_RULES},
-        {.id = "Asia/Gaza", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_GAZA_RULES},
+        {.id = "Asia/Dushanbe", .utcOffset = 18000, .names = TJT_ZONE_NAMES, .rules = ASIA_DUSHANBE_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_DUSHANBE_RULES)},
+        {.id = "Asia/Famagusta", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_FAMAGUSTA_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_FAMAGUSTA_RULES)},
+        {.id = "Asia/Gaza", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_GAZA_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_GAZA_RULES)},
         {.id = "Asia/Harbin", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Hebron", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_HEBRON_RULES},
-        {.id = "Asia/Ho_Chi_Minh", .utcOffset = 25200, .names = ICT_ZONE_NAMES, .rules = ASIA_HO_CHI_MINH_RULES},
-        {.id = "Asia/Hong_Kong", .utcOffset = 28800, .names = HKT_ZONE_NAMES, .rules = ASIA_HONG_KONG_RULES},
-        {.id = "Asia/Hovd", .utcOffset = 25200, .names = HOVT_ZONE_NAMES, .rules = ASIA_HOVD_RULES},
-        {.id = "Asia/Irkutsk", .utcOffset = 28800, .names = IRKT_ZONE_NAMES, .rules = ASIA_IRKUTSK_RULES},
+        {.id = "Asia/Hebron", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_HEBRON_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_HEBRON_RULES)},
+        {.id = "Asia/Ho_Chi_Minh", .utcOffset = 25200, .names = ICT_ZONE_NAMES, .rules = ASIA_HO_CHI_MINH_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_HO_CHI_MINH_RULES)},
+        {.id = "Asia/Hong_Kong", .utcOffset = 28800, .names = HKT_ZONE_NAMES, .rules = ASIA_HONG_KONG_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_HONG_KONG_RULES)},
+        {.id = "Asia/Hovd", .utcOffset = 25200, .names = HOVT_ZONE_NAMES, .rules = ASIA_HOVD_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_HOVD_RULES)},
+        {.id = "Asia/Irkutsk", .utcOffset = 28800, .names = IRKT_ZONE_NAMES, .rules = ASIA_IRKUTSK_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_IRKUTSK_RULES)},
         {.id = "Asia/Istanbul", .utcOffset = 10800, .names = TRT_ZONE_NAMES, .rules = NULL},
         {.id = "Asia/Jakarta", .utcOffset = 25200, .names = WIB_ZONE_NAMES, .rules = NULL},
         {.id = "Asia/Jayapura", .utcOffset = 32400, .names = WIT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Jerusalem", .utcOffset = 10800, .names = IST_ZONE_NAMES, .rules = ASIA_JERUSALEM_RULES},
+        {.id = "Asia/Jerusalem", .utcOffset = 10800, .names = IST_ZONE_NAMES, .rules = ASIA_JERUSALEM_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_JERUSALEM_RULES)},
         {.id = "Asia/Kabul", .utcOffset = 16200, .names = AFT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Kamchatka", .utcOffset = 43200, .names = PETT_ZONE_NAMES, .rules = ASIA_KAMCHATKA_RULES},
-        {.id = "Asia/Karachi", .utcOffset = 18000, .names = PKT_ZONE_NAMES, .rules = ASIA_KARACHI_RULES},
+        {.id = "Asia/Kamchatka", .utcOffset = 43200, .names = PETT_ZONE_NAMES, .rules = ASIA_KAMCHATKA_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_KAMCHATKA_RULES)},
+        {.id = "Asia/Karachi", .utcOffset = 18000, .names = PKT_ZONE_NAMES, .rules = ASIA_KARACHI_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_KARACHI_RULES)},
         {.id = "Asia/Kashgar", .utcOffset = 21600, .names = XJT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Kathmandu", .utcOffset = 20700, .names = NPT_ZONE_NAMES, .rules = ASIA_KATHMANDU_RULES},
+        {.id = "Asia/Kathmandu", .utcOffset = 20700, .names = NPT_ZONE_NAMES, .rules = ASIA_KATHMANDU_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_KATHMANDU_RULES)},
         {.id = "Asia/Katmandu", .utcOffset = 20700, .names = NPT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Khandyga", .utcOffset = 32400, .names = YAKT_ZONE_NAMES, .rules = ASIA_KHANDYGA_RULES},
+        {.id = "Asia/Khandyga", .utcOffset = 32400, .names = YAKT_ZONE_NAMES, .rules = ASIA_KHANDYGA_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_KHANDYGA_RULES)},
         {.id = "Asia/Kolkata", .utcOffset = 19800, .names = IST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Krasnoyarsk", .utcOffset = 25200, .names = KRAT_ZONE_NAMES, .rules = ASIA_KRASNOYARSK_RULES},
-        {.id = "Asia/Kuala_Lumpur", .utcOffset = 28800, .names = MYT_ZONE_NAMES, .rules = ASIA_KUALA_LUMPUR_RULES},
+        {.id = "Asia/Krasnoyarsk", .utcOffset = 25200, .names = KRAT_ZONE_NAMES, .rules = ASIA_KRASNOYARSK_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_KRASNOYARSK_RULES)},
+        {.id = "Asia/Kuala_Lumpur", .utcOffset = 28800, .names = MYT_ZONE_NAMES, .rules = ASIA_KUALA_LUMPUR_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_KUALA_LUMPUR_RULES)},
         {.id = "Asia/Kuching", .utcOffset = 28800, .names = MYT_ZONE_NAMES, .rules = NULL},
         {.id = "Asia/Kuwait", .utcOffset = 10800, .names = AST_ZONE_NAMES, .rules = NULL},
         {.id = "Asia/Macao", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Macau", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = ASIA_MACAU_RULES},
-        {.id = "Asia/Magadan", .utcOffset = 39600, .names = MAGT_ZONE_NAMES, .rules = ASIA_MAGADAN_RULES},
+        {.id = "Asia/Macau", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = ASIA_MACAU_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_MACAU_RULES)},
+        {.id = "Asia/Magadan", .utcOffset = 39600, .names = MAGT_ZONE_NAMES, .rules = ASIA_MAGADAN_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_MAGADAN_RULES)},
         {.id = "Asia/Makassar", .utcOffset = 28800, .names = WITA_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Manila", .utcOffset = 28800, .names = PST_ZONE_NAMES, .rules = ASIA_MANILA_RULES},
+        {.id = "Asia/Manila", .utcOffset = 28800, .names = PST_ZONE_NAMES, .rules = ASIA_MANILA_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_MANILA_RULES)},
         {.id = "Asia/Muscat", .utcOffset = 14400, .names = GST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Nicosia", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_NICOSIA_RULES},
-        {.id = "Asia/Novokuznetsk", .utcOffset = 25200, .names = KRAT_ZONE_NAMES, .rules = ASIA_NOVOKUZNETSK_RULES},
-        {.id = "Asia/Novosibirsk", .utcOffset = 25200, .names = NOVT_ZONE_NAMES, .rules = ASIA_NOVOSIBIRSK_RULES},
-        {.id = "Asia/Omsk", .utcOffset = 21600, .names = OMST_ZONE_NAMES, .rules = ASIA_OMSK_RULES},
-        {.id = "Asia/Oral", .utcOffset = 18000, .names = ORAT_ZONE_NAMES, .rules = ASIA_ORAL_RULES},
+        {.id = "Asia/Nicosia", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = ASIA_NICOSIA_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_NICOSIA_RULES)},
+        {.id = "Asia/Novokuznetsk", .utcOffset = 25200, .names = KRAT_ZONE_NAMES, .rules = ASIA_NOVOKUZNETSK_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_NOVOKUZNETSK_RULES)},
+        {.id = "Asia/Novosibirsk", .utcOffset = 25200, .names = NOVT_ZONE_NAMES, .rules = ASIA_NOVOSIBIRSK_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_NOVOSIBIRSK_RULES)},
+        {.id = "Asia/Omsk", .utcOffset = 21600, .names = OMST_ZONE_NAMES, .rules = ASIA_OMSK_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_OMSK_RULES)},
+        {.id = "Asia/Oral", .utcOffset = 18000, .names = ORAT_ZONE_NAMES, .rules = ASIA_ORAL_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_ORAL_RULES)},
         {.id = "Asia/Phnom_Penh", .utcOffset = 25200, .names = ICT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Pontianak", .utcOffset = 25200, .names = WIB_ZONE_NAMES, .rules = ASIA_PONTIANAK_RULES},
-        {.id = "Asia/Pyongyang", .utcOffset = 32400, .names = KST_ZONE_NAMES, .rules = ASIA_PYONGYANG_RULES},
-        {.id = "Asia/Qatar", .utcOffset = 10800, .names = AST_ZONE_NAMES, .rules = ASIA_QATAR_RULES},
-        {.id = "Asia/Qostanay", .utcOffset = 21600, .names = QOST_ZONE_NAMES, .rules = ASIA_QOSTANAY_RULES},
-        {.id = "Asia/Qyzylorda", .utcOffset = 18000, .names = QYZT_ZONE_NAMES, .rules = ASIA_QYZYLORDA_RULES},
+        {.id = "Asia/Pontianak", .utcOffset = 25200, .names = WIB_ZONE_NAMES, .rules = ASIA_PONTIANAK_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_PONTIANAK_RULES)},
+        {.id = "Asia/Pyongyang", .utcOffset = 32400, .names = KST_ZONE_NAMES, .rules = ASIA_PYONGYANG_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_PYONGYANG_RULES)},
+        {.id = "Asia/Qatar", .utcOffset = 10800, .names = AST_ZONE_NAMES, .rules = ASIA_QATAR_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_QATAR_RULES)},
+        {.id = "Asia/Qostanay", .utcOffset = 21600, .names = QOST_ZONE_NAMES, .rules = ASIA_QOSTANAY_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_QOSTANAY_RULES)},
+        {.id = "Asia/Qyzylorda", .utcOffset = 18000, .names = QYZT_ZONE_NAMES, .rules = ASIA_QYZYLORDA_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_QYZYLORDA_RULES)},
         {.id = "Asia/Rangoon", .utcOffset = 23400, .names = MMT_ZONE_NAMES, .rules = NULL},
         {.id = "Asia/Riyadh", .utcOffset = 10800, .names = AST_ZONE_NAMES, .rules = NULL},
         {.id = "Asia/Saigon", .utcOffset = 25200, .names = ICT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Sakhalin", .utcOffset = 39600, .names = SAKT_ZONE_NAMES, .rules = ASIA_SAKHALIN_RULES},
-        {.id = "Asia/Samarkand", .utcOffset = 18000, .names = UZT_ZONE_NAMES, .rules = ASIA_SAMARKAND_RULES},
-        {.id = "Asia/Seoul", .utcOffset = 32400, .names = KST_ZONE_NAMES, .rules = ASIA_SEOUL_RULES},
-        {.id = "Asia/Shanghai", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = ASIA_SHANGHAI_RULES},
-        {.id = "Asia/Singapore", .utcOffset = 28800, .names = SGT_ZONE_NAMES, .rules = ASIA_SINGAPORE_RULES},
-        {.id = "Asia/Srednekolymsk", .utcOffset = 39600, .names = SRET_ZONE_NAMES, .rules = ASIA_SREDNEKOLYMSK_RULES},
-        {.id = "Asia/Taipei", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = ASIA_TAIPEI_RULES},
-        {.id = "Asia/Tashkent", .utcOffset = 18000, .names = UZT_ZONE_NAMES, .rules = ASIA_TASHKENT_RULES},
-        {.id = "Asia/Tbilisi", .utcOffset = 14400, .names = GET_ZONE_NAMES, .rules = ASIA_TBILISI_RULES},
-        {.id = "Asia/Tehran", .utcOffset = 16200, .names = IRST_ZONE_NAMES, .rules = ASIA_TEHRAN_RULES},
+        {.id = "Asia/Sakhalin", .utcOffset = 39600, .names = SAKT_ZONE_NAMES, .rules = ASIA_SAKHALIN_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_SAKHALIN_RULES)},
+        {.id = "Asia/Samarkand", .utcOffset = 18000, .names = UZT_ZONE_NAMES, .rules = ASIA_SAMARKAND_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_SAMARKAND_RULES)},
+        {.id = "Asia/Seoul", .utcOffset = 32400, .names = KST_ZONE_NAMES, .rules = ASIA_SEOUL_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_SEOUL_RULES)},
+        {.id = "Asia/Shanghai", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = ASIA_SHANGHAI_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_SHANGHAI_RULES)},
+        {.id = "Asia/Singapore", .utcOffset = 28800, .names = SGT_ZONE_NAMES, .rules = ASIA_SINGAPORE_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_SINGAPORE_RULES)},
+        {.id = "Asia/Srednekolymsk", .utcOffset = 39600, .names = SRET_ZONE_NAMES, .rules = ASIA_SREDNEKOLYMSK_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_SREDNEKOLYMSK_RULES)},
+        {.id = "Asia/Taipei", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = ASIA_TAIPEI_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_TAIPEI_RULES)},
+        {.id = "Asia/Tashkent", .utcOffset = 18000, .names = UZT_ZONE_NAMES, .rules = ASIA_TASHKENT_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_TASHKENT_RULES)},
+        {.id = "Asia/Tbilisi", .utcOffset = 14400, .names = GET_ZONE_NAMES, .rules = ASIA_TBILISI_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_TBILISI_RULES)},
+        {.id = "Asia/Tehran", .utcOffset = 16200, .names = IRST_ZONE_NAMES, .rules = ASIA_TEHRAN_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_TEHRAN_RULES)},
         {.id = "Asia/Tel_Aviv", .utcOffset = 10800, .names = IST_ZONE_NAMES, .rules = NULL},
         {.id = "Asia/Thimbu", .utcOffset = 21600, .names = BTT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Thimphu", .utcOffset = 21600, .names = BTT_ZONE_NAMES, .rules = ASIA_THIMPHU_RULES},
+        {.id = "Asia/Thimphu", .utcOffset = 21600, .names = BTT_ZONE_NAMES, .rules = ASIA_THIMPHU_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_THIMPHU_RULES)},
         {.id = "Asia/Tokyo", .utcOffset = 32400, .names = JST_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Tomsk", .utcOffset = 25200, .names = GMT_07_00_ZONE_NAMES, .rules = ASIA_TOMSK_RULES},
+        {.id = "Asia/Tomsk", .utcOffset = 25200, .names = GMT_07_00_ZONE_NAMES, .rules = ASIA_TOMSK_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_TOMSK_RULES)},
         {.id = "Asia/Ujung_Pandang", .utcOffset = 28800, .names = WITA_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Ulaanbaatar", .utcOffset = 28800, .names = ULAT_ZONE_NAMES, .rules = ASIA_ULAANBAATAR_RULES},
+        {.id = "Asia/Ulaanbaatar", .utcOffset = 28800, .names = ULAT_ZONE_NAMES, .rules = ASIA_ULAANBAATAR_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_ULAANBAATAR_RULES)},
         {.id = "Asia/Ulan_Bator", .utcOffset = 28800, .names = ULAT_ZONE_NAMES, .rules = NULL},
         {.id = "Asia/Urumqi", .utcOffset = 21600, .names = XJT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Ust-Nera", .utcOffset = 36000, .names = VLAT_ZONE_NAMES, .rules = ASIA_UST_NERA_RULES},
+        {.id = "Asia/Ust-Nera", .utcOffset = 36000, .names = VLAT_ZONE_NAMES, .rules = ASIA_UST_NERA_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_UST_NERA_RULES)},
         {.id = "Asia/Vientiane", .utcOffset = 25200, .names = ICT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Vladivostok", .utcOffset = 36000, .names = VLAT_ZONE_NAMES, .rules = ASIA_VLADIVOSTOK_RULES},
-        {.id = "Asia/Yakutsk", .utcOffset = 32400, .names = YAKT_ZONE_NAMES, .rules = ASIA_YAKUTSK_RULES},
+        {.id = "Asia/Vladivostok", .utcOffset = 36000, .names = VLAT_ZONE_NAMES, .rules = ASIA_VLADIVOSTOK_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_VLADIVOSTOK_RULES)},
+        {.id = "Asia/Yakutsk", .utcOffset = 32400, .names = YAKT_ZONE_NAMES, .rules = ASIA_YAKUTSK_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_YAKUTSK_RULES)},
         {.id = "Asia/Yangon", .utcOffset = 23400, .names = MMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Asia/Yekaterinburg", .utcOffset = 18000, .names = YEKT_ZONE_NAMES, .rules = ASIA_YEKATERINBURG_RULES},
-        {.id = "Asia/Yerevan", .utcOffset = 14400, .names = AMT_ZONE_NAMES, .rules = ASIA_YEREVAN_RULES},
-        {.id = "Atlantic/Azores", .utcOffset = 0, .names = AZOT_ZONE_NAMES, .rules = ATLANTIC_AZORES_RULES},
-        {.id = "Atlantic/Bermuda", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = ATLANTIC_BERMUDA_RULES},
-        {.id = "Atlantic/Canary", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = ATLANTIC_CANARY_RULES},
-        {.id = "Atlantic/Cape_Verde", .utcOffset = -3600, .names = CVT_ZONE_NAMES, .rules = ATLANTIC_CAPE_VERDE_RULES},
+        {.id = "Asia/Yekaterinburg", .utcOffset = 18000, .names = YEKT_ZONE_NAMES, .rules = ASIA_YEKATERINBURG_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_YEKATERINBURG_RULES)},
+        {.id = "Asia/Yerevan", .utcOffset = 14400, .names = AMT_ZONE_NAMES, .rules = ASIA_YEREVAN_RULES, .ruleCount = ZONE_RULE_COUNT(ASIA_YEREVAN_RULES)},
+        {.id = "Atlantic/Azores", .utcOffset = 0, .names = AZOT_ZONE_NAMES, .rules = ATLANTIC_AZORES_RULES, .ruleCount = ZONE_RULE_COUNT(ATLANTIC_AZORES_RULES)},
+        {.id = "Atlantic/Bermuda", .utcOffset = -10800, .names = AST_ZONE_NAMES, .rules = ATLANTIC_BERMUDA_RULES, .ruleCount = ZONE_RULE_COUNT(ATLANTIC_BERMUDA_RULES)},
+        {.id = "Atlantic/Canary", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = ATLANTIC_CANARY_RULES, .ruleCount = ZONE_RULE_COUNT(ATLANTIC_CANARY_RULES)},
+        {.id = "Atlantic/Cape_Verde", .utcOffset = -3600, .names = CVT_ZONE_NAMES, .rules = ATLANTIC_CAPE_VERDE_RULES, .ruleCount = ZONE_RULE_COUNT(ATLANTIC_CAPE_VERDE_RULES)},
         {.id = "Atlantic/Faeroe", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = NULL},
-        {.id = "Atlantic/Faroe", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = ATLANTIC_FAROE_RULES},
+        {.id = "Atlantic/Faroe", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = ATLANTIC_FAROE_RULES, .ruleCount = ZONE_RULE_COUNT(ATLANTIC_FAROE_RULES)},
         {.id = "Atlantic/Jan_Mayen", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = NULL},
-        {.id = "Atlantic/Madeira", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = ATLANTIC_MADEIRA_RULES},
+        {.id = "Atlantic/Madeira", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = ATLANTIC_MADEIRA_RULES, .ruleCount = ZONE_RULE_COUNT(ATLANTIC_MADEIRA_RULES)},
         {.id = "Atlantic/Reykjavik", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
         {.id = "Atlantic/South_Georgia", .utcOffset = -7200, .names = GST_ZONE_NAMES, .rules = NULL},
         {.id = "Atlantic/St_Helena", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Atlantic/Stanley", .utcOffset = -10800, .names = FKT_ZONE_NAMES, .rules = ATLANTIC_STANLEY_RULES},
+        {.id = "Atlantic/Stanley", .utcOffset = -10800, .names = FKT_ZONE_NAMES, .rules = ATLANTIC_STANLEY_RULES, .ruleCount = ZONE_RULE_COUNT(ATLANTIC_STANLEY_RULES)},
         {.id = "Australia/ACT", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = NULL},
-        {.id = "Australia/Adelaide", .utcOffset = 34200, .names = ACST_ZONE_NAMES, .rules = AUSTRALIA_ADELAIDE_RULES},
-        {.id = "Australia/Brisbane", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = AUSTRALIA_BRISBANE_RULES},
-        {.id = "Australia/Broken_Hill", .utcOffset = 34200, .names = ACST_ZONE_NAMES, .rules = AUSTRALIA_BROKEN_HILL_RULES},
+        {.id = "Australia/Adelaide", .utcOffset = 34200, .names = ACST_ZONE_NAMES, .rules = AUSTRALIA_ADELAIDE_RULES, .ruleCount = ZONE_RULE_COUNT(AUSTRALIA_ADELAIDE_RULES)},
+        {.id = "Australia/Brisbane", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = AUSTRALIA_BRISBANE_RULES, .ruleCount = ZONE_RULE_COUNT(AUSTRALIA_BRISBANE_RULES)},
+        {.id = "Australia/Broken_Hill", .utcOffset = 34200, .names = ACST_ZONE_NAMES, .rules = AUSTRALIA_BROKEN_HILL_RULES, .ruleCount = ZONE_RULE_COUNT(AUSTRALIA_BROKEN_HILL_RULES)},
         {.id = "Australia/Canberra", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = NULL},
         {.id = "Australia/Currie", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = NULL},
         {.id = "Australia/Darwin", .utcOffset = 34200, .names = ACST_ZONE_NAMES, .rules = NULL},
-        {.id = "Australia/Eucla", .utcOffset = 31500, .names = ACWST_ZONE_NAMES, .rules = AUSTRALIA_EUCLA_RULES},
-        {.id = "Australia/Hobart", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = AUSTRALIA_HOBART_RULES},
+        {.id = "Australia/Eucla", .utcOffset = 31500, .names = ACWST_ZONE_NAMES, .rules = AUSTRALIA_EUCLA_RULES, .ruleCount = ZONE_RULE_COUNT(AUSTRALIA_EUCLA_RULES)},
+        {.id = "Australia/Hobart", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = AUSTRALIA_HOBART_RULES, .ruleCount = ZONE_RULE_COUNT(AUSTRALIA_HOBART_RULES)},
         {.id = "Australia/LHI", .utcOffset = 37800, .names = LHST_ZONE_NAMES, .rules = NULL},
-        {.id = "Australia/Lindeman", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = AUSTRALIA_LINDEMAN_RULES},
-        {.id = "Australia/Lord_Howe", .utcOffset = 37800, .names = LHST_ZONE_NAMES, .rules = AUSTRALIA_LORD_HOWE_RULES},
-        {.id = "Australia/Melbourne", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = AUSTRALIA_MELBOURNE_RULES},
+        {.id = "Australia/Lindeman", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = AUSTRALIA_LINDEMAN_RULES, .ruleCount = ZONE_RULE_COUNT(AUSTRALIA_LINDEMAN_RULES)},
+        {.id = "Australia/Lord_Howe", .utcOffset = 37800, .names = LHST_ZONE_NAMES, .rules = AUSTRALIA_LORD_HOWE_RULES, .ruleCount = ZONE_RULE_COUNT(AUSTRALIA_LORD_HOWE_RULES)},
+        {.id = "Australia/Melbourne", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = AUSTRALIA_MELBOURNE_RULES, .ruleCount = ZONE_RULE_COUNT(AUSTRALIA_MELBOURNE_RULES)},
         {.id = "Australia/NSW", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = NULL},
         {.id = "Australia/North", .utcOffset = 34200, .names = ACST_ZONE_NAMES, .rules = NULL},
-        {.id = "Australia/Perth", .utcOffset = 28800, .names = AWST_ZONE_NAMES, .rules = AUSTRALIA_PERTH_RULES},
+        {.id = "Australia/Perth", .utcOffset = 28800, .names = AWST_ZONE_NAMES, .rules = AUSTRALIA_PERTH_RULES, .ruleCount = ZONE_RULE_COUNT(AUSTRALIA_PERTH_RULES)},
         {.id = "Australia/Queensland", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = NULL},
         {.id = "Australia/South", .utcOffset = 34200, .names = ACST_ZONE_NAMES, .rules = NULL},
-        {.id = "Australia/Sydney", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = AUSTRALIA_SYDNEY_RULES},
+        {.id = "Australia/Sydney", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = AUSTRALIA_SYDNEY_RULES, .ruleCount = ZONE_RULE_COUNT(AUSTRALIA_SYDNEY_RULES)},
         {.id = "Australia/Tasmania", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = NULL},
         {.id = "Australia/Victoria", .utcOffset = 36000, .names = AEST_ZONE_NAMES, .rules = NULL},
         {.id = "Australia/West", .utcOffset = 28800, .names = AWST_ZONE_NAMES, .rules = NULL},
@@ -418,83 +431,83 @@ static const TimeZone ZONE_LIST[] = {
         {.id = "EST5EDT", .utcOffset = -14400, .names = EST_ZONE_NAMES, .rules = NULL},
         {.id = "Egypt", .utcOffset = 7200, .names = EET_ZONE_NAMES, .rules = NULL},
         {.id = "Eire", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Europe/Amsterdam", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_AMSTERDAM_RULES},
-        {.id = "Europe/Andorra", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_ANDORRA_RULES},
-        {.id = "Europe/Astrakhan", .utcOffset = 14400, .names = GMT_04_00_ZONE_NAMES, .rules = EUROPE_ASTRAKHAN_RULES},
-        {.id = "Europe/Athens", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_ATHENS_RULES},
+        {.id = "Europe/Amsterdam", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_AMSTERDAM_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_AMSTERDAM_RULES)},
+        {.id = "Europe/Andorra", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_ANDORRA_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_ANDORRA_RULES)},
+        {.id = "Europe/Astrakhan", .utcOffset = 14400, .names = GMT_04_00_ZONE_NAMES, .rules = EUROPE_ASTRAKHAN_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_ASTRAKHAN_RULES)},
+        {.id = "Europe/Athens", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_ATHENS_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_ATHENS_RULES)},
         {.id = "Europe/Belfast", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = NULL},
-        {.id = "Europe/Belgrade", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_BELGRADE_RULES},
-        {.id = "Europe/Berlin", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_BERLIN_RULES},
-        {.id = "Europe/Bratislava", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_BRATISLAVA_RULES},
-        {.id = "Europe/Brussels", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_BRUSSELS_RULES},
-        {.id = "Europe/Bucharest", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_BUCHAREST_RULES},
-        {.id = "Europe/Budapest", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_BUDAPEST_RULES},
-        {.id = "Europe/Busingen", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_BUSINGEN_RULES},
-        {.id = "Europe/Chisinau", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_CHISINAU_RULES},
-        {.id = "Europe/Copenhagen", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_COPENHAGEN_RULES},
-        {.id = "Europe/Dublin", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = EUROPE_DUBLIN_RULES},
-        {.id = "Europe/Gibraltar", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_GIBRALTAR_RULES},
-        {.id = "Europe/Guernsey", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = EUROPE_GUERNSEY_RULES},
-        {.id = "Europe/Helsinki", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_HELSINKI_RULES},
-        {.id = "Europe/Isle_of_Man", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = EUROPE_ISLE_OF_MAN_RULES},
-        {.id = "Europe/Istanbul", .utcOffset = 10800, .names = TRT_ZONE_NAMES, .rules = EUROPE_ISTANBUL_RULES},
-        {.id = "Europe/Jersey", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = EUROPE_JERSEY_RULES},
-        {.id = "Europe/Kaliningrad", .utcOffset = 7200, .names = EET_ZONE_NAMES, .rules = EUROPE_KALININGRAD_RULES},
-        {.id = "Europe/Kiev", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_KIEV_RULES},
-        {.id = "Europe/Kirov", .utcOffset = 10800, .names = GMT_03_00_ZONE_NAMES, .rules = EUROPE_KIROV_RULES},
-        {.id = "Europe/Lisbon", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = EUROPE_LISBON_RULES},
-        {.id = "Europe/Ljubljana", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_LJUBLJANA_RULES},
-        {.id = "Europe/London", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = EUROPE_LONDON_RULES},
-        {.id = "Europe/Luxembourg", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_LUXEMBOURG_RULES},
-        {.id = "Europe/Madrid", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_MADRID_RULES},
-        {.id = "Europe/Malta", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_MALTA_RULES},
-        {.id = "Europe/Mariehamn", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_MARIEHAMN_RULES},
-        {.id = "Europe/Minsk", .utcOffset = 10800, .names = MSK_ZONE_NAMES, .rules = EUROPE_MINSK_RULES},
-        {.id = "Europe/Monaco", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_MONACO_RULES},
-        {.id = "Europe/Moscow", .utcOffset = 10800, .names = MSK_ZONE_NAMES, .rules = EUROPE_MOSCOW_RULES},
+        {.id = "Europe/Belgrade", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_BELGRADE_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_BELGRADE_RULES)},
+        {.id = "Europe/Berlin", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_BERLIN_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_BERLIN_RULES)},
+        {.id = "Europe/Bratislava", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_BRATISLAVA_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_BRATISLAVA_RULES)},
+        {.id = "Europe/Brussels", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_BRUSSELS_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_BRUSSELS_RULES)},
+        {.id = "Europe/Bucharest", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_BUCHAREST_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_BUCHAREST_RULES)},
+        {.id = "Europe/Budapest", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_BUDAPEST_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_BUDAPEST_RULES)},
+        {.id = "Europe/Busingen", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_BUSINGEN_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_BUSINGEN_RULES)},
+        {.id = "Europe/Chisinau", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_CHISINAU_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_CHISINAU_RULES)},
+        {.id = "Europe/Copenhagen", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_COPENHAGEN_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_COPENHAGEN_RULES)},
+        {.id = "Europe/Dublin", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = EUROPE_DUBLIN_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_DUBLIN_RULES)},
+        {.id = "Europe/Gibraltar", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_GIBRALTAR_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_GIBRALTAR_RULES)},
+        {.id = "Europe/Guernsey", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = EUROPE_GUERNSEY_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_GUERNSEY_RULES)},
+        {.id = "Europe/Helsinki", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_HELSINKI_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_HELSINKI_RULES)},
+        {.id = "Europe/Isle_of_Man", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = EUROPE_ISLE_OF_MAN_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_ISLE_OF_MAN_RULES)},
+        {.id = "Europe/Istanbul", .utcOffset = 10800, .names = TRT_ZONE_NAMES, .rules = EUROPE_ISTANBUL_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_ISTANBUL_RULES)},
+        {.id = "Europe/Jersey", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = EUROPE_JERSEY_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_JERSEY_RULES)},
+        {.id = "Europe/Kaliningrad", .utcOffset = 7200, .names = EET_ZONE_NAMES, .rules = EUROPE_KALININGRAD_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_KALININGRAD_RULES)},
+        {.id = "Europe/Kiev", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_KIEV_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_KIEV_RULES)},
+        {.id = "Europe/Kirov", .utcOffset = 10800, .names = GMT_03_00_ZONE_NAMES, .rules = EUROPE_KIROV_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_KIROV_RULES)},
+        {.id = "Europe/Lisbon", .utcOffset = 3600, .names = WET_ZONE_NAMES, .rules = EUROPE_LISBON_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_LISBON_RULES)},
+        {.id = "Europe/Ljubljana", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_LJUBLJANA_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_LJUBLJANA_RULES)},
+        {.id = "Europe/London", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = EUROPE_LONDON_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_LONDON_RULES)},
+        {.id = "Europe/Luxembourg", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_LUXEMBOURG_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_LUXEMBOURG_RULES)},
+        {.id = "Europe/Madrid", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_MADRID_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_MADRID_RULES)},
+        {.id = "Europe/Malta", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_MALTA_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_MALTA_RULES)},
+        {.id = "Europe/Mariehamn", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_MARIEHAMN_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_MARIEHAMN_RULES)},
+        {.id = "Europe/Minsk", .utcOffset = 10800, .names = MSK_ZONE_NAMES, .rules = EUROPE_MINSK_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_MINSK_RULES)},
+        {.id = "Europe/Monaco", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_MONACO_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_MONACO_RULES)},
+        {.id = "Europe/Moscow", .utcOffset = 10800, .names = MSK_ZONE_NAMES, .rules = EUROPE_MOSCOW_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_MOSCOW_RULES)},
         {.id = "Europe/Nicosia", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = NULL},
-        {.id = "Europe/Oslo", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_OSLO_RULES},
-        {.id = "Europe/Paris", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_PARIS_RULES},
-        {.id = "Europe/Podgorica", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_PODGORICA_RULES},
-        {.id = "Europe/Prague", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_PRAGUE_RULES},
-        {.id = "Europe/Riga", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_RIGA_RULES},
-        {.id = "Europe/Rome", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_ROME_RULES},
-        {.id = "Europe/Samara", .utcOffset = 14400, .names = SAMT_ZONE_NAMES, .rules = EUROPE_SAMARA_RULES},
-        {.id = "Europe/San_Marino", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_SAN_MARINO_RULES},
-        {.id = "Europe/Sarajevo", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_SARAJEVO_RULES},
-        {.id = "Europe/Saratov", .utcOffset = 14400, .names = GMT_04_00_ZONE_NAMES, .rules = EUROPE_SARATOV_RULES},
-        {.id = "Europe/Simferopol", .utcOffset = 10800, .names = MSK_ZONE_NAMES, .rules = EUROPE_SIMFEROPOL_RULES},
-        {.id = "Europe/Skopje", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_SKOPJE_RULES},
-        {.id = "Europe/Sofia", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_SOFIA_RULES},
-        {.id = "Europe/Stockholm", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_STOCKHOLM_RULES},
-        {.id = "Europe/Tallinn", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_TALLINN_RULES},
-        {.id = "Europe/Tirane", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_TIRANE_RULES},
+        {.id = "Europe/Oslo", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_OSLO_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_OSLO_RULES)},
+        {.id = "Europe/Paris", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_PARIS_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_PARIS_RULES)},
+        {.id = "Europe/Podgorica", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_PODGORICA_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_PODGORICA_RULES)},
+        {.id = "Europe/Prague", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_PRAGUE_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_PRAGUE_RULES)},
+        {.id = "Europe/Riga", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_RIGA_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_RIGA_RULES)},
+        {.id = "Europe/Rome", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_ROME_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_ROME_RULES)},
+        {.id = "Europe/Samara", .utcOffset = 14400, .names = SAMT_ZONE_NAMES, .rules = EUROPE_SAMARA_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_SAMARA_RULES)},
+        {.id = "Europe/San_Marino", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_SAN_MARINO_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_SAN_MARINO_RULES)},
+        {.id = "Europe/Sarajevo", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_SARAJEVO_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_SARAJEVO_RULES)},
+        {.id = "Europe/Saratov", .utcOffset = 14400, .names = GMT_04_00_ZONE_NAMES, .rules = EUROPE_SARATOV_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_SARATOV_RULES)},
+        {.id = "Europe/Simferopol", .utcOffset = 10800, .names = MSK_ZONE_NAMES, .rules = EUROPE_SIMFEROPOL_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_SIMFEROPOL_RULES)},
+        {.id = "Europe/Skopje", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_SKOPJE_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_SKOPJE_RULES)},
+        {.id = "Europe/Sofia", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_SOFIA_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_SOFIA_RULES)},
+        {.id = "Europe/Stockholm", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_STOCKHOLM_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_STOCKHOLM_RULES)},
+        {.id = "Europe/Tallinn", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_TALLINN_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_TALLINN_RULES)},
+        {.id = "Europe/Tirane", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_TIRANE_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_TIRANE_RULES)},
         {.id = "Europe/Tiraspol", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = NULL},
-        {.id = "Europe/Ulyanovsk", .utcOffset = 14400, .names = GMT_04_00_ZONE_NAMES, .rules = EUROPE_ULYANOVSK_RULES},
-        {.id = "Europe/Uzhgorod", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_UZHGOROD_RULES},
-        {.id = "Europe/Vaduz", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_VADUZ_RULES},
-        {.id = "Europe/Vatican", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_VATICAN_RULES},
-        {.id = "Europe/Vienna", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_VIENNA_RULES},
-        {.id = "Europe/Vilnius", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_VILNIUS_RULES},
-        {.id = "Europe/Volgograd", .utcOffset = 10800, .names = MSK_ZONE_NAMES, .rules = EUROPE_VOLGOGRAD_RULES},
-        {.id = "Europe/Warsaw", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_WARSAW_RULES},
-        {.id = "Europe/Zagreb", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_ZAGREB_RULES},
-        {.id = "Europe/Zaporozhye", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_ZAPOROZHYE_RULES},
-        {.id = "Europe/Zurich", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_ZURICH_RULES},
+        {.id = "Europe/Ulyanovsk", .utcOffset = 14400, .names = GMT_04_00_ZONE_NAMES, .rules = EUROPE_ULYANOVSK_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_ULYANOVSK_RULES)},
+        {.id = "Europe/Uzhgorod", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_UZHGOROD_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_UZHGOROD_RULES)},
+        {.id = "Europe/Vaduz", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_VADUZ_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_VADUZ_RULES)},
+        {.id = "Europe/Vatican", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_VATICAN_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_VATICAN_RULES)},
+        {.id = "Europe/Vienna", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_VIENNA_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_VIENNA_RULES)},
+        {.id = "Europe/Vilnius", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_VILNIUS_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_VILNIUS_RULES)},
+        {.id = "Europe/Volgograd", .utcOffset = 10800, .names = MSK_ZONE_NAMES, .rules = EUROPE_VOLGOGRAD_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_VOLGOGRAD_RULES)},
+        {.id = "Europe/Warsaw", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_WARSAW_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_WARSAW_RULES)},
+        {.id = "Europe/Zagreb", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_ZAGREB_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_ZAGREB_RULES)},
+        {.id = "Europe/Zaporozhye", .utcOffset = 10800, .names = EET_ZONE_NAMES, .rules = EUROPE_ZAPOROZHYE_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_ZAPOROZHYE_RULES)},
+        {.id = "Europe/Zurich", .utcOffset = 7200, .names = CET_ZONE_NAMES, .rules = EUROPE_ZURICH_RULES, .ruleCount = ZONE_RULE_COUNT(EUROPE_ZURICH_RULES)},
         {.id = "GB", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = NULL},
         {.id = "GB-Eire", .utcOffset = 3600, .names = GMT_ZONE_NAMES, .rules = NULL},
         {.id = "Greenwich", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
         {.id = "Hongkong", .utcOffset = 28800, .names = HKT_ZONE_NAMES, .rules = NULL},
         {.id = "Iceland", .utcOffset = 0, .names = GMT_ZONE_NAMES, .rules = NULL},
         {.id = "Indian/Antananarivo", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
-        {.id = "Indian/Chagos", .utcOffset = 21600, .names = IOT_ZONE_NAMES, .rules = INDIAN_CHAGOS_RULES},
+        {.id = "Indian/Chagos", .utcOffset = 21600, .names = IOT_ZONE_NAMES, .rules = INDIAN_CHAGOS_RULES, .ruleCount = ZONE_RULE_COUNT(INDIAN_CHAGOS_RULES)},
         {.id = "Indian/Christmas", .utcOffset = 25200, .names = CXT_ZONE_NAMES, .rules = NULL},
         {.id = "Indian/Cocos", .utcOffset = 23400, .names = CCT_ZONE_NAMES, .rules = NULL},
         {.id = "Indian/Comoro", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
         {.id = "Indian/Kerguelen", .utcOffset = 18000, .names = TFT_ZONE_NAMES, .rules = NULL},
         {.id = "Indian/Mahe", .utcOffset = 14400, .names = SCT_ZONE_NAMES, .rules = NULL},
         {.id = "Indian/Maldives", .utcOffset = 18000, .names = MVT_ZONE_NAMES, .rules = NULL},
-        {.id = "Indian/Mauritius", .utcOffset = 14400, .names = MUT_ZONE_NAMES, .rules = INDIAN_MAURITIUS_RULES},
+        {.id = "Indian/Mauritius", .utcOffset = 14400, .names = MUT_ZONE_NAMES, .rules = INDIAN_MAURITIUS_RULES, .ruleCount = ZONE_RULE_COUNT(INDIAN_MAURITIUS_RULES)},
         {.id = "Indian/Mayotte", .utcOffset = 10800, .names = EAT_ZONE_NAMES, .rules = NULL},
         {.id = "Indian/Reunion", .utcOffset = 14400, .names = RET_ZONE_NAMES, .rules = NULL},
         {.id = "Iran", .utcOffset = 16200, .names = IRST_ZONE_NAMES, .rules = NULL},
@@ -513,45 +526,45 @@ static const TimeZone ZONE_LIST[] = {
         {.id = "Navajo", .utcOffset = -21600, .names = MST_ZONE_NAMES, .rules = NULL},
         {.id = "PRC", .utcOffset = 28800, .names = CST_ZONE_NAMES, .rules = NULL},
         {.id = "PST8PDT", .utcOffset = -25200, .names = PST_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Apia", .utcOffset = 46800, .names = WSST_ZONE_NAMES, .rules = PACIFIC_APIA_RULES},
-        {.id = "Pacific/Auckland", .utcOffset = 43200, .names = NZST_ZONE_NAMES, .rules = PACIFIC_AUCKLAND_RULES},
-        {.id = "Pacific/Bougainville", .utcOffset = 39600, .names = BST_ZONE_NAMES, .rules = PACIFIC_BOUGAINVILLE_RULES},
-        {.id = "Pacific/Chatham", .utcOffset = 45900, .names = CHAST_ZONE_NAMES, .rules = PACIFIC_CHATHAM_RULES},
+        {.id = "Pacific/Apia", .utcOffset = 46800, .names = WSST_ZONE_NAMES, .rules = PACIFIC_APIA_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_APIA_RULES)},
+        {.id = "Pacific/Auckland", .utcOffset = 43200, .names = NZST_ZONE_NAMES, .rules = PACIFIC_AUCKLAND_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_AUCKLAND_RULES)},
+        {.id = "Pacific/Bougainville", .utcOffset = 39600, .names = BST_ZONE_NAMES, .rules = PACIFIC_BOUGAINVILLE_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_BOUGAINVILLE_RULES)},
+        {.id = "Pacific/Chatham", .utcOffset = 45900, .names = CHAST_ZONE_NAMES, .rules = PACIFIC_CHATHAM_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_CHATHAM_RULES)},
         {.id = "Pacific/Chuuk", .utcOffset = 36000, .names = CHUT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Easter", .utcOffset = -21600, .names = EAST_ZONE_NAMES, .rules = PACIFIC_EASTER_RULES},
-        {.id = "Pacific/Efate", .utcOffset = 39600, .names = VUT_ZONE_NAMES, .rules = PACIFIC_EFATE_RULES},
+        {.id = "Pacific/Easter", .utcOffset = -21600, .names = EAST_ZONE_NAMES, .rules = PACIFIC_EASTER_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_EASTER_RULES)},
+        {.id = "Pacific/Efate", .utcOffset = 39600, .names = VUT_ZONE_NAMES, .rules = PACIFIC_EFATE_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_EFATE_RULES)},
         {.id = "Pacific/Enderbury", .utcOffset = 46800, .names = PHOT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Fakaofo", .utcOffset = 46800, .names = TKT_ZONE_NAMES, .rules = PACIFIC_FAKAOFO_RULES},
-        {.id = "Pacific/Fiji", .utcOffset = 43200, .names = FJT_ZONE_NAMES, .rules = PACIFIC_FIJI_RULES},
+        {.id = "Pacific/Fakaofo", .utcOffset = 46800, .names = TKT_ZONE_NAMES, .rules = PACIFIC_FAKAOFO_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_FAKAOFO_RULES)},
+        {.id = "Pacific/Fiji", .utcOffset = 43200, .names = FJT_ZONE_NAMES, .rules = PACIFIC_FIJI_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_FIJI_RULES)},
         {.id = "Pacific/Funafuti", .utcOffset = 43200, .names = TVT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Galapagos", .utcOffset = -21600, .names = GALT_ZONE_NAMES, .rules = PACIFIC_GALAPAGOS_RULES},
+        {.id = "Pacific/Galapagos", .utcOffset = -21600, .names = GALT_ZONE_NAMES, .rules = PACIFIC_GALAPAGOS_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_GALAPAGOS_RULES)},
         {.id = "Pacific/Gambier", .utcOffset = -32400, .names = GAMT_ZONE_NAMES, .rules = NULL},
         {.id = "Pacific/Guadalcanal", .utcOffset = 39600, .names = SBT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Guam", .utcOffset = 36000, .names = ChST_ZONE_NAMES, .rules = PACIFIC_GUAM_RULES},
+        {.id = "Pacific/Guam", .utcOffset = 36000, .names = ChST_ZONE_NAMES, .rules = PACIFIC_GUAM_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_GUAM_RULES)},
         {.id = "Pacific/Honolulu", .utcOffset = -36000, .names = HST_ZONE_NAMES, .rules = NULL},
         {.id = "Pacific/Johnston", .utcOffset = -36000, .names = HST_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Kiritimati", .utcOffset = 50400, .names = LINT_ZONE_NAMES, .rules = PACIFIC_KIRITIMATI_RULES},
-        {.id = "Pacific/Kosrae", .utcOffset = 39600, .names = KOST_ZONE_NAMES, .rules = PACIFIC_KOSRAE_RULES},
-        {.id = "Pacific/Kwajalein", .utcOffset = 43200, .names = MHT_ZONE_NAMES, .rules = PACIFIC_KWAJALEIN_RULES},
+        {.id = "Pacific/Kiritimati", .utcOffset = 50400, .names = LINT_ZONE_NAMES, .rules = PACIFIC_KIRITIMATI_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_KIRITIMATI_RULES)},
+        {.id = "Pacific/Kosrae", .utcOffset = 39600, .names = KOST_ZONE_NAMES, .rules = PACIFIC_KOSRAE_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_KOSRAE_RULES)},
+        {.id = "Pacific/Kwajalein", .utcOffset = 43200, .names = MHT_ZONE_NAMES, .rules = PACIFIC_KWAJALEIN_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_KWAJALEIN_RULES)},
         {.id = "Pacific/Majuro", .utcOffset = 43200, .names = MHT_ZONE_NAMES, .rules = NULL},
         {.id = "Pacific/Marquesas", .utcOffset = -34200, .names = MART_ZONE_NAMES, .rules = NULL},
         {.id = "Pacific/Midway", .utcOffset = -39600, .names = SST_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Nauru", .utcOffset = 43200, .names = NRT_ZONE_NAMES, .rules = PACIFIC_NAURU_RULES},
+        {.id = "Pacific/Nauru", .utcOffset = 43200, .names = NRT_ZONE_NAMES, .rules = PACIFIC_NAURU_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_NAURU_RULES)},
         {.id = "Pacific/Niue", .utcOffset = -39600, .names = NUT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Norfolk", .utcOffset = 39600, .names = NFT_ZONE_NAMES, .rules = PACIFIC_NORFOLK_RULES},
-        {.id = "Pacific/Noumea", .utcOffset = 39600, .names = NCT_ZONE_NAMES, .rules = PACIFIC_NOUMEA_RULES},
+        {.id = "Pacific/Norfolk", .utcOffset = 39600, .names = NFT_ZONE_NAMES, .rules = PACIFIC_NORFOLK_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_NORFOLK_RULES)},
+        {.id = "Pacific/Noumea", .utcOffset = 39600, .names = NCT_ZONE_NAMES, .rules = PACIFIC_NOUMEA_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_NOUMEA_RULES)},
         {.id = "Pacific/Pago_Pago", .utcOffset = -39600, .names = SST_ZONE_NAMES, .rules = NULL},
         {.id = "Pacific/Palau", .utcOffset = 32400, .names = PWT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Pitcairn", .utcOffset = -28800, .names = PST_ZONE_NAMES, .rules = PACIFIC_PITCAIRN_RULES},
+        {.id = "Pacific/Pitcairn", .utcOffset = -28800, .names = PST_ZONE_NAMES, .rules = PACIFIC_PITCAIRN_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_PITCAIRN_RULES)},
         {.id = "Pacific/Pohnpei", .utcOffset = 39600, .names = PONT_ZONE_NAMES, .rules = NULL},
         {.id = "Pacific/Ponape", .utcOffset = 39600, .names = PONT_ZONE_NAMES, .rules = NULL},
         {.id = "Pacific/Port_Moresby", .utcOffset = 36000, .names = PGT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Rarotonga", .utcOffset = -36000, .names = CKT_ZONE_NAMES, .rules = PACIFIC_RAROTONGA_RULES},
-        {.id = "Pacific/Saipan", .utcOffset = 36000, .names = ChST_ZONE_NAMES, .rules = PACIFIC_SAIPAN_RULES},
+        {.id = "Pacific/Rarotonga", .utcOffset = -36000, .names = CKT_ZONE_NAMES, .rules = PACIFIC_RAROTONGA_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_RAROTONGA_RULES)},
+        {.id = "Pacific/Saipan", .utcOffset = 36000, .names = ChST_ZONE_NAMES, .rules = PACIFIC_SAIPAN_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_SAIPAN_RULES)},
         {.id = "Pacific/Samoa", .utcOffset = -39600, .names = SST_ZONE_NAMES, .rules = NULL},
         {.id = "Pacific/Tahiti", .utcOffset = -36000, .names = TAHT_ZONE_NAMES, .rules = NULL},
         {.id = "Pacific/Tarawa", .utcOffset = 43200, .names = GILT_ZONE_NAMES, .rules = NULL},
-        {.id = "Pacific/Tongatapu", .utcOffset = 46800, .names = TOT_ZONE_NAMES, .rules = PACIFIC_TONGATAPU_RULES},
+        {.id = "Pacific/Tongatapu", .utcOffset = 46800, .names = TOT_ZONE_NAMES, .rules = PACIFIC_TONGATAPU_RULES, .ruleCount = ZONE_RULE_COUNT(PACIFIC_TONGATAPU_RULES)},
         {.id = "Pacific/Truk", .utcOffset = 36000, .names = CHUT_ZONE_NAMES, .rules = NULL},
         {.id = "Pacific/Wake", .utcOffset = 43200, .names = WAKT_ZONE_NAMES, .rules = NULL},
         {.id = "Pacific/Wallis", .utcOffset = 43200, .names = WFT_ZONE_NAMES, .rules = NULL},
@@ -582,8 +595,16 @@ static const TimeZone ZONE_LIST[] = {
 };
 
 
+// Zone by id or alias ignoring case, like "europe/riga". Single hash probe, NULL when not found
 const TimeZone *findTimeZone(const char *zoneId);
+/* Zones with id starting with prefix ignoring case, in alphabetical order, for autocomplete.
+ * Up to capacity zones are stored to zones. Returns count of all matching zones, it can be more than capacity*/
+uint32_t findTimeZonesByPrefix(const char *prefix, const TimeZone **zones, uint32_t capacity);
 
+/* Offset, DST flag and names for an instant with single transition lookup.
+ * Last result is cached per task together with instant range it is valid for, so next lookups in the same zone until transition are range check only.
+ * Cache is keyed by zone rules pointer and count, call resetZoneOffsetCache() after rules were changed in place, it invalidates cache of all tasks.*/
+ZoneOffsetInfo resolveTimeZoneInfo(int64_t epochSeconds, const TimeZone *zone);
 int32_t resolveTimeZoneOffset(int64_t epochSeconds, const TimeZone *zone);
 const char *resolveTimeZoneName(int64_t epochSeconds, const TimeZone *zone, ZoneTextStyle textStyle);
 ZoneTransition findZoneRuleTransition(int64_t epochSeconds, const TimeZone *zone);
@@ -595,4 +616,14 @@ ZoneTransition findZoneRuleTransition(int64_t epochSeconds, const TimeZone *zone
  * true if transition is a gap for provided epoch seconds, false if it is an overlap*/
 bool isTransitionGap(ZoneTransition *transition, int64_t epochSeconds);
 
+/* Finds transition that makes local date-time ambiguous, without converting it to instant first.
+ * Params:
+ *  localEpochSeconds – local date-time as epoch seconds with zero offset
+ *  offset – set to valid offset for local date-time, for gap or overlap it is the earlier offset (before transition)
+ * Returns: transition when local date-time is in gap (after offset is bigger) or overlap (after offset is smaller), otherwise both rules are NULL*/
+ZoneTransition findLocalZoneTransition(int64_t localEpochSeconds, const TimeZone *zone, int32_t *offset);
+
 bool isTimeZoneEquals(const TimeZone *timeZone, const TimeZone *other);
+
+ZoneOffsetCacheStats getZoneOffsetCacheStats();  // for calling task
+void resetZoneOffsetCache();    // stats are reset for calling task only
@@ -0,0 +1,176 @@
+#include "TimeZoneDb.h"
+
+#define TZDB_MAGIC "TZDB"
+#define TZDB_MIN_VERSION 1
+#define TZDB_VERSION 2
+#define TZDB_HEADER_SIZE_V1 28
+#define TZDB_HEADER_SIZE 32
+#define TZDB_HASH_ENTRY_SIZE 4
+#define TZDB_INDEX_ENTRY_SIZE 16
+#define TZDB_NAME_SET_SIZE 16
+#define TZDB_ZONE_NAME_COUNT 4
+
+static bool readFileAt(FILE *file, uint32_t offset, uint8_t *buffer, uint32_t length);
+static bool readStringAt(TimeZoneDb *db, uint32_t offset, char *buffer, uint32_t bufferSize);
+static bool readIndexEntry(TimeZoneDb *db, uint32_t index, TimeZoneDbEntry *entry);
+static bool findHashedEntry(TimeZoneDb *db, const char *zoneId, TimeZoneDbEntry *entry);
+static bool findSortedEntry(TimeZoneDb *db, const char *zoneId, TimeZoneDbEntry *entry);
+static uint32_t hashZoneId(const char *zoneId, uint32_t length, uint32_t seed);
+static bool readZigZagVarInt(FILE *file, int64_t *value);
+static uint32_t readUInt32(const uint8_t *buffer);
+static uint16_t readUInt16(const uint8_t *buffer);
+
+
+bool openTimeZoneDb(TimeZoneDb *db, const char *path) {
+    if (db == NULL || path == NULL) return false;
+    memset(db, 0, sizeof(struct TimeZoneDb));
+    db->file = fopen(path, "rb");
+    if (db->file == NULL) return false;
+
+    uint8_t header[TZDB_HEADER_SIZE];
+    if (!readFileAt(db->file, 0, header, TZDB_HEADER_SIZE_V1) || memcmp(header, TZDB_MAGIC, 4) != 0 ||
+        header[4] < TZDB_MIN_VERSION || header[4] > TZDB_VERSION ||
+        (header[4] > TZDB_MIN_VERSION && !readFileAt(db->file, TZDB_HEADER_SIZE_V1, header + TZDB_HEADER_SIZE_V1, TZDB_HEADER_SIZE - TZDB_HEADER_SIZE_V1))) {
+        closeTimeZoneDb(db);
+        return false;
+    }
+    db->zoneCount = readUInt16(header + 6);
+    db->nameSetCount = readUInt16(header + 8);
+    db->stringTableOffset = readUInt32(header + 12);
+    db->nameSetOffset = readUInt32(header + 16);
+    db->indexOffset = readUInt32(header + 20);
+    db->ruleDataOffset = readUInt32(header + 24);
+    db->hashTableOffset = header[4] > TZDB_MIN_VERSION ? readUInt32(header + 28) : 0;
+    return true;
+}
+
+bool findTimeZoneDbEntry(TimeZoneDb *db, const char *zoneId, TimeZoneDbEntry *entry) {
+    if (db == NULL || db->file == NULL || zoneId == NULL || entry == NULL || db->zoneCount == 0) return false;
+    return db->hashTableOffset != 0 ? findHashedEntry(db, zoneId, entry) : findSortedEntry(db, zoneId, entry);
+}
+
+uint32_t readTimeZoneDbRules(TimeZoneDb *db, TimeZoneDbEntry *entry, int64_t fromEpochSeconds, TimeZoneRule *rules, uint32_t capacity) {
+    if (db == NULL || db->file == NULL || entry == NULL || rules == NULL || capacity == 0) return 0;
+    uint32_t count = 0;
+    if (fseek(db->file, (long) (db->ruleDataOffset + entry->ruleDataOffset), SEEK_SET) == 0) {
+        int64_t transition = 0;
+        for (uint32_t i = 0; i < entry->ruleCount && count < capacity - 1; i++) {
+            int64_t transitionDelta;
+            int64_t offsetAndFlag;
+            if (!readZigZagVarInt(db->file, &transitionDelta) || !readZigZagVarInt(db->file, &offsetAndFlag)) break;
+            transition += transitionDelta;
+            if (transition <= fromEpochSeconds) continue;
+
+            rules[count].transition = transition;
+            rules[count].gmtOffset = (int32_t) (offsetAndFlag >> 1);
+            rules[count].isDaylightTime = (offsetAndFlag & 1) != 0;
+            count++;
+        }
+    }
+    rules[count] = (TimeZoneRule) {.transition = 0};
+    return count;
+}
+
+bool readTimeZoneDbName(TimeZoneDb *db, TimeZoneDbEntry *entry, uint8_t nameIndex, char *buffer, uint32_t bufferSize) {
+    if (db == NULL || db->file == NULL || entry == NULL || nameIndex >= TZDB_ZONE_NAME_COUNT || entry->nameSetIndex >= db->nameSetCount) return false;
+    uint8_t nameOffset[4];
+    if (!readFileAt(db->file, db->nameSetOffset + entry->nameSetIndex * TZDB_NAME_SET_SIZE + nameIndex * 4, nameOffset, sizeof(nameOffset))) return false;
+    return readStringAt(db, readUInt32(nameOffset), buffer, bufferSize);
+}
+
+void closeTimeZoneDb(TimeZoneDb *db) {
+    if (db != NULL && db->file != NULL) {
+        fclose(db->file);
+        db->file = NULL;
+    }
+}
+
+static bool readFileAt(FILE *file, uint32_t offset, uint8_t *buffer, uint32_t length) {
+    return fseek(file, (long) offset, SEEK_SET) == 0 && fread(buffer, 1, length, file) == length;
+}
+
+static bool readStringAt(TimeZoneDb *db, uint32_t offset, char *buffer, uint32_t bufferSize) {
+    if (buffer == NULL || bufferSize == 0 || fseek(db->file, (long) (db->stringTableOffset + offset), SEEK_SET) != 0) return false;
+    for (uint32_t i = 0; i < bufferSize; i++) {
+        int value = fgetc(db->file);
+        if (value == EOF) return false;
+        buffer[i] = (char) value;
+        if (value == '\0') return true;
+    }
+    buffer[bufferSize - 1] = '\0';  // truncated
+    return false;
+}
+
+static bool readIndexEntry(TimeZoneDb *db, uint32_t index, TimeZoneDbEntry *entry) {
+    uint8_t buffer[TZDB_INDEX_ENTRY_SIZE];
+    if (!readFileAt(db->file, db->indexOffset + index * TZDB_INDEX_ENTRY_SIZE, buffer, sizeof(buffer))) return false;
+    entry->utcOffset = (int32_t) readUInt32(buffer + 4);
+    entry->ruleDataOffset = readUInt32(buffer + 8);
+    entry->ruleCount = readUInt16(buffer + 12);
+    entry->nameSetIndex = readUInt16(buffer + 14);
+    return readStringAt(db, readUInt32(buffer), entry->id, sizeof(entry->id));
+}
+
+static bool findHashedEntry(TimeZoneDb *db, const char *zoneId, TimeZoneDbEntry *entry) {
+    uint32_t length = strnlen(zoneId, TZDB_ZONE_ID_MAX_LENGTH);
+    if (length == 0 || length >= TZDB_ZONE_ID_MAX_LENGTH) return false;
+    uint8_t hashEntry[TZDB_HASH_ENTRY_SIZE];    // [displacement i16][index position u16]
+    uint32_t bucket = hashZoneId(zoneId, length, 0) % db->zoneCount;
+    if (!readFileAt(db->file, db->hashTableOffset + bucket * TZDB_HASH_ENTRY_SIZE, hashEntry, sizeof(hashEntry))) return false;
+
+    int16_t displacement = (int16_t) readUInt16(hashEntry);
+    uint32_t slot = displacement < 0 ? (uint32_t) (-displacement - 1) : hashZoneId(zoneId, length, displacement) % db->zoneCount;
+    if (slot != bucket && !readFileAt(db->file, db->hashTableOffset + slot * TZDB_HASH_ENTRY_SIZE, hashEntry, sizeof(hashEntry))) return false;
+
+    uint16_t position = readUInt16(hashEntry + 2);
+    return position < db->zoneCount && readIndexEntry(db, position, entry) && strcasecmp(zoneId, entry->id) == 0;
+}
+
+static bool findSortedEntry(TimeZoneDb *db, const char *zoneId, TimeZoneDbEntry *entry) {
+    int32_t leftIndex = 0;
+    int32_t rightIndex = db->zoneCount - 1;
+    while (leftIndex <= rightIndex) {
+        int32_t middleIndex = leftIndex + (rightIndex - leftIndex) / 2;
+        if (!readIndexEntry(db, middleIndex, entry)) return false;
+
+        int32_t result = strcasecmp(zoneId, entry->id);
+        if (result == 0) return true;
+        if (result > 0) {
+            leftIndex = middleIndex + 1;
+        } else {
+            rightIndex = middleIndex - 1;
+        }
+    }
+    return false;
+}
+
+static uint32_t hashZoneId(const char *zoneId, uint32_t length, uint32_t seed) {   // FNV-1a over lower case chars, same as scripts/perfect_hash.py
+    uint32_t hash = (2166136261UL ^ seed) * 16777619UL;
+    for (uint32_t i = 0; i < length; i++) {
+        hash ^= ((uint8_t) zoneId[i]) | 0x20;
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+static bool readZigZagVarInt(FILE *file, int64_t *value) {
+    uint64_t result = 0;
+    for (uint8_t shift = 0; shift < 64; shift += 7) {
+        int byte = fgetc(file);
+        if (byte == EOF) return false;
+        result |= ((uint64_t) (byte & 0x7F)) << shift;
+        if ((byte & 0x80) == 0) {
+            *value = (int64_t) (result >> 1) ^ -((int64_t) (result & 1));
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint32_t readUInt32(const uint8_t *buffer) {
+    return (uint32_t) buffer[0] | ((uint32_t) buffer[1] << 8) | ((uint32_t) buffer[2] << 16) | ((uint32_t) buffer[3] << 24);
+}
+
+static uint16_t readUInt16(const uint8_t *buffer) {
+    return (uint16_t) (buffer[0] | (buffer[1] << 8));
+}
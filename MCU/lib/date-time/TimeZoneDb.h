@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdio.h>
+#include <strings.h>
+
+#include "TimeZone.h"
+
+// Reader for compact binary timezone database generated by scripts/tzdb_generator.py.
+// Only header is kept in memory, zone index and rules are read from file on demand, so it works from SD card without loading whole file.
+
+#define TZDB_ZONE_ID_MAX_LENGTH 64
+#define TZDB_ZONE_NAME_MAX_LENGTH 64
+
+typedef struct TimeZoneDb {
+    FILE *file;
+    uint16_t zoneCount;
+    uint16_t nameSetCount;
+    uint32_t stringTableOffset;
+    uint32_t nameSetOffset;
+    uint32_t indexOffset;
+    uint32_t ruleDataOffset;
+    uint32_t hashTableOffset;   // 0 for version 1 files without hash table
+} TimeZoneDb;
+
+typedef struct TimeZoneDbEntry {
+    char id[TZDB_ZONE_ID_MAX_LENGTH];
+    int32_t utcOffset;
+    uint32_t ruleDataOffset;
+    uint16_t ruleCount;
+    uint16_t nameSetIndex;
+} TimeZoneDbEntry;
+
+bool openTimeZoneDb(TimeZoneDb *db, const char *path);
+// Case-insensitive perfect hash lookup: two 4 byte reads and one index entry to confirm id. Binary search over index for version 1 files
+bool findTimeZoneDbEntry(TimeZoneDb *db, const char *zoneId, TimeZoneDbEntry *entry);
+/*
+ * Decode zone rules with transition after fromEpochSeconds, up to (capacity - 1), last one is terminating rule {.transition = 0}.
+ * Returns number of stored rules without terminating one.
+ */
+uint32_t readTimeZoneDbRules(TimeZoneDb *db, TimeZoneDbEntry *entry, int64_t fromEpochSeconds, TimeZoneRule *rules, uint32_t capacity);
+// Name index is one of ZONE_*_NAME_*_INDEX. Returns false when name can't be read
+bool readTimeZoneDbName(TimeZoneDb *db, TimeZoneDbEntry *entry, uint8_t nameIndex, char *buffer, uint32_t bufferSize);
+void closeTimeZoneDb(TimeZoneDb *db);
@@ -0,0 +1,720 @@
+#pragma once
+
+// Generated by scripts/perfect_hash.py from TimeZoneIds.phf, do not edit manually
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <strings.h>
+
+#ifndef PERFECT_HASH_OF_DEFINED
+#define PERFECT_HASH_OF_DEFINED
+static inline uint32_t perfectHashOf(const char *key, uint32_t length, uint32_t seed, bool isIgnoreCase) {
+    uint32_t hash = (2166136261UL ^ seed) * 16777619UL;
+    for (uint32_t i = 0; i < length; i++) {
+        uint8_t byte = (uint8_t) key[i];
+        hash ^= isIgnoreCase ? (byte | 0x20) : byte;
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+#endif
+
+#define TIME_ZONE_ID_KEYWORD_COUNT 549
+#define TIME_ZONE_ID_MIN_LENGTH 2
+#define TIME_ZONE_ID_MAX_LENGTH 32
+
+typedef struct TimeZoneIdKeyword {
+    const char *name;
+    uint8_t length;
+    uint16_t value;
+} TimeZoneIdKeyword;
+
+static const int16_t TIME_ZONE_ID_DISPLACEMENTS[TIME_ZONE_ID_KEYWORD_COUNT] = {
+        -548, 0, 1, -547, 1, 1, 2, 0, -545, -541, -540, -539,
+        -538, 1, -533, -532, 1, 0, -530, -529, 0, -527, -526, 0,
+        -525, 1, 0, 0, 1, -522, 0, 2, -521, 0, 0, -520,
+        0, -516, 2, -512, -505, -500, 3, 0, 0, 0, 9, 0,
+        0, 0, -498, 0, -496, 0, 1, -495, 1, -492, -488, 0,
+        1, 1, -483, 1, 0, -481, -480, 0, 1, 0, -479, -476,
+        1, -471, 0, -464, -463, -456, -452, -451, -450, 0, 0, 0,
+        0, 0, -448, 1, -447, -442, 0, 0, -440, 2, 4, -437,
+        0, 5, -434, -431, -425, -424, 1, -423, 2, 0, -422, -420,
+        1, 1, 0, 0, 1, -419, 1, 0, 3, 3, -418, 4,
+        -416, -414, 0, 2, 0, 1, 0, 0, 1, 1, 0, 1,
+        2, 0, 0, 0, 2, -410, -408, -407, -399, 0, 0, 0,
+        4, -398, -397, 0, -392, 4, -391, -390, -389, 0, -384, 1,
+        -381, 0, 1, 1, 0, 1, 4, -375, 0, -374, -373, 7,
+        -369, 3, 1, -368, 0, 0, 4, -364, -363, -358, 0, 2,
+        0, 1, 0, 5, 0, 6, -357, 1, 0, 0, 2, 0,
+        4, -352, 0, 0, -350, 0, -349, 0, -343, 0, 0, -341,
+        0, 4, -339, 0, -334, 0, 0, -330, 1, -325, -321, -320,
+        -318, -317, 0, 0, 0, 0, 0, 1, -315, 2, 6, 5,
+        0, 1, 3, 0, -314, -313, -309, -308, 0, 0, -307, 0,
+        0, -306, 0, -305, 2, 1, -302, -299, -295, -293, 1, 0,
+        4, 0, -289, 0, -283, 1, -281, -280, 1, 0, -274, 0,
+        0, -272, -271, 1, -268, -266, -263, 1, -261, -258, -255, -254,
+        0, -253, 8, 1, 1, -251, 0, -250, 12, -249, -248, -245,
+        -244, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 1,
+        0, -241, -239, -238, -236, 2, -235, -233, -232, 0, -221, -220,
+        0, -219, 1, -218, 0, -216, 2, -213, 2, 0, 1, 2,
+        -210, 0, 0, -209, 0, 0, -206, 0, -203, 0, -200, 11,
+        2, 5, -197, -194, -193, 0, 4, -188, 2, 2, -186, 1,
+        0, -177, 1, -176, 0, 3, 0, 0, -175, -174, -173, -172,
+        -168, 0, 2, 0, 0, 5, 0, -163, 0, 1, 0, -162,
+        0, -161, -159, -155, 1, -154, -152, -149, 3, -148, -147, 0,
+        -144, 0, -143, 0, -140, 7, 5, -127, 7, -126, -123, 0,
+        0, 2, -118, -116, -115, 0, 1, 0, 2, -114, 0, -113,
+        -111, 0, 0, -110, 6, -109, 1, -108, 0, -106, -105, 0,
+        3, 1, -97, 0, 8, 0, 0, -95, 0, 2, 14, -91,
+        0, 2, 0, 1, 3, -90, 3, 0, 0, 1, -89, 2,
+        -87, -86, 0, -85, 1, 0, 1, -83, 0, -82, -80, -79,
+        -78, 1, 0, 0, 18, -74, 0, -69, 0, 3, 0, -68,
+        0, 0, -65, 0, 2, 0, 0, 0, -62, 0, -61, -57,
+        0, 1, 0, 0, -54, -52, -51, 0, 0, 0, 0, -50,
+        -49, 0, 0, -47, 0, 3, 0, -45, -44, -42, 0, 0,
+        0, 1, 0, 0, 19, 6, 3, 0, 0, -40, -35, 0,
+        0, 0, -34, 2, 0, 0, -30, -29, -25, 0, -24, 7,
+        -23, 7, -22, -20, 0, -18, 0, 0, 2, 1, 3, 0,
+        -12, -11, -8, -6, 0, 0, -5, 10, -4,
+};
+
+static const TimeZoneIdKeyword TIME_ZONE_ID_KEYWORDS[TIME_ZONE_ID_KEYWORD_COUNT] = {
+        {"America/Nome", 12, 170},
+        {"America/Metlakatla", 18, 159},
+        {"Europe/Mariehamn", 16, 419},
+        {"US/East-Indiana", 15, 537},
+        {"Europe/Tiraspol", 15, 440},
+        {"America/Indiana/Tell_City", 25, 130},
+        {"W-SU", 4, 546},
+        {"Asia/Tbilisi", 12, 315},
+        {"Australia/Darwin", 16, 351},
+        {"Africa/Nouakchott", 17, 46},
+        {"America/New_York", 16, 168},
+        {"Europe/Amsterdam", 16, 389},
+        {"America/Grenada", 15, 118},
+        {"Africa/Abidjan", 14, 0},
+        {"US/Eastern", 10, 538},
+        {"America/Argentina/Cordoba", 25, 62},
+        {"Europe/Vatican", 14, 444},
+        {"Asia/Saigon", 11, 306},
+        {"Europe/Tirane", 13, 439},
+        {"Indian/Reunion", 14, 467},
+        {"Australia/Perth", 15, 360},
+        {"Asia/Hovd", 9, 269},
+        {"Hongkong", 8, 455},
+        {"America/Guadeloupe", 18, 119},
+        {"GB", 2, 452},
+        {"Canada/Saskatchewan", 19, 380},
+        {"ROK", 3, 529},
+        {"Singapore", 9, 530},
+        {"America/Belize", 14, 80},
+        {"Africa/Windhoek", 15, 53},
+        {"America/Anguilla", 16, 56},
+        {"America/Recife", 14, 189},
+        {"Brazil/Acre", 11, 368},
+        {"Egypt", 5, 387},
+        {"America/Thunder_Bay", 19, 211},
+        {"America/Indiana/Winamac", 23, 133},
+        {"Japan", 5, 471},
+        {"Asia/Bangkok", 12, 246},
+        {"Pacific/Noumea", 14, 510},
+        {"Antarctica/Macquarie", 20, 224},
+        {"Pacific/Midway", 14, 506},
+        {"America/Grand_Turk", 18, 117},
+        {"Asia/Qostanay", 13, 302},
+        {"America/Boise", 13, 84},
+        {"America/Port_of_Spain", 21, 182},
+        {"America/Cordoba", 15, 96},
+        {"Pacific/Pitcairn", 16, 513},
+        {"Africa/Banjul", 13, 8},
+        {"Asia/Singapore", 14, 311},
+        {"Asia/Calcutta", 13, 251},
+        {"Asia/Famagusta", 14, 263},
+        {"America/Vancouver", 17, 215},
+        {"CST6CDT", 7, 373},
+        {"America/Santo_Domingo", 21, 197},
+        {"Australia/Lindeman", 18, 355},
+        {"Canada/Yukon", 12, 381},
+        {"Israel", 6, 469},
+        {"Africa/Ceuta", 12, 15},
+        {"Jamaica", 7, 470},
+        {"America/Jujuy", 13, 138},
+        {"America/Rainy_River", 19, 187},
+        {"Europe/Moscow", 13, 422},
+        {"Australia/Melbourne", 19, 357},
+        {"Asia/Rangoon", 12, 304},
+        {"Portugal", 8, 528},
+        {"Pacific/Norfolk", 15, 509},
+        {"Asia/Dhaka", 10, 259},
+        {"US/Michigan", 11, 541},
+        {"Europe/Madrid", 13, 417},
+        {"Europe/Vilnius", 14, 446},
+        {"America/Noronha", 15, 171},
+        {"Turkey", 6, 531},
+        {"Australia/Victoria", 18, 365},
+        {"Asia/Jakarta", 12, 272},
+        {"Pacific/Gambier", 15, 496},
+        {"Asia/Tokyo", 10, 320},
+        {"Asia/Ashkhabad", 14, 241},
+        {"Antarctica/Vostok", 17, 232},
+        {"America/Guatemala", 17, 120},
+        {"Asia/Choibalsan", 15, 253},
+        {"Asia/Dubai", 10, 261},
+        {"Asia/Aqtobe", 11, 239},
+        {"Antarctica/DumontDUrville", 25, 223},
+        {"Asia/Ujung_Pandang", 18, 322},
+        {"Africa/Lome", 11, 33},
+        {"America/Araguaina", 17, 58},
+        {"Pacific/Funafuti", 16, 494},
+        {"Europe/Jersey", 13, 409},
+        {"America/Detroit", 15, 105},
+        {"Asia/Colombo", 12, 256},
+        {"America/Chicago", 15, 93},
+        {"Asia/Anadyr", 11, 237},
+        {"Brazil/West", 11, 371},
+        {"Pacific/Tahiti", 14, 520},
+        {"America/Argentina/Rio_Gallegos", 30, 66},
+        {"America/Aruba", 13, 72},
+        {"Australia/Brisbane", 18, 347},
+        {"MET", 3, 474},
+        {"EST5EDT", 7, 386},
+        {"America/Jamaica", 15, 137},
+        {"America/Anchorage", 17, 55},
+        {"America/Resolute", 16, 191},
+        {"Europe/Samara", 13, 430},
+        {"Asia/Irkutsk", 12, 270},
+        {"Africa/Libreville", 17, 32},
+        {"Asia/Kamchatka", 14, 276},
+        {"America/Merida", 14, 158},
+        {"EET", 3, 385},
+        {"Europe/Volgograd", 16, 447},
+        {"Antarctica/Davis", 16, 222},
+        {"America/Argentina/Ushuaia", 25, 71},
+        {"Pacific/Tongatapu", 17, 522},
+        {"Africa/Douala", 13, 20},
+        {"America/St_Lucia", 16, 205},
+        {"Europe/Skopje", 13, 435},
+        {"Asia/Thimphu", 12, 319},
+        {"Africa/Asmara", 13, 4},
+        {"Pacific/Auckland", 16, 485},
+        {"Asia/Yerevan", 12, 332},
+        {"US/Hawaii", 9, 539},
+        {"America/Sao_Paulo", 17, 198},
+        {"Australia/Hobart", 16, 353},
+        {"Europe/Brussels", 15, 397},
+        {"America/Indianapolis", 20, 134},
+        {"Asia/Yakutsk", 12, 329},
+        {"Asia/Sakhalin", 13, 307},
+        {"America/La_Paz", 14, 144},
+        {"CET", 3, 372},
+        {"Asia/Manila", 11, 291},
+        {"America/Nuuk", 12, 175},
+        {"America/Mexico_City", 19, 160},
+        {"Asia/Chita", 10, 252},
+        {"Asia/Baku", 9, 245},
+        {"Pacific/Pago_Pago", 17, 511},
+        {"Asia/Omsk", 9, 296},
+        {"Atlantic/Faroe", 14, 338},
+        {"Pacific/Kosrae", 14, 502},
+        {"Europe/Busingen", 15, 400},
+        {"Indian/Chagos", 13, 458},
+        {"Africa/Kampala", 14, 27},
+        {"Africa/Asmera", 13, 5},
+        {"US/Arizona", 10, 535},
+        {"Antarctica/South_Pole", 21, 229},
+        {"America/Thule", 13, 210},
+        {"America/Tegucigalpa", 19, 209},
+        {"Australia/South", 15, 362},
+        {"Asia/Qatar", 10, 301},
+        {"America/Menominee", 17, 157},
+        {"Europe/Warsaw", 13, 448},
+        {"Asia/Urumqi", 11, 325},
+        {"Pacific/Guadalcanal", 19, 497},
+        {"Australia/LHI", 13, 354},
+        {"US/Samoa", 8, 544},
+        {"Asia/Bishkek", 12, 249},
+        {"America/Argentina/Tucuman", 25, 70},
+        {"America/Dawson", 14, 102},
+        {"WET", 3, 547},
+        {"Antarctica/Rothera", 18, 228},
+        {"America/Cayenne", 15, 91},
+        {"America/Danmarkshavn", 20, 101},
+        {"Europe/Prague", 13, 427},
+        {"Africa/Brazzaville", 18, 11},
+        {"Greenwich", 9, 454},
+        {"Antarctica/Troll", 16, 231},
+        {"America/Nassau", 14, 167},
+        {"Asia/Chongqing", 14, 254},
+        {"Indian/Antananarivo", 19, 457},
+        {"Europe/Simferopol", 17, 434},
+        {"Australia/Sydney", 16, 363},
+        {"Asia/Barnaul", 12, 247},
+        {"Europe/Paris", 12, 425},
+        {"Navajo", 6, 481},
+        {"Asia/Kashgar", 12, 278},
+        {"Australia/Adelaide", 18, 346},
+        {"Africa/Khartoum", 15, 28},
+        {"Africa/Maseru", 13, 39},
+        {"Africa/Maputo", 13, 38},
+        {"Europe/Minsk", 12, 420},
+        {"Africa/Cairo", 12, 13},
+        {"America/Argentina/Mendoza", 25, 65},
+        {"US/Indiana-Starke", 17, 540},
+        {"Asia/Amman", 10, 236},
+        {"America/Argentina/Catamarca", 27, 60},
+        {"America/Argentina/Jujuy", 23, 63},
+        {"America/Managua", 15, 150},
+        {"America/Kentucky/Louisville", 27, 140},
+        {"Asia/Muscat", 11, 292},
+        {"America/St_Barthelemy", 21, 202},
+        {"America/Argentina/Salta", 23, 67},
+        {"Pacific/Marquesas", 17, 505},
+        {"America/Argentina/San_Luis", 26, 69},
+        {"Indian/Maldives", 15, 464},
+        {"America/Asuncion", 16, 73},
+        {"US/Pacific", 10, 543},
+        {"America/St_Kitts", 16, 204},
+        {"America/Denver", 14, 104},
+        {"America/Sitka", 13, 201},
+        {"Africa/Nairobi", 14, 43},
+        {"America/Miquelon", 16, 161},
+        {"America/Maceio", 14, 149},
+        {"Africa/Porto-Novo", 17, 48},
+        {"Pacific/Fakaofo", 15, 492},
+        {"Asia/Tashkent", 13, 314},
+        {"Africa/Algiers", 14, 3},
+        {"Asia/Kuching", 12, 285},
+        {"America/Los_Angeles", 19, 146},
+        {"America/Santa_Isabel", 20, 194},
+        {"America/Knox_IN", 15, 142},
+        {"Asia/Kolkata", 12, 282},
+        {"US/Central", 10, 536},
+        {"America/Marigot", 15, 152},
+        {"America/Toronto", 15, 213},
+        {"Pacific/Apia", 12, 484},
+        {"Europe/Ljubljana", 16, 414},
+        {"America/Indiana/Indianapolis", 28, 126},
+        {"Africa/Bujumbura", 16, 12},
+        {"Asia/Yangon", 11, 330},
+        {"Asia/Macao", 10, 287},
+        {"Africa/Luanda", 13, 34},
+        {"Africa/Accra", 12, 1},
+        {"NZ-CHAT", 7, 480},
+        {"America/Puerto_Rico", 19, 185},
+        {"Europe/Copenhagen", 17, 402},
+        {"Asia/Aqtau", 10, 238},
+        {"Europe/Podgorica", 16, 426},
+        {"Asia/Nicosia", 12, 293},
+        {"Europe/Nicosia", 14, 423},
+        {"Asia/Magadan", 12, 289},
+        {"America/Lima", 12, 145},
+        {"MST7MDT", 7, 475},
+        {"Asia/Jayapura", 13, 273},
+        {"UCT", 3, 532},
+        {"America/Antigua", 15, 57},
+        {"Asia/Chungking", 14, 255},
+        {"Atlantic/Jan_Mayen", 18, 339},
+        {"Canada/Central", 14, 375},
+        {"Pacific/Galapagos", 17, 495},
+        {"Asia/Hebron", 11, 266},
+        {"Africa/Dar_es_Salaam", 20, 18},
+        {"Cuba", 4, 384},
+        {"America/Fortaleza", 17, 113},
+        {"Eire", 4, 388},
+        {"America/El_Salvador", 19, 109},
+        {"Africa/El_Aaiun", 15, 21},
+        {"America/St_Vincent", 18, 207},
+        {"Pacific/Rarotonga", 17, 517},
+        {"Europe/Kirov", 12, 412},
+        {"Asia/Krasnoyarsk", 16, 283},
+        {"America/Argentina/San_Juan", 26, 68},
+        {"Africa/Casablanca", 17, 14},
+        {"America/Manaus", 14, 151},
+        {"Pacific/Easter", 14, 489},
+        {"Europe/Zaporozhye", 17, 450},
+        {"America/Cancun", 14, 88},
+        {"America/Santiago", 16, 196},
+        {"Africa/Monrovia", 15, 42},
+        {"America/Indiana/Vincennes", 25, 132},
+        {"Indian/Cocos", 12, 460},
+        {"Australia/Lord_Howe", 19, 356},
+        {"Asia/Katmandu", 13, 280},
+        {"Australia/North", 15, 359},
+        {"Asia/Kathmandu", 14, 279},
+        {"America/Moncton", 15, 162},
+        {"Pacific/Chuuk", 13, 488},
+        {"Asia/Hong_Kong", 14, 268},
+        {"America/Rio_Branco", 18, 192},
+        {"Africa/Sao_Tome", 15, 49},
+        {"Africa/Harare", 13, 24},
+        {"America/Atikokan", 16, 74},
+        {"Asia/Ulaanbaatar", 16, 323},
+        {"Pacific/Chatham", 15, 487},
+        {"Universal", 9, 545},
+        {"Africa/Lubumbashi", 17, 35},
+        {"Europe/Vienna", 13, 445},
+        {"Asia/Baghdad", 12, 243},
+        {"Europe/Kiev", 11, 411},
+        {"PST8PDT", 7, 483},
+        {"America/Chihuahua", 17, 94},
+        {"Asia/Taipei", 11, 313},
+        {"Europe/Astrakhan", 16, 391},
+        {"Antarctica/Casey", 16, 221},
+        {"Asia/Istanbul", 13, 271},
+        {"America/Atka", 12, 75},
+        {"Pacific/Yap", 11, 526},
+        {"Asia/Vladivostok", 16, 328},
+        {"Australia/West", 14, 366},
+        {"Pacific/Majuro", 14, 504},
+        {"Africa/Kinshasa", 15, 30},
+        {"Africa/Kigali", 13, 29},
+        {"America/Porto_Velho", 19, 184},
+        {"America/Punta_Arenas", 20, 186},
+        {"America/Rankin_Inlet", 20, 188},
+        {"Europe/Athens", 13, 392},
+        {"America/North_Dakota/New_Salem", 30, 174},
+        {"Africa/Lusaka", 13, 36},
+        {"Europe/Malta", 12, 418},
+        {"Europe/Oslo", 11, 424},
+        {"Pacific/Kiritimati", 18, 501},
+        {"America/Indiana/Knox", 20, 127},
+        {"Atlantic/Stanley", 16, 344},
+        {"Asia/Yekaterinburg", 18, 331},
+        {"Atlantic/Reykjavik", 18, 341},
+        {"Pacific/Wallis", 14, 525},
+        {"Europe/Monaco", 13, 421},
+        {"Asia/Dushanbe", 13, 262},
+        {"Canada/Pacific", 14, 379},
+        {"America/Fort_Nelson", 19, 111},
+        {"America/Godthab", 15, 115},
+        {"Africa/Freetown", 15, 22},
+        {"America/Caracas", 15, 89},
+        {"Asia/Aden", 9, 234},
+        {"America/Blanc-Sablon", 20, 81},
+        {"Europe/Belfast", 14, 393},
+        {"America/Catamarca", 17, 90},
+        {"America/Santarem", 16, 195},
+        {"Africa/Malabo", 13, 37},
+        {"Africa/Conakry", 14, 16},
+        {"Pacific/Niue", 12, 508},
+        {"America/Scoresbysund", 20, 199},
+        {"Asia/Tehran", 11, 316},
+        {"America/St_Johns", 16, 203},
+        {"Pacific/Samoa", 13, 519},
+        {"Europe/Belgrade", 15, 394},
+        {"Africa/Niamey", 13, 45},
+        {"America/Montreal", 16, 165},
+        {"Asia/Karachi", 12, 277},
+        {"Asia/Bahrain", 12, 244},
+        {"Indian/Mayotte", 14, 466},
+        {"Brazil/DeNoronha", 16, 369},
+        {"Libya", 5, 473},
+        {"America/Ojinaga", 15, 176},
+        {"Europe/Chisinau", 15, 401},
+        {"Indian/Kerguelen", 16, 462},
+        {"Pacific/Nauru", 13, 507},
+        {"Africa/Bamako", 13, 6},
+        {"Africa/Johannesburg", 19, 25},
+        {"Asia/Oral", 9, 297},
+        {"Indian/Christmas", 16, 459},
+        {"Europe/Helsinki", 15, 406},
+        {"America/Iqaluit", 15, 136},
+        {"Asia/Ho_Chi_Minh", 16, 267},
+        {"America/Indiana/Vevay", 21, 131},
+        {"Africa/Mogadishu", 16, 41},
+        {"Antarctica/Mawson", 17, 225},
+        {"Asia/Novokuznetsk", 17, 294},
+        {"Asia/Kuala_Lumpur", 17, 284},
+        {"Atlantic/Cape_Verde", 19, 336},
+        {"Africa/Blantyre", 15, 10},
+        {"Europe/Isle_of_Man", 18, 407},
+        {"Pacific/Kwajalein", 17, 503},
+        {"America/Yakutat", 15, 219},
+        {"America/Regina", 14, 190},
+        {"Australia/Eucla", 15, 352},
+        {"Asia/Samarkand", 14, 308},
+        {"Pacific/Enderbury", 17, 491},
+        {"America/Barbados", 16, 78},
+        {"Europe/San_Marino", 17, 431},
+        {"Europe/Tallinn", 14, 438},
+        {"America/Tijuana", 15, 212},
+        {"America/Panama", 14, 177},
+        {"Pacific/Palau", 13, 512},
+        {"America/Eirunepe", 16, 108},
+        {"Africa/Ndjamena", 15, 44},
+        {"Asia/Makassar", 13, 290},
+        {"America/Porto_Acre", 18, 183},
+        {"Australia/Queensland", 20, 361},
+        {"America/Bogota", 14, 83},
+        {"Europe/Kaliningrad", 18, 410},
+        {"America/Juneau", 14, 139},
+        {"Europe/Dublin", 13, 403},
+        {"America/Matamoros", 17, 154},
+        {"America/Rosario", 15, 193},
+        {"Europe/Zurich", 13, 451},
+        {"America/Pangnirtung", 19, 178},
+        {"Canada/Mountain", 15, 377},
+        {"Europe/Zagreb", 13, 449},
+        {"America/Paramaribo", 18, 179},
+        {"Mexico/General", 14, 478},
+        {"America/Havana", 14, 124},
+        {"Asia/Harbin", 11, 265},
+        {"America/North_Dakota/Beulah", 27, 172},
+        {"Africa/Tunis", 12, 52},
+        {"Pacific/Ponape", 14, 515},
+        {"Pacific/Honolulu", 16, 499},
+        {"Africa/Dakar", 12, 17},
+        {"America/Tortola", 15, 214},
+        {"America/Swift_Current", 21, 208},
+        {"Atlantic/Azores", 15, 333},
+        {"Asia/Riyadh", 11, 305},
+        {"America/Mazatlan", 16, 155},
+        {"Australia/Currie", 16, 350},
+        {"Atlantic/St_Helena", 18, 343},
+        {"America/Whitehorse", 18, 217},
+        {"Antarctica/Syowa", 16, 230},
+        {"Asia/Kabul", 10, 275},
+        {"Africa/Gaborone", 15, 23},
+        {"America/Hermosillo", 18, 125},
+        {"Asia/Thimbu", 11, 318},
+        {"Australia/NSW", 13, 358},
+        {"Europe/Ulyanovsk", 16, 441},
+        {"America/Shiprock", 16, 200},
+        {"Asia/Ust-Nera", 13, 326},
+        {"NZ", 2, 479},
+        {"America/Goose_Bay", 17, 116},
+        {"Pacific/Johnston", 16, 500},
+        {"Iran", 4, 468},
+        {"PRC", 3, 482},
+        {"Indian/Mahe", 11, 463},
+        {"America/Buenos_Aires", 20, 85},
+        {"Africa/Bissau", 13, 9},
+        {"Africa/Mbabane", 14, 40},
+        {"America/Fort_Wayne", 18, 112},
+        {"Zulu", 4, 548},
+        {"Australia/Canberra", 18, 349},
+        {"Europe/Bratislava", 17, 396},
+        {"Canada/Atlantic", 15, 374},
+        {"America/Virgin", 14, 216},
+        {"Atlantic/South_Georgia", 22, 342},
+        {"America/Argentina/ComodRivadavia", 32, 61},
+        {"America/St_Thomas", 17, 206},
+        {"Pacific/Fiji", 12, 493},
+        {"America/Dominica", 16, 106},
+        {"Africa/Addis_Ababa", 18, 2},
+        {"Pacific/Tarawa", 14, 521},
+        {"Europe/Uzhgorod", 15, 442},
+        {"Asia/Jerusalem", 14, 274},
+        {"Atlantic/Bermuda", 16, 334},
+        {"Europe/London", 13, 415},
+        {"America/Yellowknife", 19, 220},
+        {"Chile/Continental", 17, 382},
+        {"America/Dawson_Creek", 20, 103},
+        {"Asia/Ashgabat", 13, 240},
+        {"America/Cambridge_Bay", 21, 86},
+        {"Pacific/Efate", 13, 490},
+        {"Iceland", 7, 456},
+        {"Africa/Juba", 11, 26},
+        {"America/Campo_Grande", 20, 87},
+        {"Europe/Rome", 11, 429},
+        {"America/North_Dakota/Center", 27, 173},
+        {"Pacific/Pohnpei", 15, 514},
+        {"Asia/Srednekolymsk", 18, 312},
+        {"Pacific/Truk", 12, 523},
+        {"Europe/Berlin", 13, 395},
+        {"America/Lower_Princes", 21, 148},
+        {"America/Martinique", 18, 153},
+        {"Pacific/Bougainville", 20, 486},
+        {"Asia/Almaty", 11, 235},
+        {"Asia/Beirut", 11, 248},
+        {"Indian/Mauritius", 16, 465},
+        {"Pacific/Port_Moresby", 20, 516},
+        {"Poland", 6, 527},
+        {"America/Louisville", 18, 147},
+        {"Pacific/Guam", 12, 498},
+        {"Africa/Djibouti", 15, 19},
+        {"America/Glace_Bay", 17, 114},
+        {"Atlantic/Madeira", 16, 340},
+        {"Mexico/BajaSur", 14, 477},
+        {"America/Inuvik", 14, 135},
+        {"America/Argentina/La_Rioja", 26, 64},
+        {"America/Boa_Vista", 17, 82},
+        {"GB-Eire", 7, 453},
+        {"Atlantic/Canary", 15, 335},
+        {"US/Alaska", 9, 533},
+        {"Europe/Lisbon", 13, 413},
+        {"Asia/Macau", 10, 288},
+        {"Canada/Newfoundland", 19, 378},
+        {"America/Mendoza", 15, 156},
+        {"America/Curacao", 15, 100},
+        {"Asia/Damascus", 13, 258},
+        {"Africa/Bangui", 13, 7},
+        {"Atlantic/Faeroe", 15, 337},
+        {"Indian/Comoro", 13, 461},
+        {"Asia/Vientiane", 14, 327},
+        {"Asia/Novosibirsk", 16, 295},
+        {"America/Montserrat", 18, 166},
+        {"America/Argentina/Buenos_Aires", 30, 59},
+        {"Europe/Riga", 11, 428},
+        {"America/Indiana/Marengo", 23, 128},
+        {"Asia/Pyongyang", 14, 300},
+        {"Asia/Dili", 9, 260},
+        {"America/Monterrey", 17, 163},
+        {"Asia/Ulan_Bator", 15, 324},
+        {"America/Creston", 15, 98},
+        {"America/Bahia", 13, 76},
+        {"Australia/Tasmania", 18, 364},
+        {"Australia/Broken_Hill", 21, 348},
+        {"America/Cayman", 14, 92},
+        {"Europe/Saratov", 14, 433},
+        {"America/Port-au-Prince", 22, 181},
+        {"Europe/Bucharest", 16, 398},
+        {"Asia/Dacca", 10, 257},
+        {"America/Bahia_Banderas", 22, 77},
+        {"Pacific/Wake", 12, 524},
+        {"America/Cuiaba", 14, 99},
+        {"Australia/ACT", 13, 345},
+        {"Africa/Timbuktu", 15, 50},
+        {"Antarctica/McMurdo", 18, 226},
+        {"Antarctica/Palmer", 17, 227},
+        {"US/Mountain", 11, 542},
+        {"America/Halifax", 15, 123},
+        {"Europe/Stockholm", 16, 437},
+        {"Asia/Qyzylorda", 14, 303},
+        {"Arctic/Longyearbyen", 19, 233},
+        {"America/Phoenix", 15, 180},
+        {"Asia/Tel_Aviv", 13, 317},
+        {"America/Montevideo", 18, 164},
+        {"Asia/Seoul", 10, 309},
+        {"Asia/Gaza", 9, 264},
+        {"Asia/Atyrau", 11, 242},
+        {"Europe/Luxembourg", 17, 416},
+        {"America/Indiana/Petersburg", 26, 129},
+        {"America/Nipigon", 15, 169},
+        {"Europe/Istanbul", 15, 408},
+        {"Europe/Guernsey", 15, 405},
+        {"Asia/Shanghai", 13, 310},
+        {"Europe/Gibraltar", 16, 404},
+        {"America/Guayaquil", 17, 121},
+        {"Brazil/East", 11, 370},
+        {"Kwajalein", 9, 472},
+        {"America/Coral_Harbour", 21, 95},
+        {"America/Belem", 13, 79},
+        {"America/Winnipeg", 16, 218},
+        {"US/Aleutian", 11, 534},
+        {"Asia/Brunei", 11, 250},
+        {"Europe/Sofia", 12, 436},
+        {"Africa/Lagos", 12, 31},
+        {"Pacific/Saipan", 14, 518},
+        {"Europe/Sarajevo", 15, 432},
+        {"Chile/EasterIsland", 18, 383},
+        {"America/Costa_Rica", 18, 97},
+        {"Asia/Tomsk", 10, 321},
+        {"Asia/Pontianak", 14, 299},
+        {"Asia/Khandyga", 13, 281},
+        {"Africa/Tripoli", 14, 51},
+        {"Europe/Budapest", 15, 399},
+        {"Australia/Yancowinna", 20, 367},
+        {"Africa/Ouagadougou", 18, 47},
+        {"Asia/Kuwait", 11, 286},
+        {"Mexico/BajaNorte", 16, 476},
+        {"America/Edmonton", 16, 107},
+        {"America/Kralendijk", 18, 143},
+        {"America/Ensenada", 16, 110},
+        {"America/Adak", 12, 54},
+        {"Europe/Andorra", 14, 390},
+        {"Asia/Phnom_Penh", 15, 298},
+        {"Europe/Vaduz", 12, 443},
+        {"America/Guyana", 14, 122},
+        {"America/Kentucky/Monticello", 27, 141},
+        {"Canada/Eastern", 14, 376},
+};
+
+static inline const TimeZoneIdKeyword *findTimeZoneIdKeyword(const char *key, uint32_t length) {
+    if (key == NULL || length < TIME_ZONE_ID_MIN_LENGTH || length > TIME_ZONE_ID_MAX_LENGTH) return NULL;
+    int32_t displacement = TIME_ZONE_ID_DISPLACEMENTS[perfectHashOf(key, length, 0, true) % TIME_ZONE_ID_KEYWORD_COUNT];
+    uint32_t index = displacement < 0 ? (uint32_t) (-displacement - 1) : perfectHashOf(key, length, displacement, true) % TIME_ZONE_ID_KEYWORD_COUNT;
+    const TimeZoneIdKeyword *keyword = &TIME_ZONE_ID_KEYWORDS[index];
+    return (keyword->length == length && strncasecmp(keyword->name, key, length) == 0) ? keyword : NULL;
+}
+
+static const uint16_t TIME_ZONE_ID_SORTED_INDEXES[TIME_ZONE_ID_KEYWORD_COUNT] = {
+        13, 219, 422, 203, 116, 140, 334, 469, 47, 409, 347, 161,
+        215, 178, 249, 57, 316, 384, 238, 453, 112, 243, 308, 395,
+        267, 335, 435, 139, 174, 288, 287, 525, 104, 84, 218, 272,
+        294, 315, 176, 175, 410, 342, 255, 197, 362, 323, 9, 536,
+        200, 266, 495, 533, 381, 29, 542, 100, 30, 232, 85, 475,
+        182, 418, 15, 183, 458, 179, 94, 188, 248, 190, 154, 110,
+        95, 192, 268, 282, 483, 491, 355, 520, 28, 311, 459, 366,
+        43, 408, 432, 436, 253, 309, 313, 158, 486, 90, 277, 519,
+        45, 529, 482, 493, 467, 159, 155, 430, 195, 88, 421, 539,
+        361, 242, 541, 306, 411, 240, 454, 307, 403, 41, 12, 23,
+        78, 516, 546, 499, 378, 396, 214, 298, 477, 510, 5, 341,
+        256, 35, 123, 457, 339, 99, 59, 368, 185, 547, 207, 540,
+        126, 228, 205, 451, 443, 199, 184, 250, 210, 444, 370, 389,
+        466, 147, 106, 1, 130, 198, 262, 480, 505, 324, 474, 164,
+        10, 511, 0, 70, 380, 438, 293, 129, 330, 359, 373, 376,
+        503, 488, 44, 364, 289, 221, 290, 60, 291, 31, 351, 101,
+        265, 371, 206, 314, 254, 53, 120, 318, 400, 196, 187, 320,
+        194, 113, 419, 244, 386, 144, 143, 34, 358, 211, 385, 51,
+        416, 392, 521, 350, 428, 280, 109, 82, 39, 343, 496, 497,
+        157, 142, 393, 163, 77, 502, 310, 446, 181, 91, 223, 81,
+        431, 76, 508, 274, 326, 132, 37, 169, 447, 153, 523, 49,
+        131, 79, 165, 233, 89, 490, 468, 66, 479, 80, 304, 50,
+        507, 379, 237, 340, 264, 21, 103, 281, 73, 230, 425, 394,
+        105, 325, 172, 261, 259, 532, 208, 247, 345, 204, 537, 217,
+        464, 227, 363, 128, 186, 225, 344, 473, 134, 336, 544, 531,
+        478, 146, 42, 501, 63, 388, 17, 125, 353, 506, 514, 48,
+        440, 278, 202, 7, 319, 504, 397, 115, 75, 530, 83, 269,
+        481, 149, 401, 472, 284, 124, 216, 300, 118, 387, 426, 461,
+        346, 470, 135, 234, 455, 301, 417, 391, 299, 494, 173, 96,
+        485, 413, 390, 8, 352, 121, 151, 54, 258, 62, 260, 398,
+        20, 365, 145, 168, 484, 72, 285, 535, 32, 328, 517, 92,
+        415, 235, 548, 374, 465, 305, 25, 55, 127, 429, 528, 52,
+        239, 107, 33, 241, 98, 11, 543, 279, 292, 312, 322, 442,
+        414, 122, 489, 534, 137, 331, 222, 369, 515, 513, 338, 348,
+        512, 87, 367, 275, 246, 463, 213, 427, 509, 68, 295, 2,
+        177, 303, 61, 226, 296, 170, 224, 160, 476, 437, 102, 356,
+        527, 487, 167, 114, 524, 500, 357, 18, 4, 399, 424, 545,
+        16, 273, 69, 108, 148, 375, 252, 372, 24, 460, 162, 22,
+        434, 166, 138, 337, 257, 471, 332, 407, 191, 448, 327, 19,
+        405, 56, 58, 36, 518, 329, 97, 538, 456, 377, 229, 171,
+        402, 220, 212, 117, 445, 270, 263, 251, 433, 354, 201, 420,
+        86, 236, 74, 150, 452, 383, 404, 297, 136, 349, 286, 189,
+        40, 333, 317, 65, 38, 133, 360, 46, 439, 382, 449, 245,
+        526, 321, 93, 423, 111, 441, 492, 302, 283, 450, 64, 406,
+        276, 26, 27, 71, 231, 271, 462, 522, 141, 209, 3, 14,
+        119, 180, 67, 498, 193, 152, 6, 156, 412,
+};
+
+static inline const TimeZoneIdKeyword *getTimeZoneIdKeywordInOrder(uint32_t position) {
+    return position < TIME_ZONE_ID_KEYWORD_COUNT ? &TIME_ZONE_ID_KEYWORDS[TIME_ZONE_ID_SORTED_INDEXES[position]] : NULL;
+}
+
+// Keywords starting with prefix are getTimeZoneIdKeywordInOrder(first) ... (first + count - 1). Returns count
+static inline uint32_t findTimeZoneIdKeywordPrefixRange(const char *prefix, uint32_t length, uint32_t *first) {
+    uint32_t lower = 0;
+    uint32_t upper = TIME_ZONE_ID_KEYWORD_COUNT;
+    while (prefix != NULL && lower < upper) {  // first keyword not less than prefix
+        uint32_t middle = lower + (upper - lower) / 2;
+        if (strncasecmp(getTimeZoneIdKeywordInOrder(middle)->name, prefix, length) < 0) {
+            lower = middle + 1;
+        } else {
+            upper = middle;
+        }
+    }
+    *first = lower;
+    uint32_t end = lower;
+    upper = prefix != NULL ? TIME_ZONE_ID_KEYWORD_COUNT : lower;
+    while (end < upper) {    // first keyword after prefix range
+        uint32_t middle = end + (upper - end) / 2;
+        if (strncasecmp(getTimeZoneIdKeywordInOrder(middle)->name, prefix, length) == 0) {
+            end = middle + 1;
+        } else {
+            upper = middle;
+        }
+    }
+    return end - lower;
+}
@@ -10,6 +10,8 @@ typedef struct TimeZoneRule {
     int64_t transition;
 } TimeZoneRule;
 
+#define ZONE_RULE_COUNT(rules) ((uint16_t) (sizeof(rules) / sizeof((rules)[0]) - 1))  // without terminating rule
+
 static const TimeZoneRule AFRICA_ALGIERS_RULES[] = {
  #ifdef ENABLE_TIME_ZONE_HISTORIC_RULES
   {.gmtOffset = 3600, .isDaylightTime = true, .transition = 231724800},
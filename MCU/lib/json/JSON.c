@@ -21,10 +21,14 @@
 #define JSON_NEXT_VALUE_COMMA_CHAR       ','
 #define JSON_NEXT_VALUE_SEMICOLON_CHAR   ';'
 
+#define JSON_WRITER_STAGING_SIZE 256    // small tokens are collected on stack and passed to writer in bigger pieces
+
 typedef struct InnerJsonBuffer {
     char *buffer;
     uint32_t length;
     uint32_t capacity;
+    JSONTextWriter writer;  // when set, buffer is staging area, text is passed to writer when it is full
+    void *writerContext;
 } InnerJsonBuffer;
 
 static char nextJsonChar(JSONTokener *jsonTokener);
@@ -50,6 +54,7 @@ static void quoteJsonString(InnerJsonBuffer *jsonBuffer, const char *value);
 static void appendJsonValue(InnerJsonBuffer *jsonBuffer, JSONValue *jsonValue, uint16_t indentFactor, uint16_t topLevelIndent);
 static void appendJsonValueCompact(InnerJsonBuffer *jsonBuffer, JSONValue *jsonValue);
 static void jsonBufferCatStr(InnerJsonBuffer *jsonBuffer, const char *str);
+static void flushJsonWriter(InnerJsonBuffer *jsonBuffer);
 
 static void deleteJsonObject(HashMap jsonObjectMap);
 static void deleteJsonArray(Vector jsonVector);
@@ -549,6 +554,22 @@ void jsonArrayToString(JSONArray *jsonArray, char *resultBuffer, uint32_t buffer
     jsonVectorToStringCompact(jsonArray->jsonVector, &jsonBuffer);
 }
 
+void jsonObjectWriteTo(JSONObject *jsonObject, JSONTextWriter writer, void *context) {
+    if (jsonObject == NULL || writer == NULL) return;
+    char staging[JSON_WRITER_STAGING_SIZE];
+    InnerJsonBuffer jsonBuffer = {.buffer = staging, .length = 0, .capacity = sizeof(staging), .writer = writer, .writerContext = context};
+    jsonHashMapToStringCompact(jsonObject->jsonMap, &jsonBuffer);
+    flushJsonWriter(&jsonBuffer);
+}
+
+void jsonArrayWriteTo(JSONArray *jsonArray, JSONTextWriter writer, void *context) {
+    if (jsonArray == NULL || writer == NULL) return;
+    char staging[JSON_WRITER_STAGING_SIZE];
+    InnerJsonBuffer jsonBuffer = {.buffer = staging, .length = 0, .capacity = sizeof(staging), .writer = writer, .writerContext = context};
+    jsonVectorToStringCompact(jsonArray->jsonVector, &jsonBuffer);
+    flushJsonWriter(&jsonBuffer);
+}
+
 void deleteJSONObject(JSONObject *jsonObject) {
     if (jsonObject != NULL) {
         deleteJsonObject(jsonObject->jsonMap);
@@ -982,6 +1003,19 @@ static void appendJsonValueCompact(InnerJsonBuffer *jsonBuffer, JSONValue *jsonV
 }
 
 static void jsonBufferCatStr(InnerJsonBuffer *jsonBuffer, const char *str) {
+    if (jsonBuffer->writer != NULL) {
+        uint32_t length = strlen(str);
+        if (length > jsonBuffer->capacity - jsonBuffer->length) {
+            flushJsonWriter(jsonBuffer);
+        }
+        if (length >= jsonBuffer->capacity) {   // long value goes directly, without staging copy
+            jsonBuffer->writer(jsonBuffer->writerContext, str, length);
+            return;
+        }
+        memcpy(jsonBuffer->buffer + jsonBuffer->length, str, length);
+        jsonBuffer->length += length;
+        return;
+    }
     uint32_t length = strnlen(str, jsonBuffer->capacity + 1);
     if (length >= (jsonBuffer->capacity - jsonBuffer->length)) return;
     memcpy(jsonBuffer->buffer + jsonBuffer->length, str, length);
@@ -989,6 +1023,13 @@ static void jsonBufferCatStr(InnerJsonBuffer *jsonBuffer, const char *str) {
     jsonBuffer->buffer[jsonBuffer->length] = '\0';
 }
 
+static void flushJsonWriter(InnerJsonBuffer *jsonBuffer) {
+    if (jsonBuffer->length > 0) {
+        jsonBuffer->writer(jsonBuffer->writerContext, jsonBuffer->buffer, jsonBuffer->length);
+        jsonBuffer->length = 0;
+    }
+}
+
 static void deleteJsonObject(HashMap jsonObjectMap) {
     HashMapIterator iterator = getHashMapIterator(jsonObjectMap);
     while (hashMapHasNext(&iterator)) {
@@ -47,6 +47,9 @@ typedef struct JSONTokener {
     JSONStatus jsonStatus;
 } JSONTokener;
 
+// Receives serialized JSON text piece by piece, text is not null terminated
+typedef void (*JSONTextWriter)(void *context, const char *value, uint32_t length);
+
 typedef struct JSONObject {
     JSONTokener *jsonTokener;
     HashMap jsonMap;
@@ -136,6 +139,10 @@ void jsonArrayToStringPretty(JSONArray *jsonArray, char *resultBuffer, uint32_t
 void jsonObjectToString(JSONObject *jsonObject, char *resultBuffer, uint32_t bufferSize);
 void jsonArrayToString(JSONArray *jsonArray, char *resultBuffer, uint32_t bufferSize);
 
+// Same compact JSON text, but streamed to writer without intermediate buffer, so output size is not limited
+void jsonObjectWriteTo(JSONObject *jsonObject, JSONTextWriter writer, void *context);
+void jsonArrayWriteTo(JSONArray *jsonArray, JSONTextWriter writer, void *context);
+
 // JSON Delete
 void deleteJSONObject(JSONObject *jsonObject);
 void deleteJSONArray(JSONArray *jsonArray);
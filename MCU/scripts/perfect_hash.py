@@ -0,0 +1,270 @@
+#!/usr/bin/env python3
+"""
+Minimal perfect hash generator for static keyword sets.
+
+Reads a keyword spec file and writes a C header with one lookup table per '%table' section.
+Every lookup costs two FNV-1a hashes over the key and a single confirming compare,
+independent of how many keywords the table holds (hash-and-displace scheme).
+
+Spec file format:
+    # comment
+    %include "Header.h"                     - extra include for value types, optional, repeatable
+    %table <Name> [ignore-case] [prefix-index]
+                                            - start new table, 'Name' is CamelCase prefix for generated symbols,
+                                              'prefix-index' adds sorted key order for prefix lookups (autocomplete)
+    %value <C type>                         - value type for the current table
+    <key> <C value expression>              - one keyword per line, value is copied verbatim
+
+Usage:
+    python scripts/perfect_hash.py lib/cron/CronKeywords.phf -o lib/cron/CronKeywords.h
+"""
+
+import argparse
+import os
+import re
+import sys
+
+FNV_OFFSET_BASIS = 2166136261
+FNV_PRIME = 16777619
+UINT32_MASK = 0xFFFFFFFF
+MAX_DISPLACEMENT = 1 << 20
+
+
+class Table:
+    def __init__(self, name, ignore_case, prefix_index):
+        self.name = name
+        self.ignore_case = ignore_case
+        self.prefix_index = prefix_index
+        self.value_type = 'uint8_t'
+        self.keywords = []   # [(key, value)]
+
+    @property
+    def prefix(self):
+        return re.sub(r'(?<=[a-z0-9])(?=[A-Z])', '_', self.name).upper()
+
+
+def perfect_hash(key, seed, ignore_case):
+    """ Must match 'perfectHashOf()' emitted into the header """
+    h = ((FNV_OFFSET_BASIS ^ seed) * FNV_PRIME) & UINT32_MASK
+    for byte in key.encode('ascii'):
+        h ^= (byte | 0x20) if ignore_case else byte
+        h = (h * FNV_PRIME) & UINT32_MASK
+    return h
+
+
+def parse_spec(path):
+    includes, tables = [], []
+    with open(path, encoding='utf-8') as spec:
+        for line_number, line in enumerate(spec, 1):
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+
+            def fail(message):
+                sys.exit(f'{path}:{line_number}: {message}')
+
+            if line.startswith('%include'):
+                includes.append(line[len('%include'):].strip())
+            elif line.startswith('%table'):
+                parts = line.split()
+                if len(parts) < 2:
+                    fail('table name expected')
+                tables.append(Table(parts[1], 'ignore-case' in parts[2:], 'prefix-index' in parts[2:]))
+            elif line.startswith('%value'):
+                if not tables:
+                    fail('%value outside of table')
+                tables[-1].value_type = line[len('%value'):].strip()
+            else:
+                if not tables:
+                    fail('keyword outside of table')
+                parts = line.split(None, 1)
+                if len(parts) != 2:
+                    fail('keyword and value expected')
+                tables[-1].keywords.append((parts[0], parts[1]))
+
+    for table in tables:
+        seen = set()
+        for key, _ in table.keywords:
+            normalized = key.lower() if table.ignore_case else key
+            if normalized in seen:
+                sys.exit(f'{path}: duplicate key "{key}" in table {table.name}')
+            seen.add(normalized)
+    return includes, tables
+
+
+def build_displacements(table):
+    """ Returns (displacements, slots): slot index -> keyword index """
+    size = len(table.keywords)
+    buckets = [[] for _ in range(size)]
+    for index, (key, _) in enumerate(table.keywords):
+        buckets[perfect_hash(key, 0, table.ignore_case) % size].append(index)
+
+    displacements = [0] * size
+    slots = [None] * size
+    for bucket_index in sorted(range(size), key=lambda b: -len(buckets[b])):
+        bucket = buckets[bucket_index]
+        if len(bucket) <= 1:
+            break
+
+        for seed in range(1, MAX_DISPLACEMENT):
+            placement = [perfect_hash(table.keywords[i][0], seed, table.ignore_case) % size for i in bucket]
+            if len(set(placement)) == len(placement) and all(slots[slot] is None for slot in placement):
+                for keyword_index, slot in zip(bucket, placement):
+                    slots[slot] = keyword_index
+                displacements[bucket_index] = seed
+                break
+        else:
+            sys.exit(f'Unable to find displacement for table {table.name}')
+
+    free_slots = [slot for slot in range(size) if slots[slot] is None]
+    for bucket_index in range(size):    # single keyword buckets are placed directly, encoded as negative value
+        if len(buckets[bucket_index]) == 1:
+            slot = free_slots.pop()
+            slots[slot] = buckets[bucket_index][0]
+            displacements[bucket_index] = -slot - 1
+    return displacements, slots
+
+
+def c_string(value):
+    return '"' + value.replace('\\', '\\\\').replace('"', '\\"') + '"'
+
+
+def generate_table(table):
+    displacements, slots = build_displacements(table)
+    size = len(table.keywords)
+    lengths = [len(key) for key, _ in table.keywords]
+    displacement_type = 'int16_t' if all(-32768 <= d <= 32767 for d in displacements) else 'int32_t'
+    keyword_type = f'{table.name}Keyword'
+    compare = (f'strncasecmp(keyword->name, key, length) == 0' if table.ignore_case
+               else f'memcmp(keyword->name, key, length) == 0')
+    ignore_case = 'true' if table.ignore_case else 'false'
+
+    out = [f'#define {table.prefix}_KEYWORD_COUNT {size}',
+           f'#define {table.prefix}_MIN_LENGTH {min(lengths)}',
+           f'#define {table.prefix}_MAX_LENGTH {max(lengths)}',
+           '',
+           f'typedef struct {keyword_type} {{',
+           '    const char *name;',
+           '    uint8_t length;',
+           f'    {table.value_type}{"" if table.value_type.endswith("*") else " "}value;',
+           f'}} {keyword_type};',
+           '',
+           f'static const {displacement_type} {table.prefix}_DISPLACEMENTS[{table.prefix}_KEYWORD_COUNT] = {{']
+    for start in range(0, size, 12):
+        out.append('        ' + ', '.join(str(d) for d in displacements[start:start + 12]) + ',')
+    out.append('};')
+    out.append('')
+    out.append(f'static const {keyword_type} {table.prefix}_KEYWORDS[{table.prefix}_KEYWORD_COUNT] = {{')
+    for slot in slots:
+        key, value = table.keywords[slot]
+        out.append(f'        {{{c_string(key)}, {len(key)}, {value}}},')
+    out.append('};')
+    out.append('')
+    out.append(f'static inline const {keyword_type} *find{keyword_type}(const char *key, uint32_t length) {{')
+    out.append(f'    if (key == NULL || length < {table.prefix}_MIN_LENGTH || length > {table.prefix}_MAX_LENGTH) return NULL;')
+    out.append(f'    int32_t displacement = {table.prefix}_DISPLACEMENTS[perfectHashOf(key, length, 0, {ignore_case}) % {table.prefix}_KEYWORD_COUNT];')
+    out.append(f'    uint32_t index = displacement < 0 ? (uint32_t) (-displacement - 1) : perfectHashOf(key, length, displacement, {ignore_case}) % {table.prefix}_KEYWORD_COUNT;')
+    out.append(f'    const {keyword_type} *keyword = &{table.prefix}_KEYWORDS[index];')
+    out.append(f'    return (keyword->length == length && {compare}) ? keyword : NULL;')
+    out.append('}')
+    if table.prefix_index:
+        out += generate_prefix_index(table, slots)
+    return out
+
+
+def generate_prefix_index(table, slots):
+    """ Keyword slots in key order and binary search over them, same order as strncasecmp()/strncmp() """
+    keyword_type = f'{table.name}Keyword'
+    index_type = 'uint8_t' if len(slots) <= 256 else 'uint16_t'
+    normalize = (lambda key: key.lower()) if table.ignore_case else (lambda key: key)
+    slot_of_keyword = {keyword_index: slot for slot, keyword_index in enumerate(slots)}
+    sorted_slots = [slot_of_keyword[index] for index in sorted(range(len(slots)), key=lambda i: normalize(table.keywords[i][0]).encode('ascii'))]
+    compare = 'strncasecmp' if table.ignore_case else 'strncmp'
+
+    out = ['',
+           f'static const {index_type} {table.prefix}_SORTED_INDEXES[{table.prefix}_KEYWORD_COUNT] = {{']
+    for start in range(0, len(sorted_slots), 12):
+        out.append('        ' + ', '.join(str(slot) for slot in sorted_slots[start:start + 12]) + ',')
+    out.append('};')
+    out.append('')
+    out.append(f'static inline const {keyword_type} *get{keyword_type}InOrder(uint32_t position) {{')
+    out.append(f'    return position < {table.prefix}_KEYWORD_COUNT ? &{table.prefix}_KEYWORDS[{table.prefix}_SORTED_INDEXES[position]] : NULL;')
+    out.append('}')
+    out.append('')
+    out.append(f'// Keywords starting with prefix are get{keyword_type}InOrder(first) ... (first + count - 1). Returns count')
+    out.append(f'static inline uint32_t find{keyword_type}PrefixRange(const char *prefix, uint32_t length, uint32_t *first) {{')
+    out.append('    uint32_t lower = 0;')
+    out.append(f'    uint32_t upper = {table.prefix}_KEYWORD_COUNT;')
+    out.append(f'    while (prefix != NULL && lower < upper) {{  // first keyword not less than prefix')
+    out.append('        uint32_t middle = lower + (upper - lower) / 2;')
+    out.append(f'        if ({compare}(get{keyword_type}InOrder(middle)->name, prefix, length) < 0) {{')
+    out.append('            lower = middle + 1;')
+    out.append(f'        }} else {{')
+    out.append('            upper = middle;')
+    out.append('        }')
+    out.append('    }')
+    out.append('    *first = lower;')
+    out.append('    uint32_t end = lower;')
+    out.append(f'    upper = prefix != NULL ? {table.prefix}_KEYWORD_COUNT : lower;')
+    out.append(f'    while (end < upper) {{    // first keyword after prefix range')
+    out.append('        uint32_t middle = end + (upper - end) / 2;')
+    out.append(f'        if ({compare}(get{keyword_type}InOrder(middle)->name, prefix, length) == 0) {{')
+    out.append('            end = middle + 1;')
+    out.append(f'        }} else {{')
+    out.append('            upper = middle;')
+    out.append('        }')
+    out.append('    }')
+    out.append('    return end - lower;')
+    out.append('}')
+    return out
+
+
+def generate_header(spec_path, includes, tables):
+    spec_name = os.path.basename(spec_path)
+    out = ['#pragma once',
+           '',
+           f'// Generated by scripts/perfect_hash.py from {spec_name}, do not edit manually',
+           '',
+           '#include <stdint.h>',
+           '#include <stdbool.h>',
+           '#include <stddef.h>',
+           '#include <string.h>',
+           '#include <strings.h>']
+    out += [f'#include {include}' for include in includes]
+    out += ['',
+            '#ifndef PERFECT_HASH_OF_DEFINED',
+            '#define PERFECT_HASH_OF_DEFINED',
+            'static inline uint32_t perfectHashOf(const char *key, uint32_t length, uint32_t seed, bool isIgnoreCase) {',
+            f'    uint32_t hash = ({FNV_OFFSET_BASIS}UL ^ seed) * {FNV_PRIME}UL;',
+            '    for (uint32_t i = 0; i < length; i++) {',
+            '        uint8_t byte = (uint8_t) key[i];',
+            '        hash ^= isIgnoreCase ? (byte | 0x20) : byte;',
+            f'        hash *= {FNV_PRIME}UL;',
+            '    }',
+            '    return hash;',
+            '}',
+            '#endif',
+            '']
+    for table in tables:
+        out += generate_table(table)
+        out.append('')
+    return '\n'.join(out).rstrip('\n') + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate minimal perfect hash lookup tables for static keyword sets')
+    parser.add_argument('spec', help='keyword spec file (.phf)')
+    parser.add_argument('-o', '--output', help='output header, defaults to spec file name with .h extension')
+    args = parser.parse_args()
+
+    includes, tables = parse_spec(args.spec)
+    if not tables:
+        sys.exit(f'{args.spec}: no tables defined')
+
+    output = args.output or os.path.splitext(args.spec)[0] + '.h'
+    with open(output, 'w', encoding='utf-8', newline='\n') as header:
+        header.write(generate_header(args.spec, includes, tables))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""
+Compact binary timezone database generator.
+
+Reads zone list, zone names and historic transition rules from the date-time library headers
+and writes single binary file, that firmware reads lazily per zone from SD card (see lib/date-time/TimeZoneDb.h).
+
+File layout, all numbers little endian:
+    header      - "TZDB", version u8, flags u8, zone count u16, name set count u16, reserved u16,
+                  string table offset u32, name set table offset u32, zone index offset u32, rule data offset u32,
+                  hash table offset u32 (since version 2)
+    strings     - deduplicated zero terminated strings: zone ids and zone names
+    name sets   - 4 x u32 string offsets per set: [long std, short std, long dst, short dst], shared between zones
+    zone index  - 16 bytes per zone, sorted by case-insensitive id for binary search:
+                  id offset u32, utc offset i32, rule data offset u32, rule count u16, name set index u16
+    hash table  - 4 bytes per zone, case-insensitive minimal perfect hash of zone id, same scheme as scripts/perfect_hash.py:
+                  displacement i16 of bucket (hash % zone count), zone index position u16 of slot.
+                  Lookup reads bucket displacement, then slot position, then one index entry to confirm the id
+    rule data   - per zone, for each rule: zigzag varint of transition delta from previous rule (first one from 0),
+                  then zigzag varint of (gmt offset << 1 | daylight flag)
+
+Usage:
+    python scripts/tzdb_generator.py -o sd-card/db/tzdb.bin
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+from perfect_hash import Table, build_displacements
+
+TZDB_MAGIC = b'TZDB'
+TZDB_VERSION = 2
+HEADER_FORMAT = '<4sBBHHHIIIII'
+INDEX_ENTRY_FORMAT = '<IiIHH'
+NAME_SET_FORMAT = '<IIII'
+HASH_ENTRY_FORMAT = '<hH'
+
+LIB_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'lib', 'date-time')
+
+RULES_ARRAY_PATTERN = re.compile(r'static const TimeZoneRule (\w+)\[\] = \{(.*?)\{\.transition = 0\}\};', re.S)
+RULE_PATTERN = re.compile(r'\{\.gmtOffset = (-?\d+), \.isDaylightTime = (true|false), \.transition = (-?\d+)\}')
+NAMES_ARRAY_PATTERN = re.compile(r'static const char \*const (\w+)\[\] = \{(.*?)\};', re.S)
+ZONE_PATTERN = re.compile(r'\{\.id = "([^"]+)", \.utcOffset = (-?\d+), \.names = (\w+), \.rules = (\w+)')
+
+
+def read_source(name):
+    with open(os.path.join(LIB_DIR, name), encoding='utf-8') as source:
+        return source.read()
+
+
+def parse_rules(text):
+    rules = {}
+    for name, body in RULES_ARRAY_PATTERN.findall(text):
+        rules[name] = [(int(transition), int(offset), dst == 'true') for offset, dst, transition in RULE_PATTERN.findall(body)]
+    return rules
+
+
+def parse_names(text):
+    names = {}
+    for name, body in NAMES_ARRAY_PATTERN.findall(text):
+        values = re.findall(r'"([^"]*)"', body)
+        if len(values) != 4:
+            sys.exit(f'{name}: 4 zone names expected, found {len(values)}')
+        names[name] = tuple(values)
+    return names
+
+
+def parse_zones(text, rules, names):
+    zones = []
+    for zone_id, utc_offset, names_name, rules_name in ZONE_PATTERN.findall(text):
+        if names_name not in names:
+            sys.exit(f'{zone_id}: unknown zone names {names_name}')
+        if rules_name != 'NULL' and rules_name not in rules:
+            sys.exit(f'{zone_id}: unknown zone rules {rules_name}')
+        zone_rules = rules.get(rules_name, [])
+        if any(one[0] >= two[0] for one, two in zip(zone_rules, zone_rules[1:])):
+            sys.exit(f'{zone_id}: transitions are not sorted')
+        zones.append((zone_id, int(utc_offset), names[names_name], zone_rules))
+    return sorted(zones, key=lambda zone: zone[0].lower())
+
+
+def zigzag_varint(value):
+    value = (value << 1) ^ (value >> 63)
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+class StringTable:
+    def __init__(self):
+        self.data = bytearray()
+        self.offsets = {}
+
+    def add(self, value):
+        if value not in self.offsets:
+            self.offsets[value] = len(self.data)
+            self.data += value.encode('utf-8') + b'\0'
+        return self.offsets[value]
+
+
+def build_database(zones):
+    strings = StringTable()
+    name_sets, name_set_indexes = [], {}
+    rule_data = bytearray()
+    index = []
+
+    for zone_id, utc_offset, zone_names, zone_rules in zones:
+        if zone_names not in name_set_indexes:
+            name_set_indexes[zone_names] = len(name_sets)
+            name_sets.append(tuple(strings.add(name) for name in zone_names))
+
+        rules_offset = len(rule_data)
+        previous_transition = 0
+        for transition, gmt_offset, is_daylight_time in zone_rules:
+            rule_data += zigzag_varint(transition - previous_transition)
+            rule_data += zigzag_varint((gmt_offset << 1) | int(is_daylight_time))
+            previous_transition = transition
+        index.append((strings.add(zone_id), utc_offset, rules_offset, len(zone_rules), name_set_indexes[zone_names]))
+
+    hash_table = Table('TimeZoneDbId', True, False)
+    hash_table.keywords = [(zone[0], position) for position, zone in enumerate(zones)]
+    displacements, slots = build_displacements(hash_table)
+
+    header_size = struct.calcsize(HEADER_FORMAT)
+    string_table_offset = header_size
+    name_set_offset = string_table_offset + len(strings.data)
+    index_offset = name_set_offset + len(name_sets) * struct.calcsize(NAME_SET_FORMAT)
+    hash_table_offset = index_offset + len(index) * struct.calcsize(INDEX_ENTRY_FORMAT)
+    rule_data_offset = hash_table_offset + len(slots) * struct.calcsize(HASH_ENTRY_FORMAT)
+
+    out = bytearray(struct.pack(HEADER_FORMAT, TZDB_MAGIC, TZDB_VERSION, 0, len(index), len(name_sets), 0,
+                                string_table_offset, name_set_offset, index_offset, rule_data_offset, hash_table_offset))
+    out += strings.data
+    for name_set in name_sets:
+        out += struct.pack(NAME_SET_FORMAT, *name_set)
+    for entry in index:
+        out += struct.pack(INDEX_ENTRY_FORMAT, *entry)
+    for displacement, position in zip(displacements, slots):
+        out += struct.pack(HASH_ENTRY_FORMAT, displacement, position)
+    out += rule_data
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate compact binary timezone database from date-time library headers')
+    parser.add_argument('-o', '--output', default='tzdb.bin', help='output file, defaults to tzdb.bin')
+    args = parser.parse_args()
+
+    rules = parse_rules(read_source('TimeZoneRules.h'))
+    names = parse_names(read_source('TimeZoneNames.h'))
+    zones = parse_zones(read_source('TimeZone.h'), rules, names)
+    if not zones:
+        sys.exit('No zones found')
+
+    database = build_database(zones)
+    with open(args.output, 'wb') as output:
+        output.write(database)
+    print(f'{args.output}: {len(zones)} zones, {sum(len(zone[3]) for zone in zones)} rules, {len(database)} bytes')
+
+
+if __name__ == '__main__':
+    main()
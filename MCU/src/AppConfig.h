@@ -17,6 +17,7 @@
 #define CAMERA_IMAGE_DIR        SD_CARD_ROOT "/photo"
 #define DATABASE_DIR            SD_CARD_ROOT "/db"
 #define EMBEDDED_DATABASE_FILE  DATABASE_DIR "/embedded.db"
+#define TIMEZONE_DATABASE_FILE  DATABASE_DIR "/tzdb.bin"    // generated by scripts/tzdb_generator.py, embedded DB is used when missing
 #define ENCRYPTION_DIR          SD_CARD_ROOT "/encryption"
 #define PRIVATE_KEY_PEM_FILE    ENCRYPTION_DIR "/private_encryption_key.pem"
 #define PUBLIC_KEY_PEM_FILE     ENCRYPTION_DIR "/public_encryption_key.pem"
@@ -103,8 +104,13 @@
 #include "FileUtils.h"
 #include "Logger.h"
 #include "BufferString.h"
+#include "StringView.h"
+#include "StringRope.h"
 #include "GlobalDateTime.h"
+#include "TimeZoneDb.h"
+#include "Clock.h"
 #include "CronExpression.h"
+#include "CronStore.h"
 #include "SqliteWrapper.h"
 #include "BufferVector.h"
 #include "Properties.h"
@@ -14,6 +14,7 @@
 #include "esp_adc/adc_cali_scheme.h"
 
 #include "esp_sleep.h"
+#include "esp_attr.h"
 
 #include "SDCard.h"
 #include "StatusLed.h"
@@ -54,7 +55,7 @@ CronExpression cron;
 sqlite3 *embeddedDb;
 
 static int batteryPercentage;
-static DateTimeFormatter photoFileDateTimeFormatter;
+RTC_DATA_ATTR static uint8_t cronBinary[CRON_BINARY_SIZE];   // survives deep sleep, so expression is not parsed on every wakeup
 
 static int logOverrideFunction(const char *format, va_list argumentList);
 static int getBatteryDividerVoltage();
@@ -272,9 +273,15 @@ void app_main() {
     LOG_INFO(TAG, "Project fully configured, enabling worker mode");
 
     char *cronStr = getProperty(&wlanConfig, PROPERTY_SYSTEM_CRON_EXPR_KEY);
-    CronStatus cronStatus = parseCronExpression(&cron, cronStr);
+    CronStatus cronStatus = deserializeCronExpression(&cron, cronStr, cronBinary, sizeof(cronBinary));
     if (cronStatus == CRON_OK) {
-        LOG_INFO(TAG, "Cron initialized OK!");
+        LOG_INFO(TAG, "Cron restored from RTC memory");
+    } else {
+        cronStatus = parseCronExpression(&cron, cronStr);
+        if (cronStatus == CRON_OK) {
+            serializeCronExpression(&cron, cronStr, cronBinary, sizeof(cronBinary));
+            LOG_INFO(TAG, "Cron initialized OK!");
+        }
     }
 
     executeCronJob();   // send a meter photo with data if it is time
@@ -436,9 +443,11 @@ static void executeCronJob() {
     LOG_INFO(TAG, "Cron now: %s", zonedDateTimeToStrByFormat(&zdtNow, DATE_TIME_FORMAT_SHORT));
 
     char *previousExecutionDateStr = getProperty(&wlanConfig, PROPERTY_PREVIOUS_CRON_DATE_KEY);
-    DateTimeFormatter formatter;
-    parseDateTimePattern(&formatter, DATE_TIME_FORMAT_SHORT);
-    DateTime previousDateTime = parseToDateTime(previousExecutionDateStr, &formatter);
+    int64_t previousEpoch = 0;  // missing or broken date is handled as the epoch start, then job is not approved
+    if (previousExecutionDateStr != NULL) {
+        parseEpochSecondsByPattern(previousExecutionDateStr, strlen(previousExecutionDateStr), DATE_TIME_FORMAT_SHORT, &previousEpoch, NULL);
+    }
+    DateTime previousDateTime = dateTimeOfEpochSeconds(previousEpoch, 0, 0);
     ZonedDateTime previousZdt = zonedDateTimeOfDateTime(&previousDateTime, &timeZone);
 
     ZonedDateTime expectedExecution = nextCronZonedDateTime(&cron, &previousZdt);
@@ -494,7 +503,6 @@ static void cleanupPhotoDirectory() {
     LOG_INFO(TAG, "Total photos in dir: [%d]", fileVecSize(photoVec));
     if (fileVecSize(photoVec) >= MAX_FILES_IN_DIR) {
         LOG_INFO(TAG, "Collected photos more than: %d. Removing oldest %d photos", MAX_FILES_IN_DIR, OLDEST_PHOTOS_TO_REMOVE_COUNT);
-        parseDateTimePattern(&photoFileDateTimeFormatter, DATE_TIME_FILE_NAME_FORMAT);
         qsort(photoVec->items, fileVecSize(photoVec), sizeof(File), fileDateCompareFunction);   // sort by photo date time from it name, first will be the oldest one
 
         for (int i = 0; i < OLDEST_PHOTOS_TO_REMOVE_COUNT; i++) { // remove oldest 20 photos
@@ -506,9 +514,11 @@ static void cleanupPhotoDirectory() {
 }
 
 static int fileDateCompareFunction (const void *one, const void *two) {
-    BufferString *firstDateStr = SUBSTRING_CSTR_BETWEEN(32, ((File *) one)->path, "photo_", ".jpeg");   // extract date-time string
-    BufferString *secondDateStr = SUBSTRING_CSTR_BETWEEN(32, ((File *) two)->path, "photo_", ".jpeg");
-    DateTime firstDateTime = parseToDateTime(stringValue(firstDateStr), &photoFileDateTimeFormatter);
-    DateTime secondDateTime = parseToDateTime(stringValue(secondDateStr), &photoFileDateTimeFormatter);
-    return (int) dateTimeCompare(&firstDateTime, &secondDateTime);
+    // file date format is fixed width with most significant field first, so text order is the date-time order, no parsing required
+    StringView firstDate = stringViewBetween(stringViewOf(((File *) one)->path), "photo_", ".jpeg");
+    StringView secondDate = stringViewBetween(stringViewOf(((File *) two)->path), "photo_", ".jpeg");
+    if (isStringViewEmpty(firstDate) || isStringViewEmpty(secondDate)) {    // names without date, as calibration photo, go to list bottom
+        return (int) isStringViewEmpty(firstDate) - (int) isStringViewEmpty(secondDate);
+    }
+    return (int) stringViewCompare(firstDate, secondDate);
 }
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef ARRAY_SIZE
+    #define ARRAY_SIZE(arr) (sizeof(arr) / sizeof((arr)[0]))
+#endif
+
+#ifndef MIN
+    #define MIN(x, y) (((x)<(y))?(x):(y))
+#endif
+
+#ifndef MAX
+    #define MAX(x, y) (((x)>(y))?(x):(y))
+#endif
+
+// Minimal host test runner: failed assertions are printed with location and counted, test main returns TEST_RESULT()
+
+static uint32_t testFailureCount = 0;
+
+#define TEST_FAIL(...) do {                                     \
+    testFailureCount++;                                         \
+    printf("%s:%d: ", __FILE__, __LINE__);                      \
+    printf(__VA_ARGS__);                                        \
+    printf("\n");                                               \
+} while (0)
+
+#define ASSERT_TRUE(condition) do {                             \
+    if (!(condition)) TEST_FAIL("expected true: %s", #condition); \
+} while (0)
+
+#define ASSERT_FALSE(condition) do {                            \
+    if (condition) TEST_FAIL("expected false: %s", #condition); \
+} while (0)
+
+#define ASSERT_EQ_INT(expected, actual) do {                    \
+    int64_t expectedValue = (int64_t) (expected);               \
+    int64_t actualValue = (int64_t) (actual);                   \
+    if (expectedValue != actualValue) TEST_FAIL("%s: expected %lld, got %lld", #actual, (long long) expectedValue, (long long) actualValue); \
+} while (0)
+
+#define ASSERT_EQ_STR(expected, actual) do {                    \
+    const char *expectedString = (expected);                    \
+    const char *actualString = (actual);                        \
+    if (expectedString == NULL || actualString == NULL || strcmp(expectedString, actualString) != 0) \
+        TEST_FAIL("%s: expected \"%s\", got \"%s\"", #actual, expectedString ? expectedString : "NULL", actualString ? actualString : "NULL"); \
+} while (0)
+
+#define RUN_TEST(test) do {                                     \
+    uint32_t failuresBefore = testFailureCount;                 \
+    test();                                                     \
+    printf("%s %s\n", failuresBefore == testFailureCount ? "[PASS]" : "[FAIL]", #test); \
+} while (0)
+
+#define TEST_RESULT() (testFailureCount == 0 ? 0 : 1)
+
+
+// Benchmarks run full size by default, with "--quick" only smoke iterations are run, as ctest does
+static bool isQuickBench = false;
+static volatile uint64_t benchSink = 0;     // results are added here, so compiler can't drop measured work
+
+static inline void initBench(int argc, char **argv) {
+    isQuickBench = argc > 1 && strcmp(argv[1], "--quick") == 0;
+}
+
+static inline uint32_t benchIterations(uint32_t fullCount) {
+    return isQuickBench ? (fullCount / 1000) + 1 : fullCount;
+}
+
+static inline uint64_t benchNowNanos() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+}
+
+static inline void printBenchResult(const char *name, uint64_t elapsedNanos, uint64_t operations) {
+    printf("%-48s %10.1f ns/op (%llu ops)\n", name, operations > 0 ? (double) elapsedNanos / (double) operations : 0.0, (unsigned long long) operations);
+}
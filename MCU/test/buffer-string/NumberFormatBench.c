@@ -0,0 +1,84 @@
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "BufferString.h"
+
+// Number to text against snprintf: integers, shortest doubles and log-style format line
+
+#define VALUE_COUNT 1024
+
+static uint64_t integers[VALUE_COUNT];
+static double doubles[VALUE_COUNT];
+
+static void benchIntegers() {
+    uint32_t iterations = benchIterations(5000000);
+    char buffer[32];
+    uint64_t start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += uInt64ToDecimalChars(integers[i % VALUE_COUNT], buffer);
+    }
+    printBenchResult("uInt64ToDecimalChars", benchNowNanos() - start, iterations);
+
+    start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long) integers[i % VALUE_COUNT]);
+    }
+    printBenchResult("snprintf %llu", benchNowNanos() - start, iterations);
+}
+
+static void benchDoubles() {
+    uint32_t iterations = benchIterations(2000000);
+    char buffer[32];
+    uint64_t start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += doubleToShortestChars(doubles[i % VALUE_COUNT], buffer);
+    }
+    printBenchResult("doubleToShortestChars", benchNowNanos() - start, iterations);
+
+    start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += snprintf(buffer, sizeof(buffer), "%.17g", doubles[i % VALUE_COUNT]);
+    }
+    printBenchResult("snprintf %.17g", benchNowNanos() - start, iterations);
+}
+
+static void benchLogLine() {
+    uint32_t iterations = benchIterations(2000000);
+    char buffer[128];
+    uint64_t start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        BufferString *line = stringFormat(EMPTY_STRING(128), "[%s] %5u ms battery: %d mV, free heap: %08X, photo: %s",
+                                          "MAIN", i, (int) (integers[i % VALUE_COUNT] % 5000), (unsigned) i * 7919, "photo_2024_01_02_03_04.jpeg");
+        benchSink += line->length;
+    }
+    printBenchResult("stringFormat log line", benchNowNanos() - start, iterations);
+
+    start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        BufferString *line = STRING_FORMAT(128, "[%s] %5u ms battery: %d mV, free heap: %08X, photo: %s",
+                                           "MAIN", i, (int) (integers[i % VALUE_COUNT] % 5000), (unsigned) i * 7919, "photo_2024_01_02_03_04.jpeg");
+        benchSink += line->length;
+    }
+    printBenchResult("STRING_FORMAT log line", benchNowNanos() - start, iterations);
+
+    start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += snprintf(buffer, sizeof(buffer), "[%s] %5u ms battery: %d mV, free heap: %08X, photo: %s",
+                              "MAIN", i, (int) (integers[i % VALUE_COUNT] % 5000), (unsigned) i * 7919, "photo_2024_01_02_03_04.jpeg");
+    }
+    printBenchResult("snprintf log line", benchNowNanos() - start, iterations);
+}
+
+int main(int argc, char **argv) {
+    initBench(argc, argv);
+    srand(33);
+    for (uint32_t i = 0; i < VALUE_COUNT; i++) {
+        integers[i] = (((uint64_t) rand() << 42) ^ ((uint64_t) rand() << 21) ^ (uint64_t) rand()) >> (rand() % 64);
+        doubles[i] = (double) (rand() % 100000) / (1 + rand() % 1000);
+    }
+
+    benchIntegers();
+    benchDoubles();
+    benchLogLine();
+    return 0;
+}
@@ -0,0 +1,188 @@
+#include <stdlib.h>
+#include <math.h>
+
+#include "TestUtils.h"
+#include "BufferString.h"
+
+// NumberFormat digits and stringFormat integer conversions against snprintf, shortest doubles against strtod
+
+static uint64_t randomU64() {   // random bit length, so small and large values are equally covered
+    uint64_t value = ((uint64_t) rand() << 42) ^ ((uint64_t) rand() << 21) ^ (uint64_t) rand();
+    return value >> (rand() % 64);
+}
+
+static void testDecimalChars() {
+    static const uint64_t boundaries[] = {0, 9, 10, 99, 100, 999, 1000, UINT32_MAX, (uint64_t) UINT32_MAX + 1, 9999999999ULL, 10000000000ULL, UINT64_MAX};
+    char expected[32];
+    char actual[UINT64_DECIMAL_MAX_LENGTH + 1];
+    for (uint32_t i = 0; i < ARRAY_SIZE(boundaries); i++) {
+        actual[uInt64ToDecimalChars(boundaries[i], actual)] = '\0';
+        snprintf(expected, sizeof(expected), "%llu", (unsigned long long) boundaries[i]);
+        ASSERT_EQ_STR(expected, actual);
+    }
+
+    srand(33);
+    for (uint32_t round = 0; round < 300000; round++) {
+        uint64_t value = randomU64();
+        actual[uInt64ToDecimalChars(value, actual)] = '\0';
+        snprintf(expected, sizeof(expected), "%llu", (unsigned long long) value);
+        if (strcmp(expected, actual) != 0) {
+            TEST_FAIL("%s: got %s", expected, actual);
+            return;
+        }
+    }
+}
+
+static void testCharsByBase() {
+    char expected[UINT64_BINARY_MAX_LENGTH + 1];
+    char actual[UINT64_BINARY_MAX_LENGTH + 1];
+    srand(133);
+    for (uint32_t round = 0; round < 100000; round++) {
+        uint64_t value = randomU64();
+        actual[uInt64ToCharsByBase(value, actual, 16, true)] = '\0';
+        snprintf(expected, sizeof(expected), "%llx", (unsigned long long) value);
+        ASSERT_EQ_STR(expected, actual);
+        actual[uInt64ToCharsByBase(value, actual, 16, false)] = '\0';
+        snprintf(expected, sizeof(expected), "%llX", (unsigned long long) value);
+        ASSERT_EQ_STR(expected, actual);
+        actual[uInt64ToCharsByBase(value, actual, 8, false)] = '\0';
+        snprintf(expected, sizeof(expected), "%llo", (unsigned long long) value);
+        ASSERT_EQ_STR(expected, actual);
+
+        uint32_t length = 0;
+        for (int32_t bit = 63; bit >= 0; bit--) {
+            if (length > 0 || (value >> bit) & 1 || bit == 0) {
+                expected[length++] = (char) ('0' + ((value >> bit) & 1));
+            }
+        }
+        expected[length] = '\0';
+        actual[uInt64ToCharsByBase(value, actual, 2, false)] = '\0';
+        ASSERT_EQ_STR(expected, actual);
+    }
+}
+
+static void testIntegerSpecsAgainstSnprintf() {    // stringFormat integer conversions follow printf for all flag, width and precision mixes
+    static const char *const lengthFields[] = {"", "l", "ll", "h", "hh"};
+    static const char conversions[] = "diuxXo";
+    static const char flags[] = "-+ 0#";
+    char format[32];
+    char expected[128];
+    srand(233);
+    for (uint32_t round = 0; round < 300000; round++) {
+        char *formatPointer = format;
+        *formatPointer++ = '%';
+        for (uint32_t i = 0; i < strlen(flags); i++) {
+            if (rand() % 4 == 0) *formatPointer++ = flags[i];
+        }
+        if (rand() % 2) formatPointer += sprintf(formatPointer, "%d", rand() % 21);
+        if (rand() % 2) formatPointer += sprintf(formatPointer, ".%d", rand() % 21);
+        const char *lengthField = lengthFields[rand() % ARRAY_SIZE(lengthFields)];
+        sprintf(formatPointer, "%s%c", lengthField, conversions[rand() % (sizeof(conversions) - 1)]);
+
+        int64_t value = rand() % 10 == 0 ? 0 : (int64_t) randomU64();
+        value = rand() % 2 ? -value : value;
+        BufferString *actual;
+        if (lengthField[0] == 'l') {
+            snprintf(expected, sizeof(expected), format, (long long) value);
+            actual = stringFormat(EMPTY_STRING(128), format, (long long) value);
+        } else {
+            snprintf(expected, sizeof(expected), format, (int) value);
+            actual = stringFormat(EMPTY_STRING(128), format, (int) value);
+        }
+        if (actual == NULL || strcmp(expected, actual->value) != 0) {
+            TEST_FAIL("\"%s\" of %lld: got \"%s\", printf \"%s\"", format, (long long) value, actual != NULL ? actual->value : "NULL", expected);
+            return;
+        }
+    }
+    ASSERT_EQ_STR("12:00:05", STRING_FORMAT(16, "%02d:%02d:%02d", 12, 0, 5)->value);
+    ASSERT_EQ_STR("0b101   |", stringFormat(EMPTY_STRING(16), "%-#8b|", 5)->value);
+    ASSERT_EQ_STR("-9223372036854775808", stringFormat(EMPTY_STRING(32), "%I64", INT64_MIN)->value);
+}
+
+static uint32_t significantDigits(const char *number) {
+    uint32_t count = 0;
+    uint32_t trailingZeros = 0;
+    for (; *number != '\0' && *number != 'e'; number++) {
+        if (*number >= '1' && *number <= '9') {
+            count += trailingZeros + 1;
+            trailingZeros = 0;
+        } else if (*number == '0' && count > 0) {
+            trailingZeros++;
+        }
+    }
+    return count;
+}
+
+static uint32_t shortestRoundTripDigits(double value) {
+    char buffer[40];
+    for (uint32_t precision = 1; precision < 17; precision++) {
+        snprintf(buffer, sizeof(buffer), "%.*e", precision - 1, value);
+        if (strtod(buffer, NULL) == value) return precision;
+    }
+    return 17;
+}
+
+static void testShortestDoubleRoundTrip() {
+    char buffer[DOUBLE_SHORTEST_MAX_LENGTH + 1];
+    uint32_t longerThanShortest = 0;
+    uint32_t count = 0;
+    srand(333);
+    for (uint32_t round = 0; round < 200000; round++) {
+        uint64_t bits = ((uint64_t) rand() << 42) ^ ((uint64_t) rand() << 21) ^ (uint64_t) rand();
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        if (round % 2 == 0) value = (double) (rand() % 100000) / (1 + rand() % 1000);   // short decimal values, as sensor readings
+        if (!isfinite(value)) continue;
+
+        uint32_t length = doubleToShortestChars(value, buffer);
+        buffer[length] = '\0';
+        if (length >= DOUBLE_SHORTEST_MAX_LENGTH || strtod(buffer, NULL) != value || signbit(strtod(buffer, NULL)) != signbit(value)) {
+            TEST_FAIL("%.17g written as \"%s\"", value, buffer);
+            return;
+        }
+        longerThanShortest += significantDigits(buffer) > shortestRoundTripDigits(value);
+        count++;
+    }
+    if (longerThanShortest * 200 > count) {  // Grisu2 is not shortest for ~0.1% of values
+        TEST_FAIL("%u of %u values are longer than shortest", longerThanShortest, count);
+    }
+}
+
+static void testShortestDoubleLayout() {
+    static const struct {
+        double value;
+        const char *expected;
+    } cases[] = {
+            {0.0, "0.0"}, {-0.0, "-0.0"}, {1.5, "1.5"}, {100.0, "100.0"}, {0.1, "0.1"},
+            {0.0001, "0.0001"}, {1e-05, "1e-05"}, {-2.5e-07, "-2.5e-07"},
+            {1e15, "1000000000000000.0"}, {1e16, "1e+16"}, {123456789012345678.0, "1.2345678901234568e+17"},
+            {5e-324, "5e-324"}, {1.7976931348623157e308, "1.7976931348623157e+308"},
+            {INFINITY, "inf"}, {-INFINITY, "-inf"}, {NAN, "nan"}
+    };
+    char buffer[DOUBLE_SHORTEST_MAX_LENGTH + 1];
+    for (uint32_t i = 0; i < ARRAY_SIZE(cases); i++) {
+        buffer[doubleToShortestChars(cases[i].value, buffer)] = '\0';
+        ASSERT_EQ_STR(cases[i].expected, buffer);
+    }
+    ASSERT_EQ_STR("x=0.1 y=   2.0|", stringFormat(EMPTY_STRING(32), "x=%D y=%6D|", 0.1, 2.0)->value);
+    ASSERT_EQ_STR("1000000000000000.0", DOUBLE_TO_STRING(1e15)->value);
+}
+
+static void testIntToStringCapacity() {
+    ASSERT_EQ_STR("-9223372036854775808", INT64_TO_STRING(INT64_MIN)->value);
+    ASSERT_EQ_STR("18446744073709551615", UINT64_TO_STRING(UINT64_MAX)->value);
+    BufferString *small = EMPTY_STRING(4);
+    ASSERT_TRUE(int64ToString(small, -12345) == NULL);  // does not fit, nothing written past capacity
+    ASSERT_EQ_INT(0, small->length);
+    ASSERT_EQ_STR("-123", int64ToString(EMPTY_STRING(5), -123)->value);
+}
+
+int main() {
+    RUN_TEST(testDecimalChars);
+    RUN_TEST(testCharsByBase);
+    RUN_TEST(testIntegerSpecsAgainstSnprintf);
+    RUN_TEST(testShortestDoubleRoundTrip);
+    RUN_TEST(testShortestDoubleLayout);
+    RUN_TEST(testIntToStringCapacity);
+    return TEST_RESULT();
+}
@@ -0,0 +1,156 @@
+#include <pthread.h>
+
+#include "TestUtils.h"
+#include "AllocationCounter.h"
+#include "BufferString.h"
+
+// STRING_FORMAT pre-parsed call site specs against runtime parsed stringFormat and snprintf
+
+#define PRINTF_CASES(X)                                         \
+    X("plain %d", -42)                                          \
+    X("%5u|%-5u|%05u", 7u, 8u, 9u)                              \
+    X("%x %X %#x %#o %o", 255u, 255u, 255u, 8u, 0u)             \
+    X("%+d % d %+.3d %-+6d|", 5, 5, 5, -5)                      \
+    X("%hhd %hhu %hd %hu", 300, 300, 70000, 70000)              \
+    X("%ld %lu %lx", -123456789L, 123456789UL, 0xABCDEFUL)      \
+    X("%lld %llu %llX", (long long) INT64_MIN, (unsigned long long) UINT64_MAX, 0x1234ULL)\
+    X("%*d|%-*d|%.*d", 6, 42, 6, 42, 4, 42)                     \
+    X("%s and %.3s and %8s|%-8s|", "full", "cut off", "right", "left") \
+    X("%c%c%5c|%-3c|", 'a', 'b', 'c', 'd')                      \
+    X("[%s] %5u ms battery: %d mV, free heap: %08X", "MAIN", 1234u, 3700, 0xBEEFu) \
+    X("%02d:%02d:%02d", 9, 0, 5)                                \
+    X("%%d is literal, %d is not", 1)                           \
+    X("%.0d|%3.0d|%-3.0d|", 0, 0, 0)                            \
+    X("trailing %s", "arg")
+
+#define EXTENSION_CASES(X)                                      \
+    X("name|    name|name    |na", "%S|%8S|%-8S|%.2S", view, view, view, view) \
+    X("-1 255 -1 65535", "%I8 %U8 %I16 %U16", -1, 255, -1, 65535) \
+    X("-2147483648 4294967295 -9223372036854775808 18446744073709551615", "%I32 %U32 %I64 %U64", INT32_MIN, UINT32_MAX, INT64_MIN, UINT64_MAX) \
+    X("101 0b101 00000101", "%b %#b %08b", 5u, 5u, 5u)        \
+    X("0.1 1000000000000000.0 1e+16    2.0|", "%D %D %D %6D|", 0.1, 1e15, 1e16, 2.0) \
+    X("line\nnext 1", "line%nnext %d", 1)
+
+static void testPrintfCases() {
+    char expected[256];
+#define CHECK_PRINTF_CASE(FORMAT, args...) {                                                \
+        snprintf(expected, sizeof(expected), FORMAT, args);                                 \
+        for (uint32_t call = 0; call < 2; call++) {     /* first call builds spec, second reuses it */ \
+            BufferString *specResult = STRING_FORMAT(256, FORMAT, args);                    \
+            BufferString *runtimeResult = stringFormat(EMPTY_STRING(256), FORMAT, args);    \
+            ASSERT_TRUE(specResult != NULL && runtimeResult != NULL);                        \
+            if (specResult == NULL || runtimeResult == NULL) break;                          \
+            ASSERT_EQ_STR(expected, specResult->value);                                     \
+            ASSERT_EQ_STR(expected, runtimeResult->value);                                  \
+        }                                                                                   \
+    }
+    PRINTF_CASES(CHECK_PRINTF_CASE)
+#undef CHECK_PRINTF_CASE
+}
+
+static void testExtensionCases() {
+    BufferString *view = NEW_STRING(16, "name");
+#define CHECK_EXTENSION_CASE(EXPECTED, FORMAT, args...) {                                   \
+        BufferString *specResult = STRING_FORMAT(256, FORMAT, args);                        \
+        BufferString *runtimeResult = stringFormat(EMPTY_STRING(256), FORMAT, args);        \
+        ASSERT_TRUE(specResult != NULL && runtimeResult != NULL);                            \
+        if (specResult != NULL && runtimeResult != NULL) {                                   \
+            ASSERT_EQ_STR(EXPECTED, specResult->value);                                     \
+            ASSERT_EQ_STR(EXPECTED, runtimeResult->value);                                  \
+        }                                                                                   \
+    }
+    EXTENSION_CASES(CHECK_EXTENSION_CASE)
+#undef CHECK_EXTENSION_CASE
+}
+
+static void testMismatchedArgumentsFallBackToParsing() {
+    BufferString *name = NEW_STRING(16, "name");
+    const char *chars = "name";
+    void *pointer = (void *) chars;
+    ASSERT_EQ_STR("config name", STRING_FORMAT(32, "config %s", chars)->value);
+    ASSERT_EQ_STR("config name", STRING_FORMAT(32, "config %s", pointer)->value);  // void * is taken for %s and %S
+    ASSERT_EQ_STR("config name", STRING_FORMAT(32, "config %S", (void *) name)->value);
+    ASSERT_EQ_STR("42", STRING_FORMAT(32, "%d", 42, 43)->value);   // extra arguments are ignored, as in printf
+    ASSERT_TRUE(STRING_FORMAT(32, "%p", name) != NULL);             // any pointer goes to %p
+    ASSERT_TRUE(STRING_FORMAT(8, "%s", "longer than capacity") == NULL);
+
+    for (uint32_t call = 0; call < 3; call++) {     // rejected spec keeps formatting by parsing on later calls
+        ASSERT_EQ_STR("42 ff   42", STRING_FORMAT(32, "%d %x %*d", 42LL, 255LL, 4LL, 42)->value);
+    }
+
+    StringFormatSpec *spec = STRING_FORMAT_SPEC("%d", 42LL);
+    ASSERT_TRUE(stringFormatBySpec(EMPTY_STRING(8), spec, 42LL) != NULL);
+    ASSERT_FALSE(atomic_load(&spec->ops)->isArgsMatch);
+    spec = STRING_FORMAT_SPEC("%s", NULL);
+    ASSERT_TRUE(stringFormatBySpec(EMPTY_STRING(8), spec, NULL) == NULL);   // NULL value fails formatting like in stringFormat()
+    ASSERT_TRUE(stringFormat(EMPTY_STRING(8), "%s", NULL) == NULL);
+    ASSERT_TRUE(atomic_load(&spec->ops)->isArgsMatch);
+}
+
+static void testFallBackToParsingWhenOutOfMemory() {
+    for (uint32_t call = 0; call < 2; call++) {     // first call can't allocate ops, second one builds them
+        if (call == 0) failAllocationsAfter(0);
+        BufferString *result = STRING_FORMAT(32, "out of memory %d %s", 7, "ok");
+        resetAllocationCounts();
+        ASSERT_TRUE(result != NULL);
+        if (result != NULL) ASSERT_EQ_STR("out of memory 7 ok", result->value);
+    }
+}
+
+#define THREAD_COUNT 4
+#define RACE_ROUNDS 200
+
+static StringFormatSpec raceSpec;
+static pthread_barrier_t roundStart;
+static pthread_barrier_t roundEnd;
+
+static void *formatFromSameCallSite(void *arg) {
+    uintptr_t mismatches = 0;
+    for (int32_t i = 0; i < RACE_ROUNDS; i++) {
+        pthread_barrier_wait(&roundStart);
+        BufferString *result = stringFormatBySpec(EMPTY_STRING(64), &raceSpec, (int) (uintptr_t) arg, i);
+        char expected[64];
+        snprintf(expected, sizeof(expected), "thread %d call %04d", (int) (uintptr_t) arg, i);
+        mismatches += result == NULL || strcmp(result->value, expected) != 0;
+        pthread_barrier_wait(&roundEnd);
+    }
+    return (void *) mismatches;
+}
+
+static void testConcurrentFirstCall() {     // every round threads race to build the same fresh spec, one published block wins
+    static const uint8_t argTypes[] = {FORMAT_ARG_INT32, FORMAT_ARG_INT32};
+    pthread_barrier_init(&roundStart, NULL, THREAD_COUNT + 1);
+    pthread_barrier_init(&roundEnd, NULL, THREAD_COUNT + 1);
+    pthread_t threads[THREAD_COUNT];
+    for (uintptr_t i = 0; i < THREAD_COUNT; i++) {
+        pthread_create(&threads[i], NULL, formatFromSameCallSite, (void *) i);
+    }
+
+    uint32_t invalidRounds = 0;
+    for (int32_t i = 0; i < RACE_ROUNDS; i++) {
+        raceSpec = (StringFormatSpec) {.format = "thread %d call %04d", .argTypes = argTypes, .argCount = ARRAY_SIZE(argTypes)};
+        pthread_barrier_wait(&roundStart);
+        pthread_barrier_wait(&roundEnd);
+        StringFormatOps *ops = atomic_load(&raceSpec.ops);
+        invalidRounds += ops == NULL || ops->count != 2 || !ops->isArgsMatch;
+        free(ops);
+    }
+    ASSERT_EQ_INT(0, invalidRounds);
+
+    for (uint32_t i = 0; i < THREAD_COUNT; i++) {
+        void *mismatches;
+        pthread_join(threads[i], &mismatches);
+        ASSERT_EQ_INT(0, (uintptr_t) mismatches);
+    }
+    pthread_barrier_destroy(&roundStart);
+    pthread_barrier_destroy(&roundEnd);
+}
+
+int main() {
+    RUN_TEST(testPrintfCases);
+    RUN_TEST(testExtensionCases);
+    RUN_TEST(testMismatchedArgumentsFallBackToParsing);
+    RUN_TEST(testFallBackToParsingWhenOutOfMemory);
+    RUN_TEST(testConcurrentFirstCall);
+    return TEST_RESULT();
+}
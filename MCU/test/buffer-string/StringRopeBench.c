@@ -0,0 +1,107 @@
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "StringRope.h"
+#include "JSON.h"
+
+// Directory listing JSON: worst-case buffer (128 files * 255 path + 4 KB) against rope, and rope appends against realloc doubling
+
+#define LISTING_FILES 128
+#define WORST_CASE_BUFFER_SIZE (LISTING_FILES * 255 + 4096)
+
+static char listingPaths[LISTING_FILES][64];
+
+static bool countChunk(void *context, const char *value, uint32_t length) {
+    *(uint32_t *) context += length + (uint8_t) value[0];
+    return true;
+}
+
+static void ropeWriter(void *rope, const char *value, uint32_t length) {
+    ropeConcatCharsByLength(rope, value, length);
+}
+
+static void benchListing() {
+    JSONTokener jsonTokener = createEmptyJSONTokener();
+    JSONObject rootObject = createJsonObject(&jsonTokener);
+    JSONArray contentArray = createJsonArray(&jsonTokener);
+    for (uint32_t i = 0; i < LISTING_FILES; i++) {
+        snprintf(listingPaths[i], sizeof(listingPaths[i]), "/sdcard/photo/photo_2024_01_%02u_%02u_%02u.jpeg", 1 + i % 28, i % 24, i % 60);
+        JSONObject itemObject = createJsonObject(&jsonTokener);
+        jsonObjectPut(&itemObject, "type", "file");
+        jsonObjectPut(&itemObject, "path", listingPaths[i]);
+        jsonArrayAddObject(&contentArray, &itemObject);
+    }
+    jsonObjectAddArray(&rootObject, "content", &contentArray);
+
+    uint32_t iterations = benchIterations(5000);
+    uint64_t start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        char *buffer = calloc(WORST_CASE_BUFFER_SIZE, sizeof(char));
+        jsonObjectToString(&rootObject, buffer, WORST_CASE_BUFFER_SIZE);
+        benchSink += strlen(buffer);
+        free(buffer);
+    }
+    printBenchResult("listing to worst-case buffer", benchNowNanos() - start, iterations);
+
+    uint32_t ropeLength = 0;
+    start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        StringRope rope = EMPTY_STRING_ROPE(STRING_ROPE_DEFAULT_CHUNK_SIZE);
+        jsonObjectWriteTo(&rootObject, ropeWriter, &rope);
+        uint32_t sent = 0;
+        ropeForEachChunk(&rope, countChunk, &sent);
+        benchSink += sent;
+        ropeLength = rope.length;
+        clearStringRope(&rope);
+    }
+    printBenchResult("listing to rope", benchNowNanos() - start, iterations);
+    printf("%-48s %10u B worst-case buffer, %u B in rope chunks\n", "listing memory", WORST_CASE_BUFFER_SIZE,
+           ((ropeLength + STRING_ROPE_DEFAULT_CHUNK_SIZE - 1) / STRING_ROPE_DEFAULT_CHUNK_SIZE) * STRING_ROPE_DEFAULT_CHUNK_SIZE);
+    deleteJSONObject(&rootObject);
+}
+
+static void benchAppends(uint32_t totalLength) {
+    static const char piece[] = "{\"path\":\"/sdcard/photo/photo_2024_01_02_03_04.jpeg\",\"type\":\"file\"},";
+    uint32_t pieceLength = sizeof(piece) - 1;
+    uint32_t iterations = benchIterations(50000000 / totalLength + 10);
+    char name[64];
+
+    uint64_t start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        StringRope rope = EMPTY_STRING_ROPE(STRING_ROPE_DEFAULT_CHUNK_SIZE);
+        while (rope.length < totalLength) {
+            ropeConcatCharsByLength(&rope, piece, pieceLength);
+        }
+        benchSink += rope.length;
+        clearStringRope(&rope);
+    }
+    snprintf(name, sizeof(name), "rope append %u KB", totalLength / 1024);
+    printBenchResult(name, benchNowNanos() - start, iterations);
+
+    start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        uint32_t capacity = 64;
+        uint32_t length = 0;
+        char *buffer = malloc(capacity);
+        while (length < totalLength) {
+            if (length + pieceLength > capacity) {
+                capacity *= 2;
+                buffer = realloc(buffer, capacity);
+            }
+            memcpy(buffer + length, piece, pieceLength);
+            length += pieceLength;
+        }
+        benchSink += length + (uint8_t) buffer[0];
+        free(buffer);
+    }
+    snprintf(name, sizeof(name), "realloc doubling append %u KB", totalLength / 1024);
+    printBenchResult(name, benchNowNanos() - start, iterations);
+}
+
+int main(int argc, char **argv) {
+    initBench(argc, argv);
+    benchListing();
+    benchAppends(16 * 1024);
+    benchAppends(256 * 1024);
+    return 0;
+}
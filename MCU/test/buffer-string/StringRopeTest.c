@@ -0,0 +1,198 @@
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "StringRope.h"
+#include "JSON.h"
+#include "AllocationCounter.h"
+
+// StringRope content against flat reference buffer, and JSON streamed to rope against jsonObjectToString
+
+#define REFERENCE_CAPACITY 200000
+
+static char reference[REFERENCE_CAPACITY];
+static char collected[REFERENCE_CAPACITY];
+
+typedef struct ChunkCollector {
+    uint32_t length;
+    uint32_t chunkCount;
+    uint32_t maxChunkLength;
+    uint32_t stopAfterChunks;
+} ChunkCollector;
+
+static bool collectChunk(void *context, const char *value, uint32_t length) {
+    ChunkCollector *collector = context;
+    memcpy(collected + collector->length, value, length);
+    collector->length += length;
+    collector->chunkCount++;
+    collector->maxChunkLength = length > collector->maxChunkLength ? length : collector->maxChunkLength;
+    return collector->chunkCount != collector->stopAfterChunks;
+}
+
+static void ropeWriter(void *rope, const char *value, uint32_t length) {   // same adapter as directory listing handler
+    ropeConcatCharsByLength(rope, value, length);
+}
+
+static void testRandomAppends() {
+    static const uint32_t chunkSizes[] = {1, 7, 64, STRING_ROPE_DEFAULT_CHUNK_SIZE};
+    srand(35);
+    for (uint32_t sizeIndex = 0; sizeIndex < ARRAY_SIZE(chunkSizes); sizeIndex++) {
+        StringRope rope = EMPTY_STRING_ROPE(chunkSizes[sizeIndex]);
+        uint32_t referenceLength = 0;
+        while (referenceLength < REFERENCE_CAPACITY - 5000) {
+            char piece[4096];
+            uint32_t pieceLength = rand() % 3 == 0 ? rand() % sizeof(piece) : rand() % 40;
+            for (uint32_t i = 0; i < pieceLength; i++) {
+                piece[i] = (char) ('a' + rand() % 26);
+            }
+            piece[pieceLength] = '\0';
+
+            switch (rand() % 4) {
+                case 0:
+                    ASSERT_TRUE(ropeConcatCharsByLength(&rope, piece, pieceLength) == &rope);
+                    break;
+                case 1:
+                    ASSERT_TRUE(ropeConcatChars(&rope, piece) == &rope);
+                    break;
+                case 2:
+                    pieceLength = 1;
+                    ASSERT_TRUE(ropeConcatChar(&rope, piece[0]) == &rope);
+                    break;
+                default:
+                    pieceLength = pieceLength < 63 ? pieceLength : 63;
+                    ASSERT_TRUE(ropeConcatString(&rope, NEW_STRING_LEN(64, piece, pieceLength)) == &rope);
+                    break;
+            }
+            memcpy(reference + referenceLength, piece, pieceLength);
+            referenceLength += pieceLength;
+        }
+
+        ChunkCollector collector = {0};
+        ASSERT_TRUE(ropeForEachChunk(&rope, collectChunk, &collector));
+        ASSERT_EQ_INT(referenceLength, rope.length);
+        ASSERT_EQ_INT(referenceLength, collector.length);
+        ASSERT_TRUE(memcmp(reference, collected, referenceLength) == 0);
+        ASSERT_EQ_INT(rope.chunkCount, collector.chunkCount);
+        ASSERT_EQ_INT((referenceLength + chunkSizes[sizeIndex] - 1) / chunkSizes[sizeIndex], rope.chunkCount);  // only last chunk is partial
+        ASSERT_TRUE(collector.maxChunkLength <= chunkSizes[sizeIndex]);
+        clearStringRope(&rope);
+        ASSERT_TRUE(isStringRopeEmpty(&rope));
+    }
+}
+
+static void testWrittenBytesNeverMove() {
+    StringRope *rope = newStringRope(16);
+    ropeConcatChars(rope, "first chunk text");
+    const char *firstChunk = rope->head->value;
+    for (uint32_t i = 0; i < 1000; i++) {
+        ropeConcatChars(rope, "more text that fills later chunks");
+    }
+    ASSERT_TRUE(rope->head->value == firstChunk);
+    ASSERT_TRUE(memcmp(firstChunk, "first chunk text", 16) == 0);
+    deleteStringRope(rope);
+}
+
+static void testConsumerStop() {
+    StringRope rope = EMPTY_STRING_ROPE(4);
+    ropeConcatChars(&rope, "0123456789abcdef");
+    ChunkCollector collector = {.stopAfterChunks = 2};  // e.g. socket send failed
+    ASSERT_FALSE(ropeForEachChunk(&rope, collectChunk, &collector));
+    ASSERT_EQ_INT(2, collector.chunkCount);
+    ASSERT_EQ_INT(8, collector.length);
+    clearStringRope(&rope);
+}
+
+static void testOutOfMemory() {
+    resetAllocationCounts();
+    StringRope rope = EMPTY_STRING_ROPE(8);
+    failAllocationsAfter(2);
+    ASSERT_TRUE(ropeConcatChars(&rope, "0123456789abcdef") == &rope);
+    ASSERT_TRUE(ropeConcatChars(&rope, "more") == NULL);
+    ASSERT_TRUE(rope.isOutOfMemory);
+    ASSERT_EQ_INT(16, rope.length);
+    failAllocationsAfter(UINT32_MAX);
+    ASSERT_TRUE(ropeConcatChars(&rope, "more") == NULL);   // stays failed, content would have a hole otherwise
+
+    ChunkCollector collector = {0};
+    ASSERT_FALSE(ropeForEachChunk(&rope, collectChunk, &collector));
+    ASSERT_EQ_INT(16, collector.length);
+
+    clearStringRope(&rope);
+    ASSERT_FALSE(rope.isOutOfMemory);
+    ASSERT_EQ_INT(getAllocationCounts().allocations, getAllocationCounts().frees);
+    ASSERT_TRUE(ropeConcatChars(&rope, "reused") == &rope);
+    clearStringRope(&rope);
+    ASSERT_EQ_INT(getAllocationCounts().allocations, getAllocationCounts().frees);
+}
+
+#define MAX_LISTING_FILES 2000
+
+static char listingPaths[MAX_LISTING_FILES][64];    // json keeps value pointers, as handler keeps its file buffer
+
+static void buildDirectoryListing(JSONTokener *jsonTokener, JSONObject *rootObject, uint32_t fileCount) {  // same shape as admin directory handler
+    *rootObject = createJsonObject(jsonTokener);
+    JSONArray contentArray = createJsonArray(jsonTokener);
+    for (uint32_t i = 0; i < fileCount; i++) {
+        snprintf(listingPaths[i], sizeof(listingPaths[i]), "/sdcard/photo/photo_2024_01_%02u_%02u_%02u.jpeg", 1 + i % 28, i % 24, i % 60);
+        JSONObject itemObject = createJsonObject(jsonTokener);
+        jsonObjectPut(&itemObject, "type", i % 10 == 0 ? "dir" : "file");
+        jsonObjectPut(&itemObject, "path", listingPaths[i]);
+        jsonArrayAddObject(&contentArray, &itemObject);
+    }
+    jsonObjectAddArray(rootObject, "content", &contentArray);
+}
+
+static void testJsonWriteToRope() {
+    static const uint32_t fileCounts[] = {0, 1, 10, MAX_LISTING_FILES};
+    for (uint32_t i = 0; i < ARRAY_SIZE(fileCounts); i++) {
+        JSONTokener jsonTokener = createEmptyJSONTokener();
+        JSONObject rootObject;
+        buildDirectoryListing(&jsonTokener, &rootObject, fileCounts[i]);
+
+        jsonObjectToString(&rootObject, reference, sizeof(reference));
+        StringRope rope = EMPTY_STRING_ROPE(STRING_ROPE_DEFAULT_CHUNK_SIZE);
+        jsonObjectWriteTo(&rootObject, ropeWriter, &rope);
+        ChunkCollector collector = {0};
+        ASSERT_TRUE(ropeForEachChunk(&rope, collectChunk, &collector));
+        ASSERT_EQ_INT(strlen(reference), collector.length);
+        ASSERT_TRUE(memcmp(reference, collected, collector.length) == 0);
+
+        JSONArray contentArray = getJSONArrayFromObject(&rootObject, "content");
+        jsonArrayToString(&contentArray, reference, sizeof(reference));
+        clearStringRope(&rope);
+        jsonArrayWriteTo(&contentArray, ropeWriter, &rope);
+        collector = (ChunkCollector) {0};
+        ASSERT_TRUE(ropeForEachChunk(&rope, collectChunk, &collector));
+        ASSERT_EQ_INT(strlen(reference), collector.length);
+        ASSERT_TRUE(memcmp(reference, collected, collector.length) == 0);
+
+        clearStringRope(&rope);
+        deleteJSONObject(&rootObject);
+    }
+}
+
+static void testParsedJsonWriteToRope() {
+    char jsonText[] = "{\"name\": \"camera\", \"values\": [1, 2.5, -3, true, null, \"a\\\"b\"], \"nested\": {\"empty\": {}, \"list\": []}}";
+    JSONTokener jsonTokener = getJSONTokener(jsonText, strlen(jsonText));
+    JSONObject rootObject = jsonObjectParse(&jsonTokener);
+    ASSERT_TRUE(isJsonObjectOk(&rootObject));
+
+    jsonObjectToString(&rootObject, reference, sizeof(reference));
+    StringRope rope = EMPTY_STRING_ROPE(3);
+    jsonObjectWriteTo(&rootObject, ropeWriter, &rope);
+    ChunkCollector collector = {0};
+    ASSERT_TRUE(ropeForEachChunk(&rope, collectChunk, &collector));
+    ASSERT_EQ_INT(strlen(reference), collector.length);
+    ASSERT_TRUE(memcmp(reference, collected, collector.length) == 0);
+    clearStringRope(&rope);
+    deleteJSONObject(&rootObject);
+}
+
+int main() {
+    RUN_TEST(testRandomAppends);
+    RUN_TEST(testWrittenBytesNeverMove);
+    RUN_TEST(testConsumerStop);
+    RUN_TEST(testOutOfMemory);
+    RUN_TEST(testJsonWriteToRope);
+    RUN_TEST(testParsedJsonWriteToRope);
+    return TEST_RESULT();
+}
@@ -0,0 +1,86 @@
+#define _GNU_SOURCE     // memmem
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "StringSearch.h"
+
+// Search primitives against libc memchr/memmem/strstr, text like http headers and templates for 64 B - 16 KB
+
+#define MAX_TEXT_LENGTH 16384
+
+static char text[MAX_TEXT_LENGTH + 1];
+
+static void benchFindChar(uint32_t length) {
+    uint32_t iterations = benchIterations(200000000 / length + 1000);
+    char name[64];
+
+    uint64_t start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += (uintptr_t) findCharInRange(text + (i & 7), length, '#');
+    }
+    snprintf(name, sizeof(name), "findCharInRange %u B", length);
+    printBenchResult(name, benchNowNanos() - start, iterations);
+
+    start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += (uintptr_t) memchr(text + (i & 7), '#', length);
+    }
+    snprintf(name, sizeof(name), "memchr %u B", length);
+    printBenchResult(name, benchNowNanos() - start, iterations);
+}
+
+static void benchFindStr(uint32_t length, const char *needle) {
+    uint32_t needleLength = strlen(needle);
+    uint32_t iterations = benchIterations(100000000 / length + 1000);
+    char name[64];
+
+    char saved = text[length];
+    text[length] = '\0';    // strstr needs terminated text
+    uint64_t start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += (uintptr_t) findStrInRange(text, length, needle, needleLength);
+    }
+    snprintf(name, sizeof(name), "findStrInRange %u B, needle %u", length, needleLength);
+    printBenchResult(name, benchNowNanos() - start, iterations);
+
+    start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += (uintptr_t) memmem(text, length, needle, needleLength);
+    }
+    snprintf(name, sizeof(name), "memmem %u B, needle %u", length, needleLength);
+    printBenchResult(name, benchNowNanos() - start, iterations);
+
+    start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += (uintptr_t) strstr(text, needle);
+    }
+    snprintf(name, sizeof(name), "strstr %u B, needle %u", length, needleLength);
+    printBenchResult(name, benchNowNanos() - start, iterations);
+    text[length] = saved;
+}
+
+int main(int argc, char **argv) {
+    initBench(argc, argv);
+#if defined(__AVX2__)
+    if (!__builtin_cpu_supports("avx2")) {
+        printf("AVX2 not supported by this CPU, skipped\n");
+        return 0;
+    }
+#endif
+    static const char WORDS[][12] = {"<div ", "class=", "\"row\"", "${name}", "</div>", "<csp:if ", "Content-", "Length: ", "\r\n"};
+    srand(31);
+    for (uint32_t length = 0; length < MAX_TEXT_LENGTH;) {    // searched char and strings are absent, whole text is scanned
+        const char *word = WORDS[rand() % ARRAY_SIZE(WORDS)];
+        for (uint32_t i = 0; word[i] != '\0' && length < MAX_TEXT_LENGTH; i++) text[length++] = word[i];
+    }
+
+    static const uint32_t lengths[] = {64, 1024, MAX_TEXT_LENGTH};
+    for (uint32_t i = 0; i < ARRAY_SIZE(lengths); i++) {
+        benchFindChar(lengths[i] - 8);
+    }
+    for (uint32_t i = 0; i < ARRAY_SIZE(lengths); i++) {
+        benchFindStr(lengths[i], "</csp:");
+        benchFindStr(lengths[i], "Content-Type: ");
+    }
+    return 0;
+}
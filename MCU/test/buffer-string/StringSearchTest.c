@@ -0,0 +1,209 @@
+#define _GNU_SOURCE     // memmem
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "BufferString.h"
+
+// Search primitives against memchr/memmem on random inputs at every alignment, then BufferString methods built on them
+// against strstr based reference. Same source is built for SWAR only and AVX2 variants, see CMakeLists.txt
+
+#define MAX_HAYSTACK_LENGTH 700
+#define RANDOM_ROUNDS 300000
+
+static char randomChar(uint32_t alphabetSize) {
+    return (char) ('a' + rand() % alphabetSize);
+}
+
+static void fillRandom(char *buffer, uint32_t length, uint32_t alphabetSize) {
+    for (uint32_t i = 0; i < length; i++) {
+        buffer[i] = randomChar(alphabetSize);
+    }
+}
+
+static void testFindCharAgainstMemchr() {
+    static char buffer[MAX_HAYSTACK_LENGTH + 64];
+    srand(31);
+    for (uint32_t round = 0; round < RANDOM_ROUNDS; round++) {
+        uint32_t offset = rand() % 64;
+        uint32_t length = rand() % (round % 8 == 0 ? MAX_HAYSTACK_LENGTH : 80);
+        char *haystack = buffer + offset;
+        fillRandom(haystack, length, 2 + rand() % 40);
+        if (length > 0 && rand() % 4 == 0) haystack[rand() % length] = (char) (rand() % 256);   // high and zero bytes
+        char charToFind = rand() % 8 == 0 ? (char) (rand() % 256) : randomChar(26);
+
+        const char *expected = memchr(haystack, charToFind, length);
+        const char *actual = findCharInRange(haystack, length, charToFind);
+        if (expected != actual) {
+            TEST_FAIL("offset %u, length %u, char 0x%02x: expected index %ld, got %ld", offset, length, (uint8_t) charToFind,
+                      expected ? (long) (expected - haystack) : -1L, actual ? (long) (actual - haystack) : -1L);
+            return;
+        }
+    }
+    ASSERT_TRUE(findCharInRange(NULL, 10, 'a') == NULL);
+    ASSERT_TRUE(findCharInRange("abc", 0, 'a') == NULL);
+}
+
+static void testFindCharDoesNotReadPastLength() {
+    char text[] = "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxy";
+    for (uint32_t length = 0; length < sizeof(text) - 1; length++) {
+        if (findCharInRange(text, length, 'y') != NULL) {
+            TEST_FAIL("char past length %u found", length);
+            return;
+        }
+    }
+}
+
+static void testFindStrAgainstMemmem() {
+    static char buffer[MAX_HAYSTACK_LENGTH + 64];
+    static char needle[300];
+    srand(131);
+    for (uint32_t round = 0; round < RANDOM_ROUNDS; round++) {
+        uint32_t offset = rand() % 64;
+        uint32_t length = rand() % (round % 4 == 0 ? MAX_HAYSTACK_LENGTH : 100);
+        uint32_t alphabetSize = 1 + rand() % 6;     // small alphabets give many partial matches
+        char *haystack = buffer + offset;
+        fillRandom(haystack, length, alphabetSize);
+
+        uint32_t needleLength;
+        uint32_t kind = rand() % 8;
+        if (kind < 4 && length > 0) {    // substring of haystack, maybe mutated
+            needleLength = 1 + rand() % MIN(length, kind == 0 ? 299 : 24);
+            memcpy(needle, haystack + rand() % (length - needleLength + 1), needleLength);
+            if (kind == 1) needle[rand() % needleLength] = randomChar(alphabetSize + 1);
+        } else {
+            needleLength = rand() % (kind == 7 ? 299 : 16);
+            fillRandom(needle, needleLength, alphabetSize);
+        }
+
+        const char *expected = memmem(haystack, length, needle, needleLength);
+        const char *actual = findStrInRange(haystack, length, needle, needleLength);
+        if (expected != actual) {
+            TEST_FAIL("offset %u, length %u, needle length %u: expected index %ld, got %ld", offset, length, needleLength,
+                      expected ? (long) (expected - haystack) : -1L, actual ? (long) (actual - haystack) : -1L);
+            return;
+        }
+    }
+}
+
+static void testFindStrLongNeedleShiftCap() {    // Horspool shifts are capped to uint8_t, needles longer than 255
+    static char haystack[2000];
+    static char needle[400];
+    memset(haystack, 'a', sizeof(haystack));
+    memset(needle, 'a', sizeof(needle));
+    needle[0] = 'b';
+    haystack[1500] = 'b';
+    ASSERT_TRUE(findStrInRange(haystack, sizeof(haystack), needle, sizeof(needle)) == haystack + 1500);
+    haystack[1500 + 399] = 'c';
+    ASSERT_TRUE(findStrInRange(haystack, sizeof(haystack), needle, sizeof(needle)) == NULL);
+}
+
+static int32_t referenceIndexOf(const char *text, const char *toFind, uint32_t fromIndex) {
+    if (fromIndex >= strlen(text)) return -1;
+    const char *found = strstr(text + fromIndex, toFind);
+    return found != NULL ? (int32_t) (found - text) : -1;
+}
+
+static bool referenceReplaceAll(char *text, uint32_t capacity, const char *target, const char *replacement) {  // rescans from start, as before
+    uint32_t targetLength = strlen(target);
+    uint32_t replacementLength = strlen(replacement);
+    char *found;
+    while ((found = strstr(text, target)) != NULL) {
+        if (strlen(text) - targetLength + replacementLength >= capacity) return false;  // replacements keep making new occurrences
+        memmove(found + replacementLength, found + targetLength, strlen(found + targetLength) + 1);
+        memcpy(found, replacement, replacementLength);
+    }
+    return true;
+}
+
+static void testBufferStringSearchMethods() {
+    char text[128];
+    char toFind[8];
+    srand(231);
+    for (uint32_t round = 0; round < 50000; round++) {
+        uint32_t length = rand() % 100;
+        uint32_t alphabetSize = 2 + rand() % 3;
+        fillRandom(text, length, alphabetSize);
+        text[length] = '\0';
+        uint32_t findLength = 1 + rand() % 5;
+        fillRandom(toFind, findLength, alphabetSize);
+        toFind[findLength] = '\0';
+        uint32_t fromIndex = rand() % (length + 2);
+
+        BufferString *str = NEW_STRING(128, text);
+        int32_t expected = referenceIndexOf(text, toFind, fromIndex);
+        if (indexOfString(str, toFind, fromIndex) != expected || indexOfCStr(text, toFind, fromIndex) != expected) {
+            TEST_FAIL("indexOf(\"%s\", \"%s\", %u): expected %d", text, toFind, fromIndex, expected);
+            return;
+        }
+        const char *charFound = fromIndex < length ? strchr(text + fromIndex, toFind[0]) : NULL;
+        ASSERT_EQ_INT(charFound != NULL ? charFound - text : -1, indexOfChar(str, toFind[0], fromIndex));
+        ASSERT_EQ_INT(strstr(text, toFind) != NULL, containsStr(str, toFind));
+        ASSERT_EQ_INT(length >= findLength && strcmp(text + length - findLength, toFind) == 0, isStrEndsWith(str, toFind));
+        ASSERT_EQ_INT(length >= findLength && strncmp(text, toFind, findLength) == 0, isStrStartsWith(str, toFind, 0));
+    }
+}
+
+static void testReplaceAllAgainstRescan() {
+    char text[256];
+    char expected[256];
+    char target[6];
+    char replacement[6];
+    srand(331);
+    for (uint32_t round = 0; round < 50000; round++) {
+        uint32_t length = rand() % 60;
+        fillRandom(text, length, 3);
+        text[length] = '\0';
+        uint32_t targetLength = 1 + rand() % 4;
+        fillRandom(target, targetLength, 3);
+        target[targetLength] = '\0';
+        uint32_t replacementLength = rand() % 5;
+        fillRandom(replacement, replacementLength, 3);
+        replacement[replacementLength] = '\0';
+        if (strstr(replacement, target) != NULL) continue;    // would never terminate
+
+        strcpy(expected, text);
+        if (!referenceReplaceAll(expected, sizeof(expected), target, replacement)) continue;
+
+        BufferString *str = NEW_STRING(256, text);
+        replaceAllOccurrences(str, target, replacement);
+        if (strcmp(str->value, expected) != 0 || str->length != strlen(expected)) {
+            TEST_FAIL("replaceAll(\"%s\", \"%s\", \"%s\"): expected \"%s\", got \"%s\"", text, target, replacement, expected, str->value);
+            return;
+        }
+    }
+
+    BufferString *path = NEW_STRING(32, "a///b");
+    ASSERT_EQ_STR("a/b", replaceAllOccurrences(path, "//", "/")->value);
+    BufferString *same = NEW_STRING(32, "abab");
+    ASSERT_EQ_STR("abab", replaceAllOccurrences(same, "ab", "ab")->value);
+}
+
+static void testSplitIterator() {
+    BufferString *str = NEW_STRING(64, "one, two,, three, four");
+    StringIterator iterator = getStringSplitIterator(str, ", ");
+    BufferString *token = EMPTY_STRING(32);
+    const char *expected[] = {"one", "two,", "three", "four"};
+    uint32_t count = 0;
+    while (hasNextSplitToken(&iterator, token)) {
+        if (count < ARRAY_SIZE(expected)) ASSERT_EQ_STR(expected[count], token->value);
+        count++;
+    }
+    ASSERT_EQ_INT(4, count);
+}
+
+int main() {
+#if defined(__AVX2__)
+    if (!__builtin_cpu_supports("avx2")) {
+        printf("AVX2 not supported by this CPU, skipped\n");
+        return 0;
+    }
+#endif
+    RUN_TEST(testFindCharAgainstMemchr);
+    RUN_TEST(testFindCharDoesNotReadPastLength);
+    RUN_TEST(testFindStrAgainstMemmem);
+    RUN_TEST(testFindStrLongNeedleShiftCap);
+    RUN_TEST(testBufferStringSearchMethods);
+    RUN_TEST(testReplaceAllAgainstRescan);
+    RUN_TEST(testSplitIterator);
+    return TEST_RESULT();
+}
@@ -0,0 +1,56 @@
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "StringView.h"
+#include "GlobalDateTime.h"
+
+// Photo cleanup sort: name slice compare against substring copy and date-time parse per comparison, 1000 photos
+
+#define PHOTO_COUNT 1000
+
+static char photoPaths[PHOTO_COUNT][64];
+static char *sortedPaths[PHOTO_COUNT];
+static DateTimeFormatter photoFormatter;
+
+static int parsingCompare(const void *one, const void *two) {
+    BufferString *firstDateStr = SUBSTRING_CSTR_BETWEEN(32, *(char **) one, "photo_", ".jpeg");
+    BufferString *secondDateStr = SUBSTRING_CSTR_BETWEEN(32, *(char **) two, "photo_", ".jpeg");
+    DateTime firstDateTime = parseToDateTime(stringValue(firstDateStr), &photoFormatter);
+    DateTime secondDateTime = parseToDateTime(stringValue(secondDateStr), &photoFormatter);
+    return (int) dateTimeCompare(&firstDateTime, &secondDateTime);
+}
+
+static int viewCompare(const void *one, const void *two) {
+    StringView firstDate = stringViewBetween(stringViewOf(*(char **) one), "photo_", ".jpeg");
+    StringView secondDate = stringViewBetween(stringViewOf(*(char **) two), "photo_", ".jpeg");
+    return stringViewCompare(firstDate, secondDate);
+}
+
+static void benchSort(const char *name, int (*compare)(const void *, const void *)) {
+    uint32_t iterations = benchIterations(200);
+    uint64_t start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        for (uint32_t j = 0; j < PHOTO_COUNT; j++) {
+            sortedPaths[j] = photoPaths[j];
+        }
+        qsort(sortedPaths, PHOTO_COUNT, sizeof(char *), compare);
+        benchSink += (uintptr_t) sortedPaths[0];
+    }
+    printBenchResult(name, benchNowNanos() - start, iterations);
+}
+
+int main(int argc, char **argv) {
+    initBench(argc, argv);
+    parseDateTimePattern(&photoFormatter, "yyyy_MM_dd_HH_mm");
+    srand(32);
+    for (uint32_t i = 0; i < PHOTO_COUNT; i++) {
+        DateTime dateTime = dateTimeOf(2020 + rand() % 5, 1 + rand() % 12, 1 + rand() % 28, rand() % 24, rand() % 60);
+        char dateText[32];
+        formatDateTime(&dateTime, dateText, sizeof(dateText), &photoFormatter);
+        snprintf(photoPaths[i], sizeof(photoPaths[i]), "/sdcard/photo/photo_%s.jpeg", dateText);
+    }
+
+    benchSort("qsort 1000 photos, substring + parseToDateTime", parsingCompare);
+    benchSort("qsort 1000 photos, StringView compare", viewCompare);
+    return 0;
+}
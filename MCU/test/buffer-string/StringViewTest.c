@@ -0,0 +1,165 @@
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "StringView.h"
+#include "GlobalDateTime.h"
+
+// StringView slices and searches against the copying BufferString functions with the same semantics, on random text
+
+static void fillRandom(char *buffer, uint32_t length, uint32_t alphabetSize) {
+    for (uint32_t i = 0; i < length; i++) {
+        buffer[i] = (char) ('a' + rand() % alphabetSize);
+    }
+    buffer[length] = '\0';
+}
+
+static bool isSameContent(StringView view, BufferString *str) {     // missing result is empty view or NULL/empty string
+    const char *expected = str != NULL ? str->value : "";
+    return view.length == strlen(expected) && (view.length == 0 || memcmp(view.value, expected, view.length) == 0);
+}
+
+static void testSlicesAgainstBufferString() {
+    char text[64];
+    char separator[4];
+    char close[4];
+    srand(32);
+    for (uint32_t round = 0; round < 100000; round++) {
+        fillRandom(text, rand() % 40, 3);
+        fillRandom(separator, 1 + rand() % 3, 3);
+        fillRandom(close, 1 + rand() % 3, 3);
+        StringView view = stringViewOf(text);
+
+        if (!isSameContent(stringViewAfter(view, separator), SUBSTRING_CSTR_AFTER(64, text, separator)) ||
+            !isSameContent(stringViewAfterLast(view, separator), SUBSTRING_CSTR_AFTER_LAST(64, text, separator)) ||
+            !isSameContent(stringViewBefore(view, separator), SUBSTRING_CSTR_BEFORE(64, text, separator)) ||
+            !isSameContent(stringViewBeforeLast(view, separator), SUBSTRING_CSTR_BEFORE_LAST(64, text, separator)) ||
+            !isSameContent(stringViewBetween(view, separator, close), SUBSTRING_CSTR_BETWEEN(64, text, separator, close))) {
+            TEST_FAIL("slices of \"%s\" by \"%s\", \"%s\" differ", text, separator, close);
+            return;
+        }
+
+        BufferString *str = NEW_STRING(64, text);
+        uint32_t fromIndex = rand() % (view.length + 1);
+        if (stringViewIndexOf(view, separator, fromIndex) != indexOfString(str, separator, fromIndex) && fromIndex < view.length) {
+            TEST_FAIL("indexOf(\"%s\", \"%s\", %u) differs", text, separator, fromIndex);
+            return;
+        }
+        ASSERT_EQ_INT(indexOfChar(str, separator[0], fromIndex), stringViewIndexOfChar(view, separator[0], fromIndex));
+        ASSERT_EQ_INT(lastIndexOfCStr(text, separator), stringViewLastIndexOf(view, separator));
+        ASSERT_EQ_INT(isStrEndsWith(str, separator), isStringViewEndsWith(view, separator));
+        ASSERT_EQ_INT(isStrStartsWith(str, separator, 0), isStringViewStartsWith(view, separator));
+    }
+}
+
+static void testSplitAgainstBufferString() {
+    char text[64];
+    char delimiter[3];
+    srand(132);
+    for (uint32_t round = 0; round < 50000; round++) {
+        fillRandom(text, rand() % 40, 3);
+        fillRandom(delimiter, 1 + rand() % 2, 3);
+
+        BufferString *str = NEW_STRING(64, text);
+        StringIterator strIterator = getStringSplitIterator(str, delimiter);
+        StringViewIterator viewIterator = getStringViewSplitIterator(stringViewOf(text), delimiter);
+        BufferString *strToken = EMPTY_STRING(64);
+        StringView viewToken;
+        while (true) {
+            bool hasStrToken = hasNextSplitToken(&strIterator, strToken);
+            bool hasViewToken = hasNextStringViewToken(&viewIterator, &viewToken);
+            if (hasStrToken != hasViewToken || (hasStrToken && !isSameContent(viewToken, strToken))) {
+                TEST_FAIL("split of \"%s\" by \"%s\" differs", text, delimiter);
+                return;
+            }
+            if (!hasStrToken) break;
+        }
+    }
+}
+
+static void testViewsNeedNoTerminator() {
+    const char text[] = "key=value;next";
+    StringView view = stringViewOfLength(text, 9);    // "key=value" without terminator at its end
+    ASSERT_TRUE(isStringViewEqualsCstr(stringViewAfter(view, "="), "value"));
+    ASSERT_TRUE(isStringViewEqualsCstr(stringViewBefore(view, "="), "key"));
+    ASSERT_EQ_INT(-1, stringViewIndexOf(view, ";", 0));
+    ASSERT_TRUE(isStringViewEndsWith(view, "value"));
+    ASSERT_TRUE(isStringViewEmpty(stringViewAfter(view, "next")));
+    ASSERT_EQ_INT('e', stringViewCharAt(view, 8));
+    ASSERT_EQ_INT(0, stringViewCharAt(view, 9));
+    ASSERT_TRUE(isStringViewEqualsCstr(stringViewTrim(stringViewOf(" \t a b \r\n")), "a b"));
+    ASSERT_TRUE(isStringViewEmpty(stringViewTrim(stringViewOf("   "))));
+
+    BufferString *copy = stringViewToBuffStr(stringViewAfter(view, "k"), EMPTY_STRING(16));
+    ASSERT_EQ_STR("ey=value", copy->value);
+}
+
+static void testCompare() {
+    char one[8];
+    char two[8];
+    srand(232);
+    for (uint32_t round = 0; round < 100000; round++) {
+        fillRandom(one, rand() % 6, 3);
+        fillRandom(two, rand() % 6, 3);
+        int expected = strcmp(one, two);
+        int32_t actual = stringViewCompare(stringViewOf(one), stringViewOf(two));
+        if ((expected < 0) != (actual < 0) || (expected == 0) != (actual == 0)) {
+            TEST_FAIL("compare(\"%s\", \"%s\"): %d, strcmp %d", one, two, actual, expected);
+            return;
+        }
+        ASSERT_EQ_INT(expected == 0, isStringViewEquals(stringViewOf(one), stringViewOf(two)));
+        ASSERT_EQ_INT(strcasecmp(one, two) == 0, isStringViewEqualsIgnoreCase(stringViewOf(one), stringViewOf(two)));
+    }
+    ASSERT_TRUE(isStringViewEqualsIgnoreCase(stringViewOf("Content-Type"), stringViewOf("content-type")));
+}
+
+static void testToI64() {
+    static const char *const numbers[] = {"0", "-1", "42", "9223372036854775807", "-9223372036854775808", "9223372036854775808", "12a", "", "0x1F"};
+    for (uint32_t i = 0; i < ARRAY_SIZE(numbers); i++) {
+        int64_t expectedNumber = 0;
+        int64_t actualNumber = 0;
+        StringToI64Status expected = cStrToInt64(numbers[i], &expectedNumber, 10);
+        char padded[32];
+        snprintf(padded, sizeof(padded), "%s;", numbers[i]);   // view stops before ';'
+        StringToI64Status actual = stringViewToI64(stringViewOfLength(padded, strlen(numbers[i])), &actualNumber, 10);
+        if (strlen(numbers[i]) > 0) ASSERT_EQ_INT(expected, actual);
+        if (expected == STR_TO_I64_SUCCESS) ASSERT_EQ_INT(expectedNumber, actualNumber);
+    }
+    ASSERT_EQ_INT(STR_TO_I64_INCONVERTIBLE, stringViewToI64(EMPTY_STRING_VIEW, &(int64_t) {0}, 10));
+}
+
+static void testPhotoNameOrderIsDateOrder() {  // photo cleanup sorts by name slice instead of parsed date-time
+    DateTimeFormatter formatter;
+    parseDateTimePattern(&formatter, "yyyy_MM_dd_HH_mm");
+    srand(332);
+    for (uint32_t round = 0; round < 20000; round++) {
+        DateTime first = dateTimeOfWithSeconds(1990 + rand() % 120, 1 + rand() % 12, 1 + rand() % 28, rand() % 24, rand() % 60, 0);
+        DateTime second = round % 3 == 0 ? first : dateTimeOfWithSeconds(1990 + rand() % 120, 1 + rand() % 12, 1 + rand() % 28, rand() % 24, rand() % 60, 0);
+        if (round % 5 == 0) second.date.year = first.date.year;
+
+        char firstPath[64] = "/sdcard/photo/photo_";
+        char secondPath[64] = "/sdcard/photo/photo_";
+        formatDateTime(&first, firstPath + strlen(firstPath), 32, &formatter);
+        formatDateTime(&second, secondPath + strlen(secondPath), 32, &formatter);
+        strcat(firstPath, ".jpeg");
+        strcat(secondPath, ".jpeg");
+
+        int64_t expected = dateTimeCompare(&first, &second);
+        int32_t actual = stringViewCompare(stringViewBetween(stringViewOf(firstPath), "photo_", ".jpeg"),
+                                           stringViewBetween(stringViewOf(secondPath), "photo_", ".jpeg"));
+        if ((expected < 0) != (actual < 0) || (expected == 0) != (actual == 0)) {
+            TEST_FAIL("%s and %s: name order %d, date order %lld", firstPath, secondPath, actual, (long long) expected);
+            return;
+        }
+    }
+    ASSERT_TRUE(isStringViewEmpty(stringViewBetween(stringViewOf("/sdcard/photo/calibration_photo.jpeg"), "photo_", ".jpeg")));
+}
+
+int main() {
+    RUN_TEST(testSlicesAgainstBufferString);
+    RUN_TEST(testSplitAgainstBufferString);
+    RUN_TEST(testViewsNeedNoTerminator);
+    RUN_TEST(testCompare);
+    RUN_TEST(testToI64);
+    RUN_TEST(testPhotoNameOrderIsDateOrder);
+    return TEST_RESULT();
+}
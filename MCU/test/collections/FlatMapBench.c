@@ -0,0 +1,71 @@
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "BufferFlatMap.h"
+#include "HashMap.h"
+
+// Lookup time of frozen flat map in both layouts against HashMap, string keys as in content type table, 50 - 5000 keys
+
+CREATE_FLAT_MAP_TYPE(char*, uint32_t, str, uint32_t, strComparator);
+
+#define MAX_KEY_COUNT 5000
+
+static char keys[MAX_KEY_COUNT][12];
+static char *lookupKeys[MAX_KEY_COUNT * 2];    // half present, half missing
+
+static void benchFlatMap(uint32_t keyCount, FlatMapLayout layout, uint32_t iterations) {
+    static str_uint32_tFlatMapEntry entries[MAX_KEY_COUNT];
+    str_uint32_tFlatMap *map = new_str_uint32_tBufferFlatMap(&(str_uint32_tFlatMap) {0}, entries, MAX_KEY_COUNT);
+    for (uint32_t i = 0; i < keyCount; i++) {
+        str_uint32_tFlatMapAdd(map, keys[i], i);
+    }
+    str_uint32_tFlatMapFreeze(map, layout);
+
+    uint64_t start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += str_uint32_tFlatMapGetOrDefault(map, lookupKeys[i % (keyCount * 2)], 1);
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "FlatMap %s get, %u keys", layout == FLAT_MAP_LAYOUT_SORTED ? "sorted" : "eytzinger", keyCount);
+    printBenchResult(name, benchNowNanos() - start, iterations);
+}
+
+static void benchHashMap(uint32_t keyCount, uint32_t iterations) {
+    HashMap map = getHashMapInstance(keyCount);
+    for (uint32_t i = 0; i < keyCount; i++) {
+        hashMapPut(map, keys[i], (MapValueType) (uintptr_t) i);
+    }
+
+    uint64_t start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += (uintptr_t) hashMapGetOrDefault(map, lookupKeys[i % (keyCount * 2)], (MapValueType) 1);
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "HashMap get, %u keys", keyCount);
+    printBenchResult(name, benchNowNanos() - start, iterations);
+    hashMapDelete(map);
+}
+
+int main(int argc, char **argv) {
+    initBench(argc, argv);
+    static char missingKeys[MAX_KEY_COUNT][12];
+    srand(29);
+    for (uint32_t i = 0; i < MAX_KEY_COUNT; i++) {
+        snprintf(keys[i], sizeof(keys[i]), "key%08x", (uint32_t) rand());
+        snprintf(missingKeys[i], sizeof(missingKeys[i]), "miss%07x", (uint32_t) rand() & 0xFFFFFFF);
+    }
+
+    static const uint32_t keyCounts[] = {50, 500, 5000};
+    for (uint32_t c = 0; c < ARRAY_SIZE(keyCounts); c++) {
+        uint32_t keyCount = keyCounts[c];
+        for (uint32_t i = 0; i < keyCount; i++) {
+            lookupKeys[2 * i] = keys[(i * 7919) % keyCount];
+            lookupKeys[2 * i + 1] = missingKeys[i];
+        }
+        uint32_t iterations = benchIterations(5000000);
+        benchFlatMap(keyCount, FLAT_MAP_LAYOUT_SORTED, iterations);
+        benchFlatMap(keyCount, FLAT_MAP_LAYOUT_EYTZINGER, iterations);
+        benchHashMap(keyCount, iterations);
+    }
+    return 0;
+}
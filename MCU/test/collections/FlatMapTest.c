@@ -0,0 +1,131 @@
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "BufferFlatMap.h"
+
+// Frozen flat map in both layouts against linear search over the added entries, hits and misses for every size up to 300
+
+CREATE_FLAT_MAP_TYPE(uint32_t, uint32_t);
+CREATE_FLAT_MAP_TYPE(char*, uint32_t, str, uint32_t, strComparator);
+
+#define MAX_TEST_SIZE 300
+
+typedef struct ReferenceEntry {
+    uint32_t key;
+    uint32_t value;
+} ReferenceEntry;
+
+static const ReferenceEntry *findReference(const ReferenceEntry *entries, uint32_t size, uint32_t key) {
+    for (uint32_t i = 0; i < size; i++) {
+        if (entries[i].key == key) return &entries[i];
+    }
+    return NULL;
+}
+
+static bool isKeyUsed(const ReferenceEntry *entries, uint32_t size, uint32_t key) {
+    return findReference(entries, size, key) != NULL;
+}
+
+static void checkAgainstReference(FlatMapLayout layout) {
+    static ReferenceEntry reference[MAX_TEST_SIZE];
+    static uint32_t_uint32_tFlatMapEntry entries[MAX_TEST_SIZE];
+    srand(29 + layout);
+
+    for (uint32_t size = 0; size <= MAX_TEST_SIZE; size++) {
+        uint32_t_uint32_tFlatMap *map = new_uint32_t_uint32_tBufferFlatMap(&(uint32_t_uint32_tFlatMap) {0}, entries, MAX_TEST_SIZE);
+        for (uint32_t i = 0; i < size; i++) {
+            uint32_t key;
+            do {
+                key = (uint32_t) rand() % (size * 4 + 1);    // dense keys, so misses fall between present ones
+            } while (isKeyUsed(reference, i, key));
+            reference[i] = (ReferenceEntry) {.key = key, .value = (uint32_t) rand()};
+            ASSERT_TRUE(uint32_t_uint32_tFlatMapAdd(map, key, reference[i].value));
+        }
+        ASSERT_TRUE(uint32_t_uint32_tFlatMapFreeze(map, layout));
+        ASSERT_EQ_INT(size, uint32_t_uint32_tFlatMapSize(map));
+
+        for (uint32_t key = 0; key <= size * 4 + 1; key++) {
+            const ReferenceEntry *expected = findReference(reference, size, key);
+            uint32_t_uint32_tFlatMapEntry *actual = find_uint32_t_uint32_tFlatMapEntry(map, key);
+            if ((expected == NULL) != (actual == NULL) || (expected != NULL && expected->value != actual->value)) {
+                TEST_FAIL("layout %d, size %u: key %u %s", layout, size, key, expected != NULL ? "not found or wrong value" : "found but not added");
+                return;
+            }
+        }
+        ASSERT_FALSE(uint32_t_uint32_tFlatMapContains(map, UINT32_MAX));
+    }
+}
+
+static void testSortedLayoutAgainstLinearSearch() {
+    checkAgainstReference(FLAT_MAP_LAYOUT_SORTED);
+}
+
+static void testEytzingerLayoutAgainstLinearSearch() {
+    checkAgainstReference(FLAT_MAP_LAYOUT_EYTZINGER);
+}
+
+static void testSortedLayoutIsOrdered() {
+    uint32_t_uint32_tFlatMap *map = NEW_FLAT_MAP_64(uint32_t, uint32_t);
+    for (uint32_t i = 0; i < 64; i++) {
+        uint32_t_uint32_tFlatMapAdd(map, (i * 37) % 64, i);
+    }
+    uint32_t_uint32_tFlatMapFreeze(map, FLAT_MAP_LAYOUT_SORTED);
+    for (uint32_t i = 0; i < 64; i++) {
+        ASSERT_EQ_INT(i, map->entries[i].key);
+    }
+}
+
+static void testDuplicateKeysCollapse() {
+    uint32_t_uint32_tFlatMap *map = NEW_FLAT_MAP_16(uint32_t, uint32_t);
+    uint32_t_uint32_tFlatMapAdd(map, 5, 1);
+    uint32_t_uint32_tFlatMapAdd(map, 3, 2);
+    uint32_t_uint32_tFlatMapAdd(map, 5, 1);
+    uint32_t_uint32_tFlatMapAdd(map, 3, 2);
+    uint32_t_uint32_tFlatMapAdd(map, 9, 3);
+    ASSERT_TRUE(uint32_t_uint32_tFlatMapFreeze(map, FLAT_MAP_LAYOUT_EYTZINGER));
+    ASSERT_EQ_INT(3, uint32_t_uint32_tFlatMapSize(map));
+    ASSERT_EQ_INT(1, uint32_t_uint32_tFlatMapGet(map, 5));
+    ASSERT_EQ_INT(2, uint32_t_uint32_tFlatMapGet(map, 3));
+    ASSERT_EQ_INT(3, uint32_t_uint32_tFlatMapGet(map, 9));
+}
+
+static void testFrozenMapRejectsAdd() {
+    uint32_t_uint32_tFlatMap *map = NEW_FLAT_MAP_4(uint32_t, uint32_t);
+    ASSERT_FALSE(uint32_t_uint32_tFlatMapContains(map, 1));    // lookups need frozen map
+    ASSERT_TRUE(uint32_t_uint32_tFlatMapAdd(map, 1, 10));
+    ASSERT_TRUE(uint32_t_uint32_tFlatMapFreeze(map, FLAT_MAP_LAYOUT_SORTED));
+    ASSERT_FALSE(uint32_t_uint32_tFlatMapAdd(map, 2, 20));
+    ASSERT_FALSE(uint32_t_uint32_tFlatMapFreeze(map, FLAT_MAP_LAYOUT_SORTED));
+    ASSERT_EQ_INT(10, uint32_t_uint32_tFlatMapGet(map, 1));
+    ASSERT_EQ_INT(77, uint32_t_uint32_tFlatMapGetOrDefault(map, 2, 77));
+}
+
+static void testStringKeys() {
+    static const char *const extensions[] = {"pdf", "html", "css", "js", "png", "jpg", "ico", "txt", "json", "gz"};
+    for (FlatMapLayout layout = FLAT_MAP_LAYOUT_SORTED; layout <= FLAT_MAP_LAYOUT_EYTZINGER; layout++) {
+        str_uint32_tFlatMap *map = NEW_FLAT_MAP_16(char*, uint32_t, str, uint32_t);
+        for (uint32_t i = 0; i < ARRAY_SIZE(extensions); i++) {
+            str_uint32_tFlatMapAdd(map, (char *) extensions[i], i + 1);
+        }
+        str_uint32_tFlatMapFreeze(map, layout);
+
+        for (uint32_t i = 0; i < ARRAY_SIZE(extensions); i++) {
+            char key[8];
+            strcpy(key, extensions[i]);     // equal content at different address
+            ASSERT_EQ_INT(i + 1, str_uint32_tFlatMapGet(map, key));
+        }
+        ASSERT_FALSE(str_uint32_tFlatMapContains(map, "htm"));
+        ASSERT_FALSE(str_uint32_tFlatMapContains(map, "a"));
+        ASSERT_FALSE(str_uint32_tFlatMapContains(map, "zip"));
+    }
+}
+
+int main() {
+    RUN_TEST(testSortedLayoutAgainstLinearSearch);
+    RUN_TEST(testEytzingerLayoutAgainstLinearSearch);
+    RUN_TEST(testSortedLayoutIsOrdered);
+    RUN_TEST(testDuplicateKeysCollapse);
+    RUN_TEST(testFrozenMapRejectsAdd);
+    RUN_TEST(testStringKeys);
+    return TEST_RESULT();
+}
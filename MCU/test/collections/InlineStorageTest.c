@@ -0,0 +1,146 @@
+#include "TestUtils.h"
+#include "AllocationCounter.h"
+#include "Vector.h"
+#include "HashMap.h"
+#include "CSPValue.h"
+
+// Containers with inline initial storage: one allocation while within initial capacity, same contents across spill and shrink
+
+#define KEY_COUNT 1000
+
+static char keys[KEY_COUNT][8];
+
+static void initKeys() {
+    for (uint32_t i = 0; i < KEY_COUNT; i++) {
+        snprintf(keys[i], sizeof(keys[i]), "k%u", i);
+    }
+}
+
+static void testVectorSingleAllocationWithinCapacity() {
+    resetAllocationCounts();
+    Vector vector = getVectorInstance(8);
+    for (intptr_t i = 0; i < 8; i++) {
+        vectorAdd(vector, (VectorValueType) i);
+    }
+    ASSERT_EQ_INT(1, getAllocationCounts().allocations);
+
+    vectorAdd(vector, (VectorValueType) 8);    // spill to heap array
+    ASSERT_EQ_INT(2, getAllocationCounts().allocations);
+    vectorDelete(vector);
+    ASSERT_EQ_INT(2, getAllocationCounts().frees);
+}
+
+static void testVectorShrinksBackToInline() {
+    Vector vector = getVectorInstance(4);
+    for (intptr_t i = 0; i < 100; i++) {
+        vectorAdd(vector, (VectorValueType) i);
+    }
+    while (getVectorSize(vector) > 1) {
+        vectorRemoveAt(vector, 0);
+    }
+    ASSERT_EQ_INT(99, (intptr_t) vectorGet(vector, 0));
+
+    resetAllocationCounts();
+    for (intptr_t i = 0; i < 3; i++) {
+        vectorAdd(vector, (VectorValueType) i);     // inline storage again, no allocation
+    }
+    ASSERT_EQ_INT(0, getAllocationCounts().allocations);
+    ASSERT_EQ_INT(99, (intptr_t) vectorGet(vector, 0));
+    ASSERT_EQ_INT(2, (intptr_t) vectorGet(vector, 3));
+    vectorDelete(vector);
+    ASSERT_EQ_INT(1, getAllocationCounts().frees);  // only the container block
+}
+
+static void testVectorClearReturnsToInline() {
+    Vector vector = getVectorInstance(4);
+    for (intptr_t i = 0; i < 64; i++) {
+        vectorAdd(vector, (VectorValueType) i);
+    }
+    vectorClear(vector);
+    ASSERT_TRUE(isVectorEmpty(vector));
+
+    resetAllocationCounts();
+    vectorDelete(vector);
+    ASSERT_EQ_INT(1, getAllocationCounts().frees);
+}
+
+static void testHashMapSingleAllocationWithinCapacity() {
+    resetAllocationCounts();
+    HashMap map = getHashMapInstance(8);
+    for (uint32_t i = 0; i < 5; i++) {    // typical JSON payload, below 0.75 load factor of 8 entries
+        hashMapPut(map, keys[i], (MapValueType) (uintptr_t) (i + 1));
+    }
+    ASSERT_EQ_INT(1, getAllocationCounts().allocations);
+    for (uint32_t i = 0; i < 5; i++) {
+        ASSERT_EQ_INT(i + 1, (uintptr_t) hashMapGet(map, keys[i]));
+    }
+
+    for (uint32_t i = 5; i < 7; i++) {
+        hashMapPut(map, keys[i], (MapValueType) (uintptr_t) (i + 1));
+    }
+    ASSERT_EQ_INT(2, getAllocationCounts().allocations);
+    hashMapDelete(map);
+    ASSERT_EQ_INT(2, getAllocationCounts().frees);
+}
+
+static void testHashMapAcrossSpill() {
+    HashMap map = getHashMapInstance(4);
+    for (uint32_t i = 0; i < KEY_COUNT; i++) {
+        ASSERT_TRUE(hashMapPut(map, keys[i], (MapValueType) (uintptr_t) (i + 1)));
+    }
+    for (uint32_t i = 0; i < KEY_COUNT; i += 2) {
+        ASSERT_EQ_INT(i + 1, (uintptr_t) hashMapRemove(map, keys[i]));
+    }
+    ASSERT_EQ_INT(KEY_COUNT / 2, getHashMapSize(map));
+
+    for (uint32_t i = 0; i < KEY_COUNT; i++) {
+        uintptr_t expected = (i % 2 == 0) ? 0 : i + 1;
+        if ((uintptr_t) hashMapGet(map, keys[i]) != expected) {
+            TEST_FAIL("key %s: expected %lu", keys[i], (unsigned long) expected);
+            break;
+        }
+    }
+
+    uint32_t iterated = 0;
+    HashMapIterator iterator = getHashMapIterator(map);
+    while (hashMapHasNext(&iterator)) {
+        iterated++;
+    }
+    ASSERT_EQ_INT(KEY_COUNT / 2, iterated);
+    hashMapDelete(map);
+}
+
+static void testCspMapSingleAllocationWithinCapacity() {
+    resetAllocationCounts();
+    CspHashMap *map = newCspHashMap(8);
+    for (uint32_t i = 0; i < 5; i++) {
+        cspMapPut(map, keys[i], CSP_INT_VALUE(i));
+    }
+    ASSERT_EQ_INT(1, getAllocationCounts().allocations);
+
+    for (uint32_t i = 5; i < 100; i++) {
+        cspMapPut(map, keys[i], CSP_INT_VALUE(i));
+    }
+    ASSERT_EQ_INT(100, getCspMapSize(map));
+    for (uint32_t i = 0; i < 100; i++) {
+        CspValue value = cspMapGet(map, keys[i]);
+        if (!IS_CSP_INT(value) || AS_CSP_INT(value) != i) {
+            TEST_FAIL("key %s differs after spill", keys[i]);
+            break;
+        }
+    }
+    cspMapDelete(map);
+    AllocationCounts counts = getAllocationCounts();
+    ASSERT_EQ_INT(counts.allocations, counts.frees);
+}
+
+int main() {
+    initKeys();
+    RUN_TEST(testVectorSingleAllocationWithinCapacity);
+    RUN_TEST(testVectorShrinksBackToInline);
+    RUN_TEST(testVectorClearReturnsToInline);
+    RUN_TEST(testHashMapSingleAllocationWithinCapacity);
+    RUN_TEST(testHashMapAcrossSpill);
+    RUN_TEST(testCspMapSingleAllocationWithinCapacity);
+    return TEST_RESULT();
+}
@@ -0,0 +1,88 @@
+#include <pthread.h>
+#include <sched.h>
+
+#include "TestUtils.h"
+#include "BufferSpscRing.h"
+
+// SPSC ring throughput between two pthreads, one item per call against batches
+
+CREATE_SPSC_RING_TYPE(uint32_t, Seq);
+
+typedef struct BenchContext {
+    SeqSpscRing *ring;
+    uint32_t batchSize;
+    uint32_t itemCount;
+    uint64_t checksum;
+} BenchContext;
+
+static void *producerThread(void *argument) {
+    BenchContext *context = argument;
+    uint32_t batch[256];
+    for (uint32_t i = 0; i < 256; i++) batch[i] = i;
+
+    uint32_t sent = 0;
+    while (sent < context->itemCount) {
+        uint32_t length = MIN(context->batchSize, context->itemCount - sent);
+        uint32_t count = context->batchSize == 1 ? SeqSpscRingPush(context->ring, sent) : SeqSpscRingPushN(context->ring, batch, length);
+        if (count == 0) sched_yield();      // ring full, let consumer run also on single core host
+        sent += count;
+    }
+    return NULL;
+}
+
+static void *consumerThread(void *argument) {
+    BenchContext *context = argument;
+    uint32_t batch[256];
+    uint32_t received = 0;
+    uint64_t checksum = 0;
+    while (received < context->itemCount) {
+        if (context->batchSize == 1) {
+            if (SeqSpscRingPop(context->ring, batch)) {
+                checksum += batch[0];
+                received++;
+            } else {
+                sched_yield();
+            }
+        } else {
+            uint32_t count = SeqSpscRingPopN(context->ring, batch, context->batchSize);
+            for (uint32_t i = 0; i < count; i++) checksum += batch[i];
+            if (count == 0) sched_yield();
+            received += count;
+        }
+    }
+    context->checksum = checksum;
+    return NULL;
+}
+
+static void benchThroughput(uint32_t batchSize, uint32_t ringCapacity) {
+    static uint32_t buffer[4096];
+    SeqSpscRing ring;
+    BenchContext context = {
+            .ring = newSeqBuffSpscRing(&ring, buffer, ringCapacity),
+            .batchSize = batchSize,
+            .itemCount = benchIterations(50000000),
+    };
+
+    pthread_t producer;
+    pthread_t consumer;
+    uint64_t start = benchNowNanos();
+    pthread_create(&consumer, NULL, consumerThread, &context);
+    pthread_create(&producer, NULL, producerThread, &context);
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+    uint64_t elapsed = benchNowNanos() - start;
+    benchSink += context.checksum;
+
+    char name[64];
+    snprintf(name, sizeof(name), "SpscRing batch %u, capacity %u", batchSize, ringCapacity);
+    printBenchResult(name, elapsed, context.itemCount);
+}
+
+int main(int argc, char **argv) {
+    initBench(argc, argv);
+    benchThroughput(1, 1024);
+    benchThroughput(8, 1024);
+    benchThroughput(32, 1024);
+    benchThroughput(256, 4096);
+    return 0;
+}
@@ -0,0 +1,138 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "BufferSpscRing.h"
+
+// SPSC ring: wrap-around and partial batches on one thread, then sequence order across a producer and a consumer thread
+
+CREATE_SPSC_RING_TYPE(uint32_t, Seq);
+
+#define THREAD_ITEM_COUNT 4000000
+
+static void testCapacityMustBePowerOfTwo() {
+    uint32_t buffer[12];
+    SeqSpscRing ring;
+    ASSERT_TRUE(newSeqBuffSpscRing(&ring, buffer, 12) == NULL);
+    ASSERT_TRUE(newSeqBuffSpscRing(&ring, buffer, 0) == NULL);
+    ASSERT_TRUE(newSeqBuffSpscRing(&ring, buffer, 8) != NULL);
+}
+
+static void testSingleThreadWrapAround() {
+    SeqSpscRing *ring = NEW_SPSC_RING_8(uint32_t, Seq);
+    uint32_t pushed = 0;
+    uint32_t popped = 0;
+    uint32_t batch[16];
+    srand(27);
+
+    for (uint32_t step = 0; step < 100000; step++) {
+        uint32_t length = rand() % 12;
+        if (rand() % 2 == 0) {
+            uint32_t freeSlots = 8 - SeqSpscRingSize(ring);
+            for (uint32_t i = 0; i < length; i++) batch[i] = pushed + i;
+            uint32_t count = length == 1 ? SeqSpscRingPush(ring, batch[0]) : SeqSpscRingPushN(ring, batch, length);
+            ASSERT_EQ_INT(MIN(length, freeSlots), count);
+            pushed += count;
+        } else {
+            uint32_t count = length == 1 ? SeqSpscRingPop(ring, batch) : SeqSpscRingPopN(ring, batch, length);
+            ASSERT_EQ_INT(MIN(length, pushed - popped), count);
+            for (uint32_t i = 0; i < count; i++) {
+                if (batch[i] != popped + i) {
+                    TEST_FAIL("popped %u, expected %u at step %u", batch[i], popped + i, step);
+                    return;
+                }
+            }
+            popped += count;
+        }
+        ASSERT_EQ_INT(pushed - popped, SeqSpscRingSize(ring));
+        ASSERT_EQ_INT(pushed - popped == 8, isSeqSpscRingFull(ring));
+    }
+}
+
+static void testCountersWrapAroundUint32() {
+    uint32_t buffer[4];
+    SeqSpscRing *ring = newSeqBuffSpscRing(&(SeqSpscRing) {0}, buffer, 4);
+    atomic_store(&ring->head, UINT32_MAX - 1);      // free running counters overflow after 2^32 items
+    atomic_store(&ring->tail, UINT32_MAX - 1);
+    ring->headCache = UINT32_MAX - 1;
+    ring->tailCache = UINT32_MAX - 1;
+
+    uint32_t values[] = {10, 11, 12, 13};
+    ASSERT_EQ_INT(4, SeqSpscRingPushN(ring, values, 4));
+    ASSERT_FALSE(SeqSpscRingPush(ring, 14));
+    uint32_t result[4] = {0};
+    ASSERT_EQ_INT(4, SeqSpscRingPopN(ring, result, 4));
+    ASSERT_EQ_INT(0, memcmp(values, result, sizeof(values)));
+    ASSERT_TRUE(isSeqSpscRingEmpty(ring));
+}
+
+typedef struct ThreadContext {
+    SeqSpscRing *ring;
+    uint32_t batchSize;
+    uint32_t outOfOrderCount;
+} ThreadContext;
+
+static void *producerThread(void *argument) {
+    ThreadContext *context = argument;
+    uint32_t batch[64];
+    uint32_t next = 0;
+    while (next < THREAD_ITEM_COUNT) {
+        uint32_t length = MIN(context->batchSize, THREAD_ITEM_COUNT - next);
+        for (uint32_t i = 0; i < length; i++) batch[i] = next + i;
+        uint32_t count = length == 1 ? SeqSpscRingPush(context->ring, batch[0]) : SeqSpscRingPushN(context->ring, batch, length);
+        if (count == 0) sched_yield();      // ring full, let consumer run also on single core host
+        next += count;
+    }
+    return NULL;
+}
+
+static void *consumerThread(void *argument) {
+    ThreadContext *context = argument;
+    uint32_t batch[64];
+    uint32_t expected = 0;
+    while (expected < THREAD_ITEM_COUNT) {
+        uint32_t length = (expected % 7) + 1;   // consumer batches differ from producer ones, so wrap splits vary
+        uint32_t count = SeqSpscRingPopN(context->ring, batch, MIN(length, context->batchSize));
+        for (uint32_t i = 0; i < count; i++) {
+            if (batch[i] != expected + i) context->outOfOrderCount++;
+        }
+        if (count == 0) sched_yield();
+        expected += count;
+    }
+    return NULL;
+}
+
+static void runProducerConsumer(uint32_t batchSize) {
+    static uint32_t buffer[256];
+    SeqSpscRing ring;
+    ThreadContext context = {.ring = newSeqBuffSpscRing(&ring, buffer, 256), .batchSize = batchSize};
+
+    pthread_t producer;
+    pthread_t consumer;
+    pthread_create(&consumer, NULL, consumerThread, &context);
+    pthread_create(&producer, NULL, producerThread, &context);
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+
+    if (context.outOfOrderCount > 0) TEST_FAIL("batch %u: %u items out of order", batchSize, context.outOfOrderCount);
+    ASSERT_TRUE(isSeqSpscRingEmpty(&ring));
+}
+
+static void testTwoThreadsSingleItems() {
+    runProducerConsumer(1);
+}
+
+static void testTwoThreadsBatches() {
+    runProducerConsumer(5);
+    runProducerConsumer(64);
+}
+
+int main() {
+    RUN_TEST(testCapacityMustBePowerOfTwo);
+    RUN_TEST(testSingleThreadWrapAround);
+    RUN_TEST(testCountersWrapAroundUint32);
+    RUN_TEST(testTwoThreadsSingleItems);
+    RUN_TEST(testTwoThreadsBatches);
+    return TEST_RESULT();
+}
@@ -0,0 +1,127 @@
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "HeapVector.h"
+#include "Vector.h"
+
+// Vector growth and bulk operations for 10^3 - 10^6 elements: per item Add against AddRange / Reserve, front inserts against InsertRange
+
+CREATE_HEAP_VECTOR_TYPE(int32_t, Int);
+
+static int32_t *rangeValues;
+
+static void benchGrowth(uint32_t elementCount) {
+    uint32_t repeats = benchIterations(10000000) / elementCount + 1;
+    char name[64];
+
+    uint64_t start = benchNowNanos();
+    for (uint32_t r = 0; r < repeats; r++) {
+        IntHeapVec *vector = NEW_HEAP_VECTOR(Int, 4);
+        for (uint32_t i = 0; i < elementCount; i++) {
+            IntHeapVecAdd(vector, (int32_t) i);
+        }
+        benchSink += vector->size;
+        IntHeapVecDelete(vector);
+    }
+    snprintf(name, sizeof(name), "HeapVec Add x%u", elementCount);
+    printBenchResult(name, benchNowNanos() - start, (uint64_t) repeats * elementCount);
+
+    start = benchNowNanos();
+    for (uint32_t r = 0; r < repeats; r++) {
+        IntHeapVec *vector = NEW_HEAP_VECTOR(Int, 4);
+        IntHeapVecReserve(vector, elementCount);
+        for (uint32_t i = 0; i < elementCount; i++) {
+            IntHeapVecAdd(vector, (int32_t) i);
+        }
+        benchSink += vector->size;
+        IntHeapVecDelete(vector);
+    }
+    snprintf(name, sizeof(name), "HeapVec Reserve + Add x%u", elementCount);
+    printBenchResult(name, benchNowNanos() - start, (uint64_t) repeats * elementCount);
+
+    start = benchNowNanos();
+    for (uint32_t r = 0; r < repeats; r++) {
+        IntHeapVec *vector = NEW_HEAP_VECTOR(Int, 4);
+        IntHeapVecAddRange(vector, rangeValues, elementCount);
+        benchSink += vector->size;
+        IntHeapVecDelete(vector);
+    }
+    snprintf(name, sizeof(name), "HeapVec AddRange x%u", elementCount);
+    printBenchResult(name, benchNowNanos() - start, (uint64_t) repeats * elementCount);
+
+    start = benchNowNanos();
+    for (uint32_t r = 0; r < repeats; r++) {
+        Vector vector = getVectorInstance(4);
+        for (uint32_t i = 0; i < elementCount; i++) {
+            vectorAdd(vector, (VectorValueType) (uintptr_t) i);
+        }
+        benchSink += getVectorSize(vector);
+        vectorDelete(vector);
+    }
+    snprintf(name, sizeof(name), "Vector Add x%u", elementCount);
+    printBenchResult(name, benchNowNanos() - start, (uint64_t) repeats * elementCount);
+}
+
+static void benchFrontInsert(uint32_t elementCount) {
+    uint32_t chunk = 64;
+    uint32_t repeats = benchIterations(1000000) / elementCount + 1;
+    char name[64];
+
+    uint64_t start = benchNowNanos();
+    for (uint32_t r = 0; r < repeats; r++) {
+        IntHeapVec *vector = NEW_HEAP_VECTOR(Int, 4);
+        for (uint32_t i = 0; i < elementCount; i++) {
+            if (vector->size == 0) {
+                IntHeapVecAdd(vector, (int32_t) i);
+            } else {
+                IntHeapVecAddAt(vector, 0, (int32_t) i);
+            }
+        }
+        benchSink += vector->size;
+        IntHeapVecDelete(vector);
+    }
+    snprintf(name, sizeof(name), "HeapVec AddAt(0) x%u", elementCount);
+    printBenchResult(name, benchNowNanos() - start, (uint64_t) repeats * elementCount);
+
+    start = benchNowNanos();
+    for (uint32_t r = 0; r < repeats; r++) {
+        IntHeapVec *vector = NEW_HEAP_VECTOR(Int, 4);
+        for (uint32_t i = 0; i < elementCount; i += chunk) {
+            IntHeapVecInsertRange(vector, 0, rangeValues, MIN(chunk, elementCount - i));
+        }
+        benchSink += vector->size;
+        IntHeapVecDelete(vector);
+    }
+    snprintf(name, sizeof(name), "HeapVec InsertRange(0, 64) x%u", elementCount);
+    printBenchResult(name, benchNowNanos() - start, (uint64_t) repeats * elementCount);
+
+    start = benchNowNanos();
+    for (uint32_t r = 0; r < repeats; r++) {
+        IntHeapVec *vector = NEW_HEAP_VECTOR(Int, 4);
+        IntHeapVecAddRange(vector, rangeValues, elementCount);
+        while (vector->size > 0) {
+            IntHeapVecEraseRange(vector, 0, MIN(chunk, vector->size));
+        }
+        benchSink += vector->capacity;
+        IntHeapVecDelete(vector);
+    }
+    snprintf(name, sizeof(name), "HeapVec EraseRange(0, 64) x%u", elementCount);
+    printBenchResult(name, benchNowNanos() - start, (uint64_t) repeats * elementCount);
+}
+
+int main(int argc, char **argv) {
+    initBench(argc, argv);
+    rangeValues = malloc(sizeof(int32_t) * 1000000);
+    for (uint32_t i = 0; i < 1000000; i++) {
+        rangeValues[i] = (int32_t) i;
+    }
+
+    for (uint32_t count = 1000; count <= 1000000; count *= 10) {
+        benchGrowth(count);
+    }
+    for (uint32_t count = 1000; count <= (isQuickBench ? 10000 : 100000); count *= 10) {   // quadratic, 10^6 front inserts take minutes
+        benchFrontInsert(count);
+    }
+    free(rangeValues);
+    return 0;
+}
@@ -0,0 +1,231 @@
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "HeapVector.h"
+#include "BufferVector.h"
+#include "Vector.h"
+
+// Vector containers against a plain array model: random single and bulk operations, contents compared after each step
+
+CREATE_HEAP_VECTOR_TYPE(int32_t, Int);
+CREATE_VECTOR_TYPE(int32_t, Value);
+
+#define MODEL_CAPACITY 4096
+#define RANDOM_STEPS 20000
+
+typedef struct ArrayModel {
+    int32_t items[MODEL_CAPACITY];
+    uint32_t size;
+} ArrayModel;
+
+static void modelInsert(ArrayModel *model, uint32_t index, const int32_t *values, uint32_t length) {
+    memmove(&model->items[index + length], &model->items[index], sizeof(int32_t) * (model->size - index));
+    memcpy(&model->items[index], values, sizeof(int32_t) * length);
+    model->size += length;
+}
+
+static void modelErase(ArrayModel *model, uint32_t fromIndex, uint32_t toIndex) {
+    memmove(&model->items[fromIndex], &model->items[toIndex], sizeof(int32_t) * (model->size - toIndex));
+    model->size -= toIndex - fromIndex;
+}
+
+static bool isSameAsModel(const int32_t *items, uint32_t size, const ArrayModel *model) {
+    return size == model->size && memcmp(items, model->items, sizeof(int32_t) * size) == 0;
+}
+
+static void fillRandom(int32_t *values, uint32_t length) {
+    for (uint32_t i = 0; i < length; i++) {
+        values[i] = rand();
+    }
+}
+
+static void testHeapVectorAgainstModel() {
+    srand(26);
+    IntHeapVec *vector = NEW_HEAP_VECTOR(Int, 4);
+    static ArrayModel model;
+    model.size = 0;
+    int32_t values[64];
+
+    for (uint32_t step = 0; step < RANDOM_STEPS; step++) {
+        uint32_t operation = rand() % 6;
+        uint32_t length = rand() % 64;
+        uint32_t index = model.size > 0 ? rand() % (model.size + 1) : 0;
+
+        if (model.size + length >= MODEL_CAPACITY) operation = 3;   // keep model bounded, erase instead
+        switch (operation) {
+            case 0:
+                fillRandom(values, 1);
+                ASSERT_TRUE(IntHeapVecAdd(vector, values[0]));
+                modelInsert(&model, model.size, values, 1);
+                break;
+            case 1:
+                fillRandom(values, length);
+                ASSERT_TRUE(IntHeapVecAddRange(vector, values, length));
+                modelInsert(&model, model.size, values, length);
+                break;
+            case 2:
+                fillRandom(values, length);
+                ASSERT_TRUE(IntHeapVecInsertRange(vector, index, values, length));
+                modelInsert(&model, index, values, length);
+                break;
+            case 3: {
+                uint32_t toIndex = index + MIN(length * 4, model.size - index);
+                ASSERT_TRUE(IntHeapVecEraseRange(vector, index, toIndex));
+                modelErase(&model, index, toIndex);
+                break;
+            }
+            case 4:
+                if (model.size > 0 && index < model.size) {
+                    ASSERT_EQ_INT(model.items[index], IntHeapVecRemoveAt(vector, index));
+                    modelErase(&model, index, index + 1);
+                }
+                break;
+            default:
+                fillRandom(values, 1);
+                ASSERT_TRUE(IntHeapVecAddAt(vector, index, values[0]));
+                modelInsert(&model, index, values, 1);
+                break;
+        }
+
+        if (!isSameAsModel(vector->items, vector->size, &model)) {
+            TEST_FAIL("heap vector differs from model at step %u, operation %u", step, operation);
+            break;
+        }
+        ASSERT_TRUE(vector->size <= vector->capacity);
+    }
+    IntHeapVecDelete(vector);
+}
+
+static void testHeapVectorReserveAndShrink() {
+    IntHeapVec *vector = NEW_HEAP_VECTOR(Int, 8);
+    ASSERT_TRUE(IntHeapVecReserve(vector, 1000));
+    ASSERT_EQ_INT(1000, vector->capacity);
+    ASSERT_TRUE(IntHeapVecReserve(vector, 10));     // never shrinks
+    ASSERT_EQ_INT(1000, vector->capacity);
+
+    int32_t values[100];
+    for (int32_t i = 0; i < 100; i++) values[i] = i;
+    ASSERT_TRUE(IntHeapVecAddRange(vector, values, 100));
+    ASSERT_EQ_INT(1000, vector->capacity);          // reserved capacity is used without reallocation
+
+    ASSERT_TRUE(IntHeapVecShrinkToFit(vector));
+    ASSERT_EQ_INT(100, vector->capacity);
+    for (int32_t i = 0; i < 100; i++) ASSERT_EQ_INT(i, IntHeapVecGet(vector, i));
+
+    ASSERT_TRUE(IntHeapVecEraseRange(vector, 0, 100));
+    ASSERT_TRUE(IntHeapVecShrinkToFit(vector));
+    ASSERT_EQ_INT(1, vector->capacity);             // empty vector keeps room for one item
+    ASSERT_TRUE(IntHeapVecAdd(vector, 7));
+    ASSERT_TRUE(IntHeapVecAdd(vector, 8));
+    ASSERT_EQ_INT(8, IntHeapVecGet(vector, 1));
+    IntHeapVecDelete(vector);
+}
+
+static void testHeapVectorRangeErrors() {
+    IntHeapVec *vector = NEW_HEAP_VECTOR(Int, 4);
+    int32_t values[] = {1, 2, 3};
+    ASSERT_TRUE(IntHeapVecAddRange(vector, values, 3));
+    ASSERT_FALSE(IntHeapVecInsertRange(vector, 4, values, 3));   // index past size
+    ASSERT_FALSE(IntHeapVecInsertRange(vector, 0, NULL, 3));
+    ASSERT_TRUE(IntHeapVecInsertRange(vector, 0, NULL, 0));
+    ASSERT_FALSE(IntHeapVecEraseRange(vector, 2, 1));
+    ASSERT_FALSE(IntHeapVecEraseRange(vector, 0, 4));
+    ASSERT_FALSE(IntHeapVecAddRange(NULL, values, 3));
+    ASSERT_EQ_INT(3, vector->size);
+    IntHeapVecDelete(vector);
+}
+
+static void testBufferVectorAgainstModel() {
+    srand(2026);
+    int32_t buffer[MODEL_CAPACITY];
+    ValueVector *vector = NEW_VECTOR_BUFF(int32_t, Value, buffer, MODEL_CAPACITY);
+    static ArrayModel model;
+    model.size = 0;
+    int32_t values[64];
+
+    for (uint32_t step = 0; step < RANDOM_STEPS; step++) {
+        uint32_t length = rand() % 64;
+        uint32_t index = model.size > 0 ? rand() % (model.size + 1) : 0;
+        fillRandom(values, length);
+
+        if (rand() % 3 == 0) {
+            uint32_t toIndex = index + MIN(length * 2, model.size - index);
+            ASSERT_TRUE(ValueVecEraseRange(vector, index, toIndex));
+            modelErase(&model, index, toIndex);
+        } else if (model.size + length <= MODEL_CAPACITY) {
+            ASSERT_TRUE(ValueVecInsertRange(vector, index, values, length));
+            modelInsert(&model, index, values, length);
+        } else {
+            ASSERT_FALSE(ValueVecInsertRange(vector, index, values, length));    // range that doesn't fit is rejected as a whole
+        }
+
+        if (!isSameAsModel(vector->items, vector->size, &model)) {
+            TEST_FAIL("buffer vector differs from model at step %u", step);
+            break;
+        }
+    }
+    for (uint32_t i = model.size; i < MODEL_CAPACITY; i++) {
+        if (buffer[i] != 0) {
+            TEST_FAIL("erased tail not cleared at %u", i);
+            break;
+        }
+    }
+}
+
+static void testBufferVectorRemoveAtBounds() {
+    ValueVector *vector = NEW_VECTOR_OF(8, int32_t, Value, 5, 6, 7);
+    ASSERT_EQ_INT(0, ValueVecRemoveAt(vector, 3));
+    ASSERT_EQ_INT(3, vector->size);
+    ASSERT_EQ_INT(6, ValueVecRemoveAt(vector, 1));
+    ASSERT_EQ_INT(7, ValueVecGet(vector, 1));
+}
+
+static void testVectorSpillAndShrink() {
+    static ArrayModel model;
+    model.size = 0;
+    Vector vector = getVectorInstance(4);
+
+    for (intptr_t i = 1; i <= 1000; i++) {
+        ASSERT_TRUE(vectorAdd(vector, (VectorValueType) i));
+        model.items[model.size++] = (int32_t) i;
+    }
+    srand(41);
+    for (uint32_t step = 0; step < 2000 && model.size > 0; step++) {
+        uint32_t index = rand() % model.size;
+        if (rand() % 2 == 0) {
+            ASSERT_TRUE(vectorAddAt(vector, index, (VectorValueType) (intptr_t) (step + 5000)));
+            int32_t value = (int32_t) (step + 5000);
+            modelInsert(&model, index, &value, 1);
+        } else {
+            VectorValueType removed = vectorRemoveAt(vector, index);    // returns removed item also when capacity shrinks
+            if ((intptr_t) removed != model.items[index]) {
+                TEST_FAIL("removed %ld at %u, expected %d", (long) (intptr_t) removed, index, model.items[index]);
+                break;
+            }
+            modelErase(&model, index, index + 1);
+        }
+    }
+
+    ASSERT_EQ_INT(model.size, getVectorSize(vector));
+    for (uint32_t i = 0; i < model.size; i++) {
+        if ((intptr_t) vectorGet(vector, i) != model.items[i]) {
+            TEST_FAIL("vector differs from model at %u", i);
+            break;
+        }
+    }
+    while (getVectorSize(vector) > 0) {
+        vectorRemoveAt(vector, 0);
+    }
+    ASSERT_TRUE(isVectorEmpty(vector));
+    vectorDelete(vector);
+}
+
+int main() {
+    RUN_TEST(testHeapVectorAgainstModel);
+    RUN_TEST(testHeapVectorReserveAndShrink);
+    RUN_TEST(testHeapVectorRangeErrors);
+    RUN_TEST(testBufferVectorAgainstModel);
+    RUN_TEST(testBufferVectorRemoveAtBounds);
+    RUN_TEST(testVectorSpillAndShrink);
+    return TEST_RESULT();
+}
@@ -0,0 +1,127 @@
+#include "TestUtils.h"
+#include "CronExpression.h"
+
+// Parse time and next fire time throughput, next fire time is what each wakeup computes for sleep duration
+
+static const char *const BENCH_EXPRESSIONS[] = {
+        "0 */5 9-17 * * MON-FRI", "0 0 12 1 * ?", "0 0 0 L * ?", "0 0 0 LW * ?", "0 0 10 15W * ?", "0 0 9 ? * 2#3",
+        "5,10,59 1-3,58 0,23 * JAN,JUL,DEC *", "0 0 0 29 2 ?", "@daily",
+};
+#define BENCH_EXPRESSION_COUNT (sizeof(BENCH_EXPRESSIONS) / sizeof(BENCH_EXPRESSIONS[0]))
+
+static void benchParse() {
+    uint32_t iterations = benchIterations(200000);
+    uint64_t start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        CronExpression cron;
+        benchSink += parseCronExpression(&cron, BENCH_EXPRESSIONS[i % BENCH_EXPRESSION_COUNT]) + cron.hours;
+    }
+    printBenchResult("parseCronExpression", benchNowNanos() - start, iterations);
+}
+
+static void benchNextFireTime() {
+    for (uint32_t e = 0; e < BENCH_EXPRESSION_COUNT; e++) {
+        CronExpression cron;
+        parseCronExpression(&cron, BENCH_EXPRESSIONS[e]);
+        uint32_t iterations = benchIterations(20000);
+        DateTime current = dateTimeOfWithSeconds(2024, 1, 1, 0, 0, 0);
+
+        uint64_t start = benchNowNanos();
+        for (uint32_t i = 0; i < iterations; i++) {
+            current = nextCronDateTime(&cron, &current);
+            if (!isDateTimeValid(&current)) current = dateTimeOfWithSeconds(2024, 1, 1, 0, 0, 0);
+        }
+        uint64_t elapsed = benchNowNanos() - start;
+        benchSink += current.date.day;
+
+        char name[64];
+        snprintf(name, sizeof(name), "nextCronDateTime \"%s\"", BENCH_EXPRESSIONS[e]);
+        printBenchResult(name, elapsed, iterations);
+    }
+}
+
+typedef struct IteratorBenchCase {
+    const char *expression;
+    uint32_t iterations;    // sparse expressions run fewer fire times, so search stays within a few thousand years
+} IteratorBenchCase;
+
+// Dense every-second up to sparse Feb 29 and last weekday ones
+static const IteratorBenchCase ITERATOR_CASES[] = {
+        {"* * * * * *", 100000}, {"*/15 * * * * *", 100000}, {"0 */5 9-17 * * MON-FRI", 100000}, {"0 0 * * * *", 100000},
+        {"0 0 0 LW * ?", 10000}, {"0 0 0 29 2 ?", 1000},
+};
+
+#define BATCH_SIZE 64
+
+static void benchIterator() {     // fire times in a row, as scheduler preview or catch-up after sleep
+    for (uint32_t e = 0; e < ARRAY_SIZE(ITERATOR_CASES); e++) {
+        CronExpression cron;
+        parseCronExpression(&cron, ITERATOR_CASES[e].expression);
+        uint32_t iterations = benchIterations(ITERATOR_CASES[e].iterations);
+        char name[64];
+
+        DateTime current = dateTimeOfWithSeconds(2024, 1, 1, 0, 0, 0);
+        uint64_t start = benchNowNanos();
+        for (uint32_t i = 0; i < iterations; i++) {
+            current = nextCronDateTime(&cron, &current);
+        }
+        benchSink += current.time.minutes;
+        snprintf(name, sizeof(name), "repeated next \"%s\"", ITERATOR_CASES[e].expression);
+        printBenchResult(name, benchNowNanos() - start, iterations);
+
+        DateTime from = dateTimeOfWithSeconds(2024, 1, 1, 0, 0, 0);
+        CronIterator iterator = getCronIterator(&cron, &from);
+        start = benchNowNanos();
+        for (uint32_t i = 0; i < iterations; i++) {
+            hasNextCronDateTime(&iterator, &current);
+        }
+        benchSink += current.time.minutes;
+        snprintf(name, sizeof(name), "iterator \"%s\"", ITERATOR_CASES[e].expression);
+        printBenchResult(name, benchNowNanos() - start, iterations);
+    }
+}
+
+static void benchBatch() {    // per fire time for nextCronDateTimes, per call for a one day cronDateTimesUntil window
+    DateTime results[BATCH_SIZE];
+    for (uint32_t e = 0; e < ARRAY_SIZE(ITERATOR_CASES); e++) {
+        CronExpression cron;
+        parseCronExpression(&cron, ITERATOR_CASES[e].expression);
+        uint32_t iterations = benchIterations(ITERATOR_CASES[e].iterations);
+        char name[64];
+
+        DateTime current = dateTimeOfWithSeconds(2024, 1, 1, 0, 0, 0);
+        uint32_t resultCount = 0;
+        uint64_t start = benchNowNanos();
+        while (resultCount < iterations) {
+            uint32_t count = nextCronDateTimes(&cron, &current, results, MIN(BATCH_SIZE, iterations - resultCount));
+            if (count == 0) break;
+            current = results[count - 1];
+            resultCount += count;
+        }
+        benchSink += current.time.minutes;
+        snprintf(name, sizeof(name), "nextCronDateTimes \"%s\"", ITERATOR_CASES[e].expression);
+        printBenchResult(name, benchNowNanos() - start, resultCount);
+
+        uint32_t windows = benchIterations(ITERATOR_CASES[e].iterations / 10);
+        current = dateTimeOfWithSeconds(2024, 1, 1, 0, 0, 0);
+        start = benchNowNanos();
+        for (uint32_t i = 0; i < windows; i++) {
+            DateTime until = current;
+            dateTimePlusDays(&until, 1);
+            uint32_t count = cronDateTimesUntil(&cron, &current, &until, results, BATCH_SIZE);
+            current = count == BATCH_SIZE ? results[count - 1] : until;     // full batch continues from last result
+            benchSink += count;
+        }
+        snprintf(name, sizeof(name), "cronDateTimesUntil day \"%s\"", ITERATOR_CASES[e].expression);
+        printBenchResult(name, benchNowNanos() - start, windows);
+    }
+}
+
+int main(int argc, char **argv) {
+    initBench(argc, argv);
+    benchParse();
+    benchNextFireTime();
+    benchIterator();
+    benchBatch();
+    return 0;
+}
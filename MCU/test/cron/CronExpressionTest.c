@@ -0,0 +1,346 @@
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "CronExpression.h"
+#include "CronBitScan.h"
+
+#define REFERENCE_MAX_SEARCH_DAYS (366 * 9)     // "0 0 0 29 2 ?" can wait 8 years
+#define CROSS_CHECK_FIRE_COUNT 60
+#define ITERATOR_CHECK_FIRE_COUNT 2000
+
+// Standard and Quartz expressions, cross-checked against reference from several start dates
+static const char *const CROSS_CHECK_EXPRESSIONS[] = {
+        "* * * * * *", "0 0 * * * *", "*/15 * * * * *", "0 */5 9-17 * * MON-FRI", "0 0 12 1 * ?", "0 30 6 ? * SUN",
+        "0 0 0 L * ?", "0 0 0 LW * ?", "0 0 0 L-3 * ?", "0 0 10 15W * ?", "0 0 0 ? * 5L", "0 0 9 ? * 2#3",
+        "0 0 0 29 2 ?", "0 0 0 1,15,L * ?", "5,10,59 1-3,58 0,23 * JAN,JUL,DEC *", "0 0 0 31 * *", "0 0 0 * * 0",
+        "0 0 0 * * 7", "30 45 23 * * 1-5", "0 0 0-23/7 * * *", "0 0 0 ? 2 1#1", "59 59 23 31 12 *", "0 0 0 ? * SAT,SUN",
+        "0 0/20 * * * *", "0 0 6-18/3 10-20 3-9 *", "0 15 10 ? * 6L", "0 0 12 ? * 1#5", "0 0 8 L-30 * ?", "0 0 8 10W * ?",
+        "@daily", "@hourly", "@weekly", "@monthly", "@yearly",
+};
+
+static const char *const CRON_MACROS[][2] = {
+        {"@yearly", "0 0 0 1 1 *"}, {"@annually", "0 0 0 1 1 *"}, {"@monthly", "0 0 0 1 * *"},
+        {"@weekly", "0 0 0 * * 0"}, {"@daily", "0 0 0 * * *"}, {"@midnight", "0 0 0 * * *"}, {"@hourly", "0 0 * * * *"},
+};
+
+typedef struct ReferenceDayRule {
+    bool isLastDay;             // "L", also inside list "1,15,L"
+    bool isLastWeekday;         // "LW"
+    int32_t lastDayOffset;      // "L-3", -1 when not set
+    int32_t nearestWeekday;     // "15W", 0 when not set
+    int32_t lastWeekdayOfMonth; // "5L", 0 when not set
+    int32_t weekdayOfMonth;     // "2#3" weekday, 0 when not set
+    int32_t weekdayCount;       // "2#3" count
+} ReferenceDayRule;
+
+static bool isDateTimeSame(DateTime *expected, DateTime *actual) {
+    return expected->date.year == actual->date.year && expected->date.month == actual->date.month && expected->date.day == actual->date.day &&
+           expected->time.hours == actual->time.hours && expected->time.minutes == actual->time.minutes && expected->time.seconds == actual->time.seconds;
+}
+
+static DateTime dateTimeOfFields(const int32_t *fields) {
+    return dateTimeOfWithSeconds(fields[0], fields[1], fields[2], fields[3], fields[4], fields[5]);
+}
+
+static void dateTimeToText(DateTime *dateTime, char *buffer, size_t size) {
+    snprintf(buffer, size, "%04lld-%02d-%02d %02d:%02d:%02d", (long long) dateTime->date.year, dateTime->date.month, dateTime->date.day,
+             dateTime->time.hours, dateTime->time.minutes, dateTime->time.seconds);
+}
+
+/*
+ * Reference evaluator, independent of search engine. Day of month and day of week special values are read from expression text
+ * by Quartz definitions, plain fields come from parsed bitsets. Each candidate second of each matching day is checked one by one.
+ */
+static const char *expandCronMacro(const char *expression) {
+    for (size_t i = 0; i < sizeof(CRON_MACROS) / sizeof(CRON_MACROS[0]); i++) {
+        if (strcmp(expression, CRON_MACROS[i][0]) == 0) return CRON_MACROS[i][1];
+    }
+    return expression;
+}
+
+static ReferenceDayRule parseReferenceDayRule(const char *expression) {
+    ReferenceDayRule rule = {.lastDayOffset = -1};
+    char fields[6][32] = {0};
+    sscanf(expandCronMacro(expression), "%31s %31s %31s %31s %31s %31s", fields[0], fields[1], fields[2], fields[3], fields[4], fields[5]);
+    const char *dayOfMonth = fields[3];
+    const char *dayOfWeek = fields[5];
+
+    if (strcmp(dayOfMonth, "LW") == 0) {
+        rule.isLastWeekday = true;
+    } else if (strncmp(dayOfMonth, "L-", 2) == 0) {
+        rule.lastDayOffset = atoi(dayOfMonth + 2);
+    } else if (strchr(dayOfMonth, 'W') != NULL) {
+        rule.nearestWeekday = atoi(dayOfMonth);
+    } else if (strcmp(dayOfMonth, "L") == 0 || strstr(dayOfMonth, ",L") != NULL) {
+        rule.isLastDay = true;
+    }
+
+    const char *hash = strchr(dayOfWeek, '#');
+    if (hash != NULL) {
+        rule.weekdayOfMonth = atoi(dayOfWeek) == 0 ? SUNDAY : atoi(dayOfWeek);
+        rule.weekdayCount = atoi(hash + 1);
+    } else if (strchr(dayOfWeek, 'L') != NULL) {
+        rule.lastWeekdayOfMonth = atoi(dayOfWeek) == 0 ? SUNDAY : atoi(dayOfWeek);
+    }
+    return rule;
+}
+
+static bool isBitOn(uint64_t bits, int32_t index) {
+    return index >= 0 && index < 64 && ((bits >> index) & 1ULL);
+}
+
+static int32_t nearestWeekdayInMonth(Date *date, int32_t day) {    // Quartz "W": never leaves the month
+    int32_t monthLength = lengthOfMonth(date->month, isLeapYear(date->year));
+    if (day > monthLength) return -1;
+    Date target = dateOf(date->year, date->month, day);
+    if (target.weekDay == SATURDAY) return day == 1 ? 3 : day - 1;
+    if (target.weekDay == SUNDAY) return day == monthLength ? day - 2 : day + 1;
+    return day;
+}
+
+static bool isReferenceDayMatch(CronExpression *cron, ReferenceDayRule *rule, Date *date) {
+    int32_t monthLength = lengthOfMonth(date->month, isLeapYear(date->year));
+    bool isDayOfMonthMatch;
+    if (rule->isLastWeekday) {
+        int32_t lastWeekday = monthLength;
+        while (dateOf(date->year, date->month, lastWeekday).weekDay > FRIDAY) lastWeekday--;
+        isDayOfMonthMatch = date->day == lastWeekday;
+    } else if (rule->lastDayOffset >= 0) {
+        isDayOfMonthMatch = date->day == monthLength - rule->lastDayOffset;
+    } else if (rule->nearestWeekday > 0) {
+        isDayOfMonthMatch = date->day == nearestWeekdayInMonth(date, rule->nearestWeekday);
+    } else {
+        isDayOfMonthMatch = isBitOn(cron->daysOfMonth, date->day) || (rule->isLastDay && date->day == monthLength);
+    }
+
+    bool isDayOfWeekMatch;
+    if (rule->weekdayOfMonth != 0) {
+        isDayOfWeekMatch = date->weekDay == rule->weekdayOfMonth && (date->day - 1) / 7 + 1 == rule->weekdayCount;
+    } else if (rule->lastWeekdayOfMonth != 0) {
+        isDayOfWeekMatch = date->weekDay == rule->lastWeekdayOfMonth && date->day + 7 > monthLength;
+    } else {
+        isDayOfWeekMatch = isBitOn(cron->daysOfWeek, date->weekDay);
+    }
+    return isDayOfMonthMatch && isDayOfWeekMatch;
+}
+
+static bool referenceNextFireTime(CronExpression *cron, ReferenceDayRule *rule, DateTime *from, DateTime *next) {
+    DateTime start = *from;
+    dateTimePlusSeconds(&start, 1);     // strictly after start date
+    Date date = start.date;
+    for (int32_t dayIndex = 0; dayIndex < REFERENCE_MAX_SEARCH_DAYS; dayIndex++) {
+        if (isBitOn(cron->months, date.month) && isReferenceDayMatch(cron, rule, &date)) {
+            int32_t firstSecond = dayIndex == 0 ? start.time.hours * 3600 + start.time.minutes * 60 + start.time.seconds : 0;
+            for (int32_t second = firstSecond; second < 86400; second++) {
+                if (isBitOn(cron->hours, second / 3600) && isBitOn(cron->minutes, second / 60 % 60) && isBitOn(cron->seconds, second % 60)) {
+                    *next = dateTimeOfWithSeconds(date.year, date.month, date.day, second / 3600, second / 60 % 60, second % 60);
+                    return true;
+                }
+            }
+        }
+        datePlusDays(&date, 1);
+    }
+    return false;
+}
+
+
+static void testParseValidExpressions() {
+    for (size_t i = 0; i < sizeof(CROSS_CHECK_EXPRESSIONS) / sizeof(CROSS_CHECK_EXPRESSIONS[0]); i++) {
+        CronExpression cron;
+        CronStatus status = parseCronExpression(&cron, CROSS_CHECK_EXPRESSIONS[i]);
+        if (status != CRON_OK) TEST_FAIL("\"%s\": status %d", CROSS_CHECK_EXPRESSIONS[i], status);
+    }
+}
+
+static void testParseBitsets() {
+    CronExpression cron;
+    ASSERT_EQ_INT(CRON_OK, parseCronExpression(&cron, "0,30 5-7 */6 1,L JAN,DEC MON-FRI"));
+    ASSERT_EQ_INT((1ULL << 0) | (1ULL << 30), cron.seconds);
+    ASSERT_EQ_INT((1ULL << 5) | (1ULL << 6) | (1ULL << 7), cron.minutes);
+    ASSERT_EQ_INT((1ULL << 0) | (1ULL << 6) | (1ULL << 12) | (1ULL << 18), cron.hours);
+    ASSERT_EQ_INT(1ULL << 1, cron.daysOfMonth & 0xFFFFFFFEULL);    // "L" is option, it doesn't set bits of days 1-31
+    ASSERT_EQ_INT((1ULL << 1) | (1ULL << 12), cron.months);
+    ASSERT_EQ_INT(0x3EULL, cron.daysOfWeek);         // Monday 1 ... Friday 5
+
+    ASSERT_EQ_INT(CRON_OK, parseCronExpression(&cron, "0 0 0 ? * 0"));
+    ASSERT_EQ_INT(1ULL << SUNDAY, cron.daysOfWeek); // 0 and 7 are Sunday
+    ASSERT_EQ_INT(0xFFFFFFFEULL, cron.daysOfMonth); // "?" is any day, 1-31
+}
+
+static void testParseErrors() {
+    CronExpression cron;
+    ASSERT_EQ_INT(CRON_ERROR_EMPTY_STRING, parseCronExpression(&cron, ""));
+    ASSERT_EQ_INT(CRON_ERROR_EMPTY_STRING, parseCronExpression(&cron, "   "));
+    ASSERT_EQ_INT(CRON_ERROR_INVALID_NUMBER_OF_FIELDS, parseCronExpression(&cron, "0 0 * * *"));
+    ASSERT_EQ_INT(CRON_ERROR_RANGE_EXCEEDS_MAX, parseCronExpression(&cron, "60 * * * * *"));
+    ASSERT_EQ_INT(CRON_ERROR_RANGE_EXCEEDS_MAX, parseCronExpression(&cron, "0 0 24 * * *"));
+    ASSERT_EQ_INT(CRON_ERROR_RANGE_MIN_GREATER_THAN_MAX, parseCronExpression(&cron, "5-1 * * * * *"));
+    ASSERT_EQ_INT(CRON_ERROR_INCREMENTER_INVALID_VALUE, parseCronExpression(&cron, "*/0 * * * * *"));
+    ASSERT_EQ_INT(CRON_ERROR_QUESTION_MARK_NOT_ALLOWED, parseCronExpression(&cron, "? * * * * *"));
+    ASSERT_EQ_INT(CRON_ERROR_LAST_DAY_OFFSET_INVALID, parseCronExpression(&cron, "0 0 0 L-31 * ?"));
+    ASSERT_EQ_INT(CRON_ERROR_UNRECOGNIZED_CHAR_NEAR_L, parseCronExpression(&cron, "0 0 0 LX * ?"));
+}
+
+static void testKnownFireTimes() {
+    static const struct {
+        const char *expression;
+        int32_t from[6];        // year, month, day, hours, minutes, seconds
+        int32_t expected[6];
+    } CASES[] = {
+            {"0 0 12 * * ?",  {2024, 1, 1, 12, 0, 0},  {2024, 1, 2, 12, 0, 0}},
+            {"0 0 0 L * ?",   {2024, 2, 1, 0, 0, 0},   {2024, 2, 29, 0, 0, 0}},
+            {"0 0 0 L * ?",   {2023, 2, 1, 0, 0, 0},   {2023, 2, 28, 0, 0, 0}},
+            {"0 0 0 LW * ?",  {2024, 3, 1, 0, 0, 0},   {2024, 3, 29, 0, 0, 0}},    // 31st is Sunday
+            {"0 0 0 L-3 * ?", {2024, 2, 1, 0, 0, 0},   {2024, 2, 26, 0, 0, 0}},
+            {"0 0 10 15W * ?", {2024, 6, 1, 0, 0, 0},  {2024, 6, 14, 10, 0, 0}},   // 15th is Saturday
+            {"0 0 0 ? * 5L",  {2024, 5, 1, 0, 0, 0},   {2024, 5, 31, 0, 0, 0}},    // last Friday
+            {"0 0 9 ? * 2#3", {2024, 5, 1, 0, 0, 0},   {2024, 5, 21, 9, 0, 0}},    // third Tuesday
+            {"0 0 0 29 2 ?",  {2024, 3, 1, 0, 0, 0},   {2028, 2, 29, 0, 0, 0}},
+            {"@hourly",       {2024, 12, 31, 23, 0, 0}, {2025, 1, 1, 0, 0, 0}},
+            {"@weekly",       {2024, 5, 1, 0, 0, 0},   {2024, 5, 5, 0, 0, 0}},     // Sunday
+    };
+
+    for (size_t i = 0; i < sizeof(CASES) / sizeof(CASES[0]); i++) {
+        CronExpression cron;
+        ASSERT_EQ_INT(CRON_OK, parseCronExpression(&cron, CASES[i].expression));
+        DateTime from = dateTimeOfFields(CASES[i].from);
+        DateTime expected = dateTimeOfFields(CASES[i].expected);
+        DateTime next = nextCronDateTime(&cron, &from);
+        if (!isDateTimeSame(&expected, &next)) {
+            char expectedText[32], actualText[32];
+            dateTimeToText(&expected, expectedText, sizeof(expectedText));
+            dateTimeToText(&next, actualText, sizeof(actualText));
+            TEST_FAIL("\"%s\": expected %s, got %s", CASES[i].expression, expectedText, actualText);
+        }
+    }
+}
+
+static void testCrossCheckWithReference() {
+    static const int32_t STARTS[][6] = {
+            {2023, 1, 1, 0, 0, 0}, {2024, 2, 28, 23, 59, 59}, {2025, 12, 31, 23, 59, 30}, {2026, 7, 15, 12, 34, 56},
+    };
+    uint32_t checkedCount = 0;
+    for (size_t e = 0; e < sizeof(CROSS_CHECK_EXPRESSIONS) / sizeof(CROSS_CHECK_EXPRESSIONS[0]); e++) {
+        const char *expression = CROSS_CHECK_EXPRESSIONS[e];
+        CronExpression cron;
+        parseCronExpression(&cron, expression);
+        CronExpression referenceCron = cron;   // reference reads bitsets of the parsed expression only
+        ReferenceDayRule rule = parseReferenceDayRule(expression);
+
+        for (size_t s = 0; s < sizeof(STARTS) / sizeof(STARTS[0]); s++) {
+            DateTime current = dateTimeOfFields(STARTS[s]);
+            for (uint32_t i = 0; i < CROSS_CHECK_FIRE_COUNT; i++) {
+                DateTime expected = {0};
+                bool isFound = referenceNextFireTime(&referenceCron, &rule, &current, &expected);
+                DateTime next = nextCronDateTime(&cron, &current);
+                checkedCount++;
+                if (!isFound || !isDateTimeSame(&expected, &next)) {
+                    char fromText[32], expectedText[32], actualText[32];
+                    dateTimeToText(&current, fromText, sizeof(fromText));
+                    dateTimeToText(&expected, expectedText, sizeof(expectedText));
+                    dateTimeToText(&next, actualText, sizeof(actualText));
+                    TEST_FAIL("\"%s\" after %s: expected %s, got %s", expression, fromText, isFound ? expectedText : "none", actualText);
+                    break;
+                }
+                current = next;
+            }
+        }
+    }
+    printf("cross-checked %u fire times\n", checkedCount);
+}
+
+static void testIteratorMatchesRepeatedNext() {   // iterator continues from previous result, it must give same times as full searches
+    static const int32_t STARTS[][6] = {
+            {2023, 1, 1, 0, 0, 0}, {2024, 2, 28, 23, 59, 59}, {2025, 12, 31, 23, 59, 30}, {2026, 7, 15, 12, 34, 56},
+    };
+    uint32_t checkedCount = 0;
+    for (size_t e = 0; e < sizeof(CROSS_CHECK_EXPRESSIONS) / sizeof(CROSS_CHECK_EXPRESSIONS[0]); e++) {
+        CronExpression cron;
+        parseCronExpression(&cron, CROSS_CHECK_EXPRESSIONS[e]);
+        for (size_t s = 0; s < sizeof(STARTS) / sizeof(STARTS[0]); s++) {
+            DateTime current = dateTimeOfFields(STARTS[s]);
+            CronIterator iterator = getCronIterator(&cron, &current);
+            for (uint32_t i = 0; i < ITERATOR_CHECK_FIRE_COUNT; i++) {
+                DateTime expected = nextCronDateTime(&cron, &current);
+                DateTime next = {0};
+                ASSERT_TRUE(hasNextCronDateTime(&iterator, &next));
+                checkedCount++;
+                if (!isDateTimeSame(&expected, &next)) {
+                    char fromText[32], expectedText[32], actualText[32];
+                    dateTimeToText(&current, fromText, sizeof(fromText));
+                    dateTimeToText(&expected, expectedText, sizeof(expectedText));
+                    dateTimeToText(&next, actualText, sizeof(actualText));
+                    TEST_FAIL("\"%s\" after %s: next %s, iterator %s", CROSS_CHECK_EXPRESSIONS[e], fromText, expectedText, actualText);
+                    break;
+                }
+                current = expected;
+            }
+        }
+    }
+    printf("iterator checked %u fire times\n", checkedCount);
+}
+
+static void testBatchFireTimes() {
+    CronExpression cron;
+    parseCronExpression(&cron, "0 */5 9-17 * * MON-FRI");
+    DateTime from = dateTimeOfWithSeconds(2024, 5, 3, 17, 50, 0);    // Friday
+    DateTime results[8];
+    ASSERT_EQ_INT(8, nextCronDateTimes(&cron, &from, results, 8));
+    DateTime current = from;
+    for (uint32_t i = 0; i < 8; i++) {
+        DateTime expected = nextCronDateTime(&cron, &current);
+        ASSERT_TRUE(isDateTimeSame(&expected, &results[i]));
+        current = expected;
+    }
+    DateTime monday = dateTimeOfWithSeconds(2024, 5, 6, 9, 0, 0);
+    ASSERT_TRUE(isDateTimeSame(&monday, &results[1]));     // 17:55, then weekend is skipped
+    ASSERT_EQ_INT(0, nextCronDateTimes(&cron, &from, results, 0));
+
+    DateTime until = dateTimeOfWithSeconds(2024, 5, 6, 9, 10, 0);
+    ASSERT_EQ_INT(4, cronDateTimesUntil(&cron, &from, &until, results, 8));    // 17:55, 9:00, 9:05, 9:10 is included
+    ASSERT_TRUE(isDateTimeSame(&until, &results[3]));
+    ASSERT_EQ_INT(2, cronDateTimesUntil(&cron, &from, &until, results, 2));     // capacity limits results
+    ASSERT_EQ_INT(0, cronDateTimesUntil(&cron, &until, &from, results, 8));     // window end before start
+
+    DateTime invalid = {0};
+    CronIterator iterator = getCronIterator(&cron, &invalid);
+    ASSERT_FALSE(hasNextCronDateTime(&iterator, &results[0]));
+}
+
+static void testBitScansAgainstLinearScan() {     // builtin or portable fallback, same as the linked cron library variant
+    uint64_t bitsets[64 + 4] = {0, UINT64_MAX, 0x8000000000000001ULL, 0x0F0F0F0F0F0F0F0FULL};
+    uint64_t random = 0x9E3779B97F4A7C15ULL;
+    for (uint32_t i = 4; i < ARRAY_SIZE(bitsets); i++) {
+        random ^= random << 13, random ^= random >> 7, random ^= random << 17;
+        bitsets[i] = (i % 2 == 0) ? (1ULL << (i - 4)) : random & (random >> 29);    // single bits and sparse random sets
+    }
+
+    uint32_t mismatches = 0;
+    for (uint32_t i = 0; i < ARRAY_SIZE(bitsets); i++) {
+        for (uint32_t fromIndex = 0; fromIndex <= CRON_BITSET_SIZE; fromIndex++) {
+            int32_t expectedNext = BIT_NOT_FOUND;
+            for (int32_t bit = (int32_t) fromIndex; bit < CRON_BITSET_SIZE && expectedNext == BIT_NOT_FOUND; bit++) {
+                if ((bitsets[i] >> bit) & 1ULL) expectedNext = bit;
+            }
+            int32_t expectedPrevious = BIT_NOT_FOUND;
+            for (int32_t bit = (int32_t) MIN(fromIndex, CRON_BITSET_SIZE - 1); bit >= 0 && expectedPrevious == BIT_NOT_FOUND; bit--) {
+                if ((bitsets[i] >> bit) & 1ULL) expectedPrevious = bit;
+            }
+            mismatches += nextSetBit(bitsets[i], fromIndex) != expectedNext;
+            mismatches += previousSetBit(bitsets[i], fromIndex) != expectedPrevious;
+        }
+    }
+    ASSERT_EQ_INT(0, mismatches);
+}
+
+int main() {
+    RUN_TEST(testBitScansAgainstLinearScan);
+    RUN_TEST(testParseValidExpressions);
+    RUN_TEST(testParseBitsets);
+    RUN_TEST(testParseErrors);
+    RUN_TEST(testKnownFireTimes);
+    RUN_TEST(testCrossCheckWithReference);
+    RUN_TEST(testIteratorMatchesRepeatedNext);
+    RUN_TEST(testBatchFireTimes);
+    return TEST_RESULT();
+}
@@ -0,0 +1,88 @@
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "CronScheduler.h"
+
+// Next due job from heap against scanning every job, 10 - 10000 jobs firing every few minutes, and O(log n) job update
+
+static void benchPoll(uint32_t jobCount) {
+    static const char *const expressions[] = {"0 */5 * * * *", "0 */3 * * * *", "30 */7 * * * *", "0 0 * * * *"};
+    CronScheduler *scheduler = newCronScheduler(jobCount);
+    CronJob **jobs = malloc(jobCount * sizeof(CronJob *));
+    DateTime start = dateTimeOfWithSeconds(2024, 1, 1, 0, 0, 0);
+    for (uint32_t i = 0; i < jobCount; i++) {
+        CronExpression cron;
+        parseCronExpression(&cron, expressions[i % 4]);
+        DateTime from = start;
+        dateTimePlusSeconds(&from, i * 17);
+        jobs[i] = cronSchedulerAdd(scheduler, i, &cron, NULL, &from);
+    }
+
+    uint32_t iterations = benchIterations(2000000 / jobCount + 100);
+    char name[64];
+    uint64_t startNanos = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += cronSchedulerPeek(scheduler)->nextEpochSecond;
+    }
+    snprintf(name, sizeof(name), "heap peek, %u jobs", jobCount);
+    printBenchResult(name, benchNowNanos() - startNanos, iterations);
+
+    startNanos = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {    // what a wakeup without scheduler does: earliest of all next fire times
+        int64_t minEpochSecond = INT64_MAX;
+        for (uint32_t j = 0; j < jobCount; j++) {
+            minEpochSecond = jobs[j]->nextEpochSecond < minEpochSecond ? jobs[j]->nextEpochSecond : minEpochSecond;
+        }
+        benchSink += minEpochSecond;
+    }
+    snprintf(name, sizeof(name), "linear min, %u jobs", jobCount);
+    printBenchResult(name, benchNowNanos() - startNanos, iterations);
+
+    uint32_t pollCount = 0;
+    DateTime now = start;
+    startNanos = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        dateTimePlusSeconds(&now, 60);
+        DateTime fired;
+        while (cronSchedulerPoll(scheduler, &now, &fired) != NULL) {
+            pollCount++;
+        }
+    }
+    uint64_t elapsed = benchNowNanos() - startNanos;
+    snprintf(name, sizeof(name), "poll + reschedule, %u jobs", jobCount);
+    printBenchResult(name, elapsed, pollCount > 0 ? pollCount : 1);
+
+    CronExpression updatedCron[4];
+    for (uint32_t i = 0; i < 4; i++) {
+        parseCronExpression(&updatedCron[i], expressions[(i + 1) % 4]);
+    }
+    uint32_t updateCount = benchIterations(200000);
+    startNanos = benchNowNanos();
+    for (uint32_t i = 0; i < updateCount; i++) {   // edited job: new expression, next fire time search and heap sift
+        CronJob *job = jobs[(i * 7919u) % jobCount];
+        benchSink += cronSchedulerUpdate(scheduler, job, &updatedCron[i % 4], &now);
+    }
+    snprintf(name, sizeof(name), "update, %u jobs", jobCount);
+    printBenchResult(name, benchNowNanos() - startNanos, updateCount);
+
+    startNanos = benchNowNanos();
+    for (uint32_t i = 0; i < updateCount; i++) {   // same next fire time search without scheduler, to split heap part out
+        DateTime next = nextCronDateTime(&updatedCron[i % 4], &now);
+        benchSink += next.time.minutes;
+    }
+    snprintf(name, sizeof(name), "nextCronDateTime only, %u jobs", jobCount);
+    printBenchResult(name, benchNowNanos() - startNanos, updateCount);
+
+    free(jobs);
+    deleteCronScheduler(scheduler);
+}
+
+int main(int argc, char **argv) {
+    initBench(argc, argv);
+    benchPoll(10);
+    benchPoll(100);
+    benchPoll(1000);
+    benchPoll(5000);
+    benchPoll(10000);
+    return 0;
+}
@@ -0,0 +1,151 @@
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "CronScheduler.h"
+
+// Scheduler heap against linear minimum under random add, update, remove and poll steps
+
+static const char *const JOB_EXPRESSIONS[] = {
+        "0 */5 * * * *", "0 0 12 * * ?", "30 15 * * * *", "0 0 0 L * ?", "0 0 9 ? * 2#3", "*/7 * * * * *", "0 0 0 29 2 ?", "0 30 6 ? * SUN",
+};
+
+#define MAX_JOBS 1000
+
+static bool isHeapValid(CronScheduler *scheduler) {
+    for (uint32_t i = 0; i < scheduler->size; i++) {
+        if (scheduler->queue[i]->queueIndex != i) return false;
+        if (i > 0 && scheduler->queue[(i - 1) / 2]->nextEpochSecond > scheduler->queue[i]->nextEpochSecond) return false;
+    }
+    return true;
+}
+
+static CronExpression randomExpression() {
+    CronExpression cron;
+    parseCronExpression(&cron, JOB_EXPRESSIONS[rand() % ARRAY_SIZE(JOB_EXPRESSIONS)]);
+    return cron;
+}
+
+static void testRandomOperationsAgainstLinearMin() {
+    static CronJob *handles[MAX_JOBS];
+    uint32_t jobCount = 0;
+    CronScheduler *scheduler = newCronScheduler(MAX_JOBS);
+    DateTime start = dateTimeOfWithSeconds(2024, 1, 1, 0, 0, 0);
+    srand(38);
+    for (uint32_t i = 0; i < 300; i++) {
+        CronExpression cron = randomExpression();
+        DateTime from = start;
+        dateTimePlusSeconds(&from, rand() % 100000);
+        handles[jobCount++] = cronSchedulerAdd(scheduler, i, &cron, NULL, &from);
+    }
+
+    uint32_t pollCount = 0;
+    for (uint32_t step = 0; step < 3000; step++) {
+        uint32_t operation = rand() % 40;
+        if (operation == 0 && jobCount > 0) {
+            uint32_t index = rand() % jobCount;
+            cronSchedulerRemove(scheduler, handles[index]);
+            handles[index] = handles[--jobCount];
+
+        } else if (operation == 1 && jobCount > 0) {
+            CronExpression cron = randomExpression();
+            DateTime from = start;
+            dateTimePlusSeconds(&from, rand() % 1000000);
+            ASSERT_TRUE(cronSchedulerUpdate(scheduler, handles[rand() % jobCount], &cron, &from));
+
+        } else if (operation == 2 && jobCount < MAX_JOBS) {
+            CronExpression cron = randomExpression();
+            DateTime from = start;
+            dateTimePlusSeconds(&from, step * 60);
+            handles[jobCount] = cronSchedulerAdd(scheduler, 1000 + step, &cron, NULL, &from);
+            ASSERT_TRUE(handles[jobCount] != NULL);
+            jobCount++;
+
+        } else {
+            DateTime now = start;
+            dateTimePlusSeconds(&now, step * 60);
+            int64_t nowEpochSecond = dateTimeToEpochSecond(&now, 0);
+            while (true) {
+                int64_t minEpochSecond = INT64_MAX;
+                for (uint32_t i = 0; i < jobCount; i++) {
+                    minEpochSecond = handles[i]->nextEpochSecond < minEpochSecond ? handles[i]->nextEpochSecond : minEpochSecond;
+                }
+                DateTime fired;
+                CronJob *job = cronSchedulerPoll(scheduler, &now, &fired);
+                if (job == NULL) {
+                    if (minEpochSecond <= nowEpochSecond) TEST_FAIL("step %u: due job at %lld not polled", step, (long long) minEpochSecond);
+                    break;
+                }
+                if (dateTimeToEpochSecond(&fired, 0) != minEpochSecond) {
+                    TEST_FAIL("step %u: polled %lld, earliest is %lld", step, (long long) dateTimeToEpochSecond(&fired, 0), (long long) minEpochSecond);
+                    break;
+                }
+                ASSERT_TRUE(job->nextEpochSecond > nowEpochSecond);   // rescheduled after now, not after missed fire time
+                pollCount++;
+            }
+        }
+
+        if (!isHeapValid(scheduler) || getCronSchedulerSize(scheduler) != jobCount) {
+            TEST_FAIL("step %u: heap invariant broken", step);
+            break;
+        }
+    }
+    printf("polled %u jobs, %u left\n", pollCount, jobCount);
+    deleteCronScheduler(scheduler);
+}
+
+static void testMissedFireTimesCoalesced() {    // every minute job polled 30 minutes late runs once
+    CronScheduler *scheduler = newCronScheduler(4);
+    CronExpression cron;
+    parseCronExpression(&cron, "0 * * * * *");
+    DateTime from = dateTimeOfWithSeconds(2024, 1, 1, 10, 0, 0);
+    cronSchedulerAdd(scheduler, 1, &cron, NULL, &from);
+
+    DateTime now = dateTimeOfWithSeconds(2024, 1, 1, 10, 30, 0);
+    DateTime fired;
+    uint32_t runCount = 0;
+    DateTime firstFired = {0};
+    while (cronSchedulerPoll(scheduler, &now, &fired) != NULL) {
+        if (runCount++ == 0) firstFired = fired;
+    }
+    ASSERT_EQ_INT(1, runCount);
+    ASSERT_EQ_INT(1, firstFired.time.minutes);     // reported with first missed fire time
+    ASSERT_EQ_INT(31, cronSchedulerPeek(scheduler)->nextDateTime.time.minutes);
+    deleteCronScheduler(scheduler);
+}
+
+static void testHandlesAndCapacity() {
+    CronScheduler *scheduler = newCronScheduler(2);
+    CronExpression cron;
+    parseCronExpression(&cron, "0 0 12 * * ?");
+    DateTime from = dateTimeOfWithSeconds(2024, 1, 1, 0, 0, 0);
+    int payload = 42;
+    CronJob *first = cronSchedulerAdd(scheduler, 7, &cron, &payload, &from);
+    CronJob *second = cronSchedulerAdd(scheduler, 8, &cron, NULL, &from);
+    ASSERT_TRUE(first != NULL && second != NULL);
+    ASSERT_TRUE(cronSchedulerAdd(scheduler, 9, &cron, NULL, &from) == NULL);   // full
+    ASSERT_TRUE(findCronSchedulerJob(scheduler, 7) == first);
+    ASSERT_TRUE(findCronSchedulerJob(scheduler, 7)->payload == &payload);
+    ASSERT_TRUE(findCronSchedulerJob(scheduler, 9) == NULL);
+
+    parseCronExpression(&cron, "0 0 6 * * ?");
+    ASSERT_TRUE(cronSchedulerUpdate(scheduler, second, &cron, &from));
+    ASSERT_TRUE(cronSchedulerPeek(scheduler) == second);
+    ASSERT_TRUE(cronSchedulerUpdate(scheduler, second, NULL, &second->nextDateTime));   // keep expression, move to next day
+    ASSERT_TRUE(cronSchedulerPeek(scheduler) == first);
+
+    cronSchedulerRemove(scheduler, first);
+    ASSERT_EQ_INT(1, getCronSchedulerSize(scheduler));
+    ASSERT_TRUE(findCronSchedulerJob(scheduler, 7) == NULL);
+    cronSchedulerRemove(scheduler, second);
+    ASSERT_TRUE(cronSchedulerPeek(scheduler) == NULL);
+    DateTime fired;
+    ASSERT_TRUE(cronSchedulerPoll(scheduler, &from, &fired) == NULL);
+    deleteCronScheduler(scheduler);
+}
+
+int main() {
+    RUN_TEST(testRandomOperationsAgainstLinearMin);
+    RUN_TEST(testMissedFireTimesCoalesced);
+    RUN_TEST(testHandlesAndCapacity);
+    return TEST_RESULT();
+}
@@ -0,0 +1,37 @@
+#include "TestUtils.h"
+#include "CronStore.h"
+
+// Restoring expression on wakeup: parse source again, deserialize stored binary form or take it from parse cache
+
+int main(int argc, char **argv) {
+    initBench(argc, argv);
+    static const char *const expressions[] = {"0 */5 9-17 * * MON-FRI", "0 0 9 ? * 2#3", "5,10,59 1-3,58 0,23 * JAN,JUL,DEC *"};
+    for (uint32_t e = 0; e < ARRAY_SIZE(expressions); e++) {
+        const char *source = expressions[e];
+        uint32_t iterations = benchIterations(200000);
+        printf("\"%s\"\n", source);
+        CronExpression cron;
+
+        uint64_t start = benchNowNanos();
+        for (uint32_t i = 0; i < iterations; i++) {
+            benchSink += parseCronExpression(&cron, source);
+        }
+        printBenchResult("parse", benchNowNanos() - start, iterations);
+
+        uint8_t buffer[CRON_BINARY_SIZE];
+        serializeCronExpression(&cron, source, buffer, sizeof(buffer));
+        start = benchNowNanos();
+        for (uint32_t i = 0; i < iterations; i++) {
+            benchSink += deserializeCronExpression(&cron, source, buffer, sizeof(buffer));
+        }
+        printBenchResult("deserialize", benchNowNanos() - start, iterations);
+
+        clearCronParseCache();
+        start = benchNowNanos();
+        for (uint32_t i = 0; i < iterations; i++) {
+            benchSink += (uintptr_t) parseCronExpressionCached(source, NULL);
+        }
+        printBenchResult("parse cached", benchNowNanos() - start, iterations);
+    }
+    return 0;
+}
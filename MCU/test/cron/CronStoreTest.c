@@ -0,0 +1,136 @@
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "CronStore.h"
+
+#define ROUND_TRIP_FIRE_COUNT 50
+
+static const char *const STORED_EXPRESSIONS[] = {
+        "* * * * * *", "0 */5 9-17 * * MON-FRI", "0 0 0 L * ?", "0 0 0 LW * ?", "0 0 0 L-3 * ?", "0 0 10 15W * ?",
+        "0 0 0 ? * 5L", "0 0 9 ? * 2#3", "0 0 0 29 2 ?", "0 0 0 1,15,L * ?", "5,10,59 1-3,58 0,23 * JAN,JUL,DEC *", "@weekly",
+};
+
+static bool isSameFireTimes(const CronExpression *expected, const CronExpression *actual) {
+    DateTime expectedNext = dateTimeOfWithSeconds(2023, 2, 2, 10, 15, 30);
+    DateTime actualNext = expectedNext;
+    for (uint32_t i = 0; i < ROUND_TRIP_FIRE_COUNT; i++) {
+        expectedNext = nextCronDateTime(expected, &expectedNext);
+        actualNext = nextCronDateTime(actual, &actualNext);
+        if (dateTimeCompare(&expectedNext, &actualNext) != 0) return false;
+    }
+    return true;
+}
+
+static void testSerializeRoundTrip() {
+    for (uint32_t i = 0; i < ARRAY_SIZE(STORED_EXPRESSIONS); i++) {
+        CronExpression cron;
+        ASSERT_EQ_INT(CRON_OK, parseCronExpression(&cron, STORED_EXPRESSIONS[i]));
+        uint8_t buffer[CRON_BINARY_SIZE];
+        ASSERT_EQ_INT(CRON_BINARY_SIZE, serializeCronExpression(&cron, STORED_EXPRESSIONS[i], buffer, sizeof(buffer)));
+
+        CronExpression restored;
+        ASSERT_EQ_INT(CRON_OK, deserializeCronExpression(&restored, STORED_EXPRESSIONS[i], buffer, sizeof(buffer)));
+        if (!isSameFireTimes(&cron, &restored)) TEST_FAIL("\"%s\" restored with other fire times", STORED_EXPRESSIONS[i]);
+    }
+}
+
+static void testSerializeErrors() {
+    const char *source = "0 0 9 ? * 2#3";
+    CronExpression cron;
+    parseCronExpression(&cron, source);
+    uint8_t buffer[CRON_BINARY_SIZE];
+    ASSERT_EQ_INT(0, serializeCronExpression(&cron, source, buffer, CRON_BINARY_SIZE - 1));
+    serializeCronExpression(&cron, source, buffer, sizeof(buffer));
+
+    CronExpression restored;
+    ASSERT_EQ_INT(CRON_ERROR_BINARY_SOURCE_CHANGED, deserializeCronExpression(&restored, "0 0 10 ? * 2#3", buffer, sizeof(buffer)));
+    ASSERT_EQ_INT(CRON_ERROR_INVALID_BINARY_FORMAT, deserializeCronExpression(&restored, source, buffer, CRON_BINARY_SIZE - 1));
+    for (uint32_t i = 0; i < CRON_BINARY_SIZE; i++) {      // any single damaged byte is detected
+        uint8_t damaged[CRON_BINARY_SIZE];
+        memcpy(damaged, buffer, sizeof(damaged));
+        damaged[i] ^= 0x10;
+        CronStatus status = deserializeCronExpression(&restored, source, damaged, sizeof(damaged));
+        if (status == CRON_OK) TEST_FAIL("damaged byte %u not detected", i);
+    }
+}
+
+static void testParseCache() {
+    clearCronParseCache();
+    CronStatus status;
+    const CronExpression *first = parseCronExpressionCached("0 0 12 * * ?", &status);
+    ASSERT_EQ_INT(CRON_OK, status);
+    ASSERT_TRUE(first != NULL);
+    ASSERT_TRUE(parseCronExpressionCached("0 0 12 * * ?", NULL) == first);   // same object for unchanged string
+    const CronExpression *other = parseCronExpressionCached("0 0 13 * * ?", NULL);
+    ASSERT_TRUE(other != NULL && other != first);
+
+    ASSERT_TRUE(parseCronExpressionCached("0 0 25 * * ?", &status) == NULL);
+    ASSERT_TRUE(status != CRON_OK);
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(STORED_EXPRESSIONS); i++) {     // more than cache size, evicted entries are parsed again
+        const CronExpression *cached = parseCronExpressionCached(STORED_EXPRESSIONS[i], &status);
+        ASSERT_TRUE(cached != NULL);
+        CronExpression parsed;
+        parseCronExpression(&parsed, STORED_EXPRESSIONS[i]);
+        if (!isSameFireTimes(&parsed, cached)) TEST_FAIL("cached \"%s\" has other fire times", STORED_EXPRESSIONS[i]);
+    }
+    clearCronParseCache();
+}
+
+static void testParseCacheMatchesSourceText() {
+    // same length and same CRC32, a checksum keyed cache would return the first one for both
+    static const char *const collidingFirst = "56,53,54,16,38 38,17,49,58,27 * * * ?";
+    static const char *const collidingSecond = "25,55,43,29,53 27,14,15,43,48 * * * ?";
+    ASSERT_EQ_INT(generateCRC32(collidingFirst, strlen(collidingFirst)), generateCRC32(collidingSecond, strlen(collidingSecond)));
+
+    clearCronParseCache();
+    const CronExpression *first = parseCronExpressionCached(collidingFirst, NULL);
+    const CronExpression *second = parseCronExpressionCached(collidingSecond, NULL);
+    ASSERT_TRUE(first != NULL && second != NULL && first != second);
+    CronExpression parsed;
+    parseCronExpression(&parsed, collidingSecond);
+    if (second != NULL && !isSameFireTimes(&parsed, second)) TEST_FAIL("colliding source got other expression");
+    ASSERT_TRUE(parseCronExpressionCached(collidingFirst, NULL) == first);
+
+    char longSource[CRON_PARSE_CACHE_SOURCE_SIZE + 16] = "0 0 0 ";     // parsed each call, never cached
+    while (strlen(longSource) < CRON_PARSE_CACHE_SOURCE_SIZE) strcat(longSource, "1,");
+    strcat(longSource, "2 * ?");
+    const CronExpression *longCron = parseCronExpressionCached(longSource, NULL);
+    ASSERT_TRUE(longCron != NULL);
+    parseCronExpression(&parsed, longSource);
+    if (longCron != NULL && !isSameFireTimes(&parsed, longCron)) TEST_FAIL("long source got other expression");
+    clearCronParseCache();
+}
+
+static void testSearchKeepsCachedExpression() {     // "1,L" resolved for February must not leave Feb 28 in shared expression
+    clearCronParseCache();
+    const CronExpression *cron = parseCronExpressionCached("0 0 0 1,L * ?", NULL);
+    DateTime from = dateTimeOf(2023, 2, 2, 0, 0);
+    DateTime next = nextCronDateTime(cron, &from);
+    ASSERT_EQ_INT(2, next.date.month);
+    ASSERT_EQ_INT(28, next.date.day);
+
+    from = dateTimeOf(2023, 3, 2, 0, 0);
+    next = nextCronDateTime(parseCronExpressionCached("0 0 0 1,L * ?", NULL), &from);
+    ASSERT_EQ_INT(3, next.date.month);
+    ASSERT_EQ_INT(31, next.date.day);
+
+    static const uint8_t expectedDates[][2] = {{2, 28}, {3, 1}, {3, 31}, {4, 1}, {4, 30}, {5, 1}};
+    from = dateTimeOf(2023, 2, 2, 0, 0);
+    CronIterator iterator = getCronIterator(cron, &from);
+    for (uint32_t i = 0; i < ARRAY_SIZE(expectedDates); i++) {
+        ASSERT_TRUE(hasNextCronDateTime(&iterator, &next));
+        ASSERT_EQ_INT(expectedDates[i][0], next.date.month);
+        ASSERT_EQ_INT(expectedDates[i][1], next.date.day);
+    }
+    clearCronParseCache();
+}
+
+int main() {
+    RUN_TEST(testSerializeRoundTrip);
+    RUN_TEST(testSerializeErrors);
+    RUN_TEST(testParseCache);
+    RUN_TEST(testParseCacheMatchesSourceText);
+    RUN_TEST(testSearchKeepsCachedExpression);
+    return TEST_RESULT();
+}
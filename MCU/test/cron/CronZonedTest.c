@@ -0,0 +1,150 @@
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "CronExpression.h"
+
+// Zoned fire times around every DST transition of every zone, against brute force walk over UTC minutes
+
+#define CHECK_FROM_EPOCH_SECOND 1672531200LL    // 2023-01-01
+#define CHECK_TO_EPOCH_SECOND 1924992000LL      // 2031-01-01
+#define WINDOW_SECONDS 86400                    // checked before and after transition
+#define LOCAL_MARGIN_SECONDS (26 * 3600)        // more than any offset
+#define MAX_SEARCH_STEPS 8                      // field passes and day steps per call, all expressions fire at least daily
+#define LOCAL_MINUTES ((2 * WINDOW_SECONDS + 2 * LOCAL_MARGIN_SECONDS) / 60 + 1)
+
+static const char *const ZONED_EXPRESSIONS[] = {
+        "0 * * * * *", "0 */15 * * * *", "0 30 2 * * *", "0 0 * * * *", "0 30 * * * *", "0 0 1 * * *",
+        "0 45 1-3 * * *", "0 0 0 * * *", "0 59 23 * * *", "0 0,30 0-4 * * *", "0 15 0 * * *",
+};
+
+typedef struct LocalMatches {   // which local minutes match expression, from plain local cron search
+    int64_t localBase;
+    bool isMatch[LOCAL_MINUTES];
+} LocalMatches;
+
+static void fillLocalMatches(LocalMatches *matches, CronExpression *cron, int64_t localBase) {
+    matches->localBase = localBase;
+    memset(matches->isMatch, 0, sizeof(matches->isMatch));
+    DateTime local = dateTimeOfEpochSeconds(localBase - 1, 0, 0);
+    while (true) {
+        local = nextCronDateTime(cron, &local);
+        int64_t minute = (dateTimeToEpochSecond(&local, 0) - localBase) / 60;
+        if (minute >= LOCAL_MINUTES) break;
+        matches->isMatch[minute] = true;
+    }
+}
+
+static bool isLocalMatch(LocalMatches *matches, int64_t localEpochSecond) {
+    return matches->isMatch[(localEpochSecond - matches->localBase) / 60];
+}
+
+// Window holds single transition, so offset is one of two and gap or overlap is around it
+static int32_t referenceOffset(const TimeZoneRule *transition, int64_t epochSecond) {
+    return epochSecond < transition->transition ? (transition - 1)->gmtOffset : transition->gmtOffset;
+}
+
+static bool isExpectedFire(LocalMatches *matches, const TimeZoneRule *transition, int64_t epochSecond) {
+    int32_t offsetBefore = (transition - 1)->gmtOffset;
+    int32_t offsetAfter = transition->gmtOffset;
+    if (offsetAfter > offsetBefore && epochSecond == transition->transition) {    // skipped local minute matched, fire at transition
+        for (int64_t local = epochSecond + offsetBefore; local < epochSecond + offsetAfter; local += 60) {
+            if (isLocalMatch(matches, local)) return true;
+        }
+    }
+    bool isSecondOccurrence = offsetAfter < offsetBefore && transition->transition <= epochSecond &&
+                              epochSecond + offsetAfter < transition->transition + offsetBefore;   // local time was already seen before clocks moved back
+    return isLocalMatch(matches, epochSecond + referenceOffset(transition, epochSecond)) && !isSecondOccurrence;
+}
+
+static void testTransitionsAgainstBruteForce() {
+    static LocalMatches matches;
+    uint32_t zoneCount = 0;
+    uint64_t checkedCount = 0;
+    uint32_t failureCount = 0;
+    uint32_t maxSearchSteps = 0;
+    for (uint32_t zoneIndex = 0; zoneIndex < ARRAY_SIZE(ZONE_LIST); zoneIndex++) {
+        const TimeZone *zone = &ZONE_LIST[zoneIndex];
+        if (zone->rules == NULL) continue;
+        bool hasTransition = false;
+
+        for (uint32_t ruleIndex = 1; zone->rules[ruleIndex].transition != 0; ruleIndex++) {
+            const TimeZoneRule *rule = &zone->rules[ruleIndex];
+            int64_t transition = rule->transition;
+            if (transition < CHECK_FROM_EPOCH_SECOND || transition >= CHECK_TO_EPOCH_SECOND) continue;
+            if (transition - (rule - 1)->transition <= 2 * WINDOW_SECONDS || ((rule + 1)->transition != 0 && (rule + 1)->transition - transition <= 2 * WINDOW_SECONDS)) continue;
+            hasTransition = true;
+            int64_t from = (transition - WINDOW_SECONDS) / 60 * 60;
+            int64_t to = transition + WINDOW_SECONDS;
+
+            for (uint32_t expressionIndex = 0; expressionIndex < ARRAY_SIZE(ZONED_EXPRESSIONS); expressionIndex++) {
+                CronExpression cron;
+                parseCronExpression(&cron, ZONED_EXPRESSIONS[expressionIndex]);
+                fillLocalMatches(&matches, &cron, from - LOCAL_MARGIN_SECONDS);
+
+                int32_t offset = referenceOffset(rule, from);
+                ZonedDateTime current = {.dateTime = dateTimeOfEpochSeconds(from, 0, offset), .zone = *zone, .offset = offset};
+                int64_t expected = from;
+                while (true) {
+                    do {
+                        expected += 60;
+                    } while (expected <= to && !isExpectedFire(&matches, rule, expected));
+                    if (expected > to) break;
+
+                    resetCronSearchSteps();
+                    current = nextCronZonedDateTime(&cron, &current);
+                    maxSearchSteps = MAX(maxSearchSteps, getCronSearchSteps());
+                    int64_t actual = dateTimeToEpochSecond(&current.dateTime, current.offset);
+                    checkedCount++;
+                    if (actual != expected || current.offset != referenceOffset(rule, actual)) {
+                        if (failureCount++ < 10) {
+                            TEST_FAIL("%s \"%s\" near %lld: expected %lld, got %lld offset %d",
+                                      zone->id, ZONED_EXPRESSIONS[expressionIndex], (long long) transition, (long long) expected, (long long) actual, current.offset);
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+        zoneCount += hasTransition;
+    }
+    printf("%u zones, %llu fire times checked, at most %u search steps per call\n", zoneCount, (unsigned long long) checkedCount, maxSearchSteps);
+    ASSERT_TRUE(zoneCount > 0);
+    ASSERT_TRUE(maxSearchSteps <= MAX_SEARCH_STEPS);
+}
+
+static void testKnownTransitions() {
+    CronExpression cron;
+    const TimeZone *berlin = findTimeZone("Europe/Berlin");
+    ASSERT_TRUE(berlin != NULL);
+
+    parseCronExpression(&cron, "0 30 2 * * *");     // 2024-03-31 02:30 does not exist, fires at 03:00 CEST
+    ZonedDateTime from = zonedDateTimeOf(2024, 3, 30, 12, 0, 0, 0, berlin);
+    ZonedDateTime next = nextCronZonedDateTime(&cron, &from);
+    ASSERT_EQ_INT(31, next.dateTime.date.day);
+    ASSERT_EQ_INT(3, next.dateTime.time.hours);
+    ASSERT_EQ_INT(0, next.dateTime.time.minutes);
+    ASSERT_EQ_INT(7200, next.offset);
+    next = nextCronZonedDateTime(&cron, &next);
+    ASSERT_EQ_INT(1, next.dateTime.date.day);
+    ASSERT_EQ_INT(2, next.dateTime.time.hours);
+    ASSERT_EQ_INT(30, next.dateTime.time.minutes);
+
+    // 2024-10-27 02:30 happens twice, fires only with CEST
+    from = zonedDateTimeOf(2024, 10, 26, 12, 0, 0, 0, berlin);
+    next = nextCronZonedDateTime(&cron, &from);
+    ASSERT_EQ_INT(27, next.dateTime.date.day);
+    ASSERT_EQ_INT(7200, next.offset);
+    next = nextCronZonedDateTime(&cron, &next);
+    ASSERT_EQ_INT(28, next.dateTime.date.day);
+    ASSERT_EQ_INT(3600, next.offset);
+
+    ZonedDateTime secondPass = {.dateTime = dateTimeOfWithSeconds(2024, 10, 27, 2, 10, 0), .zone = *berlin, .offset = 3600};
+    next = nextCronZonedDateTime(&cron, &secondPass);
+    ASSERT_EQ_INT(28, next.dateTime.date.day);
+}
+
+int main() {
+    RUN_TEST(testKnownTransitions);
+    RUN_TEST(testTransitionsAgainstBruteForce);
+    return TEST_RESULT();
+}
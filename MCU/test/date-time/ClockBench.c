@@ -0,0 +1,44 @@
+#include <stdlib.h>
+#include <time.h>
+
+#include "TestUtils.h"
+#include "Clock.h"
+
+// Current zoned date-time: clock against setenv, tzset and localtime_r on every call as zonedDateTimeNow did before
+
+static ZonedDateTime localtimeNow(const TimeZone *zone) {
+    time_t now;
+    struct tm localTime;
+    setenv("TZ", "UTC0", 1);
+    tzset();
+    time(&now);
+    localtime_r(&now, &localTime);
+    ZonedDateTime utc = zonedDateTimeOf(localTime.tm_year + 1900, localTime.tm_mon + 1, localTime.tm_mday, localTime.tm_hour,
+                                        localTime.tm_min, localTime.tm_sec, 0, &UTC);
+    return zonedDateTimeWithSameInstant(&utc, zone);
+}
+
+int main(int argc, char **argv) {
+    initBench(argc, argv);
+    const TimeZone *zone = findTimeZone("Europe/Riga");
+    uint32_t iterations = benchIterations(300000);
+
+    uint64_t start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += localtimeNow(zone).dateTime.time.seconds;
+    }
+    printBenchResult("setenv, tzset, localtime_r", benchNowNanos() - start, iterations);
+
+    start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += clockZonedDateTime(zone).dateTime.time.seconds;
+    }
+    printBenchResult("clock", benchNowNanos() - start, iterations);
+
+    start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += clockEpochMicros();
+    }
+    printBenchResult("clock epoch micros", benchNowNanos() - start, iterations);
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "TestUtils.h"
+#include "Clock.h"
+#include "HostClock.h"
+
+// Clock against libc TZ and localtime_r path it replaced, and wall clock changes picked up after syncClock()
+
+static const char *const CLOCK_ZONE_IDS[] = {"Europe/Riga", "America/New_York", "Asia/Kolkata", "Australia/Lord_Howe", "Pacific/Chatham", "Asia/Kathmandu"};
+
+static void testMatchesLocaltime() {    // system zoneinfo has the same current rules for these zones
+    for (uint32_t i = 0; i < ARRAY_SIZE(CLOCK_ZONE_IDS); i++) {
+        const TimeZone *zone = findTimeZone(CLOCK_ZONE_IDS[i]);
+        if (zone == NULL) {
+            TEST_FAIL("%s not found", CLOCK_ZONE_IDS[i]);
+            continue;
+        }
+        setenv("TZ", CLOCK_ZONE_IDS[i], 1);
+        tzset();
+        for (uint32_t j = 0; j < 100; j++) {
+            time_t now = time(NULL);
+            struct tm localTime;
+            localtime_r(&now, &localTime);
+            ZonedDateTime zonedDateTime = clockZonedDateTime(zone);
+            int64_t epochSeconds = dateTimeToEpochSecond(&zonedDateTime.dateTime, zonedDateTime.offset);
+            if (llabs(epochSeconds - (int64_t) now) > 1 || zonedDateTime.offset != localTime.tm_gmtoff || strcmp(zonedDateTime.zone.id, zone->id) != 0) {
+                TEST_FAIL("%s: %lld offset %d, localtime %lld offset %ld",
+                          zone->id, (long long) epochSeconds, zonedDateTime.offset, (long long) now, localTime.tm_gmtoff);
+                break;
+            }
+            if (epochSeconds == now && (zonedDateTime.dateTime.time.hours != localTime.tm_hour || zonedDateTime.dateTime.date.day != localTime.tm_mday)) {
+                TEST_FAIL("%s: local %02d:%02d, localtime %02d:%02d", zone->id, zonedDateTime.dateTime.time.hours,
+                          zonedDateTime.dateTime.time.minutes, localTime.tm_hour, localTime.tm_min);
+                break;
+            }
+        }
+    }
+    unsetenv("TZ");
+    tzset();
+
+    ZonedDateTime utc = clockZonedDateTime(NULL);
+    ASSERT_EQ_STR("UTC", utc.zone.id);
+    ASSERT_EQ_INT(0, utc.offset);
+}
+
+static void testInstantMatchesWallClock() {
+    syncClock();
+    for (uint32_t i = 0; i < 1000; i++) {
+        int64_t before = clockWallMicros();
+        int64_t epochMicros = clockEpochMicros();
+        int64_t after = clockWallMicros();
+        if (epochMicros < before - 1000 || epochMicros > after + 1000) {    // base plus monotonic elapsed, may drift from wall clock slightly
+            TEST_FAIL("clock %lld outside of wall clock [%lld, %lld]", (long long) epochMicros, (long long) before, (long long) after);
+            break;
+        }
+        Instant instant = clockInstant();
+        ASSERT_TRUE(instant.micros >= 0 && instant.micros < MICROS_PER_SECOND);
+    }
+}
+
+static int64_t otherTaskEpochMicros;
+
+static void *readClockTask(void *argument) {
+    otherTaskEpochMicros = clockEpochMicros();
+    return argument;
+}
+
+static void testShiftFollowedAfterSync() {  // e.g. NTP sync moved system time forward one hour
+    int64_t before = clockEpochMicros();
+    setHostWallClockShift(3600LL * MICROS_PER_SECOND);
+    ASSERT_TRUE(clockEpochMicros() - before < MICROS_PER_SECOND);    // base is kept until sync or resync interval
+
+    pthread_t thread;
+    pthread_create(&thread, NULL, readClockTask, NULL);     // new task reads wall clock on first call
+    pthread_join(thread, NULL);
+    ASSERT_TRUE(otherTaskEpochMicros - before >= 3600LL * MICROS_PER_SECOND);
+
+    syncClock();
+    ASSERT_TRUE(clockEpochMicros() - before >= 3600LL * MICROS_PER_SECOND);
+    setHostWallClockShift(0);
+    syncClock();
+    ASSERT_TRUE(clockEpochMicros() - before < MICROS_PER_SECOND);
+}
+
+int main() {
+    RUN_TEST(testMatchesLocaltime);
+    RUN_TEST(testInstantMatchesWallClock);
+    RUN_TEST(testShiftFollowedAfterSync);
+    return TEST_RESULT();
+}
@@ -0,0 +1,125 @@
+#include "TestUtils.h"
+#include "GlobalDateTime.h"
+
+// Log timestamp formatting: parse pattern on each call, format with parsed pattern, cached compiled formatter, bulk column.
+// Parsing file names straight to epoch seconds against legacy parser
+
+static void benchPattern(const char *pattern) {
+    uint32_t iterations = benchIterations(500000);
+    ZonedDateTime zonedDateTime = zonedDateTimeOf(2024, 5, 6, 7, 8, 9, 10, findTimeZone("Europe/Riga"));
+    char buffer[128];
+    printf("\"%s\"\n", pattern);
+
+    uint64_t start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        DateTimeFormatter formatter;
+        parseDateTimePattern(&formatter, pattern);
+        formatZonedDateTime(&zonedDateTime, buffer, sizeof(buffer), &formatter);
+        benchSink += buffer[0];
+    }
+    printBenchResult("parse + format", benchNowNanos() - start, iterations);
+
+    DateTimeFormatter formatter;
+    parseDateTimePattern(&formatter, pattern);
+    start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        formatZonedDateTime(&zonedDateTime, buffer, sizeof(buffer), &formatter);
+        benchSink += buffer[0];
+    }
+    printBenchResult("format", benchNowNanos() - start, iterations);
+
+    start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += formatZonedDateTimeCompiled(&zonedDateTime, buffer, sizeof(buffer), getCachedDateTimeFormatter(pattern));
+    }
+    printBenchResult("cached compiled", benchNowNanos() - start, iterations);
+}
+
+static void benchBulk() {   // sorted log timestamps, one per 7 seconds, into packed column
+    enum { VALUE_COUNT = 20000 };
+    static int64_t epochSeconds[VALUE_COUNT];
+    static char packed[VALUE_COUNT * 32];
+    static uint32_t offsets[VALUE_COUNT];
+    for (uint32_t i = 0; i < VALUE_COUNT; i++) {
+        epochSeconds[i] = 1700000000 + i * 7;
+    }
+    const char *pattern = "yyyy-MM-dd HH:mm:ss";
+    const TimeZone *zone = findTimeZone("Europe/Riga");
+    CompiledDateTimeFormatter *compiled = getCachedDateTimeFormatter(pattern);
+    uint32_t rounds = benchIterations(20);
+    printf("bulk \"%s\", %u sorted values\n", pattern, VALUE_COUNT);
+
+    uint64_t start = benchNowNanos();
+    for (uint32_t round = 0; round < rounds; round++) {
+        benchSink += formatEpochSecondsBulk(epochSeconds, VALUE_COUNT, zone, compiled, packed, sizeof(packed), offsets);
+    }
+    printBenchResult("bulk", benchNowNanos() - start, rounds * VALUE_COUNT);
+
+    start = benchNowNanos();
+    for (uint32_t round = 0; round < rounds; round++) {
+        for (uint32_t i = 0; i < VALUE_COUNT; i++) {
+            int32_t offset = resolveTimeZoneOffset(epochSeconds[i], zone);
+            ZonedDateTime zonedDateTime = {.dateTime = dateTimeOfEpochSeconds(epochSeconds[i], 0, offset), .zone = *zone, .offset = offset};
+            benchSink += formatZonedDateTimeCompiled(&zonedDateTime, packed, 32, compiled);
+        }
+    }
+    printBenchResult("each value, compiled", benchNowNanos() - start, rounds * VALUE_COUNT);
+
+    DateTimeFormatter formatter;
+    parseDateTimePattern(&formatter, pattern);
+    start = benchNowNanos();
+    for (uint32_t round = 0; round < rounds; round++) {
+        for (uint32_t i = 0; i < VALUE_COUNT; i++) {
+            ZonedDateTime utc = {.dateTime = dateTimeOfEpochSeconds(epochSeconds[i], 0, 0), .zone = UTC, .offset = 0};
+            ZonedDateTime zonedDateTime = zonedDateTimeWithSameInstant(&utc, zone);
+            formatZonedDateTime(&zonedDateTime, packed, 32, &formatter);
+            benchSink += packed[0];
+        }
+    }
+    printBenchResult("each value, zone conversion and format", benchNowNanos() - start, rounds * VALUE_COUNT);
+}
+
+static void benchParseFileNames() {     // photo file names to epoch seconds
+    enum { NAME_COUNT = 20000 };
+    static char names[NAME_COUNT][20];
+    const char *pattern = "yyyy_MM_dd_HH_mm";
+    CompiledDateTimeFormatter compiled;
+    compileDateTimePattern(&compiled, pattern);
+    for (uint32_t i = 0; i < NAME_COUNT; i++) {
+        DateTime dateTime = dateTimeOfEpochSeconds(1600000000 + (int64_t) i * 600, 0, 0);
+        formatDateTimeCompiled(&dateTime, names[i], sizeof(names[i]), &compiled);
+    }
+    uint32_t rounds = benchIterations(50);
+    printf("parse \"%s\", %u names\n", pattern, NAME_COUNT);
+
+    uint64_t start = benchNowNanos();
+    for (uint32_t round = 0; round < rounds; round++) {
+        for (uint32_t i = 0; i < NAME_COUNT; i++) {
+            int64_t epochSeconds;
+            parseEpochSecondsCompiled(names[i], 16, &compiled, &epochSeconds, NULL);
+            benchSink += epochSeconds;
+        }
+    }
+    printBenchResult("compiled to epoch seconds", benchNowNanos() - start, rounds * NAME_COUNT);
+
+    DateTimeFormatter formatter;
+    parseDateTimePattern(&formatter, pattern);
+    start = benchNowNanos();
+    for (uint32_t round = 0; round < rounds; round++) {
+        for (uint32_t i = 0; i < NAME_COUNT; i++) {
+            DateTime dateTime = parseToDateTime(names[i], &formatter);
+            benchSink += dateTimeToEpochSecond(&dateTime, 0);
+        }
+    }
+    printBenchResult("parseToDateTime", benchNowNanos() - start, rounds * NAME_COUNT);
+}
+
+int main(int argc, char **argv) {
+    initBench(argc, argv);
+    benchPattern("yyyy-MM-dd HH:mm:ss.SSS");
+    benchPattern("EEE, d MMM yyyy HH:mm:ss Z");
+    benchPattern("yyyy_MM_dd-HH_mm_ss");
+    benchBulk();
+    benchParseFileNames();
+    return 0;
+}
@@ -0,0 +1,359 @@
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "TestUtils.h"
+#include "GlobalDateTime.h"
+
+// Compiled formatter against pattern formatter for every pattern letter and width, in several zones and for invalid dates.
+// Bulk formatting against formatting each value on its own, parsing straight to epoch seconds against legacy parser
+
+#define RANDOM_DATES_PER_PATTERN 20000
+#define THREAD_COUNT 4
+#define THREAD_FORMAT_COUNT 50000
+#define BULK_VALUE_COUNT 50000
+#define PARSE_TEXTS_PER_PATTERN 100000
+
+static const char *const FORMAT_PATTERNS[] = {
+        "yyyy-MM-dd HH:mm:ss", "yyyy-MM-dd'T'HH:mm:ss.SSSZ", "dd.MM.yyyy HH:mm", "y yy yyy yyyy yyyyy u uu", "M MM MMM MMMM MMMMM",
+        "d dd D DD DDD w ww W F E EE EEE EEEE EEEEE", "G GGGG a h hh K KK k kk H HH", "m mm s ss S SS SSS", "z zz zzz zzzz Z ZZ ZZZ ZZZZ ZZZZZ",
+        "'at' HH 'o''clock' ''", "yyyy_MM_dd-HH_mm_ss", "EEE, d MMM yyyy HH:mm:ss Z", "[HH:mm:ss.SSS]", "yyyyMMddHHmmss",
+};
+
+static const char *const LONG_PATTERN = "yyyyMMddHHmmss yyyyMMddHHmmss yyyyMMddHHmmss yyyyMMddHHmmss yyyyMMddHHmmss";   // over DATE_TIME_FORMAT_SIZE
+
+static ZonedDateTime randomZonedDateTime(uint32_t index, const TimeZone *zone) {
+    int64_t year = (index % 50 == 0) ? rand() % 100 : (index % 77 == 0 ? -(rand() % 3000) : 1900 + rand() % 300);
+    ZonedDateTime zonedDateTime = zonedDateTimeOf(year, 1 + rand() % 12, 1 + rand() % 28, rand() % 24, rand() % 60, rand() % 60, rand() % 1000, zone);
+    if (index % 97 == 0) {
+        zonedDateTime.dateTime.time.hours = -1;     // invalid values are printed the same way
+    }
+    return zonedDateTime;
+}
+
+static void testCompiledMatchesPatternFormatter() {
+    const TimeZone *zones[] = {&UTC, findTimeZone("Europe/Riga"), findTimeZone("America/New_York"), findTimeZone("Asia/Kolkata"), findTimeZone("America/St_Johns")};
+    srand(45);
+    uint32_t checkedCount = 0;
+    for (uint32_t p = 0; p < ARRAY_SIZE(FORMAT_PATTERNS); p++) {
+        DateTimeFormatter formatter;
+        parseDateTimePattern(&formatter, FORMAT_PATTERNS[p]);
+        ASSERT_TRUE(formatter.isFormatValid);
+        CompiledDateTimeFormatter compiled;
+        compileDateTimeFormatter(&compiled, &formatter);
+
+        for (uint32_t i = 0; i < RANDOM_DATES_PER_PATTERN; i++) {
+            ZonedDateTime zonedDateTime = randomZonedDateTime(i, zones[i % ARRAY_SIZE(zones)]);
+            char expected[256];
+            char actual[256];
+            memset(actual, 'X', sizeof(actual));
+            formatZonedDateTime(&zonedDateTime, expected, sizeof(expected), &formatter);
+            uint32_t length = formatZonedDateTimeCompiled(&zonedDateTime, actual, sizeof(actual), &compiled);
+            if (strcmp(expected, actual) != 0 || length != strlen(expected)) {
+                TEST_FAIL("\"%s\": \"%s\", expected \"%s\"", FORMAT_PATTERNS[p], actual, expected);
+                break;
+            }
+
+            formatDateTime(&zonedDateTime.dateTime, expected, sizeof(expected), &formatter);
+            formatDateTimeCompiled(&zonedDateTime.dateTime, actual, sizeof(actual), &compiled);
+            if (strcmp(expected, actual) != 0) {
+                TEST_FAIL("\"%s\" without zone: \"%s\", expected \"%s\"", FORMAT_PATTERNS[p], actual, expected);
+                break;
+            }
+
+            char shortBuffer[8];    // bounded by length, truncated output is prefix of full one
+            formatZonedDateTime(&zonedDateTime, expected, sizeof(expected), &formatter);
+            length = formatZonedDateTimeCompiled(&zonedDateTime, shortBuffer, sizeof(shortBuffer), &compiled);
+            if (length >= sizeof(shortBuffer) || strlen(shortBuffer) != length || strncmp(shortBuffer, expected, length) != 0) {
+                TEST_FAIL("\"%s\": truncated to \"%s\"", FORMAT_PATTERNS[p], shortBuffer);
+                break;
+            }
+            checkedCount++;
+        }
+    }
+    printf("%u dates checked\n", checkedCount);
+}
+
+static void testFormatterCache() {
+    clearDateTimeFormatterCache();
+    CompiledDateTimeFormatter *first = getCachedDateTimeFormatter("yyyy-MM-dd");
+    ASSERT_TRUE(first != NULL);
+    ASSERT_TRUE(getCachedDateTimeFormatter("yyyy-MM-dd") == first);
+    ASSERT_TRUE(getCachedDateTimeFormatter(LONG_PATTERN) == NULL);
+
+    for (uint32_t i = 1; i < DATE_TIME_FORMATTER_CACHE_SIZE; i++) {
+        ASSERT_TRUE(getCachedDateTimeFormatter(FORMAT_PATTERNS[i]) != NULL);
+    }
+    ASSERT_TRUE(getCachedDateTimeFormatter("HH:mm") == NULL);    // full, existing entries are kept
+    ASSERT_TRUE(getCachedDateTimeFormatter("yyyy-MM-dd") == first);
+
+    ZonedDateTime zonedDateTime = {.dateTime = dateTimeOfWithSeconds(2024, 3, 5, 7, 8, 9), .zone = UTC, .offset = 0};
+    char buffer[128];
+    formatZonedDateTimeByPattern(&zonedDateTime, buffer, sizeof(buffer), "HH:mm");    // not cached, still formatted
+    ASSERT_EQ_STR("07:08", buffer);
+    formatZonedDateTimeByPattern(&zonedDateTime, buffer, sizeof(buffer), LONG_PATTERN);
+    ASSERT_EQ_STR("20240305070809 20240305070809 20240305070809 20240305070809 20240305070809", buffer);
+    clearDateTimeFormatterCache();
+}
+
+static int compareEpochSeconds(const void *first, const void *second) {
+    int64_t firstValue = *(const int64_t *) first;
+    int64_t secondValue = *(const int64_t *) second;
+    return firstValue < secondValue ? -1 : firstValue > secondValue;
+}
+
+static void testBulkMatchesSingleValues() {     // unsorted and sorted column, reused offset and date must not leak into next value
+    static int64_t epochSeconds[BULK_VALUE_COUNT];
+    static char packed[BULK_VALUE_COUNT * 64];
+    static uint32_t offsets[BULK_VALUE_COUNT];
+    const char *patterns[] = {"yyyy-MM-dd HH:mm:ss", "yyyy-MM-dd'T'HH:mm:ssZ z", "EEE d MMM yyyy hh:mm a zzzz"};
+    const TimeZone *zones[] = {&UTC, findTimeZone("Europe/Riga"), findTimeZone("America/New_York"), findTimeZone("Australia/Lord_Howe")};
+    srand(47);
+    for (uint32_t i = 0; i < BULK_VALUE_COUNT; i++) {
+        epochSeconds[i] = (int64_t) (rand() % 2000000000) - 500000000;
+    }
+
+    for (uint32_t sorted = 0; sorted < 2; sorted++) {
+        if (sorted) qsort(epochSeconds, BULK_VALUE_COUNT, sizeof(epochSeconds[0]), compareEpochSeconds);
+        for (uint32_t z = 0; z < ARRAY_SIZE(zones); z++) {
+            for (uint32_t p = 0; p < ARRAY_SIZE(patterns); p++) {
+                CompiledDateTimeFormatter compiled;
+                ASSERT_TRUE(compileDateTimePattern(&compiled, patterns[p]));
+                uint32_t count = formatEpochSecondsBulk(epochSeconds, BULK_VALUE_COUNT, zones[z], &compiled, packed, sizeof(packed), offsets);
+                ASSERT_EQ_INT(BULK_VALUE_COUNT, count);
+
+                for (uint32_t i = 0; i < count; i++) {
+                    int32_t offset = resolveTimeZoneOffset(epochSeconds[i], zones[z]);
+                    ZonedDateTime zonedDateTime = {.dateTime = dateTimeOfEpochSeconds(epochSeconds[i], 0, offset), .zone = *zones[z], .offset = offset};
+                    char expected[128];
+                    formatZonedDateTimeCompiled(&zonedDateTime, expected, sizeof(expected), &compiled);
+                    if (strcmp(expected, packed + offsets[i]) != 0) {
+                        TEST_FAIL("%s \"%s\" at %lld: \"%s\", expected \"%s\"", zones[z]->id, patterns[p], (long long) epochSeconds[i], packed + offsets[i], expected);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+}
+
+static void testBulkStopsWhenBufferIsFull() {
+    const int64_t epochSeconds[] = {0, 60, 120, 180, 240, 300, 360, 420};
+    CompiledDateTimeFormatter compiled;
+    compileDateTimePattern(&compiled, "yyyy-MM-dd HH:mm:ss");
+    char packed[100];   // 5 values of 19 chars and terminator
+    uint32_t offsets[ARRAY_SIZE(epochSeconds)];
+    ASSERT_EQ_INT(5, formatEpochSecondsBulk(epochSeconds, ARRAY_SIZE(epochSeconds), &UTC, &compiled, packed, sizeof(packed), offsets));
+    ASSERT_EQ_STR("1970-01-01 00:04:00", packed + offsets[4]);
+    ASSERT_EQ_INT(5, formatEpochSecondsBulk(epochSeconds, ARRAY_SIZE(epochSeconds), &UTC, &compiled, packed, sizeof(packed), NULL));
+    ASSERT_EQ_STR("1970-01-01 00:01:00", packed + 20);
+}
+
+static uint64_t randomState = 88172645463325252ULL;
+
+static uint64_t nextRandom() {  // xorshift, rand() range is too small for epoch seconds
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 7;
+    randomState ^= randomState << 17;
+    return randomState;
+}
+
+// Formatted and randomly damaged texts: same result as legacy parser, extra rejections only for damaged text with wrong literals
+static void testParseEpochSecondsMatchesLegacyParser() {
+    const char *patterns[] = {"yyyy_MM_dd_HH_mm", "yyyy.MM.dd HH:mm", "yyyy-MM-dd HH:mm:ss.SSSZ", "d MMM yyyy h:mm a", "EEE, dd MMMM yyyy HH:mm:ss Z", "y-M-d H:m:s"};
+    const char *damageChars = ":.-_ ,0123456789aAPMZ+";
+    uint32_t stricterCount = 0;
+    for (uint32_t p = 0; p < ARRAY_SIZE(patterns); p++) {
+        DateTimeFormatter formatter;
+        parseDateTimePattern(&formatter, patterns[p]);
+        CompiledDateTimeFormatter compiled;
+        ASSERT_TRUE(compileDateTimePattern(&compiled, patterns[p]));
+        bool hasZone = strchr(patterns[p], 'Z') != NULL;
+
+        for (uint32_t i = 0; i < PARSE_TEXTS_PER_PATTERN; i++) {
+            int64_t epochSeconds = (int64_t) (nextRandom() % 4000000000ULL) - 1000000000LL;
+            int32_t offset = hasZone ? ((int32_t) (nextRandom() % 105) - 52) * 900 : 0;
+            TimeZone zone = UTC;
+            zone.utcOffset = offset;
+            DateTime dateTime = dateTimeOfEpochSeconds(epochSeconds, (nextRandom() % 1000) * 1000, offset);
+            ZonedDateTime zonedDateTime = zonedDateTimeOfDateTime(&dateTime, &zone);
+            char text[128];
+            formatZonedDateTime(&zonedDateTime, text, sizeof(text), &formatter);
+            uint32_t length = strlen(text);
+            bool isDamaged = i % 2 == 1;
+            if (isDamaged) {
+                for (uint32_t j = nextRandom() % 3; j > 0; j--) {
+                    text[nextRandom() % length] = damageChars[nextRandom() % strlen(damageChars)];
+                }
+                if (nextRandom() % 8 == 0) {
+                    length = nextRandom() % (length + 1);
+                    text[length] = '\0';
+                }
+            }
+
+            int64_t legacyEpochSeconds = 0;
+            bool isLegacyValid;
+            if (hasZone) {
+                ZonedDateTime parsed = parseToZonedDateTime(text, &formatter);
+                isLegacyValid = isDateTimeValid(&parsed.dateTime);
+                if (isLegacyValid) legacyEpochSeconds = dateTimeToEpochSecond(&parsed.dateTime, parsed.zone.utcOffset);
+            } else {
+                DateTime parsed = parseToDateTime(text, &formatter);
+                isLegacyValid = isDateTimeValid(&parsed);
+                if (isLegacyValid) legacyEpochSeconds = dateTimeToEpochSecond(&parsed, 0);
+            }
+            int64_t parsedEpochSeconds = 0;
+            bool isValid = parseEpochSecondsCompiled(text, length, &compiled, &parsedEpochSeconds, NULL);
+
+            if (isValid && (!isLegacyValid || parsedEpochSeconds != legacyEpochSeconds)) {
+                TEST_FAIL("\"%s\" as \"%s\": %lld, legacy %d %lld", text, patterns[p], (long long) parsedEpochSeconds, isLegacyValid, (long long) legacyEpochSeconds);
+                break;
+            }
+            bool isRoundTrip = !(offset < 0 && offset % 3600 != 0);     // formatter prints negative offsets with minutes as "-01-30"
+            if (!isValid && (!isDamaged && isRoundTrip)) {
+                TEST_FAIL("formatted \"%s\" as \"%s\" rejected", text, patterns[p]);
+                break;
+            }
+            stricterCount += !isValid && isLegacyValid;
+        }
+    }
+    printf("%u damaged texts rejected only by literal check\n", stricterCount);
+}
+
+static void testParseEpochSecondsSlices() {
+    CompiledDateTimeFormatter compiled;
+    compileDateTimePattern(&compiled, "yyyy_MM_dd_HH_mm");
+    const char *fileName = "2024_03_05_07_08.jpg";
+    int64_t epochSeconds = -1;
+    ASSERT_TRUE(parseEpochSecondsCompiled(fileName, 16, &compiled, &epochSeconds, NULL));     // slice, not '\0' terminated
+    ASSERT_TRUE(epochSeconds == 1709622480);
+    ASSERT_FALSE(parseEpochSecondsCompiled(fileName, 15, &compiled, &epochSeconds, NULL));
+    ASSERT_FALSE(parseEpochSecondsCompiled("2024-03-05_07_08", 16, &compiled, &epochSeconds, NULL));    // literal must match
+    ASSERT_FALSE(parseEpochSecondsCompiled("2024_02_30_07_08", 16, &compiled, &epochSeconds, NULL));
+    ASSERT_TRUE(epochSeconds == 1709622480);     // untouched on failure
+
+    compileDateTimePattern(&compiled, "EEE, dd MMM yyyy HH:mm:ss Z");
+    int32_t zoneOffset = 0;
+    const char *header = "Tue, 05 Mar 2024 09:08:00 +0200";
+    ASSERT_TRUE(parseEpochSecondsCompiled(header, strlen(header), &compiled, &epochSeconds, &zoneOffset));
+    ASSERT_TRUE(epochSeconds == 1709622480);
+    ASSERT_EQ_INT(7200, zoneOffset);
+    header = "Wed, 05 Mar 2024 09:08:00 +0200";    // wrong week day
+    ASSERT_FALSE(parseEpochSecondsCompiled(header, strlen(header), &compiled, &epochSeconds, &zoneOffset));
+
+    ASSERT_FALSE(compileDateTimePattern(&compiled, "yyyy-MM-dd zzzz") && parseEpochSecondsCompiled("2024-03-05 UTC", 14, &compiled, &epochSeconds, NULL));   // zone names are not parsed
+}
+
+static void testParseByPatternWithFullCache() {    // same result from cached formatter and from one compiled for the call
+    const char *text = "2024-03-05 09:08:07.123+0200";
+    const char *pattern = "yyyy-MM-dd HH:mm:ss.SSSZ";
+    int64_t cachedEpochSeconds = 0;
+    int32_t cachedOffset = 0;
+    clearDateTimeFormatterCache();
+    ASSERT_TRUE(parseEpochSecondsByPattern(text, strlen(text), pattern, &cachedEpochSeconds, &cachedOffset));
+    ASSERT_EQ_INT(1709622487, cachedEpochSeconds);
+    ASSERT_EQ_INT(7200, cachedOffset);
+
+    clearDateTimeFormatterCache();
+    for (uint32_t i = 0; i < DATE_TIME_FORMATTER_CACHE_SIZE; i++) {
+        getCachedDateTimeFormatter(FORMAT_PATTERNS[i]);
+    }
+    ASSERT_TRUE(getCachedDateTimeFormatter(pattern) == NULL);
+    int64_t epochSeconds = 0;
+    int32_t offset = 0;
+    ASSERT_TRUE(parseEpochSecondsByPattern(text, strlen(text), pattern, &epochSeconds, &offset));
+    ASSERT_EQ_INT(cachedEpochSeconds, epochSeconds);
+    ASSERT_EQ_INT(cachedOffset, offset);
+    ASSERT_FALSE(parseEpochSecondsByPattern(text, strlen(text), NULL, &epochSeconds, &offset));
+    clearDateTimeFormatterCache();
+}
+
+static volatile uint32_t threadErrorCount = 0;
+
+static void *formatInThread(void *argument) {   // more patterns than cache entries, so tasks race to fill it and fall back to parsing
+    uintptr_t threadIndex = (uintptr_t) argument;
+    ZonedDateTime zonedDateTime = {.dateTime = dateTimeOfWithSeconds(2024, 3, 5, 7, 8, 9), .zone = UTC, .offset = 0};
+    for (uint32_t i = 0; i < THREAD_FORMAT_COUNT; i++) {
+        const char *pattern = FORMAT_PATTERNS[(i + threadIndex) % 7];
+        char expected[128];
+        char actual[128];
+        DateTimeFormatter formatter;
+        parseDateTimePattern(&formatter, pattern);
+        formatZonedDateTime(&zonedDateTime, expected, sizeof(expected), &formatter);
+        formatZonedDateTimeByPattern(&zonedDateTime, actual, sizeof(actual), pattern);
+        if (strcmp(expected, actual) != 0) {
+            __atomic_add_fetch(&threadErrorCount, 1, __ATOMIC_RELAXED);
+        }
+    }
+    return NULL;
+}
+
+static void testCacheAcrossThreads() {
+    clearDateTimeFormatterCache();
+    pthread_t threads[THREAD_COUNT];
+    for (uintptr_t i = 0; i < THREAD_COUNT; i++) {
+        pthread_create(&threads[i], NULL, formatInThread, (void *) i);
+    }
+    for (uint32_t i = 0; i < THREAD_COUNT; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    ASSERT_EQ_INT(0, threadErrorCount);
+    clearDateTimeFormatterCache();
+}
+
+#define SAME_PATTERN_ROUNDS 200
+
+static pthread_barrier_t roundStart;
+static CompiledDateTimeFormatter *samePatternResults[THREAD_COUNT];
+
+static void *requestSamePattern(void *argument) {
+    uintptr_t threadIndex = (uintptr_t) argument;
+    for (uint32_t i = 0; i < SAME_PATTERN_ROUNDS; i++) {
+        pthread_barrier_wait(&roundStart);
+        samePatternResults[threadIndex] = getCachedDateTimeFormatter("dd.MM.yyyy HH:mm");
+        pthread_barrier_wait(&roundStart);
+        pthread_barrier_wait(&roundStart);  // main checks and clears cache
+    }
+    return NULL;
+}
+
+static void testSamePatternFillsOneEntry() {     // tasks asking for the same new pattern at once must not use up the cache with duplicates
+    pthread_barrier_init(&roundStart, NULL, THREAD_COUNT + 1);
+    pthread_t threads[THREAD_COUNT];
+    clearDateTimeFormatterCache();
+    for (uintptr_t i = 0; i < THREAD_COUNT; i++) {
+        pthread_create(&threads[i], NULL, requestSamePattern, (void *) i);
+    }
+
+    uint32_t duplicateRounds = 0;
+    for (uint32_t round = 0; round < SAME_PATTERN_ROUNDS; round++) {
+        pthread_barrier_wait(&roundStart);
+        pthread_barrier_wait(&roundStart);
+        CompiledDateTimeFormatter *cached = getCachedDateTimeFormatter("dd.MM.yyyy HH:mm");
+        for (uint32_t i = 0; i < THREAD_COUNT; i++) {
+            duplicateRounds += samePatternResults[i] != NULL && samePatternResults[i] != cached;
+        }
+        for (uint32_t i = 1; i < DATE_TIME_FORMATTER_CACHE_SIZE; i++) {    // one entry is used, so all other ones are still free
+            duplicateRounds += getCachedDateTimeFormatter(FORMAT_PATTERNS[i + 2]) == NULL;  // patterns after "dd.MM.yyyy HH:mm"
+        }
+        clearDateTimeFormatterCache();
+        pthread_barrier_wait(&roundStart);
+    }
+    for (uint32_t i = 0; i < THREAD_COUNT; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    pthread_barrier_destroy(&roundStart);
+    ASSERT_EQ_INT(0, duplicateRounds);
+}
+
+int main() {
+    RUN_TEST(testCompiledMatchesPatternFormatter);
+    RUN_TEST(testFormatterCache);
+    RUN_TEST(testCacheAcrossThreads);
+    RUN_TEST(testSamePatternFillsOneEntry);
+    RUN_TEST(testBulkMatchesSingleValues);
+    RUN_TEST(testBulkStopsWhenBufferIsFull);
+    RUN_TEST(testParseEpochSecondsMatchesLegacyParser);
+    RUN_TEST(testParseEpochSecondsSlices);
+    RUN_TEST(testParseByPatternWithFullCache);
+    return TEST_RESULT();
+}
@@ -0,0 +1,33 @@
+#include "TestUtils.h"
+#include "LocalDateTime.h"
+#include "PreviousEpochDay.h"
+
+// Epoch day to date and back, loop-free civil algorithms against previous implementation
+
+int main(int argc, char **argv) {
+    initBench(argc, argv);
+    uint32_t iterations = benchIterations(5000000);
+    const int64_t firstDay = 19000;     // 2022, file and log timestamps
+
+    uint64_t start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        Date date = dateOfEpochDay(firstDay + (i & 4095));
+        benchSink += dateToEpochDay(&date);
+    }
+    printBenchResult("round trip", benchNowNanos() - start, iterations);
+
+    start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        Date date = previousDateOfEpochDay(firstDay + (i & 4095));
+        benchSink += previousDateToEpochDay(&date);
+    }
+    printBenchResult("round trip, previous", benchNowNanos() - start, iterations);
+
+    start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        DateTime dateTime = dateTimeOfEpochSeconds(1640995200 + i * 97, 0, 0);
+        benchSink += dateTimeToEpochSecond(&dateTime, 0);
+    }
+    printBenchResult("date-time epoch seconds round trip", benchNowNanos() - start, iterations);
+    return 0;
+}
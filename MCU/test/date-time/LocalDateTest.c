@@ -0,0 +1,98 @@
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "DateTimeMath.h"
+#include "PreviousEpochDay.h"
+
+// Loop-free epoch day conversions against calendar stepped day by day and against previous implementation
+
+#define STEPPED_YEARS 10000
+#define RANDOM_EPOCH_DAYS 2000000
+
+static bool isSameDate(const Date *expected, const Date *actual) {
+    return expected->year == actual->year && expected->month == actual->month && expected->day == actual->day;
+}
+
+static uint32_t checkEpochDay(int64_t epochDay, const Date *expected) {    // returns 1 when conversion differs
+    Date date = dateOfEpochDay(epochDay);
+    if (!isSameDate(expected, &date) || date.weekDay != floorMod(epochDay + 3, 7) + 1) {
+        TEST_FAIL("epoch day %lld: %lld-%d-%d, expected %lld-%d-%d", (long long) epochDay,
+                  (long long) date.year, date.month, date.day, (long long) expected->year, expected->month, expected->day);
+        return 1;
+    }
+    if (dateToEpochDay(&date) != epochDay || getDayOfWeek(&date) != date.weekDay) {
+        TEST_FAIL("%lld-%d-%d: epoch day %lld, expected %lld", (long long) date.year, date.month, date.day, (long long) dateToEpochDay(&date), (long long) epochDay);
+        return 1;
+    }
+    return 0;
+}
+
+static void testEveryDayAgainstSteppedCalendar() {     // +-10000 years around epoch
+    Date expected = {.year = 1970, .month = 1, .day = 1};
+    uint32_t failureCount = 0;
+    int64_t epochDay = 0;
+    for (; expected.year < 1970 + STEPPED_YEARS && failureCount == 0; epochDay++) {
+        failureCount += checkEpochDay(epochDay, &expected);
+        if (expected.day < lengthOfMonth(expected.month, isLeapYear(expected.year))) {
+            expected.day++;
+        } else {
+            expected.day = 1;
+            expected.month = expected.month == 12 ? 1 : expected.month + 1;
+            expected.year += expected.month == 1;
+        }
+    }
+
+    expected = (Date) {.year = 1970, .month = 1, .day = 1};
+    for (epochDay = 0; expected.year > 1970 - STEPPED_YEARS && failureCount == 0; epochDay--) {
+        failureCount += checkEpochDay(epochDay, &expected);
+        if (expected.day > 1) {
+            expected.day--;
+        } else {
+            expected.month = expected.month == 1 ? 12 : expected.month - 1;
+            expected.year -= expected.month == 12;
+            expected.day = lengthOfMonth(expected.month, isLeapYear(expected.year));
+        }
+    }
+    printf("checked down to %lld\n", (long long) epochDay);
+}
+
+static void testRandomDaysAgainstPreviousImplementation() {  // whole year range and its bounds, out of year range days are invalid
+    srand(46);
+    Date firstDate = {.year = YEAR_RANGE.min, .month = 1, .day = 1};
+    Date lastDate = {.year = YEAR_RANGE.max, .month = 12, .day = 31};
+    int64_t firstDay = dateToEpochDay(&firstDate);
+    int64_t lastDay = dateToEpochDay(&lastDate);
+    const int64_t boundDays[] = {firstDay, firstDay + 1, lastDay - 1, lastDay, -719528, -719529, 2932896};
+    for (uint32_t i = 0; i < RANDOM_EPOCH_DAYS + ARRAY_SIZE(boundDays); i++) {
+        int64_t epochDay = i < ARRAY_SIZE(boundDays) ? boundDays[i] :
+                           firstDay + (int64_t) ((((uint64_t) rand() << 31) ^ (uint64_t) rand()) % (uint64_t) (lastDay - firstDay + 1));
+        Date expected = previousDateOfEpochDay(epochDay);
+        if (checkEpochDay(epochDay, &expected) > 0) break;
+        if (dateToEpochDay(&expected) != previousDateToEpochDay(&expected)) {
+            TEST_FAIL("epoch day %lld differs from previous implementation", (long long) epochDay);
+            break;
+        }
+    }
+
+    const int64_t invalidDays[] = {firstDay - 1, lastDay + 1, EPOCH_DAY_RANGE.min, EPOCH_DAY_RANGE.max, EPOCH_DAY_RANGE.min - 1, EPOCH_DAY_RANGE.max + 1, INT64_MIN};
+    for (uint32_t i = 0; i < ARRAY_SIZE(invalidDays); i++) {
+        Date date = dateOfEpochDay(invalidDays[i]);
+        Date previous = previousDateOfEpochDay(invalidDays[i]);
+        ASSERT_FALSE(isDateValid(&date));
+        ASSERT_TRUE(isSameDate(&previous, &date));
+    }
+}
+
+static void testInvalidDate() {
+    Date invalid = {.year = 2023, .month = 2, .day = 29};
+    ASSERT_TRUE(dateToEpochDay(&invalid) == INT64_MIN);
+    ASSERT_TRUE(previousDateToEpochDay(&invalid) == INT64_MIN);
+    ASSERT_EQ_INT(0, getDayOfWeek(&invalid));
+}
+
+int main() {
+    RUN_TEST(testEveryDayAgainstSteppedCalendar);
+    RUN_TEST(testRandomDaysAgainstPreviousImplementation);
+    RUN_TEST(testInvalidDate);
+    return TEST_RESULT();
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "LocalDate.h"
+#include "ValueRange.h"
+
+// Epoch day conversions as they were before loop-free civil algorithms, reference for test and benchmark
+
+static inline Date previousDateOfEpochDay(int64_t epochDay) {
+    if (isValidValue(&EPOCH_DAY_RANGE, epochDay)) {
+        int64_t zeroDay = epochDay + DAYS_0000_TO_1970;
+        // find the march-based year
+        zeroDay -= 60;  // adjust to 0000-03-01 so leap day is at end of four-year cycle
+        int64_t adjust = 0;
+        if (zeroDay < 0) {
+            // adjust negative years to positive for calculation
+            int64_t adjustCycles = (zeroDay + 1) / DAYS_PER_CYCLE - 1;
+            adjust = adjustCycles * 400;
+            zeroDay += -adjustCycles * DAYS_PER_CYCLE;
+        }
+        int64_t yearEst = (400 * zeroDay + 591) / DAYS_PER_CYCLE;
+        int64_t doyEst = zeroDay - (365 * yearEst + yearEst / 4 - yearEst / 100 + yearEst / 400);
+        if (doyEst < 0) {
+            yearEst--;// fix estimate
+            doyEst = zeroDay - (365 * yearEst + yearEst / 4 - yearEst / 100 + yearEst / 400);
+        }
+        yearEst += adjust;  // reset any negative year
+        uint32_t marchDoy0 = (uint32_t) doyEst;
+
+        // convert march-based values back to january-based
+        uint32_t marchMonth0 = (marchDoy0 * 5 + 2) / 153;
+        uint32_t month = (marchMonth0 + 2) % 12 + 1;
+        uint32_t dayOfMonth = marchDoy0 - (marchMonth0 * 306 + 5) / 10 + 1;
+        yearEst += marchMonth0 / 10;
+
+        if (isValidValue(&YEAR_RANGE, yearEst)) {
+            return dateOf(yearEst, month, dayOfMonth);
+        }
+    }
+    return (Date) {.year = -1, .month = 0, .day = -1};    // same as UNINITIALIZED_DATE
+}
+
+static inline int64_t previousDateToEpochDay(Date *date) {
+    if (!isDateValid(date)) return INT64_MIN;
+    int64_t year = date->year;
+    int64_t month = date->month;
+    int64_t total = 0;
+    total += 365 * year;
+    if (year >= 0) {
+        total += (year + 3) / 4 - (year + 99) / 100 + (year + 399) / 400;
+    } else {
+        total -= year / -4 - year / -100 + year / -400;
+    }
+    total += ((367 * month - 362) / 12);
+    total += date->day - 1;
+    if (month > 2) {
+        total--;
+        if (!isLeapYear(date->year)) {
+            total--;
+        }
+    }
+    return total - DAYS_0000_TO_1970;
+}
+
@@ -0,0 +1,115 @@
+#include "TestUtils.h"
+#include "TimeZone.h"
+
+// Rule transition lookup, binary search against linear walk as it was before rules had count, cached offset lookup and zone id lookup
+
+static ZoneTransition linearRuleTransition(int64_t epochSeconds, const TimeZone *zone) {
+    ZoneTransition zoneTransition = {.after = NULL, .before = NULL};
+    for (uint32_t i = 1; zone->rules[i].transition != 0; i++) {
+        if (zone->rules[i].transition >= epochSeconds) {
+            zoneTransition.before = &zone->rules[i - 1];
+            zoneTransition.after = &zone->rules[i];
+            break;
+        }
+    }
+    return zoneTransition;
+}
+
+static void benchZone(const char *zoneId) {
+    const TimeZone *zone = findTimeZone(zoneId);
+    uint32_t iterations = benchIterations(1000000);
+    printf("%s, %u rules\n", zoneId, zone->ruleCount);
+    const int64_t instants[] = {315532800, 1000000000, 1700000000, 2000000000};    // 1980, 2001, 2023, 2033
+
+    for (uint32_t j = 0; j < ARRAY_SIZE(instants); j++) {
+        char name[64];
+        uint64_t start = benchNowNanos();
+        for (uint32_t i = 0; i < iterations; i++) {
+            benchSink += (uintptr_t) findZoneRuleTransition(instants[j] + (i & 1023), zone).after;
+        }
+        snprintf(name, sizeof(name), "binary search at %lld", (long long) instants[j]);
+        printBenchResult(name, benchNowNanos() - start, iterations);
+
+        start = benchNowNanos();
+        for (uint32_t i = 0; i < iterations; i++) {
+            benchSink += (uintptr_t) linearRuleTransition(instants[j] + (i & 1023), zone).after;
+        }
+        snprintf(name, sizeof(name), "linear walk at %lld", (long long) instants[j]);
+        printBenchResult(name, benchNowNanos() - start, iterations);
+    }
+}
+
+static void benchOffsetCache() {    // log timestamps in one zone hit cached range, alternating zones always resolves again
+    const TimeZone *berlin = findTimeZone("Europe/Berlin");
+    const TimeZone *sydney = findTimeZone("Australia/Sydney");
+    uint32_t iterations = benchIterations(1000000);
+    resetZoneOffsetCache();
+    uint64_t start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += resolveTimeZoneOffset(1700000000 + i, berlin);
+    }
+    printBenchResult("offset, cached range", benchNowNanos() - start, iterations);
+
+    start = benchNowNanos();
+    for (uint32_t i = 0; i < iterations; i++) {
+        benchSink += resolveTimeZoneOffset(1700000000 + i, (i & 1) ? sydney : berlin);
+    }
+    printBenchResult("offset, alternating zones", benchNowNanos() - start, iterations);
+    ZoneOffsetCacheStats stats = getZoneOffsetCacheStats();
+    printf("hits %u, misses %u\n", stats.hits, stats.misses);
+}
+
+static int32_t binarySearchZoneIndex(const char *id) {    // exact case strcmp search used before hash
+    int32_t leftIndex = 0;
+    int32_t rightIndex = ARRAY_SIZE(ZONE_LIST) - 1;
+    while (leftIndex <= rightIndex) {
+        int32_t middleIndex = leftIndex + (rightIndex - leftIndex) / 2;
+        int result = strcmp(id, ZONE_LIST[middleIndex].id);
+        if (result == 0) return middleIndex;
+        if (result > 0) {
+            leftIndex = middleIndex + 1;
+        } else {
+            rightIndex = middleIndex - 1;
+        }
+    }
+    return -1;
+}
+
+static void benchZoneIdLookup() {
+    uint32_t rounds = benchIterations(200);
+    const uint32_t zoneCount = ARRAY_SIZE(ZONE_LIST);
+    uint64_t start = benchNowNanos();
+    for (uint32_t round = 0; round < rounds; round++) {
+        for (uint32_t i = 0; i < zoneCount; i++) {
+            benchSink += binarySearchZoneIndex(ZONE_LIST[(i * 37) % zoneCount].id);
+        }
+    }
+    printBenchResult("zone id, strcmp binary search", benchNowNanos() - start, rounds * zoneCount);
+
+    start = benchNowNanos();
+    for (uint32_t round = 0; round < rounds; round++) {
+        for (uint32_t i = 0; i < zoneCount; i++) {
+            benchSink += (uintptr_t) findTimeZone(ZONE_LIST[(i * 37) % zoneCount].id);
+        }
+    }
+    printBenchResult("zone id, hash ignoring case", benchNowNanos() - start, rounds * zoneCount);
+
+    const char *prefixes[] = {"e", "Europe/", "europe/r", "AMERICA/ARGENTINA/", "US/"};
+    const TimeZone *zones[10];
+    start = benchNowNanos();
+    for (uint32_t round = 0; round < rounds * 100; round++) {
+        benchSink += findTimeZonesByPrefix(prefixes[round % ARRAY_SIZE(prefixes)], zones, ARRAY_SIZE(zones));
+    }
+    printBenchResult("zone id prefix, 10 results", benchNowNanos() - start, rounds * 100);
+}
+
+int main(int argc, char **argv) {
+    initBench(argc, argv);
+    benchZone("Europe/Berlin");
+    benchZone("America/New_York");
+    benchZone("Australia/Sydney");
+    benchZone("Europe/Moscow");     // long history, last transition in 2014
+    benchOffsetCache();
+    benchZoneIdLookup();
+    return 0;
+}
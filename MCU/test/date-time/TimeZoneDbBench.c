@@ -0,0 +1,51 @@
+#include "TestUtils.h"
+#include "TimeZoneDb.h"
+
+// Zone lookup and rules load from tzdb.bin, as done when zone is selected, all zones in turn. Hash lookup against binary search
+
+int main(int argc, char **argv) {
+    initBench(argc, argv);
+    TimeZoneDb db;
+    if (!openTimeZoneDb(&db, TZDB_PATH)) return 1;
+    uint32_t rounds = benchIterations(20);
+    TimeZoneDbEntry entry;
+    TimeZoneRule rules[9];
+
+    uint64_t start = benchNowNanos();
+    for (uint32_t round = 0; round < rounds; round++) {
+        for (uint32_t i = 0; i < ARRAY_SIZE(ZONE_LIST); i++) {
+            benchSink += findTimeZoneDbEntry(&db, ZONE_LIST[i].id, &entry);
+        }
+    }
+    printBenchResult("find zone, hash", benchNowNanos() - start, rounds * ARRAY_SIZE(ZONE_LIST));
+
+    uint32_t hashTableOffset = db.hashTableOffset;
+    db.hashTableOffset = 0;     // lookup as for version 1 files
+    start = benchNowNanos();
+    for (uint32_t round = 0; round < rounds; round++) {
+        for (uint32_t i = 0; i < ARRAY_SIZE(ZONE_LIST); i++) {
+            benchSink += findTimeZoneDbEntry(&db, ZONE_LIST[i].id, &entry);
+        }
+    }
+    printBenchResult("find zone, binary search", benchNowNanos() - start, rounds * ARRAY_SIZE(ZONE_LIST));
+    db.hashTableOffset = hashTableOffset;
+
+    start = benchNowNanos();
+    for (uint32_t round = 0; round < rounds; round++) {
+        for (uint32_t i = 0; i < ARRAY_SIZE(ZONE_LIST); i++) {
+            findTimeZoneDbEntry(&db, ZONE_LIST[i].id, &entry);
+            benchSink += readTimeZoneDbRules(&db, &entry, 1700000000, rules, ARRAY_SIZE(rules));
+        }
+    }
+    printBenchResult("find zone + load 8 rules", benchNowNanos() - start, rounds * ARRAY_SIZE(ZONE_LIST));
+
+    start = benchNowNanos();
+    for (uint32_t round = 0; round < rounds; round++) {
+        for (uint32_t i = 0; i < ARRAY_SIZE(ZONE_LIST); i++) {
+            benchSink += (uintptr_t) findTimeZone(ZONE_LIST[i].id);
+        }
+    }
+    printBenchResult("find compiled zone", benchNowNanos() - start, rounds * ARRAY_SIZE(ZONE_LIST));
+    closeTimeZoneDb(&db);
+    return 0;
+}
@@ -0,0 +1,155 @@
+#include <ctype.h>
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "TimeZoneDb.h"
+
+// Zones read from sd-card/db/tzdb.bin against compiled zone list, names and historic rules
+
+#define MAX_ZONE_RULES 2000
+
+static TimeZoneRule dbRules[MAX_ZONE_RULES];
+
+static bool isSameRule(const TimeZoneRule *expected, const TimeZoneRule *actual) {
+    return expected->transition == actual->transition && expected->gmtOffset == actual->gmtOffset && expected->isDaylightTime == actual->isDaylightTime;
+}
+
+static void testAllZonesMatchCompiled() {
+    TimeZoneDb db;
+    ASSERT_TRUE(openTimeZoneDb(&db, TZDB_PATH));
+    uint64_t ruleCount = 0;
+    for (uint32_t i = 0; i < ARRAY_SIZE(ZONE_LIST); i++) {
+        const TimeZone *zone = &ZONE_LIST[i];
+        char lowerCaseId[TZDB_ZONE_ID_MAX_LENGTH];
+        uint32_t length = 0;
+        for (; zone->id[length] != '\0'; length++) {
+            lowerCaseId[length] = (char) tolower((unsigned char) zone->id[length]);
+        }
+        lowerCaseId[length] = '\0';
+
+        TimeZoneDbEntry entry;
+        if (!findTimeZoneDbEntry(&db, lowerCaseId, &entry) || strcmp(entry.id, zone->id) != 0 || entry.utcOffset != zone->utcOffset) {
+            TEST_FAIL("%s not found", zone->id);
+            continue;
+        }
+
+        uint32_t count = readTimeZoneDbRules(&db, &entry, INT64_MIN, dbRules, MAX_ZONE_RULES);
+        if (count != zone->ruleCount || dbRules[count].transition != 0) {
+            TEST_FAIL("%s: %u rules, expected %u", zone->id, count, zone->ruleCount);
+            continue;
+        }
+        for (uint32_t j = 0; j < count; j++) {
+            if (!isSameRule(&zone->rules[j], &dbRules[j])) {
+                TEST_FAIL("%s: rule %u differs", zone->id, j);
+                break;
+            }
+        }
+        ruleCount += count;
+
+        if (count > 3) {    // only rules after given instant, limited by capacity
+            uint32_t middle = count / 2;
+            uint32_t laterCount = readTimeZoneDbRules(&db, &entry, zone->rules[middle].transition, dbRules, 9);
+            ASSERT_EQ_INT(MIN(count - middle - 1, 8), laterCount);
+            ASSERT_TRUE(isSameRule(&zone->rules[middle + 1], &dbRules[0]));
+            ASSERT_TRUE(dbRules[laterCount].transition == 0);
+        }
+
+        for (uint8_t nameIndex = 0; nameIndex < 4; nameIndex++) {
+            char name[TZDB_ZONE_NAME_MAX_LENGTH];
+            if (!readTimeZoneDbName(&db, &entry, nameIndex, name, sizeof(name)) || strcmp(name, zone->names[nameIndex]) != 0) {
+                TEST_FAIL("%s: name %u differs", zone->id, nameIndex);
+            }
+        }
+    }
+    printf("%u zones, %llu rules checked\n", (uint32_t) ARRAY_SIZE(ZONE_LIST), (unsigned long long) ruleCount);
+    closeTimeZoneDb(&db);
+}
+
+static void testMissingZoneAndFile() {
+    TimeZoneDb db;
+    ASSERT_FALSE(openTimeZoneDb(&db, TZDB_PATH ".missing"));
+    ASSERT_TRUE(openTimeZoneDb(&db, TZDB_PATH));
+    TimeZoneDbEntry entry;
+    ASSERT_FALSE(findTimeZoneDbEntry(&db, "Nowhere/City", &entry));
+    ASSERT_FALSE(findTimeZoneDbEntry(&db, "", &entry));
+    ASSERT_TRUE(findTimeZoneDbEntry(&db, "EUROPE/RIGA", &entry));
+    ASSERT_EQ_STR("Europe/Riga", entry.id);
+
+    char name[4];
+    ASSERT_FALSE(readTimeZoneDbName(&db, &entry, 0, name, sizeof(name)));    // too long for buffer
+    closeTimeZoneDb(&db);
+}
+
+static void testHashLookupMatchesBinarySearch() {   // every id and its upper case form, hash table off acts as version 1 file
+    TimeZoneDb db;
+    ASSERT_TRUE(openTimeZoneDb(&db, TZDB_PATH));
+    ASSERT_TRUE(db.hashTableOffset != 0);
+    uint32_t hashTableOffset = db.hashTableOffset;
+    for (uint32_t i = 0; i < ARRAY_SIZE(ZONE_LIST); i++) {
+        char upperCaseId[TZDB_ZONE_ID_MAX_LENGTH];
+        uint32_t length = 0;
+        for (; ZONE_LIST[i].id[length] != '\0'; length++) {
+            upperCaseId[length] = (char) toupper((unsigned char) ZONE_LIST[i].id[length]);
+        }
+        upperCaseId[length] = '\0';
+
+        TimeZoneDbEntry hashed;
+        TimeZoneDbEntry sorted;
+        db.hashTableOffset = hashTableOffset;
+        bool isHashedFound = findTimeZoneDbEntry(&db, upperCaseId, &hashed);
+        db.hashTableOffset = 0;
+        bool isSortedFound = findTimeZoneDbEntry(&db, upperCaseId, &sorted);
+        if (!isHashedFound || !isSortedFound || strcmp(hashed.id, sorted.id) != 0 || hashed.ruleDataOffset != sorted.ruleDataOffset) {
+            TEST_FAIL("%s: hash and binary search differ", ZONE_LIST[i].id);
+        }
+    }
+
+    db.hashTableOffset = hashTableOffset;
+    TimeZoneDbEntry entry;
+    ASSERT_FALSE(findTimeZoneDbEntry(&db, "Europe/Berlin/", &entry));   // lands on some slot, id compare rejects it
+    ASSERT_FALSE(findTimeZoneDbEntry(&db, "Europe/Berli", &entry));
+    char longId[TZDB_ZONE_ID_MAX_LENGTH + 8];
+    memset(longId, 'a', sizeof(longId) - 1);
+    longId[sizeof(longId) - 1] = '\0';
+    ASSERT_FALSE(findTimeZoneDbEntry(&db, longId, &entry));
+    closeTimeZoneDb(&db);
+}
+
+static void testVersionOneFile() {  // same file marked as version 1: 28 byte header, hash table is ignored
+    FILE *source = fopen(TZDB_PATH, "rb");
+    ASSERT_TRUE(source != NULL);
+    if (source == NULL) return;
+    static uint8_t content[512 * 1024];
+    size_t length = fread(content, 1, sizeof(content), source);
+    fclose(source);
+    content[4] = 1;
+    char path[] = "/tmp/tzdb-v1-XXXXXX";
+    int descriptor = mkstemp(path);
+    FILE *copy = descriptor >= 0 ? fdopen(descriptor, "wb") : NULL;
+    ASSERT_TRUE(copy != NULL);
+    if (copy == NULL) return;
+    fwrite(content, 1, length, copy);
+    fclose(copy);
+
+    TimeZoneDb db;
+    ASSERT_TRUE(openTimeZoneDb(&db, path));
+    ASSERT_EQ_INT(0, db.hashTableOffset);
+    TimeZoneDbEntry entry;
+    ASSERT_TRUE(findTimeZoneDbEntry(&db, "europe/moscow", &entry));
+    ASSERT_EQ_STR("Europe/Moscow", entry.id);
+    closeTimeZoneDb(&db);
+    content[4] = 3;     // unknown newer version is rejected
+    copy = fopen(path, "wb");
+    fwrite(content, 1, length, copy);
+    fclose(copy);
+    ASSERT_FALSE(openTimeZoneDb(&db, path));
+    remove(path);
+}
+
+int main() {
+    RUN_TEST(testAllZonesMatchCompiled);
+    RUN_TEST(testMissingZoneAndFile);
+    RUN_TEST(testHashLookupMatchesBinarySearch);
+    RUN_TEST(testVersionOneFile);
+    return TEST_RESULT();
+}
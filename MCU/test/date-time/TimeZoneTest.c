@@ -0,0 +1,234 @@
+#include <stdlib.h>
+#include <ctype.h>
+#include <strings.h>
+#include <pthread.h>
+
+#include "TestUtils.h"
+#include "TimeZone.h"
+
+// Binary search over zone rules and cached offset lookups against linear walk, for all zones around every transition and gap bound.
+// Zone id hash and prefix index against scanning zone list
+
+#define TIME_ZONE_ID_TEST_LENGTH 64
+
+static ZoneTransition linearRuleTransition(int64_t epochSeconds, const TimeZone *zone) {
+    ZoneTransition zoneTransition = {.after = NULL, .before = NULL};
+    if (zone->rules == NULL) return zoneTransition;
+    for (uint32_t i = 1; zone->rules[i].transition != 0; i++) {
+        if (zone->rules[i].transition >= epochSeconds) {
+            zoneTransition.before = &zone->rules[i - 1];
+            zoneTransition.after = &zone->rules[i];
+            break;
+        }
+    }
+    return zoneTransition;
+}
+
+static int32_t linearOffset(int64_t epochSeconds, const TimeZone *zone) {
+    ZoneTransition zoneTransition = linearRuleTransition(epochSeconds, zone);
+    if (zoneTransition.after == NULL) return zone->utcOffset;
+    return isTransitionGap(&zoneTransition, epochSeconds) ? zoneTransition.after->gmtOffset : zoneTransition.before->gmtOffset;
+}
+
+static bool linearIsDaylightTime(int64_t epochSeconds, const TimeZone *zone) {
+    ZoneTransition zoneTransition = linearRuleTransition(epochSeconds, zone);
+    return zoneTransition.before != NULL && zoneTransition.before->isDaylightTime;
+}
+
+static ZoneTransition linearLocalTransition(int64_t localEpochSeconds, const TimeZone *zone, int32_t *offset) {
+    ZoneTransition zoneTransition = {.after = NULL, .before = NULL};
+    int32_t localOffset = zone->utcOffset;
+    for (uint32_t i = 0; zone->rules != NULL && zone->rules[i].transition != 0; i++) {
+        const TimeZoneRule *rule = &zone->rules[i];
+        int32_t lowOffset = localOffset < rule->gmtOffset ? localOffset : rule->gmtOffset;
+        int32_t highOffset = localOffset < rule->gmtOffset ? rule->gmtOffset : localOffset;
+        if (localEpochSeconds < rule->transition + lowOffset) break;
+        if (localEpochSeconds < rule->transition + highOffset && i > 0) {
+            zoneTransition.before = &zone->rules[i - 1];
+            zoneTransition.after = rule;
+            break;
+        }
+        localOffset = rule->gmtOffset;
+    }
+    *offset = localOffset;
+    return zoneTransition;
+}
+
+static uint32_t checkInstant(const TimeZone *zone, int64_t epochSeconds) {   // returns 1 when lookup differs
+    ZoneTransition expected = linearRuleTransition(epochSeconds, zone);
+    ZoneTransition actual = findZoneRuleTransition(epochSeconds, zone);
+    if (expected.before != actual.before || expected.after != actual.after) {
+        TEST_FAIL("%s at %lld: other transition found", zone->id, (long long) epochSeconds);
+        return 1;
+    }
+
+    ZoneOffsetInfo info = resolveTimeZoneInfo(epochSeconds, zone);
+    if (info.offset != linearOffset(epochSeconds, zone) || info.isDaylightTime != linearIsDaylightTime(epochSeconds, zone) ||
+        resolveTimeZoneOffset(epochSeconds, zone) != info.offset) {
+        TEST_FAIL("%s at %lld: offset %d, expected %d", zone->id, (long long) epochSeconds, info.offset, linearOffset(epochSeconds, zone));
+        return 1;
+    }
+
+    int32_t expectedOffset;
+    int32_t actualOffset;
+    expected = linearLocalTransition(epochSeconds, zone, &expectedOffset);
+    actual = findLocalZoneTransition(epochSeconds, zone, &actualOffset);
+    if (expected.before != actual.before || expected.after != actual.after || expectedOffset != actualOffset) {
+        TEST_FAIL("%s at local %lld: other local transition found", zone->id, (long long) epochSeconds);
+        return 1;
+    }
+    return 0;
+}
+
+static uint32_t checkZone(const TimeZone *zone, uint64_t *checkedCount) {
+    uint32_t failureCount = 0;
+    for (int64_t epochSeconds = -86400; epochSeconds < 4102444800LL && failureCount == 0; epochSeconds += 86400 * 7 + 3599) {
+        failureCount += checkInstant(zone, epochSeconds);
+        (*checkedCount)++;
+    }
+    for (uint32_t i = 0; zone->rules != NULL && zone->rules[i].transition != 0 && failureCount == 0; i++) {
+        const TimeZoneRule *rule = &zone->rules[i];
+        const int64_t instants[] = {rule->transition, rule->transition + rule->gmtOffset, rule->transition + (i > 0 ? (rule - 1)->gmtOffset : 0)};
+        for (uint32_t j = 0; j < ARRAY_SIZE(instants); j++) {
+            for (int64_t delta = -1; delta <= 1; delta++) {
+                failureCount += checkInstant(zone, instants[j] + delta);
+                (*checkedCount)++;
+            }
+        }
+    }
+    return failureCount;
+}
+
+static void testAllZonesAgainstLinearSearch() {
+    uint64_t checkedCount = 0;
+    uint32_t failedZones = 0;
+    for (uint32_t i = 0; i < ARRAY_SIZE(ZONE_LIST) && failedZones < 5; i++) {
+        failedZones += checkZone(&ZONE_LIST[i], &checkedCount) > 0;
+    }
+    printf("%u zones, %llu lookups checked\n", (uint32_t) ARRAY_SIZE(ZONE_LIST), (unsigned long long) checkedCount);
+}
+
+static void testRulesWithoutCount() {   // rules loaded at runtime may have no count, then they are counted up to terminating rule
+    uint64_t checkedCount = 0;
+    for (uint32_t i = 0; i < ARRAY_SIZE(ZONE_LIST); i++) {
+        if (ZONE_LIST[i].rules == NULL) continue;
+        TimeZone zone = ZONE_LIST[i];
+        zone.ruleCount = 0;
+        if (checkZone(&zone, &checkedCount) > 0) break;
+    }
+}
+
+static void testZonesWithoutRules() {
+    const TimeZone *tokyo = findTimeZone("Asia/Tokyo");
+    ASSERT_TRUE(tokyo != NULL);
+    ZoneTransition transition = findZoneRuleTransition(1700000000, tokyo);
+    ASSERT_TRUE(transition.before == NULL && transition.after == NULL);
+    ASSERT_EQ_INT(32400, resolveTimeZoneOffset(1700000000, tokyo));
+    ASSERT_EQ_INT(0, resolveTimeZoneOffset(1700000000, &UTC));
+}
+
+static void testCachedLookupsMatchLinearSearch() {    // hourly steps hit cached range, switching zones replaces it
+    const TimeZone *berlin = findTimeZone("Europe/Berlin");
+    const TimeZone *sydney = findTimeZone("Australia/Sydney");
+    resetZoneOffsetCache();
+    for (int64_t epochSeconds = 1577836800; epochSeconds < 1893456000; epochSeconds += 3600) {    // 2020 - 2030
+        const TimeZone *zone = (epochSeconds / 3600) % 5 == 0 ? sydney : berlin;
+        ZoneOffsetInfo info = resolveTimeZoneInfo(epochSeconds, zone);
+        bool isDaylightTime = linearIsDaylightTime(epochSeconds, zone);
+        const char *expectedName = zone->names[isDaylightTime ? ZONE_SHORT_NAME_DTS_INDEX : ZONE_SHORT_NAME_STD_INDEX];
+        if (info.offset != linearOffset(epochSeconds, zone) || info.isDaylightTime != isDaylightTime || info.shortName != expectedName) {
+            TEST_FAIL("%s at %lld: cached offset %d, expected %d", zone->id, (long long) epochSeconds, info.offset, linearOffset(epochSeconds, zone));
+            break;
+        }
+    }
+    ZoneOffsetCacheStats stats = getZoneOffsetCacheStats();
+    printf("hits %u, misses %u\n", stats.hits, stats.misses);
+    ASSERT_TRUE(stats.hits > stats.misses);
+}
+
+static TimeZoneRule mutableRules[] = {{3600, false, 1000}, {7200, true, 2000000000}, {.transition = 0}};
+static TimeZone mutableZone = {.id = "Test/Zone", .utcOffset = 3600, .rules = mutableRules, .ruleCount = 2};
+
+static void *resetCacheTask(void *argument) {
+    resetZoneOffsetCache();
+    return argument;
+}
+
+static void testResetFromOtherTask() {   // rules changed in place, e.g. reloaded from database, reset by one task drops cache of all tasks
+    ASSERT_EQ_INT(3600, resolveTimeZoneOffset(1500000000, &mutableZone));
+    mutableRules[0].gmtOffset = 5400;
+    ASSERT_EQ_INT(3600, resolveTimeZoneOffset(1500000000, &mutableZone));   // still cached
+
+    pthread_t thread;
+    pthread_create(&thread, NULL, resetCacheTask, NULL);
+    pthread_join(thread, NULL);
+    ASSERT_EQ_INT(5400, resolveTimeZoneOffset(1500000000, &mutableZone));
+    mutableRules[0].gmtOffset = 3600;
+    resetZoneOffsetCache();
+}
+
+static void testFindZoneIgnoringCase() {
+    uint32_t failureCount = 0;
+    for (uint32_t i = 0; i < ARRAY_SIZE(ZONE_LIST) && failureCount < 5; i++) {
+        const char *id = ZONE_LIST[i].id;
+        char changedId[TIME_ZONE_ID_TEST_LENGTH];
+        uint32_t length = strlen(id);
+        for (uint32_t j = 0; j <= length; j++) {
+            changedId[j] = (char) ((i & 1) ? toupper((unsigned char) id[j]) : tolower((unsigned char) id[j]));
+        }
+        const TimeZone *exact = findTimeZone(id);
+        const TimeZone *otherCase = findTimeZone(changedId);
+        if (exact == NULL || otherCase != exact || strcmp(exact->id, id) != 0) {   // static ZONE_LIST is copied to each translation unit, so compare ids
+            TEST_FAIL("%s not found as \"%s\"", id, exact == NULL ? id : changedId);
+            failureCount++;
+        }
+
+        memcpy(changedId, id, length + 1);     // near miss is found only when it is another zone id
+        changedId[length - 1] ^= 1;
+        const TimeZone *nearMiss = findTimeZone(changedId);
+        bool isOtherZone = false;
+        for (uint32_t j = 0; j < ARRAY_SIZE(ZONE_LIST); j++) {
+            isOtherZone |= strcasecmp(ZONE_LIST[j].id, changedId) == 0;
+        }
+        if ((nearMiss != NULL) != isOtherZone || (nearMiss != NULL && strcasecmp(nearMiss->id, changedId) != 0)) {
+            TEST_FAIL("near miss \"%s\" found as %s", changedId, nearMiss == NULL ? "nothing" : nearMiss->id);
+            failureCount++;
+        }
+    }
+    ASSERT_TRUE(findTimeZone("") == NULL);
+    ASSERT_TRUE(findTimeZone(NULL) == NULL);
+    ASSERT_TRUE(findTimeZone("Europe/Riga/") == NULL);
+}
+
+static void testPrefixMatchesBruteForce() {
+    const char *prefixes[] = {"", "e", "Europe/", "europe/r", "AMERICA/ARGENTINA/", "Etc/GMT+", "x", "US/", "Zulu", "Zulux", "a"};
+    static const TimeZone *zones[ARRAY_SIZE(ZONE_LIST)];
+    for (uint32_t p = 0; p < ARRAY_SIZE(prefixes); p++) {
+        uint32_t prefixLength = strlen(prefixes[p]);
+        uint32_t count = findTimeZonesByPrefix(prefixes[p], zones, ARRAY_SIZE(zones));
+        uint32_t expectedCount = 0;
+        for (uint32_t i = 0; i < ARRAY_SIZE(ZONE_LIST); i++) {
+            expectedCount += strncasecmp(ZONE_LIST[i].id, prefixes[p], prefixLength) == 0;
+        }
+        ASSERT_EQ_INT(expectedCount, count);
+        for (uint32_t i = 0; i < count; i++) {
+            if (strncasecmp(zones[i]->id, prefixes[p], prefixLength) != 0 || (i > 0 && strcasecmp(zones[i - 1]->id, zones[i]->id) >= 0)) {
+                TEST_FAIL("prefix \"%s\": %s out of order or not matching", prefixes[p], zones[i]->id);
+                break;
+            }
+        }
+        ASSERT_EQ_INT(expectedCount, findTimeZonesByPrefix(prefixes[p], zones, 3));    // count of all matches, only capacity stored
+        ASSERT_EQ_INT(expectedCount, findTimeZonesByPrefix(prefixes[p], NULL, 0));
+    }
+}
+
+int main() {
+    RUN_TEST(testZonesWithoutRules);
+    RUN_TEST(testAllZonesAgainstLinearSearch);
+    RUN_TEST(testRulesWithoutCount);
+    RUN_TEST(testCachedLookupsMatchLinearSearch);
+    RUN_TEST(testResetFromOtherTask);
+    RUN_TEST(testFindZoneIgnoringCase);
+    RUN_TEST(testPrefixMatchesBruteForce);
+    return TEST_RESULT();
+}
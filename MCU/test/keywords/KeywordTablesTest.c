@@ -0,0 +1,189 @@
+#include <stdlib.h>
+
+#include "TestUtils.h"
+#include "CronKeywords.h"
+#include "DateTimeKeywords.h"
+#include "CronExpression.h"
+#include "CSPTemplate.h"
+
+// Generated perfect hash tables against linear strncasecmp search over the spec keywords: every keyword in any case,
+// single character mutations and random strings, plus lookups through cron parser and CSP tag resolver
+
+typedef struct ReferenceKeyword {
+    const char *name;
+    int32_t value;
+} ReferenceKeyword;
+
+typedef int32_t (*KeywordLookup)(const char *key, uint32_t length);     // value of found keyword, -1 if not found
+
+static const ReferenceKeyword MONTH_SHORT_NAMES[] = {
+        {"Jan", JANUARY}, {"Feb", FEBRUARY}, {"Mar", MARCH}, {"Apr", APRIL}, {"May", MAY}, {"Jun", JUNE},
+        {"Jul", JULY}, {"Aug", AUGUST}, {"Sep", SEPTEMBER}, {"Oct", OCTOBER}, {"Nov", NOVEMBER}, {"Dec", DECEMBER},
+};
+static const ReferenceKeyword MONTH_LONG_NAMES[] = {
+        {"January", JANUARY}, {"February", FEBRUARY}, {"March", MARCH}, {"April", APRIL}, {"May", MAY}, {"June", JUNE},
+        {"July", JULY}, {"August", AUGUST}, {"September", SEPTEMBER}, {"October", OCTOBER}, {"November", NOVEMBER}, {"December", DECEMBER},
+};
+static const ReferenceKeyword WEEK_DAY_SHORT_NAMES[] = {
+        {"Mon", MONDAY}, {"Tue", TUESDAY}, {"Wed", WEDNESDAY}, {"Thu", THURSDAY}, {"Fri", FRIDAY}, {"Sat", SATURDAY}, {"Sun", SUNDAY},
+};
+static const ReferenceKeyword WEEK_DAY_LONG_NAMES[] = {
+        {"Monday", MONDAY}, {"Tuesday", TUESDAY}, {"Wednesday", WEDNESDAY}, {"Thursday", THURSDAY},
+        {"Friday", FRIDAY}, {"Saturday", SATURDAY}, {"Sunday", SUNDAY},
+};
+static const ReferenceKeyword CRON_MACROS[] = {
+        {"@yearly", 0}, {"@annually", 1}, {"@monthly", 2}, {"@weekly", 3}, {"@daily", 4}, {"@midnight", 5}, {"@hourly", 6},
+};
+static const char *const CRON_MACRO_VALUES[] = {
+        "0 0 0 1 1 *", "0 0 0 1 1 *", "0 0 0 1 * *", "0 0 0 * * 0", "0 0 0 * * *", "0 0 0 * * *", "0 0 * * * *",
+};
+
+static int32_t lookupMonthShortName(const char *key, uint32_t length) {
+    const MonthShortNameKeyword *keyword = findMonthShortNameKeyword(key, length);
+    return keyword != NULL ? (int32_t) keyword->value : -1;
+}
+
+static int32_t lookupMonthLongName(const char *key, uint32_t length) {
+    const MonthLongNameKeyword *keyword = findMonthLongNameKeyword(key, length);
+    return keyword != NULL ? (int32_t) keyword->value : -1;
+}
+
+static int32_t lookupWeekDayShortName(const char *key, uint32_t length) {
+    const WeekDayShortNameKeyword *keyword = findWeekDayShortNameKeyword(key, length);
+    return keyword != NULL ? (int32_t) keyword->value : -1;
+}
+
+static int32_t lookupWeekDayLongName(const char *key, uint32_t length) {
+    const WeekDayLongNameKeyword *keyword = findWeekDayLongNameKeyword(key, length);
+    return keyword != NULL ? (int32_t) keyword->value : -1;
+}
+
+static int32_t lookupCronMacro(const char *key, uint32_t length) {
+    const CronMacroKeyword *keyword = findCronMacroKeyword(key, length);
+    if (keyword == NULL) return -1;
+    for (uint32_t i = 0; i < ARRAY_SIZE(CRON_MACROS); i++) {    // value is expression text, map it back to reference index
+        if (strlen(CRON_MACROS[i].name) == length && strncasecmp(CRON_MACROS[i].name, key, length) == 0) {
+            return strcmp(keyword->value, CRON_MACRO_VALUES[i]) == 0 ? (int32_t) i : -2;
+        }
+    }
+    return -2;
+}
+
+static int32_t findReference(const ReferenceKeyword *keywords, uint32_t count, const char *key, uint32_t length) {
+    for (uint32_t i = 0; i < count; i++) {
+        if (strlen(keywords[i].name) == length && strncasecmp(keywords[i].name, key, length) == 0) return keywords[i].value;
+    }
+    return -1;
+}
+
+static void checkTable(const char *tableName, KeywordLookup lookup, const ReferenceKeyword *keywords, uint32_t count) {
+    char key[16];
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t length = strlen(keywords[i].name);
+        strcpy(key, keywords[i].name);
+        if (lookup(key, length) != keywords[i].value) TEST_FAIL("%s: \"%s\" not found", tableName, key);
+        for (uint32_t j = 0; j < length; j++) key[j] = (char) toupper((unsigned char) key[j]);
+        if (lookup(key, length) != keywords[i].value) TEST_FAIL("%s: \"%s\" not found", tableName, key);
+        for (uint32_t j = 0; j < length; j++) key[j] = (char) tolower((unsigned char) key[j]);
+        if (lookup(key, length) != keywords[i].value) TEST_FAIL("%s: \"%s\" not found", tableName, key);
+
+        strcpy(key, keywords[i].name);
+        strcat(key, "xyz");
+        if (lookup(key, length) != keywords[i].value) TEST_FAIL("%s: \"%s\" not found in longer text", tableName, keywords[i].name);
+        if (length > 1 && lookup(key, length - 1) != findReference(keywords, count, key, length - 1)) {
+            TEST_FAIL("%s: prefix of \"%s\" resolved", tableName, keywords[i].name);
+        }
+
+        for (uint32_t position = 0; position < length; position++) {    // every single character mutation
+            strcpy(key, keywords[i].name);
+            for (char c = '@'; c <= 'z'; c++) {
+                key[position] = c;
+                int32_t expected = findReference(keywords, count, key, length);
+                if (lookup(key, length) != expected) {
+                    TEST_FAIL("%s: \"%.*s\" expected %d", tableName, length, key, expected);
+                    return;
+                }
+            }
+        }
+    }
+
+    static const char ALPHABET[] = "@abcdefghijklmnopqrstuvwxyzAEIOUY";
+    srand(30);
+    for (uint32_t i = 0; i < 200000; i++) {
+        uint32_t length = 1 + rand() % 10;
+        for (uint32_t j = 0; j < length; j++) key[j] = ALPHABET[rand() % (sizeof(ALPHABET) - 1)];
+        int32_t expected = findReference(keywords, count, key, length);
+        if (lookup(key, length) != expected) {
+            TEST_FAIL("%s: random \"%.*s\" expected %d", tableName, length, key, expected);
+            return;
+        }
+    }
+    ASSERT_EQ_INT(-1, lookup(NULL, 3));
+    ASSERT_EQ_INT(-1, lookup("", 0));
+}
+
+static void testMonthNameTables() {
+    checkTable("MonthShortName", lookupMonthShortName, MONTH_SHORT_NAMES, ARRAY_SIZE(MONTH_SHORT_NAMES));
+    checkTable("MonthLongName", lookupMonthLongName, MONTH_LONG_NAMES, ARRAY_SIZE(MONTH_LONG_NAMES));
+}
+
+static void testWeekDayNameTables() {
+    checkTable("WeekDayShortName", lookupWeekDayShortName, WEEK_DAY_SHORT_NAMES, ARRAY_SIZE(WEEK_DAY_SHORT_NAMES));
+    checkTable("WeekDayLongName", lookupWeekDayLongName, WEEK_DAY_LONG_NAMES, ARRAY_SIZE(WEEK_DAY_LONG_NAMES));
+}
+
+static void testCronMacroTable() {
+    checkTable("CronMacro", lookupCronMacro, CRON_MACROS, ARRAY_SIZE(CRON_MACROS));
+}
+
+static bool isSameCron(const char *expression, const char *sameExpression) {
+    CronExpression first;
+    CronExpression second;
+    if (parseCronExpression(&first, expression) != CRON_OK || parseCronExpression(&second, sameExpression) != CRON_OK) return false;
+    return memcmp(&first, &second, sizeof(CronExpression)) == 0;
+}
+
+static void testCronParserUsesTables() {
+    for (uint32_t i = 0; i < ARRAY_SIZE(CRON_MACROS); i++) {
+        if (!isSameCron(CRON_MACROS[i].name, CRON_MACRO_VALUES[i])) TEST_FAIL("macro %s differs from %s", CRON_MACROS[i].name, CRON_MACRO_VALUES[i]);
+    }
+    ASSERT_TRUE(isSameCron("@DAILY", "0 0 0 * * *"));
+    ASSERT_TRUE(isSameCron("0 0 0 * jan,Feb,DEC ?", "0 0 0 * 1,2,12 ?"));
+    ASSERT_TRUE(isSameCron("0 0 0 ? * mon-Fri", "0 0 0 ? * 1-5"));
+    ASSERT_TRUE(isSameCron("0 0 0 ? * SUN,sat", "0 0 0 ? * 0,6"));
+
+    CronExpression cron;
+    ASSERT_TRUE(parseCronExpression(&cron, "@dayly") != CRON_OK);
+    ASSERT_TRUE(parseCronExpression(&cron, "0 0 0 * JNA ?") != CRON_OK);
+}
+
+static void testCspTagResolve() {
+    ASSERT_TRUE(findCspTag("<csp:set name=\"a\" value=\"1\"/>") == &CSP_VAR);
+    ASSERT_TRUE(findCspTag("<csp:if test=\"${a}\">") == &CSP_IF);
+    ASSERT_TRUE(findCspTag("<CSP:ElseIf test=\"${a}\">") == &CSP_ELSE_IF);
+    ASSERT_TRUE(findCspTag("<csp:else>") == &CSP_ELSE);
+    ASSERT_TRUE(findCspTag("<csp:render template=\"x.html\"/>") == &CSP_RENDER);
+    ASSERT_TRUE(findCspTag("<csp:loop items=\"${list}\">") == &CSP_LOOP);
+    ASSERT_TRUE(findCspTag("</csp:var>") == &CSP_END_VAR);
+    ASSERT_TRUE(findCspTag("</csp:if>") == &CSP_END_IF);
+    ASSERT_TRUE(findCspTag("</csp:elseif>") == &CSP_END_ELSE_IF);
+    ASSERT_TRUE(findCspTag("</csp:else>") == &CSP_END_ELSE);
+    ASSERT_TRUE(findCspTag("</csp:loop>") == &CSP_END_LOOP);
+
+    ASSERT_TRUE(findCspTag("<csp:render") == &CSP_RENDER);  // name ends at end of text
+    ASSERT_TRUE(findCspTag("<csp:elsewhere>") == NULL);
+    ASSERT_TRUE(findCspTag("<csp:els>") == NULL);
+    ASSERT_TRUE(findCspTag("</csp:render>") == NULL);       // render has no closing tag
+    ASSERT_TRUE(findCspTag("<csp:var>") == NULL);
+    ASSERT_TRUE(findCspTag("<div>") == NULL);
+    ASSERT_TRUE(findCspTag("<csp:") == NULL);
+}
+
+int main() {
+    RUN_TEST(testMonthNameTables);
+    RUN_TEST(testWeekDayNameTables);
+    RUN_TEST(testCronMacroTable);
+    RUN_TEST(testCronParserUsesTables);
+    RUN_TEST(testCspTagResolve);
+    return TEST_RESULT();
+}
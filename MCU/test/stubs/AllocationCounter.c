@@ -0,0 +1,51 @@
+#include <stdlib.h>
+
+#include "AllocationCounter.h"
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *pointer, size_t size);
+void __real_free(void *pointer);
+
+static AllocationCounts allocationCounts;
+static uint32_t allocationLimit = UINT32_MAX;
+
+
+void resetAllocationCounts() {
+    allocationCounts = (AllocationCounts) {0};
+    allocationLimit = UINT32_MAX;
+}
+
+AllocationCounts getAllocationCounts() {
+    return allocationCounts;
+}
+
+void failAllocationsAfter(uint32_t allowedAllocations) {
+    uint32_t remaining = UINT32_MAX - allocationCounts.allocations;
+    allocationLimit = allowedAllocations < remaining ? allocationCounts.allocations + allowedAllocations : UINT32_MAX;
+}
+
+void *__wrap_malloc(size_t size) {
+    if (allocationCounts.allocations >= allocationLimit) return NULL;
+    allocationCounts.allocations++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    if (allocationCounts.allocations >= allocationLimit) return NULL;
+    allocationCounts.allocations++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *pointer, size_t size) {
+    if (pointer == NULL) {
+        if (allocationCounts.allocations >= allocationLimit) return NULL;
+        allocationCounts.allocations++;
+    }
+    return __real_realloc(pointer, size);
+}
+
+void __wrap_free(void *pointer) {
+    if (pointer != NULL) allocationCounts.frees++;
+    __real_free(pointer);
+}
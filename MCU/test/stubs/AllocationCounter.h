@@ -0,0 +1,14 @@
+#pragma once
+
+#include <stdint.h>
+
+// Counts heap calls of everything linked into a test, link with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free
+
+typedef struct AllocationCounts {
+    uint32_t allocations;   // malloc/calloc calls and realloc calls that get a new block
+    uint32_t frees;         // free calls with non NULL pointer
+} AllocationCounts;
+
+void resetAllocationCounts();    // also stops failing allocations
+AllocationCounts getAllocationCounts();
+void failAllocationsAfter(uint32_t allowedAllocations);   // later malloc/calloc/realloc(NULL) return NULL, for out of memory paths
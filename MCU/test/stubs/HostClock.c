@@ -0,0 +1,24 @@
+#include <sys/time.h>
+#include <time.h>
+
+#include "HostClock.h"
+#include "Clock.h"
+
+static volatile int64_t wallClockShiftMicros = 0;
+
+
+void setHostWallClockShift(int64_t shiftMicros) {
+    wallClockShiftMicros = shiftMicros;
+}
+
+int64_t clockWallMicros() {
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    return (int64_t) now.tv_sec * MICROS_PER_SECOND + now.tv_usec + wallClockShiftMicros;
+}
+
+int64_t clockMonotonicMicros() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t) now.tv_sec * MICROS_PER_SECOND + now.tv_nsec / 1000;
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <stdint.h>
+
+// Host driver side of date-time Clock: wall clock is gettimeofday() plus settable shift, monotonic clock is CLOCK_MONOTONIC
+
+void setHostWallClockShift(int64_t shiftMicros);    // simulates system time being set, e.g. by NTP sync